@@ -4,7 +4,12 @@
 
 #include "Albany_Application.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
 #include <string>
+#include <type_traits>
 
 #include "AAdapt_RC_Manager.hpp"
 #include "Albany_DataTypes.hpp"
@@ -58,6 +63,24 @@ calcTangentDerivDimension(const Teuchos::RCP<Teuchos::ParameterList>& problemPar
   }
   return std::max(1, np);
 }
+
+// Whether worksets can be evaluated concurrently on the Phalanx execution
+// space. Kokkos runs a kernel launched from inside an OpenMP parallel loop
+// inline on the calling thread, and the Serial space runs the iterations
+// of a loop one after the other, so no kernel launch is shared between
+// threads.
+bool
+concurrentFillSupported()
+{
+  using ExecutionSpace = PHX::Device::execution_space;
+#if defined(KOKKOS_ENABLE_OPENMP)
+  if (std::is_same<ExecutionSpace, Kokkos::OpenMP>::value == true) return true;
+#endif
+#if defined(KOKKOS_ENABLE_SERIAL)
+  if (std::is_same<ExecutionSpace, Kokkos::Serial>::value == true) return true;
+#endif
+  return false;
+}
 }  // namespace
 
 namespace Albany {
@@ -407,6 +430,10 @@ Application::buildProblem()
 
   problem->buildProblem(meshSpecs, stateMgr);
 
+  // All states are registered now, evaluators look their handles up during
+  // postRegistrationSetup
+  phxSetup->init_state_handles(stateMgr.getStateHandles());
+
   if ((requires_sdbcs_ == true) && (problem->useSDBCs() == false) && (no_dir_bcs_ == false)) {
     ALBANY_ABORT(
         "Error in Albany::Application: you are using a "
@@ -464,6 +491,27 @@ Application::buildProblem()
     }
   }
   if (Teuchos::nonnull(rc_mgr)) rc_mgr->endBuildingSfm();
+
+  // Build one replica of the volumetric field managers per extra fill
+  // thread. This has to happen before the states are allocated, since
+  // building evaluators registers (already registered) states again.
+  workset_fill_threads_ = problemParams->get("Workset Fill Threads", 1);
+  ALBANY_ASSERT(workset_fill_threads_ >= 1, "Workset Fill Threads must be positive");
+  if (workset_fill_threads_ > 1) {
+    ALBANY_ASSERT(
+        concurrentFillSupported() == true,
+        "Workset Fill Threads > 1 requires the OpenMP or Serial Kokkos execution space");
+    ALBANY_ASSERT(
+        phxSetup->memoizer_active() == false, "Workset Fill Threads > 1 is incompatible with MDField memoization");
+  }
+  fm_replicas_.resize(workset_fill_threads_ - 1);
+  for (auto& replica : fm_replicas_) {
+    replica.resize(meshSpecs.size());
+    for (int ps = 0; ps < meshSpecs.size(); ps++) {
+      replica[ps] = Teuchos::rcp(new PHX::FieldManager<PHAL::AlbanyTraits>);
+      problem->buildEvaluators(*replica[ps], *meshSpecs[ps], stateMgr, BUILD_RESID_FM, Teuchos::null);
+    }
+  }
 }
 
 void
@@ -1064,6 +1112,147 @@ Application::writePhalanxGraph(
   }
 }
 
+template <typename EvalT>
+void
+Application::postRegSetupReplicas()
+{
+  for (int t = 1; t < workset_fill_threads_; t++) {
+    auto& replica = fm_replicas_[t - 1];
+    for (int ps = 0; ps < replica.size(); ps++) {
+      std::string const evalName = PHAL::evalName<EvalT>("FM" + std::to_string(t) + "_", ps);
+      if (phxSetup->contain_eval(evalName)) continue;
+      phxSetup->insert_eval(evalName);
+
+      std::vector<PHX::index_size_type> derivative_dimensions;
+      derivative_dimensions.push_back(PHAL::getDerivativeDimensions<EvalT>(this, ps));
+      replica[ps]->setKokkosExtendedDataTypeDimensions<EvalT>(derivative_dimensions);
+      replica[ps]->postRegistrationSetupForType<EvalT>(*phxSetup);
+
+      phxSetup->check_fields(replica[ps]->getFieldTagsForSizing<EvalT>());
+      phxSetup->update_fields();
+    }
+  }
+}
+
+void
+Application::computeWorksetColors()
+{
+  const auto& wsElNodeEqID = disc->getWsElNodeEqID();
+  int const   numWorksets  = wsElNodeEqID.size();
+
+  std::vector<LO const*> connectivity(numWorksets);
+  for (int ws = 0; ws < numWorksets; ws++) {
+    connectivity[ws] = wsElNodeEqID[ws].data();
+  }
+  if (connectivity == workset_colors_connectivity_) return;
+
+  TEUCHOS_FUNC_TIME_MONITOR("Albany Fill: Workset Coloring");
+  workset_colors_.clear();
+  workset_colors_connectivity_ = connectivity;
+
+  // Collect the overlapped DOFs touched by each workset.
+  std::vector<std::vector<LO>> ws_dofs(numWorksets);
+  LO                           max_dof = -1;
+  for (int ws = 0; ws < numWorksets; ws++) {
+    auto const conn = Kokkos::create_mirror_view(wsElNodeEqID[ws]);
+    Kokkos::deep_copy(conn, wsElNodeEqID[ws]);
+    auto& dofs = ws_dofs[ws];
+    for (int cell = 0; cell < conn.extent(0); cell++) {
+      for (int node = 0; node < conn.extent(1); node++) {
+        for (int eq = 0; eq < conn.extent(2); eq++) {
+          dofs.push_back(conn(cell, node, eq));
+        }
+      }
+    }
+    std::sort(dofs.begin(), dofs.end());
+    dofs.erase(std::unique(dofs.begin(), dofs.end()), dofs.end());
+    if (dofs.empty() == false) max_dof = std::max(max_dof, dofs.back());
+  }
+
+  // Greedy coloring: a workset goes into the first color none of whose
+  // worksets touches any of its DOFs.
+  std::vector<std::vector<bool>> dof_in_color;
+  for (int ws = 0; ws < numWorksets; ws++) {
+    auto const& dofs  = ws_dofs[ws];
+    int         color = 0;
+    for (; color < workset_colors_.size(); color++) {
+      auto const& used     = dof_in_color[color];
+      bool        conflict = false;
+      for (auto const dof : dofs) {
+        if (used[dof] == true) {
+          conflict = true;
+          break;
+        }
+      }
+      if (conflict == false) break;
+    }
+    if (color == workset_colors_.size()) {
+      workset_colors_.emplace_back();
+      dof_in_color.emplace_back(max_dof + 1, false);
+    }
+    workset_colors_[color].push_back(ws);
+    for (auto const dof : dofs) dof_in_color[color][dof] = true;
+  }
+
+  *out << "Workset coloring: " << numWorksets << " worksets in " << workset_colors_.size() << " colors" << std::endl;
+}
+
+template <typename EvalT>
+void
+Application::evaluateWorksetsConcurrently(PHAL::Workset const& base_workset)
+{
+  const auto& wsPhysIndex = disc->getWsPhysIndex();
+
+  postRegSetupReplicas<EvalT>();
+  computeWorksetColors();
+
+  for (auto const& color : workset_colors_) {
+    int const          num_worksets = color.size();
+    int const          num_threads  = std::min(workset_fill_threads_, num_worksets);
+    std::atomic<int>   next_index{0};
+    std::exception_ptr error{nullptr};
+    std::mutex         error_mutex;
+
+    // Each fill owns a copy of the workset and a field manager replica,
+    // and pulls the next workset of this color until none remain.
+    auto fill = [&](int const t) {
+      try {
+        PHAL::Workset workset = base_workset;
+        auto&         fms     = t == 0 ? fm : fm_replicas_[t - 1];
+        for (int i = next_index++; i < num_worksets; i = next_index++) {
+          int const         ws       = color[i];
+          int const         ps       = wsPhysIndex[ws];
+          std::string const evalName = t == 0 ? PHAL::evalName<EvalT>("FM", ps)
+                                              : PHAL::evalName<EvalT>("FM" + std::to_string(t) + "_", ps);
+          loadWorksetBucketInfo<EvalT>(workset, ws, evalName);
+          fms[ps]->template evaluateFields<EvalT>(workset);
+        }
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(error_mutex);
+        if (error == nullptr) error = std::current_exception();
+      }
+    };
+
+    // The fills are the iterations of a host parallel loop, so the kernels
+    // that they launch run inline on their threads instead of concurrently
+    // on the default instance of the execution space.
+    using Policy = Kokkos::RangePolicy<PHX::Device::execution_space, Kokkos::Schedule<Kokkos::Dynamic>>;
+    Kokkos::parallel_for(Policy(0, num_threads).set_chunk_size(1), [&](int const t) { fill(t); });
+    if (error != nullptr) std::rethrow_exception(error);
+  }
+
+  // Neumann field managers are not replicated; evaluate them serially.
+  if (Teuchos::nonnull(nfm)) {
+    PHAL::Workset workset     = base_workset;
+    int const     numWorksets = wsPhysIndex.size();
+    for (int ws = 0; ws < numWorksets; ws++) {
+      std::string const evalName = PHAL::evalName<EvalT>("FM", wsPhysIndex[ws]);
+      loadWorksetBucketInfo<EvalT>(workset, ws, evalName);
+      deref_nfm(nfm, wsPhysIndex, ws)->evaluateFields<EvalT>(workset);
+    }
+  }
+}
+
 void
 Application::computeGlobalResidualImpl(
     double const                           current_time,
@@ -1133,6 +1322,9 @@ Application::computeGlobalResidualImpl(
 
     loadBasicWorksetInfo(workset, this_time);
 
+    // The residual fill is the one that writes the new states
+    stateMgr.markNewStatesWritten();
+
     Teuchos::RCP<Thyra_Vector> x_post_SDBCs;
     if ((dfm != Teuchos::null) && (problem->useSDBCs() == true)) {
       workset = set_dfm_workset(current_time, x, x_dot, x_dotdot, f);
@@ -1147,15 +1339,19 @@ Application::computeGlobalResidualImpl(
 
     workset.f = overlapped_f;
 
-    for (int ws = 0; ws < numWorksets; ws++) {
-      std::string const evalName = PHAL::evalName<EvalT>("FM", wsPhysIndex[ws]);
-      loadWorksetBucketInfo<EvalT>(workset, ws, evalName);
+    if (workset_fill_threads_ > 1) {
+      evaluateWorksetsConcurrently<EvalT>(workset);
+    } else {
+      for (int ws = 0; ws < numWorksets; ws++) {
+        std::string const evalName = PHAL::evalName<EvalT>("FM", wsPhysIndex[ws]);
+        loadWorksetBucketInfo<EvalT>(workset, ws, evalName);
 
-      // FillType template argument used to specialize Sacado
-      fm[wsPhysIndex[ws]]->evaluateFields<EvalT>(workset);
+        // FillType template argument used to specialize Sacado
+        fm[wsPhysIndex[ws]]->evaluateFields<EvalT>(workset);
 
-      if (nfm != Teuchos::null) {
-        deref_nfm(nfm, wsPhysIndex, ws)->evaluateFields<EvalT>(workset);
+        if (nfm != Teuchos::null) {
+          deref_nfm(nfm, wsPhysIndex, ws)->evaluateFields<EvalT>(workset);
+        }
       }
     }
   }
@@ -1349,13 +1545,17 @@ Application::computeGlobalJacobianImpl(
     if (!workset.Jac.is_null()) {
       workset.Jac_kokkos = getNonconstDeviceData(workset.Jac);
     }
-    for (int ws = 0; ws < numWorksets; ws++) {
-      std::string const evalName = PHAL::evalName<EvalT>("FM", wsPhysIndex[ws]);
-      loadWorksetBucketInfo<EvalT>(workset, ws, evalName);
+    if (workset_fill_threads_ > 1) {
+      evaluateWorksetsConcurrently<EvalT>(workset);
+    } else {
+      for (int ws = 0; ws < numWorksets; ws++) {
+        std::string const evalName = PHAL::evalName<EvalT>("FM", wsPhysIndex[ws]);
+        loadWorksetBucketInfo<EvalT>(workset, ws, evalName);
 
-      // FillType template argument used to specialize Sacado
-      fm[wsPhysIndex[ws]]->evaluateFields<EvalT>(workset);
-      if (Teuchos::nonnull(nfm)) deref_nfm(nfm, wsPhysIndex, ws)->evaluateFields<EvalT>(workset);
+        // FillType template argument used to specialize Sacado
+        fm[wsPhysIndex[ws]]->evaluateFields<EvalT>(workset);
+        if (Teuchos::nonnull(nfm)) deref_nfm(nfm, wsPhysIndex, ws)->evaluateFields<EvalT>(workset);
+      }
     }
   }
 
@@ -6,6 +6,7 @@
 #define ALBANY_APPLICATION_HPP
 
 #include <set>
+#include <vector>
 
 #include "AAdapt_AdaptiveSolutionManager.hpp"
 #include "Albany_AbstractDiscretization.hpp"
@@ -383,6 +384,20 @@ class Application : public Sacado::ParameterAccessor<PHAL::AlbanyTraits::Residua
   void
   postRegSetupDImpl();
 
+  //! Phalanx setup for the per-thread field manager replicas
+  template <typename EvalT>
+  void
+  postRegSetupReplicas();
+
+  //! Evaluate all worksets color by color, concurrently within a color
+  template <typename EvalT>
+  void
+  evaluateWorksetsConcurrently(PHAL::Workset const& base_workset);
+
+  //! Group worksets into colors that share no overlapped DOFs
+  void
+  computeWorksetColors();
+
   template <typename EvalT>
   void
   writePhalanxGraph(
@@ -608,6 +623,18 @@ class Application : public Sacado::ParameterAccessor<PHAL::AlbanyTraits::Residua
   // Phalanx Field Manager for states
   Teuchos::Array<Teuchos::RCP<PHX::FieldManager<PHAL::AlbanyTraits>>> sfm;
 
+  // Number of host threads used to evaluate worksets in residual and
+  // Jacobian fills. Thread 0 uses fm, thread t > 0 uses fm_replicas_[t - 1].
+  int workset_fill_threads_{1};
+
+  std::vector<Teuchos::ArrayRCP<Teuchos::RCP<PHX::FieldManager<PHAL::AlbanyTraits>>>> fm_replicas_;
+
+  // Worksets grouped into colors such that no two worksets of the same color
+  // scatter into the same overlapped DOF. The connectivity pointers are kept
+  // to detect when the discretization has rebuilt its worksets.
+  std::vector<std::vector<int>> workset_colors_;
+  std::vector<LO const*>        workset_colors_connectivity_;
+
   // Data for Physics-Based Preconditioners
   bool                                 physicsBasedPreconditioner{false};
   Teuchos::RCP<Teuchos::ParameterList> precParams{Teuchos::null};
@@ -693,6 +720,7 @@ void
 Application::loadWorksetBucketInfo(PHAL::Workset& workset, int const& ws, std::string const& evalName)
 {
   auto const& wsElNodeEqID            = disc->getWsElNodeEqID();
+  auto const& wsColoring              = disc->getWsColoring();
   auto const& wsElNodeID              = disc->getWsElNodeID();
   auto const& coords                  = disc->getCoords();
   auto const& wsEBNames               = disc->getWsEBNames();
@@ -723,6 +751,7 @@ Application::loadWorksetBucketInfo(PHAL::Workset& workset, int const& ws, std::s
 
   workset.numCells             = wsElNodeEqID[ws].extent(0);
   workset.wsElNodeEqID         = wsElNodeEqID[ws];
+  workset.wsColoring           = ws < wsColoring.size() ? wsColoring[ws] : Albany::WorksetColoring();
   workset.wsElNodeID           = wsElNodeID[ws];
   workset.wsCoords             = coords[ws];
   workset.wsSphereVolume       = sphereVolume[ws];
@@ -737,7 +766,8 @@ Application::loadWorksetBucketInfo(PHAL::Workset& workset, int const& ws, std::s
   // Sidesets are integrated within the Cells
   loadWorksetSidesetInfo(workset, ws);
 
-  workset.stateArrayPtr = &stateMgr.getStateArray(Albany::StateManager::ELEM, ws);
+  workset.stateArrayPtr       = &stateMgr.getStateArray(Albany::StateManager::ELEM, ws);
+  workset.stateHandleArrayPtr = &stateMgr.getStateHandleArray(ws);
 }
 
 }  // namespace Albany
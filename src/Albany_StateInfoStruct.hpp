@@ -10,8 +10,10 @@
 // This includes name, number of quantitites (scalar,vector,tensor),
 // Element vs Node lcoation, etc.
 
+#include <algorithm>
 #include <map>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "Adapt_NodalDataBase.hpp"
@@ -39,10 +41,129 @@ using IDArray       = shards::Array<LO, shards::NaturalOrder>;
 using StateArray    = std::map<std::string, MDArray>;
 using StateArrayVec = std::vector<StateArray>;
 
+// The element state arrays of one workset indexed by the integer handles
+// that StateManager::registerStateVariable hands out, so evaluators can skip
+// the string lookups of StateArray on the hot path. Entries point into the
+// StateArray of the workset and follow StateArrays::swapOldStates.
+struct StateHandleArray
+{
+  std::vector<MDArray*>             arrays;
+  std::map<std::string, int> const* handles{nullptr};
+
+  // Handle of a state, or -1 if it was never registered.
+  int
+  getHandle(std::string const& name) const
+  {
+    if (handles == nullptr) return -1;
+    auto const it = handles->find(name);
+    return it == handles->end() ? -1 : it->second;
+  }
+
+  MDArray&
+  operator[](int const handle) const
+  {
+    return *arrays[handle];
+  }
+};
+
 struct StateArrays
 {
   StateArrayVec elemStateArrays;
   StateArrayVec nodeStateArrays;
+
+  // State name to handle, filled by the state manager, and the per-workset
+  // handle tables built from it. States missing from a workset, such as
+  // node states or states of other element blocks, map to an empty array.
+  std::map<std::string, int>    stateHandles;
+  std::vector<StateHandleArray> elemStateHandleArrays;
+
+  // Rebuild the handle tables after the arrays were rebuilt from the mesh.
+  void
+  buildStateHandleArrays()
+  {
+    static MDArray empty;
+
+    elemStateHandleArrays.resize(elemStateArrays.size());
+    for (std::size_t ws = 0; ws < elemStateArrays.size(); ++ws) {
+      StateHandleArray& table = elemStateHandleArrays[ws];
+      table.handles           = &stateHandles;
+      table.arrays.assign(stateHandles.size(), &empty);
+      for (auto const& entry : stateHandles) {
+        auto const it = elemStateArrays[ws].find(entry.first);
+        if (it != elemStateArrays[ws].end()) table.arrays[entry.second] = &it->second;
+      }
+    }
+  }
+
+  // Old states are double buffered. StateManager::updateStates trades the
+  // "name" and "name_old" arrays of the states listed here instead of
+  // copying one into the other. With an odd generation the two arrays point
+  // at each other's mesh fields.
+  std::vector<std::string> elemOldStates;
+  std::vector<std::string> nodeOldStates;
+  int                      generation{0};
+
+  // Set by a swap: the "name" arrays hold the values from before the
+  // previous update until the next evaluation overwrites them.
+  bool newStatesStale{false};
+
+  // Bumped by every fill that writes the "name" arrays. A swap records the
+  // count it saw, so that a second update without a fill in between leaves
+  // the old states alone instead of trading them back.
+  int evaluationCount{0};
+  int swappedEvaluationCount{0};
+
+  void
+  swapOldStates()
+  {
+    swapArrays(elemStateArrays, elemOldStates);
+    swapArrays(nodeStateArrays, nodeOldStates);
+    generation = 1 - generation;
+  }
+
+  // Arrays rebuilt from the mesh point at their own fields. Trade them
+  // again if the generation says the values live in the other field.
+  void
+  applyGeneration()
+  {
+    if (generation == 0) return;
+    swapArrays(elemStateArrays, elemOldStates);
+    swapArrays(nodeStateArrays, nodeOldStates);
+  }
+
+  // Copy "name_old" into a stale "name", so that readers of the mesh fields,
+  // such as the Exodus writer, see the latest values in the "name" field.
+  void
+  syncNewStates()
+  {
+    if (newStatesStale == false) return;
+    copyOldToNew(elemStateArrays, elemOldStates);
+    copyOldToNew(nodeStateArrays, nodeOldStates);
+    newStatesStale = false;
+  }
+
+ private:
+  static void
+  swapArrays(StateArrayVec& arrays, std::vector<std::string> const& names)
+  {
+    for (auto& ws_arrays : arrays) {
+      for (auto const& name : names) {
+        std::swap(ws_arrays.at(name), ws_arrays.at(name + "_old"));
+      }
+    }
+  }
+
+  static void
+  copyOldToNew(StateArrayVec& arrays, std::vector<std::string> const& names)
+  {
+    for (auto& ws_arrays : arrays) {
+      for (auto const& name : names) {
+        MDArray&       state     = ws_arrays.at(name);
+        MDArray const& old_state = ws_arrays.at(name + "_old");
+        std::copy(old_state.contiguous_data(), old_state.contiguous_data() + old_state.size(), state.contiguous_data());
+      }
+    }
+  }
 };
 
 //! Container to get state info from StateManager to STK. Made into a struct so
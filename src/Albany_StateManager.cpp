@@ -37,7 +37,9 @@ Albany::StateManager::registerStateVariable(
     std::string const&                   fieldName)
 {
   bool const bOutputToExodus = true;
-  registerStateVariable(stateName, dl, ebName, init_type, init_val, registerOldState, bOutputToExodus, fieldName);
+
+  int const handle =
+      registerStateVariable(stateName, dl, ebName, init_type, init_val, registerOldState, bOutputToExodus, fieldName);
 
   // Create param list for SaveStateField evaluator
   Teuchos::RCP<Teuchos::ParameterList> p =
@@ -46,6 +48,7 @@ Albany::StateManager::registerStateVariable(
   p->set<std::string const>("Field Name", fieldName);
   p->set<const Teuchos::RCP<PHX::DataLayout>>("State Field Layout", dl);
   p->set<const Teuchos::RCP<PHX::DataLayout>>("Dummy Data Layout", dummy);
+  p->set<int>("State Handle", handle);
   return p;
 }
 
@@ -60,7 +63,8 @@ Albany::StateManager::registerStateVariable(
     bool const                           registerOldState,
     bool const                           outputToExodus)
 {
-  registerStateVariable(stateName, dl, ebName, init_type, init_val, registerOldState, outputToExodus, stateName);
+  int const handle =
+      registerStateVariable(stateName, dl, ebName, init_type, init_val, registerOldState, outputToExodus, stateName);
 
   // Create param list for SaveStateField evaluator
   Teuchos::RCP<Teuchos::ParameterList> p =
@@ -69,6 +73,7 @@ Albany::StateManager::registerStateVariable(
   p->set<std::string const>("Field Name", stateName);
   p->set<const Teuchos::RCP<PHX::DataLayout>>("State Field Layout", dl);
   p->set<const Teuchos::RCP<PHX::DataLayout>>("Dummy Data Layout", dummy);
+  p->set<int>("State Handle", handle);
   return p;
 }
 
@@ -83,7 +88,7 @@ Albany::StateManager::registerNodalVectorStateVariable(
     bool const                           registerOldState,
     bool const                           outputToExodus)
 {
-  registerNodalVectorStateVariable(
+  int const handle = registerNodalVectorStateVariable(
       stateName, dl, ebName, init_type, init_val, registerOldState, outputToExodus, stateName);
 
   // Create param list for SaveStateField evaluator
@@ -93,6 +98,7 @@ Albany::StateManager::registerNodalVectorStateVariable(
   p->set<std::string const>("Field Name", stateName);
   p->set<const Teuchos::RCP<PHX::DataLayout>>("State Field Layout", dl);
   p->set<const Teuchos::RCP<PHX::DataLayout>>("Dummy Data Layout", dummy);
+  p->set<int>("State Handle", handle);
   return p;
 }
 
@@ -105,7 +111,8 @@ Albany::StateManager::registerStateVariable(
     StateStruct::MeshFieldEntity const*  fieldEntity,
     std::string const&                   meshPartName)
 {
-  registerStateVariable(stateName, dl, ebName, "", 0., false, outputToExodus, "", fieldEntity, meshPartName);
+  int const handle =
+      registerStateVariable(stateName, dl, ebName, "", 0., false, outputToExodus, "", fieldEntity, meshPartName);
 
   // Create param list for SaveStateField evaluator
   Teuchos::RCP<Teuchos::ParameterList> p =
@@ -113,10 +120,11 @@ Albany::StateManager::registerStateVariable(
   p->set<std::string const>("State Name", stateName);
   p->set<std::string const>("Field Name", stateName);
   p->set<const Teuchos::RCP<PHX::DataLayout>>("State Field Layout", dl);
+  p->set<int>("State Handle", handle);
   return p;
 }
 
-void
+int
 Albany::StateManager::registerStateVariable(
     std::string const&                   stateName,
     const Teuchos::RCP<PHX::DataLayout>& dl,
@@ -128,10 +136,10 @@ Albany::StateManager::registerStateVariable(
   ebName                                     = (*st)->nameMap[stateName];
 
   // Call the below function
-  registerStateVariable(stateName, dl, ebName, init_type, 0.0, false, true, "");
+  return registerStateVariable(stateName, dl, ebName, init_type, 0.0, false, true, "");
 }
 
-void
+int
 Albany::StateManager::registerStateVariable(
     std::string const&                   stateName,
     const Teuchos::RCP<PHX::DataLayout>& dl,
@@ -147,12 +155,16 @@ Albany::StateManager::registerStateVariable(
   ALBANY_ASSERT(stateName != "", "State Name cannot be the empty string");
   ALBANY_PANIC(stateVarsAreAllocated);
   using Albany::StateStruct;
+
+  int const handle = registerStateHandle(stateName);
+  if (registerOldState) registerStateHandle(stateName + "_old");
+
   auto       registered_states = statesToStore[ebName];
   auto const it                = registered_states.find(stateName);
   auto const end               = registered_states.end();
   bool const is_duplicate      = it != end;
   if (is_duplicate == true) {
-    return;  // Don't re-register the same state name
+    return handle;  // Don't re-register the same state name
   }
 
   statesToStore[ebName][stateName] = dl;
@@ -236,9 +248,10 @@ Albany::StateManager::registerStateVariable(
 
   // insert
   stateRef.nameMap[stateName] = ebName;
+  return handle;
 }
 
-void
+int
 Albany::StateManager::registerNodalVectorStateVariable(
     std::string const&                   stateName,
     const Teuchos::RCP<PHX::DataLayout>& dl,
@@ -253,8 +266,11 @@ Albany::StateManager::registerNodalVectorStateVariable(
   ALBANY_PANIC(stateVarsAreAllocated);
   using Albany::StateStruct;
 
+  int const handle = registerStateHandle(stateName);
+  if (registerOldState) registerStateHandle(stateName + "_old");
+
   if (statesToStore[ebName].find(stateName) != statesToStore[ebName].end()) {
-    return;  // Don't re-register the same state name
+    return handle;  // Don't re-register the same state name
   }
 
   statesToStore[ebName][stateName] = dl;
@@ -351,6 +367,26 @@ Albany::StateManager::registerNodalVectorStateVariable(
 
   // insert
   stateRef.nameMap[stateName] = ebName;
+  return handle;
+}
+
+int
+Albany::StateManager::registerStateHandle(std::string const& stateName)
+{
+  auto const it = stateHandles.find(stateName);
+  if (it != stateHandles.end()) return it->second;
+
+  int const handle        = stateHandles.size();
+  stateHandles[stateName] = handle;
+  return handle;
+}
+
+int
+Albany::StateManager::getStateHandle(std::string const& stateName) const
+{
+  auto const it = stateHandles.find(stateName);
+  ALBANY_ASSERT(it != stateHandles.end(), "State " << stateName << " is not registered");
+  return it->second;
 }
 
 Teuchos::RCP<Teuchos::ParameterList>
@@ -540,6 +576,10 @@ Albany::StateManager::setupStateArrays(const Teuchos::RCP<Albany::AbstractDiscre
 
   doSetStateArrays(disc, stateInfo);
 
+  Albany::StateArrays& sa = disc->getStateArrays();
+  sa.stateHandles         = stateHandles;
+  sa.buildStateHandleArrays();
+
   // First, we check the explicitly required side discretizations exist...
   const auto& ss_discs = disc->getSideSetDiscretizations();
   for (auto const& it : sideSetStateInfo) {
@@ -689,7 +729,6 @@ Albany::StateArray&
 Albany::StateManager::getStateArray(SAType type, int const ws) const
 {
   ALBANY_ASSERT(stateVarsAreAllocated == true);
-
   switch (type) {
     case ELEM: return getStateArrays().elemStateArrays[ws]; break;
     case NODE: return getStateArrays().nodeStateArrays[ws]; break;
@@ -697,6 +736,20 @@ Albany::StateManager::getStateArray(SAType type, int const ws) const
   }
 }
 
+Albany::StateHandleArray&
+Albany::StateManager::getStateHandleArray(int const ws) const
+{
+  ALBANY_ASSERT(stateVarsAreAllocated == true);
+  return getStateArrays().elemStateHandleArrays[ws];
+}
+
+void
+Albany::StateManager::markNewStatesWritten()
+{
+  ALBANY_ASSERT(stateVarsAreAllocated == true);
+  ++getStateArrays().evaluationCount;
+}
+
 Albany::StateArrays&
 Albany::StateManager::getStateArrays() const
 {
@@ -716,47 +769,32 @@ Albany::StateManager::setStateArrays(Albany::StateArrays& sa)
 void
 Albany::StateManager::updateStates()
 {
-  // Swap boolean that defines old and new (in terms of state1 and 2) in
-  // accessors
   ALBANY_ASSERT(stateVarsAreAllocated == true);
 
   // Get states from STK mesh
-  Albany::StateArrays&   sa              = disc->getStateArrays();
-  Albany::StateArrayVec& esa             = sa.elemStateArrays;
-  Albany::StateArrayVec& nsa             = sa.nodeStateArrays;
-  int                    numElemWorksets = esa.size();
-  int                    numNodeWorksets = nsa.size();
+  Albany::StateArrays& sa = disc->getStateArrays();
 
-  // For each workset, loop over registered states
+  // Nothing was evaluated since the last update, so "name_old" already
+  // holds the latest values. Swapping again would undo the last update.
+  if (sa.evaluationCount == sa.swappedEvaluationCount) return;
+
+  // Old states are double buffered: instead of copying every state into its
+  // old state, trade the two arrays of each workset, which moves no data.
+  sa.elemOldStates.clear();
+  sa.nodeOldStates.clear();
 
   for (unsigned int i = 0; i < stateInfo->size(); i++) {
     if ((*stateInfo)[i]->saveOldState) {
-      std::string const stateName     = (*stateInfo)[i]->name;
-      std::string const stateName_old = stateName + "_old";
+      std::string const& stateName = (*stateInfo)[i]->name;
 
       switch ((*stateInfo)[i]->entity) {
         case Albany::StateStruct::NodalDataToElemNode:
-          for (int ws = 0; ws < numNodeWorksets; ws++)
-            for (int j = 0; j < nsa[ws][stateName].size(); j++) nsa[ws][stateName_old][j] = nsa[ws][stateName][j];
-
-          break;
+        case Albany::StateStruct::NodalData: sa.nodeOldStates.push_back(stateName); break;
 
         case Albany::StateStruct::WorksetValue:
         case Albany::StateStruct::ElemData:
         case Albany::StateStruct::QuadPoint:
-        case Albany::StateStruct::ElemNode:
-
-          for (int ws = 0; ws < numElemWorksets; ws++)
-            for (int j = 0; j < esa[ws][stateName].size(); j++) esa[ws][stateName_old][j] = esa[ws][stateName][j];
-
-          break;
-
-        case Albany::StateStruct::NodalData:
-
-          for (int ws = 0; ws < numNodeWorksets; ws++)
-            for (int j = 0; j < nsa[ws][stateName].size(); j++) nsa[ws][stateName_old][j] = nsa[ws][stateName][j];
-
-          break;
+        case Albany::StateStruct::ElemNode: sa.elemOldStates.push_back(stateName); break;
 
         default:
           ALBANY_ABORT(
@@ -765,6 +803,10 @@ Albany::StateManager::updateStates()
       }
     }
   }
+
+  sa.swapOldStates();
+  sa.newStatesStale         = true;
+  sa.swappedEvaluationCount = sa.evaluationCount;
 }
 
 void
@@ -45,8 +45,8 @@ class StateManager
   typedef std::map<std::string, Teuchos::RCP<PHX::DataLayout>> RegisteredStates;
 
   /// Method to call multiple times (before allocate) to register which states
-  /// will be saved.
-  void
+  /// will be saved. Returns the handle of the state, see getStateHandle.
+  int
   registerStateVariable(
       std::string const&                   stateName,
       const Teuchos::RCP<PHX::DataLayout>& dl,
@@ -59,7 +59,7 @@ class StateManager
       StateStruct::MeshFieldEntity const*  fieldEntity         = 0,
       std::string const&                   meshPartName        = "");
 
-  void
+  int
   registerNodalVectorStateVariable(
       std::string const&                   stateName,
       const Teuchos::RCP<PHX::DataLayout>& dl,
@@ -73,7 +73,7 @@ class StateManager
   /// Method to call multiple times (before allocate) to register which states
   /// will be saved.
   /// Returns param vector with all info to build a SaveStateField or
-  /// LoadStateField evaluator
+  /// LoadStateField evaluator, including the "State Handle"
   Teuchos::RCP<Teuchos::ParameterList>
   registerStateVariable(
       std::string const&                   name,
@@ -131,7 +131,7 @@ class StateManager
       bool const                           outputToExodus);
 
   /// Very basic
-  void
+  int
   registerStateVariable(
       std::string const&                   stateName,
       const Teuchos::RCP<PHX::DataLayout>& dl,
@@ -189,10 +189,18 @@ class StateManager
   std::vector<std::string>
   getResidResponseIDsToRequire(std::string& elementBlockName);
 
-  /// Method to make the current newState the oldState, and vice versa
+  /// Method to make the current newState the oldState, and vice versa.
+  /// The arrays are swapped, not copied, so the new states hold stale values
+  /// until they are evaluated again. Does nothing unless markNewStatesWritten
+  /// was called since the previous update.
   void
   updateStates();
 
+  /// Method to record that a fill wrote the new states, called by the
+  /// residual fill and by drivers that evaluate the state fields themselves
+  void
+  markNewStatesWritten();
+
   /// Method to get a StateInfoStruct of info needed by STK to output States as
   /// Fields
   Teuchos::RCP<Albany::StateInfoStruct>
@@ -218,6 +226,22 @@ class StateManager
   Albany::StateArrays&
   getStateArrays() const;
 
+  /// Stable integer handle of a registered state, the same for every element
+  /// block. Old states have their own handle, under the name stateName_old.
+  int
+  getStateHandle(std::string const& stateName) const;
+
+  /// Handles of all registered states by name
+  std::map<std::string, int> const&
+  getStateHandles() const
+  {
+    return stateHandles;
+  }
+
+  /// Element state arrays of a workset indexed by handle
+  Albany::StateHandleArray&
+  getStateHandleArray(int ws) const;
+
   // Set the state array for all worksets.
   void
   setStateArrays(Albany::StateArrays& sa);
@@ -268,6 +292,10 @@ class StateManager
       const Teuchos::RCP<Albany::AbstractDiscretization>& disc,
       const Teuchos::RCP<StateInfoStruct>&                stateInfoPtr);
 
+  /// Handle of a state name, assigned on first registration
+  int
+  registerStateHandle(std::string const& stateName);
+
   /// boolean to enforce that allocate gets called once, and after registration
   /// and befor gets
   bool stateVarsAreAllocated;
@@ -277,6 +305,9 @@ class StateManager
   std::map<std::string, RegisteredStates>                        statesToStore;
   std::map<std::string, std::map<std::string, RegisteredStates>> sideSetStatesToStore;
 
+  /// State name to handle, across element blocks
+  std::map<std::string, int> stateHandles;
+
   /// Discretization object which allows StateManager to perform input/output
   Teuchos::RCP<Albany::AbstractDiscretization> disc;
 
@@ -49,12 +49,31 @@ class BifurcationCheck : public PHX::EvaluatorWithBaseImpl<Traits>, public PHX::
   typedef typename Sacado::mpl::apply<FadType, ScalarT>::type  DFadType;
   typedef typename Sacado::mpl::apply<FadType, DFadType>::type D2FadType;
 
-  //! Input: Parametrization type
-  std::string parametrization_type_;
+  enum class Parametrization
+  {
+    OLIVER,
+    PSO,
+    SPHERICAL,
+    STEREOGRAPHIC,
+    PROJECTIVE,
+    TANGENT,
+    CARTESIAN
+  };
+
+  //! Input: Parametrization type, resolved from its name at construction
+  Parametrization parametrization_;
 
   //! Input: Parametrization sweep interval
   double parametrization_interval_;
 
+  //! Input: Sweep a coarse grid first and then the fine grid only around
+  //! the coarse minimum
+  bool adaptive_sweep_;
+
+  //! Input: Skip the search at points where a lower bound of min det(A)
+  //! already proves ellipticity
+  bool lower_bound_check_;
+
   //! Input: material tangent
   PHX::MDField<ScalarT const, Cell, QuadPoint, Dim, Dim, Dim, Dim> tangent_;
 
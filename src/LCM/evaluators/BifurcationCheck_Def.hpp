@@ -2,10 +2,12 @@
 // Sandia, LLC (NTESS). This Software is released under the BSD license detailed
 // in the file license.txt in the top-level Albany directory.
 
+#include <array>
 #include <random>
 #include <typeinfo>
 
 #include "Albany_Macros.hpp"
+#include "BifurcationSweep.hpp"
 #include "LocalNonlinearSolver.hpp"
 #include "MiniTensor.h"
 #include "Phalanx_DataLayout.hpp"
@@ -16,8 +18,9 @@ template <typename EvalT, typename Traits>
 BifurcationCheck<EvalT, Traits>::BifurcationCheck(
     Teuchos::ParameterList const&        p,
     const Teuchos::RCP<Albany::Layouts>& dl)
-    : parametrization_type_(p.get<std::string>("Parametrization Type Name")),
-      parametrization_interval_(p.get<double>("Parametrization Interval Name")),
+    : parametrization_interval_(p.get<double>("Parametrization Interval Name")),
+      adaptive_sweep_(false),
+      lower_bound_check_(false),
       tangent_(p.get<std::string>("Material Tangent Name"), dl->qp_tensor4),
       ellipticity_flag_(p.get<std::string>("Ellipticity Flag Name"), dl->qp_scalar),
       direction_(p.get<std::string>("Bifurcation Direction Name"), dl->qp_vector),
@@ -28,6 +31,30 @@ BifurcationCheck<EvalT, Traits>::BifurcationCheck(
   num_pts_  = dims[1];
   num_dims_ = dims[2];
 
+  // Resolve the type once here instead of at every point. Unknown types fall
+  // back to the spherical parametrization.
+  std::string const parametrization_type = p.get<std::string>("Parametrization Type Name");
+  if (parametrization_type == "Oliver") {
+    parametrization_ = Parametrization::OLIVER;
+  } else if (parametrization_type == "PSO") {
+    parametrization_ = Parametrization::PSO;
+  } else if (parametrization_type == "Stereographic") {
+    parametrization_ = Parametrization::STEREOGRAPHIC;
+  } else if (parametrization_type == "Projective") {
+    parametrization_ = Parametrization::PROJECTIVE;
+  } else if (parametrization_type == "Tangent") {
+    parametrization_ = Parametrization::TANGENT;
+  } else if (parametrization_type == "Cartesian") {
+    parametrization_ = Parametrization::CARTESIAN;
+  } else {
+    parametrization_ = Parametrization::SPHERICAL;
+  }
+
+  // Both are optional and off by default.
+  if (p.isParameter("Parametrization Adaptive Sweep")) adaptive_sweep_ = p.get<bool>("Parametrization Adaptive Sweep");
+  if (p.isParameter("Parametrization Lower Bound Check"))
+    lower_bound_check_ = p.get<bool>("Parametrization Lower Bound Check");
+
   this->addDependentField(tangent_);
   this->addEvaluatedField(ellipticity_flag_);
   this->addEvaluatedField(direction_);
@@ -62,76 +89,94 @@ BifurcationCheck<EvalT, Traits>::evaluateFields(typename Traits::EvalData workse
 
       double interval = parametrization_interval_;
 
-      if (parametrization_type_ == "Oliver") {
-        boost::tie(ellipticity_flag, direction) = minitensor::check_strong_ellipticity(tangent);
-        min_detA = minitensor::det(minitensor::dot2(direction, minitensor::dot(tangent, direction)));
-      } else if (parametrization_type_ == "PSO") {
-        minitensor::Vector<ScalarT, 2> arg_minimum;
-
-        min_detA = stereographic_pso(tangent, arg_minimum, direction);
-
-      } else if (parametrization_type_ == "Spherical") {
-        minitensor::Vector<ScalarT, 2> arg_minimum;
-
-        min_detA = spherical_sweep(tangent, arg_minimum, direction, interval);
-        spherical_newton_raphson(tangent, arg_minimum, direction, min_detA);
-
-      } else if (parametrization_type_ == "Stereographic") {
-        minitensor::Vector<ScalarT, 2> arg_minimum;
+      // A positive lower bound already proves ellipticity, so there is no
+      // minimum to search for. Report the bound and no direction.
+      if (lower_bound_check_ == true) {
+        double const lower_bound = min_detA_lower_bound(tangent);
+        if (lower_bound > 0.0) {
+          ellipticity_flag_(cell, pt) = 1;
+          min_detA_(cell, pt)         = lower_bound;
+          for (int i(0); i < num_dims_; ++i) {
+            direction_(cell, pt, i) = 0.0;
+          }
+          continue;
+        }
+      }
 
-        min_detA = stereographic_sweep(tangent, arg_minimum, direction, interval);
-        stereographic_newton_raphson(tangent, arg_minimum, direction, min_detA);
+      switch (parametrization_) {
+        case Parametrization::OLIVER: {
+          boost::tie(ellipticity_flag, direction) = minitensor::check_strong_ellipticity(tangent);
+          min_detA = minitensor::det(minitensor::dot2(direction, minitensor::dot(tangent, direction)));
+          break;
+        }
+        case Parametrization::PSO: {
+          minitensor::Vector<ScalarT, 2> arg_minimum;
 
-      } else if (parametrization_type_ == "Projective") {
-        minitensor::Vector<ScalarT, 3> arg_minimum;
+          min_detA = stereographic_pso(tangent, arg_minimum, direction);
+          break;
+        }
+        case Parametrization::SPHERICAL: {
+          minitensor::Vector<ScalarT, 2> arg_minimum;
 
-        min_detA = projective_sweep(tangent, arg_minimum, direction, interval);
-        projective_newton_raphson(tangent, arg_minimum, direction, min_detA);
+          min_detA = spherical_sweep(tangent, arg_minimum, direction, interval);
+          spherical_newton_raphson(tangent, arg_minimum, direction, min_detA);
+          break;
+        }
+        case Parametrization::STEREOGRAPHIC: {
+          minitensor::Vector<ScalarT, 2> arg_minimum;
 
-      } else if (parametrization_type_ == "Tangent") {
-        minitensor::Vector<ScalarT, 2> arg_minimum;
+          min_detA = stereographic_sweep(tangent, arg_minimum, direction, interval);
+          stereographic_newton_raphson(tangent, arg_minimum, direction, min_detA);
+          break;
+        }
+        case Parametrization::PROJECTIVE: {
+          minitensor::Vector<ScalarT, 3> arg_minimum;
 
-        min_detA = tangent_sweep(tangent, arg_minimum, direction, interval);
-        tangent_newton_raphson(tangent, arg_minimum, direction, min_detA);
+          min_detA = projective_sweep(tangent, arg_minimum, direction, interval);
+          projective_newton_raphson(tangent, arg_minimum, direction, min_detA);
+          break;
+        }
+        case Parametrization::TANGENT: {
+          minitensor::Vector<ScalarT, 2> arg_minimum;
 
-      } else if (parametrization_type_ == "Cartesian") {
-        minitensor::Vector<ScalarT, 2> arg_minimum1;
-        minitensor::Vector<ScalarT, 2> arg_minimum2;
-        minitensor::Vector<ScalarT, 2> arg_minimum3;
-        minitensor::Vector<ScalarT, 3> direction1(1.0, 0.0, 0.0);
-        minitensor::Vector<ScalarT, 3> direction2(0.0, 1.0, 0.0);
-        minitensor::Vector<ScalarT, 3> direction3(0.0, 0.0, 1.0);
+          min_detA = tangent_sweep(tangent, arg_minimum, direction, interval);
+          tangent_newton_raphson(tangent, arg_minimum, direction, min_detA);
+          break;
+        }
+        case Parametrization::CARTESIAN: {
+          minitensor::Vector<ScalarT, 2> arg_minimum1;
+          minitensor::Vector<ScalarT, 2> arg_minimum2;
+          minitensor::Vector<ScalarT, 2> arg_minimum3;
+          minitensor::Vector<ScalarT, 3> direction1(1.0, 0.0, 0.0);
+          minitensor::Vector<ScalarT, 3> direction2(0.0, 1.0, 0.0);
+          minitensor::Vector<ScalarT, 3> direction3(0.0, 0.0, 1.0);
 
-        ScalarT min_detA1 = cartesian_sweep(tangent, arg_minimum1, 1, direction1, interval);
+          ScalarT min_detA1 = cartesian_sweep(tangent, arg_minimum1, 1, direction1, interval);
 
-        ScalarT min_detA2 = cartesian_sweep(tangent, arg_minimum2, 2, direction2, interval);
+          ScalarT min_detA2 = cartesian_sweep(tangent, arg_minimum2, 2, direction2, interval);
 
-        ScalarT min_detA3 = cartesian_sweep(tangent, arg_minimum3, 3, direction3, interval);
+          ScalarT min_detA3 = cartesian_sweep(tangent, arg_minimum3, 3, direction3, interval);
 
-        if (min_detA1 <= min_detA2 && min_detA1 <= min_detA3) {
-          cartesian_newton_raphson(tangent, arg_minimum1, 1, direction1, min_detA1);
+          if (min_detA1 <= min_detA2 && min_detA1 <= min_detA3) {
+            cartesian_newton_raphson(tangent, arg_minimum1, 1, direction1, min_detA1);
 
-          min_detA  = min_detA1;
-          direction = direction1;
+            min_detA  = min_detA1;
+            direction = direction1;
 
-        } else if (min_detA2 <= min_detA1 && min_detA2 <= min_detA3) {
-          cartesian_newton_raphson(tangent, arg_minimum2, 2, direction2, min_detA2);
+          } else if (min_detA2 <= min_detA1 && min_detA2 <= min_detA3) {
+            cartesian_newton_raphson(tangent, arg_minimum2, 2, direction2, min_detA2);
 
-          min_detA  = min_detA2;
-          direction = direction2;
+            min_detA  = min_detA2;
+            direction = direction2;
 
-        } else if (min_detA3 <= min_detA1 && min_detA3 <= min_detA2) {
-          cartesian_newton_raphson(tangent, arg_minimum3, 3, direction3, min_detA3);
+          } else if (min_detA3 <= min_detA1 && min_detA3 <= min_detA2) {
+            cartesian_newton_raphson(tangent, arg_minimum3, 3, direction3, min_detA3);
 
-          min_detA  = min_detA3;
-          direction = direction3;
+            min_detA  = min_detA3;
+            direction = direction3;
+          }
+          break;
         }
-
-      } else {
-        minitensor::Vector<ScalarT, 2> arg_minimum;
-
-        min_detA = spherical_sweep(tangent, arg_minimum, direction, interval);
-        spherical_newton_raphson(tangent, arg_minimum, direction, min_detA);
       }
 
       ellipticity_flag = true;
@@ -194,31 +239,9 @@ BifurcationCheck<EvalT, Traits>::spherical_sweep(
 
   minitensor::Vector<minitensor::Index, 2> const sphere_num_points(phi_num_points, theta_num_points);
 
-  // Build the parametric grid with the specified parameters.
-  minitensor::ParametricGrid<ScalarT, 2> sphere_grid(sphere_min, sphere_max, sphere_num_points);
-
-  // Build a spherical parametrization for this elasticity.
-  minitensor::SphericalParametrization<ScalarT, 3> sphere_param(tangent);
-
-  // Traverse the grid with the parametrization.
-  sphere_grid.traverse(sphere_param);
-
-  // Query the parametrization for the minimum and maximum found on the grid.
-  // std::cout << "\n*** SPHERICAL PARAMETRIZATION ***\n";
-  // std::cout << "Interval: " << parametrization_interval_ << std::endl;
-  // std::cout << sphere_param.get_minimum()
-  //<< "  " << sphere_param.get_normal_minimum() << std::endl;
-
-  ScalarT min_detA = sphere_param.get_minimum();
-  for (int i(0); i < 3; ++i) {
-    direction(i) = (sphere_param.get_normal_minimum())(i);
-  }
-
-  for (int i(0); i < 2; ++i) {
-    arg_minimum(i) = (sphere_param.get_arg_minimum())(i);
-  }
-
-  return min_detA;
+  // Traverse the grid with a spherical parametrization for this elasticity.
+  return bifurcation_grid_sweep<minitensor::SphericalParametrization<ScalarT, 3>>(
+      tangent, sphere_min, sphere_max, sphere_num_points, adaptive_sweep_, arg_minimum, direction);
 }
 
 template <typename EvalT, typename Traits>
@@ -266,33 +289,15 @@ BifurcationCheck<EvalT, Traits>::stereographic_sweep(
 
   minitensor::Vector<minitensor::Index, 2> const stereographic_num_points(x_num_points, y_num_points);
 
-  // Build the parametric grid with the specified parameters.
-  minitensor::ParametricGrid<ScalarT, 2> stereographic_grid(
-      stereographic_min, stereographic_max, stereographic_num_points);
-
-  // Build a stereographic parametrization for this elasticity.
-  minitensor::StereographicParametrization<ScalarT, 3> stereographic_param(tangent);
-
-  // Traverse the grid with the parametrization.
-  stereographic_grid.traverse(stereographic_param);
-
-  // Query the parametrization for the minimum and maximum found on the grid.
-  // std::cout << "\n*** STEREOGRAPHIC PARAMETRIZATION ***\n";
-  // std::cout << "Interval: " << parametrization_interval_ << std::endl;
-  // std::cout << stereographic_param.get_minimum()
-  //<< "  " << stereographic_param.get_arg_minimum() << std::endl
-  //<< "  " << stereographic_param.get_normal_minimum() << std::endl;
-
-  ScalarT min_detA = stereographic_param.get_minimum();
-  for (int i(0); i < 3; ++i) {
-    direction(i) = (stereographic_param.get_normal_minimum())(i);
-  }
-
-  for (int i(0); i < 2; ++i) {
-    arg_minimum(i) = (stereographic_param.get_arg_minimum())(i);
-  }
-
-  return min_detA;
+  // Traverse the grid with a stereographic parametrization for this elasticity.
+  return bifurcation_grid_sweep<minitensor::StereographicParametrization<ScalarT, 3>>(
+      tangent,
+      stereographic_min,
+      stereographic_max,
+      stereographic_num_points,
+      adaptive_sweep_,
+      arg_minimum,
+      direction);
 }
 
 template <typename EvalT, typename Traits>
@@ -347,31 +352,9 @@ BifurcationCheck<EvalT, Traits>::projective_sweep(
 
   minitensor::Vector<minitensor::Index, 3> const projective_num_points(x_num_points, y_num_points, z_num_points);
 
-  // Build the parametric grid with the specified parameters.
-  minitensor::ParametricGrid<ScalarT, 3> projective_grid(projective_min, projective_max, projective_num_points);
-
-  // Build a projective parametrization for this elasticity.
-  minitensor::ProjectiveParametrization<ScalarT, 3> projective_param(tangent);
-
-  // Traverse the grid with the parametrization.
-  projective_grid.traverse(projective_param);
-
-  // Query the parametrization for the minimum and maximum found on the grid.
-  // std::cout << "\n*** PROJECTIVE PARAMETRIZATION ***\n";
-  // std::cout << "Interval: " << parametrization_interval_ << std::endl;
-  // std::cout << projective_param.get_minimum()
-  //<< "  " << projective_param.get_normal_minimum() << std::endl;
-
-  ScalarT min_detA = projective_param.get_minimum();
-  for (int i(0); i < 3; ++i) {
-    direction(i) = (projective_param.get_normal_minimum())(i);
-  }
-
-  for (int i(0); i < 3; ++i) {
-    arg_minimum(i) = (projective_param.get_arg_minimum())(i);
-  }
-
-  return min_detA;
+  // Traverse the grid with a projective parametrization for this elasticity.
+  return bifurcation_grid_sweep<minitensor::ProjectiveParametrization<ScalarT, 3>>(
+      tangent, projective_min, projective_max, projective_num_points, adaptive_sweep_, arg_minimum, direction);
 }
 template <typename EvalT, typename Traits>
 typename EvalT::ScalarT
@@ -418,31 +401,9 @@ BifurcationCheck<EvalT, Traits>::tangent_sweep(
 
   minitensor::Vector<minitensor::Index, 2> const tangent_num_points(x_num_points, y_num_points);
 
-  // Build the parametric grid with the specified parameters.
-  minitensor::ParametricGrid<ScalarT, 2> tangent_grid(tangent_min, tangent_max, tangent_num_points);
-
-  // Build a tangent parametrization for this elasticity.
-  minitensor::TangentParametrization<ScalarT, 3> tangent_param(tangent);
-
-  // Traverse the grid with the parametrization.
-  tangent_grid.traverse(tangent_param);
-
-  // Query the parametrization for the minimum and maximum found on the grid.
-  // std::cout << "\n*** TANGENT PARAMETRIZATION ***\n";
-  // std::cout << "Interval: " << parametrization_interval_ << std::endl;
-  // std::cout << tangent_param.get_minimum()
-  //<< "  " << tangent_param.get_normal_minimum() << std::endl;
-
-  ScalarT min_detA = tangent_param.get_minimum();
-  for (int i(0); i < 3; ++i) {
-    direction(i) = (tangent_param.get_normal_minimum())(i);
-  }
-
-  for (int i(0); i < 2; ++i) {
-    arg_minimum(i) = (tangent_param.get_arg_minimum())(i);
-  }
-
-  return min_detA;
+  // Traverse the grid with a tangent parametrization for this elasticity.
+  return bifurcation_grid_sweep<minitensor::TangentParametrization<ScalarT, 3>>(
+      tangent, tangent_min, tangent_max, tangent_num_points, adaptive_sweep_, arg_minimum, direction);
 }
 template <typename EvalT, typename Traits>
 typename EvalT::ScalarT
@@ -488,27 +449,20 @@ BifurcationCheck<EvalT, Traits>::cartesian_sweep(
     minitensor::Vector<minitensor::Index, 3> const cartesian1_num_points(
         p_surface_num_points, p_num_points, p_num_points);
 
-    // Build the parametric grid with the specified parameters.
-    minitensor::ParametricGrid<ScalarT, 3> cartesian1_grid(cartesian1_min, cartesian1_max, cartesian1_num_points);
-
-    // Build a cartesian parametrization for this elasticity.
-    minitensor::CartesianParametrization<ScalarT, 3> cartesian1_param(tangent);
+    // Traverse the grid with a cartesian parametrization for this elasticity.
+    minitensor::Vector<ScalarT, 3> cartesian1_arg_minimum;
 
-    // Traverse the grid with the parametrization.
-    cartesian1_grid.traverse(cartesian1_param);
+    min_detA = bifurcation_grid_sweep<minitensor::CartesianParametrization<ScalarT, 3>>(
+        tangent,
+        cartesian1_min,
+        cartesian1_max,
+        cartesian1_num_points,
+        adaptive_sweep_,
+        cartesian1_arg_minimum,
+        direction);
 
-    // Query the parametrization for the minimum and maximum found on the grid.
-    // std::cout << "\n*** CARTESIAN PARAMETRIZATION ***\n";
-    // std::cout << "Interval: " << parametrization_interval_ << std::endl;
-    // std::cout << cartesian1_param.get_minimum()
-    // << "  " << cartesian1_param.get_normal_minimum() << std::endl;
-
-    min_detA       = cartesian1_param.get_minimum();
-    arg_minimum(0) = (cartesian1_param.get_arg_minimum())(1);
-    arg_minimum(1) = (cartesian1_param.get_arg_minimum())(2);
-    for (int i(0); i < 3; ++i) {
-      direction(i) = (cartesian1_param.get_normal_minimum())(i);
-    }
+    arg_minimum(0) = cartesian1_arg_minimum(1);
+    arg_minimum(1) = cartesian1_arg_minimum(2);
   }
 
   if (surface_index == 2) {
@@ -520,27 +474,20 @@ BifurcationCheck<EvalT, Traits>::cartesian_sweep(
     minitensor::Vector<minitensor::Index, 3> const cartesian2_num_points(
         p_num_points, p_surface_num_points, p_num_points);
 
-    // Build the parametric grid with the specified parameters.
-    minitensor::ParametricGrid<ScalarT, 3> cartesian2_grid(cartesian2_min, cartesian2_max, cartesian2_num_points);
-
-    // Build a cartesian parametrization for this elasticity.
-    minitensor::CartesianParametrization<ScalarT, 3> cartesian2_param(tangent);
-
-    // Traverse the grid with the parametrization.
-    cartesian2_grid.traverse(cartesian2_param);
+    // Traverse the grid with a cartesian parametrization for this elasticity.
+    minitensor::Vector<ScalarT, 3> cartesian2_arg_minimum;
 
-    // Query the parametrization for the minimum and maximum found on the grid.
-    // std::cout << "\n*** CARTESIAN PARAMETRIZATION ***\n";
-    // std::cout << "Interval: " << parametrization_interval_ << std::endl;
-    // std::cout << cartesian2_param.get_minimum()
-    // << "  " << cartesian2_param.get_normal_minimum() << std::endl;
+    min_detA = bifurcation_grid_sweep<minitensor::CartesianParametrization<ScalarT, 3>>(
+        tangent,
+        cartesian2_min,
+        cartesian2_max,
+        cartesian2_num_points,
+        adaptive_sweep_,
+        cartesian2_arg_minimum,
+        direction);
 
-    min_detA       = cartesian2_param.get_minimum();
-    arg_minimum(0) = (cartesian2_param.get_arg_minimum())(0);
-    arg_minimum(1) = (cartesian2_param.get_arg_minimum())(2);
-    for (int i(0); i < 3; ++i) {
-      direction(i) = (cartesian2_param.get_normal_minimum())(i);
-    }
+    arg_minimum(0) = cartesian2_arg_minimum(0);
+    arg_minimum(1) = cartesian2_arg_minimum(2);
   }
 
   if (surface_index == 3) {
@@ -552,27 +499,20 @@ BifurcationCheck<EvalT, Traits>::cartesian_sweep(
     minitensor::Vector<minitensor::Index, 3> const cartesian3_num_points(
         p_num_points, p_num_points, p_surface_num_points);
 
-    // Build the parametric grid with the specified parameters.
-    minitensor::ParametricGrid<ScalarT, 3> cartesian3_grid(cartesian3_min, cartesian3_max, cartesian3_num_points);
-
-    // Build a cartesian parametrization for this elasticity.
-    minitensor::CartesianParametrization<ScalarT, 3> cartesian3_param(tangent);
+    // Traverse the grid with a cartesian parametrization for this elasticity.
+    minitensor::Vector<ScalarT, 3> cartesian3_arg_minimum;
 
-    // Traverse the grid with the parametrization.
-    cartesian3_grid.traverse(cartesian3_param);
+    min_detA = bifurcation_grid_sweep<minitensor::CartesianParametrization<ScalarT, 3>>(
+        tangent,
+        cartesian3_min,
+        cartesian3_max,
+        cartesian3_num_points,
+        adaptive_sweep_,
+        cartesian3_arg_minimum,
+        direction);
 
-    // Query the parametrization for the minimum and maximum found on the grid.
-    // std::cout << "\n*** CARTESIAN PARAMETRIZATION ***\n";
-    // std::cout << "Interval: " << parametrization_interval_ << std::endl;
-    // std::cout << cartesian3_param.get_minimum()
-    //<< "  " << cartesian3_param.get_normal_minimum() << std::endl;
-
-    min_detA       = cartesian3_param.get_minimum();
-    arg_minimum(0) = (cartesian3_param.get_arg_minimum())(0);
-    arg_minimum(1) = (cartesian3_param.get_arg_minimum())(1);
-    for (int i(0); i < 3; ++i) {
-      direction(i) = (cartesian3_param.get_normal_minimum())(i);
-    }
+    arg_minimum(0) = cartesian3_arg_minimum(0);
+    arg_minimum(1) = cartesian3_arg_minimum(1);
   }
 
   return min_detA;
@@ -594,16 +534,16 @@ BifurcationCheck<EvalT, Traits>::spherical_newton_raphson(
 
   D2FadType detA;
 
-  // in std:vector form to work with nonlinear solve
+  // in array form to work with nonlinear solve
   // size of Jacobian, 4 = 2 * 2
-  std::vector<ScalarT> dRdX(4);
-  std::vector<ScalarT> X(2);
-  std::vector<ScalarT> R(2);
+  std::array<ScalarT, 4> dRdX{};
+  std::array<ScalarT, 2> X{};
+  std::array<ScalarT, 2> R{};
 
   for (int i(0); i < 2; ++i) X[i] = parameters[i];
 
   // local nonlinear solver for Newton iterative solve
-  LocalNonlinearSolver<EvalT, Traits> solver;
+  LocalNonlinearSolver<EvalT, Traits, 2> solver;
 
   ScalarT normR(0.0), normR0(0.0), relativeR(0.0);
   bool    converged = false;
@@ -697,16 +637,16 @@ BifurcationCheck<EvalT, Traits>::stereographic_newton_raphson(
 
   D2FadType detA;
 
-  // in std:vector form to work with nonlinear solve
+  // in array form to work with nonlinear solve
   // size of Jacobian, 4 = 2 * 2
-  std::vector<ScalarT> dRdX(4);
-  std::vector<ScalarT> X(2);
-  std::vector<ScalarT> R(2);
+  std::array<ScalarT, 4> dRdX{};
+  std::array<ScalarT, 2> X{};
+  std::array<ScalarT, 2> R{};
 
   for (int i(0); i < 2; ++i) X[i] = parameters[i];
 
   // local nonlinear solver for Newton iterative solve
-  LocalNonlinearSolver<EvalT, Traits> solver;
+  LocalNonlinearSolver<EvalT, Traits, 2> solver;
 
   ScalarT normR(0.0), normR0(0.0), relativeR(0.0);
   bool    converged = false;
@@ -808,16 +748,16 @@ BifurcationCheck<EvalT, Traits>::projective_newton_raphson(
 
   D2FadType detA;
 
-  // in std:vector form to work with nonlinear solve
+  // in array form to work with nonlinear solve
   // size of Jacobian, 4 = 2 * 2
-  std::vector<ScalarT> dRdX(16);
-  std::vector<ScalarT> X(4);
-  std::vector<ScalarT> R(4);
+  std::array<ScalarT, 16> dRdX{};
+  std::array<ScalarT, 4> X{};
+  std::array<ScalarT, 4> R{};
 
   for (int i(0); i < 4; ++i) X[i] = parameters_new[i];
 
   // local nonlinear solver for Newton iterative solve
-  LocalNonlinearSolver<EvalT, Traits> solver;
+  LocalNonlinearSolver<EvalT, Traits, 4> solver;
 
   ScalarT normR(0.0), normR0(0.0), relativeR(0.0);
   bool    converged = false;
@@ -916,16 +856,16 @@ BifurcationCheck<EvalT, Traits>::tangent_newton_raphson(
 
   D2FadType detA;
 
-  // in std:vector form to work with nonlinear solve
+  // in array form to work with nonlinear solve
   // size of Jacobian, 4 = 2 * 2
-  std::vector<ScalarT> dRdX(4);
-  std::vector<ScalarT> X(2);
-  std::vector<ScalarT> R(2);
+  std::array<ScalarT, 4> dRdX{};
+  std::array<ScalarT, 2> X{};
+  std::array<ScalarT, 2> R{};
 
   for (int i(0); i < 2; ++i) X[i] = parameters[i];
 
   // local nonlinear solver for Newton iterative solve
-  LocalNonlinearSolver<EvalT, Traits> solver;
+  LocalNonlinearSolver<EvalT, Traits, 2> solver;
 
   ScalarT normR(0.0), normR0(0.0), relativeR(0.0);
   bool    converged = false;
@@ -1020,16 +960,16 @@ BifurcationCheck<EvalT, Traits>::cartesian_newton_raphson(
 
   D2FadType detA;
 
-  // in std:vector form to work with nonlinear solve
+  // in array form to work with nonlinear solve
   // size of Jacobian, 4 = 2 * 2
-  std::vector<ScalarT> dRdX(4);
-  std::vector<ScalarT> X(2);
-  std::vector<ScalarT> R(2);
+  std::array<ScalarT, 4> dRdX{};
+  std::array<ScalarT, 2> X{};
+  std::array<ScalarT, 2> R{};
 
   for (int i(0); i < 2; ++i) X[i] = parameters[i];
 
   // local nonlinear solver for Newton iterative solve
-  LocalNonlinearSolver<EvalT, Traits> solver;
+  LocalNonlinearSolver<EvalT, Traits, 2> solver;
 
   ScalarT normR(0.0), normR0(0.0), relativeR(0.0);
   bool    converged = false;
@@ -5,6 +5,9 @@
 #if !defined(LCM_StrongSchwarzBC_hpp)
 #define LCM_StrongSchwarzBC_hpp
 
+#include <vector>
+
+#include "Albany_ThyraTypes.hpp"
 #include "Albany_config.h"
 #include "PHAL_AlbanyTraits.hpp"
 #include "PHAL_SDirichlet.hpp"
@@ -41,6 +44,12 @@ class StrongSchwarzBC_Base : public PHAL::SDirichlet<EvalT, Traits>
 
   StrongSchwarzBC_Base(Teuchos::ParameterList& p);
 
+  /// Locate the node set nodes in the coupled mesh and store, for each of
+  /// them, the coupled nodes and shape function values that interpolate the
+  /// coupled solution there. Only rebuilt when either mesh has changed.
+  void
+  updateInterpolation();
+
   template <typename T>
   void
   computeBCs(size_t const ns_node, T& x_val, T& y_val, T& z_val);
@@ -134,6 +143,17 @@ class StrongSchwarzBC_Base : public PHAL::SDirichlet<EvalT, Traits>
   std::string                                          coupled_block_name_{"NONE"};
   int                                                  this_app_index_{-1};
   int                                                  coupled_app_index_{-1};
+
+  // Sparse interpolation from the coupled solution to the node set, one row
+  // per node set node: node set node n takes the values at coupled overlap
+  // nodes interp_nodes_[k] weighted by interp_weights_[k] for k in
+  // [interp_offsets_[n], interp_offsets_[n + 1]).
+  std::vector<std::size_t>              interp_offsets_;
+  std::vector<LO>                       interp_nodes_;
+  std::vector<double>                   interp_weights_;
+  unsigned                              interp_dimension_{0};
+  std::size_t                           interp_coupled_cells_{0};
+  Teuchos::RCP<Thyra_VectorSpace const> interp_coupled_vs_{Teuchos::null};
 };
 
 // Fill solution with Dirichlet values
@@ -6,12 +6,16 @@
 
 #include <Phalanx_DataLayout.hpp>
 #include <Sacado_ParameterRegistration.hpp>
+#include <algorithm>
+#include <limits>
+#include <utility>
 
 #include "Albany_Application.hpp"
 #include "Albany_GenericSTKMeshStruct.hpp"
 #include "Albany_GlobalLocalIndexer.hpp"
 #include "Albany_STKDiscretization.hpp"
 #include "Albany_ThyraUtils.hpp"
+#include "BoundingVolumeHierarchy.hpp"
 #include "StrongSchwarzBC.hpp"
 
 namespace LCM {
@@ -40,32 +44,41 @@ StrongSchwarzBC_Base<EvalT, Traits>::StrongSchwarzBC_Base(Teuchos::ParameterList
 }
 
 template <typename EvalT, typename Traits>
-template <typename T>
 void
-StrongSchwarzBC_Base<EvalT, Traits>::computeBCs(size_t const ns_node, T& x_val, T& y_val, T& z_val)
+StrongSchwarzBC_Base<EvalT, Traits>::updateInterpolation()
 {
-  auto const coupled_app_index = getCoupledAppIndex();
+  auto const                 this_app_index    = getThisAppIndex();
+  auto const                 coupled_app_index = getCoupledAppIndex();
+  Albany::Application const& this_app          = getApplication(this_app_index);
+  Albany::Application const& coupled_app       = getApplication(coupled_app_index);
 
-  Albany::Application const& coupled_app = getApplication(coupled_app_index);
+  Teuchos::RCP<Albany::AbstractDiscretization> this_disc    = this_app.getDiscretization();
+  Teuchos::RCP<Albany::AbstractDiscretization> coupled_disc = coupled_app.getDiscretization();
 
-  Teuchos::RCP<Thyra_Vector const> coupled_solution = coupled_app.getX();
+  auto* this_stk_disc    = static_cast<Albany::STKDiscretization*>(this_disc.get());
+  auto* coupled_stk_disc = static_cast<Albany::STKDiscretization*>(coupled_disc.get());
 
-  if (coupled_solution == Teuchos::null) {
-    x_val = 0.0;
-    y_val = 0.0;
-    z_val = 0.0;
-    return;
-  }
+  std::string const& coupled_nodeset_name = this_app.getNodesetName(coupled_app_index);
 
-  auto const                                   this_app_index = getThisAppIndex();
-  Albany::Application const&                   this_app       = getApplication(this_app_index);
-  Teuchos::RCP<Albany::AbstractDiscretization> this_disc      = this_app.getDiscretization();
+  std::vector<double*> const& ns_coord = this_stk_disc->getNodeSetCoords().find(coupled_nodeset_name)->second;
 
-  auto* this_stk_disc = static_cast<Albany::STKDiscretization*>(this_disc.get());
+  auto const& ws_elem_to_node_id = coupled_stk_disc->getWsElNodeID();
 
-  Teuchos::RCP<Albany::AbstractDiscretization> coupled_disc = coupled_app.getDiscretization();
+  Teuchos::RCP<Thyra_VectorSpace const> coupled_overlap_node_vs = coupled_stk_disc->getOverlapNodeVectorSpace();
 
-  auto* coupled_stk_disc = static_cast<Albany::STKDiscretization*>(coupled_disc.get());
+  std::size_t coupled_cell_count{0};
+  for (auto workset = 0; workset < ws_elem_to_node_id.size(); ++workset) {
+    coupled_cell_count += ws_elem_to_node_id[workset].size();
+  }
+
+  // The meshes do not move with respect to each other in the reference
+  // configuration, so the interpolation only has to be rebuilt when either
+  // of them changes.
+  bool const same_vs    = interp_coupled_vs_.get() == coupled_overlap_node_vs.get();
+  bool const same_cells = interp_coupled_cells_ == coupled_cell_count;
+  bool const same_nodes = interp_offsets_.size() == ns_coord.size() + 1;
+
+  if (same_vs == true && same_cells == true && same_nodes == true) return;
 
   auto& coupled_gms = dynamic_cast<Albany::GenericSTKMeshStruct&>(*(coupled_stk_disc->getSTKMeshStruct()));
 
@@ -103,21 +116,6 @@ StrongSchwarzBC_Base<EvalT, Traits>::computeBCs(size_t const ns_node, T& x_val,
   auto const           coupled_dimension  = coupled_cell_topology_data.dimension;
   auto const           coupled_node_count = coupled_cell_topology_data.node_count;
 
-  std::string const& coupled_nodeset_name = this_app.getNodesetName(coupled_app_index);
-
-  std::vector<double*> const& ns_coord = this_stk_disc->getNodeSetCoords().find(coupled_nodeset_name)->second;
-
-  auto const& ws_elem_to_node_id = coupled_stk_disc->getWsElNodeID();
-
-  std::vector<minitensor::Vector<double>> coupled_element_nodes(coupled_node_count);
-
-  std::vector<minitensor::Vector<double>> coupled_element_solution(coupled_node_count);
-
-  for (unsigned i = 0; i < coupled_node_count; ++i) {
-    coupled_element_nodes[i].set_dimension(coupled_dimension);
-    coupled_element_solution[i].set_dimension(coupled_dimension);
-  }
-
   // This tolerance is used for geometric approximations. It will be used
   // to determine whether a node of this_app is inside an element of
   // coupled_app within that tolerance.
@@ -145,17 +143,9 @@ StrongSchwarzBC_Base<EvalT, Traits>::computeBCs(size_t const ns_node, T& x_val,
       break;
   }
 
-  double* const              coord = ns_coord[ns_node];
-  minitensor::Vector<double> point;
-  point.set_dimension(coupled_dimension);
-  point.fill(coord);
-
-  // Determine the element that contains this point.
   Teuchos::ArrayRCP<double> const& coupled_coordinates = coupled_stk_disc->getCoordinates();
 
-  Teuchos::ArrayRCP<ST const> coupled_solution_view = Albany::getLocalData(coupled_solution);
-
-  Teuchos::RCP<Thyra_VectorSpace const> coupled_overlap_node_vs = coupled_stk_disc->getOverlapNodeVectorSpace();
+  auto coupled_ov_node_vs_indexer = Albany::createGlobalLocalIndexer(coupled_overlap_node_vs);
 
   // We do this element by element
   auto const number_cells = 1;
@@ -167,25 +157,29 @@ StrongSchwarzBC_Base<EvalT, Traits>::computeBCs(size_t const ns_node, T& x_val,
   Kokkos::DynRankView<RealType, PHX::Device> parametric_point(
       "par_point", number_cells, number_points, parametric_dimension);
 
-  for (unsigned j = 0; j < parametric_dimension; ++j) {
-    parametric_point(0, 0, j) = 0.0;
-  }
-
   // Container for the physical point
   Kokkos::DynRankView<RealType, PHX::Device> physical_coordinates(
       "phys_point", number_cells, number_points, coupled_dimension);
 
-  for (unsigned i = 0; i < coupled_dimension; ++i) {
-    physical_coordinates(0, 0, i) = point(i);
-  }
-
   // Container for the physical nodal coordinates
   Kokkos::DynRankView<RealType, PHX::Device> nodal_coordinates(
       "coords", number_cells, coupled_node_count, coupled_dimension);
 
-  bool found = false;
+  // Shape function values at the parametric point.
+  Kokkos::DynRankView<RealType, PHX::Device> basis_values("basis", coupled_node_count, number_points);
+
+  // Another container for the parametric coordinates. Needed because above
+  // it is required that parametric_points has rank 3 for mapToReferenceFrame
+  // but here basis->getValues requires a rank 2 view :(
+  Kokkos::DynRankView<RealType, PHX::Device> pp_reduced("par_point", number_points, parametric_dimension);
+
+  // Bounding volume hierarchy of the coupled elements, so that each node
+  // set node is only mapped to the reference frame of the elements whose
+  // boxes contain it.
+  std::vector<std::pair<int, int>> bvh_elements;
+  std::vector<double>              lower;
+  std::vector<double>              upper;
 
-  auto coupled_ov_node_vs_indexer = Albany::createGlobalLocalIndexer(coupled_overlap_node_vs);
   for (auto workset = 0; workset < ws_elem_to_node_id.size(); ++workset) {
     std::string const& coupled_element_block = coupled_ws_eb_names[workset];
 
@@ -194,71 +188,143 @@ StrongSchwarzBC_Base<EvalT, Traits>::computeBCs(size_t const ns_node, T& x_val,
     auto const elements_per_workset = ws_elem_to_node_id[workset].size();
 
     for (auto element = 0; element < elements_per_workset; ++element) {
+      auto const offset = lower.size();
+
+      lower.resize(offset + coupled_dimension, std::numeric_limits<double>::max());
+      upper.resize(offset + coupled_dimension, std::numeric_limits<double>::lowest());
+
       for (unsigned node = 0; node < coupled_node_count; ++node) {
         auto const global_node_id = ws_elem_to_node_id[workset][element][node];
         auto const local_node_id  = coupled_ov_node_vs_indexer->getLocalElement(global_node_id);
 
-        double* const pcoord = &(coupled_coordinates[coupled_dimension * local_node_id]);
+        for (unsigned j = 0; j < coupled_dimension; ++j) {
+          double const x    = coupled_coordinates[coupled_dimension * local_node_id + j];
+          lower[offset + j] = std::min(lower[offset + j], x);
+          upper[offset + j] = std::max(upper[offset + j], x);
+        }
+      }  // node loop
 
-        coupled_element_nodes[node].fill(pcoord);
+      bvh_elements.emplace_back(workset, element);
 
-        for (unsigned i = 0; i < coupled_dimension; ++i) {
-          coupled_element_solution[node](i) = coupled_solution_view[coupled_dimension * local_node_id + i];
-        }  // dimension loop
+    }  // element loop
 
-      }  // node loop
+  }  // workset loop
 
-      for (unsigned i = 0; i < coupled_node_count; ++i) {
-        for (unsigned j = 0; j < coupled_dimension; ++j) {
-          nodal_coordinates(0, i, j) = coupled_element_nodes[i](j);
-        }
-      }
+  // The boxes get twice the parametric tolerance to be sure to
+  // contain every point that passes the parametric test.
+  LCM::BoundingVolumeHierarchy const bvh(coupled_dimension, lower, upper, 2.0 * tolerance);
 
-      // Get parametric coordinates
-      Intrepid2::CellTools<PHX::Device>::mapToReferenceFrame(
-          parametric_point, physical_coordinates, nodal_coordinates, coupled_cell_topology);
+  auto const ns_number_nodes = ns_coord.size();
 
-      bool in_element = true;
+  interp_offsets_.assign(ns_number_nodes + 1, 0);
+  interp_nodes_.resize(ns_number_nodes * coupled_node_count);
+  interp_weights_.resize(ns_number_nodes * coupled_node_count);
 
-      for (unsigned i = 0; i < parametric_dimension; ++i) {
-        auto const xi = parametric_point(0, 0, i);
-        in_element    = in_element && lo(i) <= xi && xi <= hi(i);
-      }
+  std::vector<LO> element_nodes(coupled_node_count);
+
+  // Map the point to the reference frame of a candidate element and test
+  // whether it is inside within the tolerance. On success the element
+  // nodes and the parametric point are left for the interpolation below.
+  auto const in_element = [&](int const bvh_element) {
+    auto const workset = bvh_elements[bvh_element].first;
+    auto const element = bvh_elements[bvh_element].second;
+
+    for (unsigned node = 0; node < coupled_node_count; ++node) {
+      auto const global_node_id = ws_elem_to_node_id[workset][element][node];
+      auto const local_node_id  = coupled_ov_node_vs_indexer->getLocalElement(global_node_id);
+
+      element_nodes[node] = local_node_id;
 
-      if (in_element == true) {
-        found = true;
-        break;
+      for (unsigned j = 0; j < coupled_dimension; ++j) {
+        nodal_coordinates(0, node, j) = coupled_coordinates[coupled_dimension * local_node_id + j];
       }
+    }  // node loop
 
-    }  // element loop
+    // Get parametric coordinates
+    Intrepid2::CellTools<PHX::Device>::mapToReferenceFrame(
+        parametric_point, physical_coordinates, nodal_coordinates, coupled_cell_topology);
 
-    if (found == true) {
-      break;
+    bool is_inside = true;
+
+    for (unsigned i = 0; i < parametric_dimension; ++i) {
+      auto const xi = parametric_point(0, 0, i);
+      is_inside     = is_inside && lo(i) <= xi && xi <= hi(i);
     }
 
-  }  // workset loop
+    return is_inside;
+  };
 
-  ALBANY_EXPECT(found == true);
+  for (auto ns_node = 0; ns_node < ns_number_nodes; ++ns_node) {
+    double* const coord = ns_coord[ns_node];
 
-  // Evaluate shape functions at parametric point.
-  Kokkos::DynRankView<RealType, PHX::Device> basis_values("basis", coupled_node_count, number_points);
+    for (unsigned i = 0; i < coupled_dimension; ++i) {
+      physical_coordinates(0, 0, i) = coord[i];
+    }
 
-  // Another container for the parametric coordinates. Needed because above
-  // it is required that parametric_points has rank 3 for mapToReferenceFrame
-  // but here basis->getValues requires a rank 2 view :(
-  Kokkos::DynRankView<RealType, PHX::Device> pp_reduced("par_point", number_points, parametric_dimension);
+    for (unsigned j = 0; j < parametric_dimension; ++j) {
+      parametric_point(0, 0, j) = 0.0;
+    }
+
+    // Determine the element that contains this point.
+    bool const found = bvh.findElement(coord, in_element) >= 0;
+
+    ALBANY_EXPECT(found == true);
+
+    // Evaluate shape functions at parametric point.
+    for (unsigned j = 0; j < parametric_dimension; ++j) {
+      pp_reduced(0, j) = parametric_point(0, 0, j);
+    }
+    basis->getValues(basis_values, pp_reduced, Intrepid2::OPERATOR_VALUE);
+
+    auto const offset = ns_node * coupled_node_count;
 
-  for (unsigned j = 0; j < parametric_dimension; ++j) {
-    pp_reduced(0, j) = parametric_point(0, 0, j);
+    for (unsigned i = 0; i < coupled_node_count; ++i) {
+      interp_nodes_[offset + i]   = element_nodes[i];
+      interp_weights_[offset + i] = basis_values(i, 0);
+    }
+    interp_offsets_[ns_node + 1] = offset + coupled_node_count;
+
+  }  // node in node set loop
+
+  interp_coupled_vs_    = coupled_overlap_node_vs;
+  interp_coupled_cells_ = coupled_cell_count;
+  interp_dimension_     = coupled_dimension;
+}
+
+template <typename EvalT, typename Traits>
+template <typename T>
+void
+StrongSchwarzBC_Base<EvalT, Traits>::computeBCs(size_t const ns_node, T& x_val, T& y_val, T& z_val)
+{
+  auto const coupled_app_index = getCoupledAppIndex();
+
+  Albany::Application const& coupled_app = getApplication(coupled_app_index);
+
+  Teuchos::RCP<Thyra_Vector const> coupled_solution = coupled_app.getX();
+
+  if (coupled_solution == Teuchos::null) {
+    x_val = 0.0;
+    y_val = 0.0;
+    z_val = 0.0;
+    return;
   }
-  basis->getValues(basis_values, pp_reduced, Intrepid2::OPERATOR_VALUE);
 
-  // Evaluate solution at parametric point using values of shape
-  // functions just computed.
-  minitensor::Vector<double> value(coupled_dimension, minitensor::Filler::ZEROS);
+  ALBANY_EXPECT(ns_node + 1 < interp_offsets_.size());
+
+  Teuchos::ArrayRCP<ST const> coupled_solution_view = Albany::getLocalData(coupled_solution);
+
+  // Evaluate solution at this node set node as the weighted sum of the
+  // coupled nodal values found by updateInterpolation.
+  auto const                 dimension = interp_dimension_;
+  minitensor::Vector<double> value(dimension, minitensor::Filler::ZEROS);
 
-  for (unsigned i = 0; i < coupled_node_count; ++i) {
-    value += basis_values(i, 0) * coupled_element_solution[i];
+  for (auto k = interp_offsets_[ns_node]; k < interp_offsets_[ns_node + 1]; ++k) {
+    auto const   local_node_id = interp_nodes_[k];
+    double const weight        = interp_weights_[k];
+
+    for (unsigned i = 0; i < dimension; ++i) {
+      value(i) += weight * coupled_solution_view[dimension * local_node_id + i];
+    }
   }
 
   x_val = value(0);
@@ -544,6 +610,8 @@ fillSolution(StrongSchwarzBC& sbc, typename Traits::EvalData workset)
     }
   }
 #else   // ALBANY_DTK
+  sbc.updateInterpolation();
+
   for (auto ns_node = 0; ns_node < ns_number_nodes; ++ns_node) {
     ST x_val, y_val, z_val;
     sbc.computeBCs(ns_node, x_val, y_val, z_val);
@@ -5,9 +5,11 @@
 #include <MiniTensor.h>
 
 #include <PHAL_Utilities.hpp>
+#include <algorithm>
 
 #include "Albany_Macros.hpp"
 #include "Phalanx_DataLayout.hpp"
+#include "utility/math/TensorPack.hpp"
 #if defined(ALBANY_TIMER)
 #include <chrono>
 #endif
@@ -99,18 +101,32 @@ Kinematics<EvalT, Traits>::evaluateFields(typename Traits::EvalData workset)
   minitensor::Tensor<ScalarT> F(num_dims_), strain(num_dims_), gradu(num_dims_);
   minitensor::Tensor<ScalarT> I(minitensor::eye<ScalarT>(num_dims_));
 
+  // The displacement gradient paths work on util::PACK_WIDTH points at a
+  // time, taken across cells, so that the tensor algebra runs in SIMD
+  // lanes. A partial last pack repeats its last point and stores nothing
+  // from the repeated lanes.
+  int const num_points = workset.numCells * num_pts_;
+
+  util::Tensor2Pack<ScalarT> const I_pack(util::identity_pack<ScalarT>(num_dims_));
+  util::Tensor2Pack<ScalarT>       gradu_pack(num_dims_);
+
   // Compute DefGrad tensor from displacement gradient
   if (!def_grad_rc_) {
-    for (int cell(0); cell < workset.numCells; ++cell) {
-      for (int pt(0); pt < num_pts_; ++pt) {
-        gradu.fill(grad_u_, cell, pt, 0, 0);
-        F            = I + gradu;
-        j_(cell, pt) = minitensor::det(F);
-        for (int i(0); i < num_dims_; ++i) {
-          for (int j(0); j < num_dims_; ++j) {
-            def_grad_(cell, pt, i, j) = F(i, j);
-          }
-        }
+    for (int first(0); first < num_points; first += util::PACK_WIDTH) {
+      int const num_lanes = std::min(util::PACK_WIDTH, num_points - first);
+      for (int lane(0); lane < util::PACK_WIDTH; ++lane) {
+        int const point = first + std::min(lane, num_lanes - 1);
+        gradu_pack.load(lane, grad_u_, point / num_pts_, point % num_pts_);
+      }
+      util::Tensor2Pack<ScalarT> const F_pack = I_pack + gradu_pack;
+
+      util::Pack<ScalarT, util::PACK_WIDTH> const J_pack = util::det(F_pack);
+
+      for (int lane(0); lane < num_lanes; ++lane) {
+        int const cell = (first + lane) / num_pts_;
+        int const pt   = (first + lane) % num_pts_;
+        F_pack.store(lane, def_grad_, cell, pt);
+        j_(cell, pt) = J_pack[lane];
       }
     }
   } else {
@@ -158,15 +174,15 @@ Kinematics<EvalT, Traits>::evaluateFields(typename Traits::EvalData workset)
 
   if (needs_strain_) {
     if (!def_grad_rc_) {
-      for (int cell(0); cell < workset.numCells; ++cell) {
-        for (int pt(0); pt < num_pts_; ++pt) {
-          gradu.fill(grad_u_, cell, pt, 0, 0);
-          strain = 0.5 * (gradu + minitensor::transpose(gradu));
-          for (int i(0); i < num_dims_; ++i) {
-            for (int j(0); j < num_dims_; ++j) {
-              strain_(cell, pt, i, j) = strain(i, j);
-            }
-          }
+      for (int first(0); first < num_points; first += util::PACK_WIDTH) {
+        int const num_lanes = std::min(util::PACK_WIDTH, num_points - first);
+        for (int lane(0); lane < util::PACK_WIDTH; ++lane) {
+          int const point = first + std::min(lane, num_lanes - 1);
+          gradu_pack.load(lane, grad_u_, point / num_pts_, point % num_pts_);
+        }
+        util::Tensor2Pack<ScalarT> const strain_pack = 0.5 * (gradu_pack + util::transpose(gradu_pack));
+        for (int lane(0); lane < num_lanes; ++lane) {
+          strain_pack.store(lane, strain_, (first + lane) / num_pts_, (first + lane) % num_pts_);
         }
       }
     } else {
@@ -31,7 +31,8 @@ namespace LCM {
  * evaluateFields() assembles (i) the consistent mass matrix or, optionally, the
  * lumped mass matrix M and (ii) the integral over each element of the projected
  * quantity b. Then postEvaluate() solves the linear equation M x = b and
- * reports x to STK's nodal database.
+ * reports x to STK's nodal database. M and its preconditioner are reused until
+ * the mesh changes, and all the fields are solved for as one multivector.
  *   The graph describing the mass matrix's structure is created in Albany::
  * STKDiscretization::meshToGraph().
  */
@@ -8,8 +8,11 @@
 // #include "Albany_ProblemUtils.hpp"
 #include <Phalanx_DataLayout_MDALayout.hpp>
 #include <Teuchos_AbstractFactoryStd.hpp>
+#include <Teuchos_CommHelpers.hpp>
 #include <Thyra_Ifpack2PreconditionerFactory.hpp>
+#include <algorithm>
 
+#include "Albany_CombineAndScatterManager.hpp"
 #include "Albany_GlobalLocalIndexer.hpp"
 #include "Albany_ThyraUtils.hpp"
 #include "Albany_Utils.hpp"
@@ -43,8 +46,35 @@ class ProjectIPtoNodalFieldManager : public Adapt::NodalDataBase::Manager
   // Start position in the nodal vector database, and number of vectors we're
   // using.
   int ndb_start, ndb_numvecs;
-
-  ProjectIPtoNodalFieldManager() : nwrkr_(0), prectr_(0), postctr_(0) {}
+  // The mass matrix depends only on the mesh. Once exported to the owned map,
+  // it is kept, together with its solver and preconditioner, until the nodal
+  // graph is rebuilt or a node moves. assemble_mass is set in preEvaluate()
+  // for the current evaluation.
+  bool                                           reuse_mass, has_owned_mass, assemble_mass;
+  // Overlapped node coordinates the kept mass matrix was assembled with.
+  std::vector<double>                            mass_coords;
+  Teuchos::RCP<Thyra::LinearOpWithSolveBase<ST>> mass_solver;
+  Teuchos::RCP<Albany::CombineAndScatterManager> cas_manager;
+  // Owned solution space to the overlapped nodal data vector space, used to
+  // store the solution back in stk. Kept with the mass matrix.
+  Teuchos::RCP<Albany::CombineAndScatterManager> store_cas_manager;
+  // Lumped Corrected: solve with the row-sum lumped mass, then apply
+  // num_corrections Richardson steps with the consistent mass.
+  bool                       lumped_corrected;
+  int                        num_corrections;
+  Teuchos::RCP<Thyra_Vector> inv_lumped_mass;
+
+  ProjectIPtoNodalFieldManager()
+      : reuse_mass(true),
+        has_owned_mass(false),
+        assemble_mass(true),
+        lumped_corrected(false),
+        num_corrections(0),
+        nwrkr_(0),
+        prectr_(0),
+        postctr_(0)
+  {
+  }
 
   void
   registerWorker()
@@ -231,8 +261,10 @@ getValidProjectIPtoNodalFieldParameters()
     valid_pl->set<std::string>(Albany::strint("IP Field Layout", i), "", "IP Field Layout: Scalar, Vector, or Tensor");
   }
   valid_pl->set<bool>("Output to File", true, "Whether nodal field info should be output to a file");
-  valid_pl->set<std::string>("Mass Matrix Type", "Full", "Full or Lumped");
+  valid_pl->set<std::string>("Mass Matrix Type", "Full", "Full, Lumped, or Lumped Corrected");
   valid_pl->set<double>("Solver Tolerance", 1e-12, "Linear solver tolerance");
+  valid_pl->set<bool>("Reuse Mass Matrix", true, "Keep the mass matrix and its solver until the mesh changes");
+  valid_pl->set<int>("Richardson Iterations", 3, "Corrections to the lumped solution for Lumped Corrected");
 
   return valid_pl;
 }
@@ -272,7 +304,8 @@ struct EMassLinearOpType
   enum Enum
   {
     full,
-    lumped
+    lumped,
+    lumped_corrected
   };
   static Enum
   fromString(std::string const& str)
@@ -281,8 +314,11 @@ struct EMassLinearOpType
       return full;
     else if (str == "Lumped")
       return lumped;
+    else if (str == "Lumped Corrected")
+      return lumped_corrected;
     else {
-      ALBANY_ABORT("Mass Matrix Type value " << str << "is invalid; valid values are Full and Lumped.");
+      ALBANY_ABORT(
+          "Mass Matrix Type value " << str << "is invalid; valid values are Full, Lumped, and Lumped Corrected.");
     }
   }
 };
@@ -404,6 +440,8 @@ ProjectIPtoNodalFieldManager::MassLinearOp::create(EMassLinearOpType::Enum type)
   switch (type) {
     case EMassLinearOpType::full: return new FullMassLinearOp();
     case EMassLinearOpType::lumped: return new LumpedMassLinearOp();
+    // The correction needs the consistent mass; the lumped one is its row sum.
+    case EMassLinearOpType::lumped_corrected: return new FullMassLinearOp();
   }
   return nullptr;
 }
@@ -425,6 +463,10 @@ ProjectIPtoNodalField<PHAL::AlbanyTraits::Residual, Traits>::initManager(
     mass_linear_op_type           = EMassLinearOpType::fromString(mmstr);
     mgr_                          = Teuchos::rcp(new ProjectIPtoNodalFieldManager());
     mgr_->mass_linear_op = Teuchos::rcp(ProjectIPtoNodalFieldManager::MassLinearOp::create(mass_linear_op_type));
+    mgr_->reuse_mass       = pl->get<bool>("Reuse Mass Matrix", true);
+    mgr_->lumped_corrected = mass_linear_op_type == EMassLinearOpType::lumped_corrected;
+    mgr_->num_corrections  = pl->get<int>("Richardson Iterations", 3);
+    ALBANY_ASSERT(mgr_->num_corrections >= 0, "Richardson Iterations must be nonnegative.");
     // Find out our starting position in the nodal database.
     mgr_->ndb_start = p_state_mgr_->getStateInfoStruct()->getNodalDataBase()->getVecsize();
     ndb->registerManager(key, mgr_);
@@ -588,12 +630,46 @@ void ProjectIPtoNodalField<PHAL::AlbanyTraits::Residual, Traits>::preEvaluate(
   bool const am_first = ctr == 1;
   if (!am_first) return;
 
+  // The nodal graph is rebuilt, and so replaced, whenever the mesh changes. If
+  // it is the one the owned mass matrix was built on, skip the assembly.
+  Teuchos::RCP<const Albany::ThyraCrsMatrixFactory> const graph_factory =
+      p_state_mgr_->getStateInfoStruct()->getNodalDataBase()->getNodalOpFactory();
+  bool const same_mesh = Teuchos::nonnull(graph_factory) && graph_factory.get() == mgr_->ovl_graph_factory.get();
+  mgr_->assemble_mass  = !(mgr_->reuse_mass == true && mgr_->has_owned_mass == true && same_mesh == true);
+
+  // The nodes can also move on the same graph, e.g. when the displacement is
+  // added to the coordinates. The decision has to be the same on all ranks.
+  Teuchos::ArrayRCP<double> const& coords = p_state_mgr_->getDiscretization()->getCoordinates();
+  if (mgr_->assemble_mass == false) {
+    int const local_moved =
+        std::equal(coords.begin(), coords.end(), mgr_->mass_coords.begin(), mgr_->mass_coords.end()) == true ? 0 : 1;
+    int moved{0};
+    Teuchos::reduceAll<int, int>(
+        *Albany::getComm(graph_factory->getRangeVectorSpace()), Teuchos::REDUCE_MAX, local_moved,
+        Teuchos::outArg(moved));
+    mgr_->assemble_mass = moved == 1;
+  }
+
+  // ip_field alternates between overlapping and nonoverlapping maps and so
+  // must be reallocated.
+  if (mgr_->assemble_mass == false) {
+    mgr_->ip_field = Thyra::createMembers(mgr_->ovl_graph_factory->getRangeVectorSpace(), mgr_->ndb_numvecs);
+    mgr_->ip_field->assign(0.0);
+    return;
+  }
+
   // Reallocate the mass matrix for assembly. Since the matrix is overwritten by
   // a version used for linear algebra having a nonoverlapping row map, we can't
-  // just resumeFill. ip_field also alternates between overlapping
-  // and nonoverlapping maps and so must be reallocated.
-  mgr_->ovl_graph_factory           = p_state_mgr_->getStateInfoStruct()->getNodalDataBase()->getNodalOpFactory();
+  // just resumeFill.
+  mgr_->has_owned_mass              = false;
+  mgr_->mass_solver                 = Teuchos::null;
+  mgr_->cas_manager                 = Teuchos::null;
+  mgr_->store_cas_manager           = Teuchos::null;
+  mgr_->inv_lumped_mass             = Teuchos::null;
+  mgr_->ovl_graph_factory           = graph_factory;
   mgr_->mass_linear_op->is_static() = true;
+  mgr_->mass_coords.clear();
+  if (mgr_->reuse_mass == true) mgr_->mass_coords.assign(coords.begin(), coords.end());
   if (Teuchos::is_null(mgr_->ovl_graph_factory)) {
     ALBANY_ABORT(
         "Construction of graph on the fly not implemented in \n"
@@ -684,12 +760,14 @@ template <typename Traits>
 void
 ProjectIPtoNodalField<PHAL::AlbanyTraits::Residual, Traits>::evaluateFields(typename Traits::EvalData workset)
 {
-  Albany::resumeFill(mgr_->mass_linear_op->linear_op());
-  if (Teuchos::nonnull(quad_mgr_)) {
-    quad_mgr_->evaluateBasis(coords_verts_);
-    mgr_->mass_linear_op->fill(workset, quad_mgr_->bf_const(), quad_mgr_->wbf_const());
-  } else {
-    mgr_->mass_linear_op->fill(workset, BF, wBF);
+  if (mgr_->assemble_mass == true) {
+    Albany::resumeFill(mgr_->mass_linear_op->linear_op());
+    if (Teuchos::nonnull(quad_mgr_)) {
+      quad_mgr_->evaluateBasis(coords_verts_);
+      mgr_->mass_linear_op->fill(workset, quad_mgr_->bf_const(), quad_mgr_->wbf_const());
+    } else {
+      mgr_->mass_linear_op->fill(workset, BF, wBF);
+    }
   }
 #if defined(PROJ_INTERP_TEST)
   for (unsigned int cell = 0; cell < workset.numCells; ++cell)
@@ -729,7 +807,9 @@ void ProjectIPtoNodalField<PHAL::AlbanyTraits::Residual, Traits>::postEvaluate(
   // operations Ifpack2 performs.) Hence I export mass matrix to a new matrix
   // having nonoverlapping row and col maps. As in case 1, I also have to create
   // a compatible b.
-  {
+  //   The owned mass matrix, the combine and scatter manager and the solver are
+  // kept in mgr_ and reused until the mesh changes; see preEvaluate().
+  if (mgr_->assemble_mass == true) {
     // Get overlapping and nonoverlapping maps.
     const Teuchos::RCP<const Thyra_LinearOp>& mm_ovl = mgr_->mass_linear_op->linear_op();
     if (!mgr_->mass_linear_op->is_static()) {
@@ -770,52 +850,86 @@ void ProjectIPtoNodalField<PHAL::AlbanyTraits::Residual, Traits>::postEvaluate(
     // IKT, note to self: the original code has a fillComplete() here.  I don't
     // think we need it because createOp() calls fillComplete.
     // mm->fillComplete();
-
+    mgr_->cas_manager    = cas_manager;
+    mgr_->has_owned_mass = true;
+
+    if (mgr_->lumped_corrected == true) {
+      // Row sums of the consistent mass are the entries of the lumped mass.
+      Teuchos::RCP<Thyra_Vector> ones = Thyra::createMember(mm->domain());
+      ones->assign(1.0);
+      mgr_->inv_lumped_mass = Thyra::createMember(mm->range());
+      mm->apply(Thyra::NOTRANS, *ones, mgr_->inv_lumped_mass.ptr(), 1.0, 0.0);
+      Thyra::reciprocal<ST>(*mgr_->inv_lumped_mass, mgr_->inv_lumped_mass.ptr());
+    } else {
+      // Building the preconditioner is the expensive part of the setup; do it
+      // once per mesh.
+      mgr_->mass_solver = lowsFactory_->createOp();
+      Thyra::initializeOp<ST>(*lowsFactory_, mm, mgr_->mass_solver.ptr());
+    }
+  }
+  {
     // Now export ip_field.
     // IKT, note to self: ipf has owned layout, since it is that of mm.
-    Teuchos::RCP<Thyra_MultiVector> ipf = Thyra::createMembers(mm->range(), Albany::getNumVectors(mgr_->ip_field));
+    Teuchos::RCP<Thyra_MultiVector> ipf =
+        Thyra::createMembers(mgr_->mass_linear_op->linear_op()->range(), Albany::getNumVectors(mgr_->ip_field));
     // IKT, not to self: we are going from overlap space to owned space -> use
     // combine method Arguments of combine are (src, tgt)
-    cas_manager->combine(mgr_->ip_field, ipf, Albany::CombineMode::ADD);
+    mgr_->cas_manager->combine(mgr_->ip_field, ipf, Albany::CombineMode::ADD);
     // Don't need the assemble form of the ip_field either.
     mgr_->ip_field = ipf;
   }
-  // Create x in A x = b.
+  // Create x in A x = b. All the projected fields are columns of b and are
+  // solved for together.
+  int const                       num_vecs                = Albany::getNumVectors(mgr_->ip_field);
   Teuchos::RCP<Thyra_MultiVector> node_projected_ip_field =
-      Thyra::createMembers(mgr_->mass_linear_op->linear_op()->domain(), Albany::getNumVectors(mgr_->ip_field));
+      Thyra::createMembers(mgr_->mass_linear_op->linear_op()->domain(), num_vecs);
   node_projected_ip_field->assign(0.0);
-  const Teuchos::RCP<Thyra_LinearOp>             A   = mgr_->mass_linear_op->linear_op();
-  Teuchos::RCP<Thyra::LinearOpWithSolveBase<ST>> nsA = lowsFactory_->createOp();
-  Thyra::initializeOp<ST>(*lowsFactory_, A, nsA.ptr());
-  Teuchos::RCP<Thyra_MultiVector> x = node_projected_ip_field;
-  Teuchos::RCP<Thyra_MultiVector> b = mgr_->ip_field;
+  const Teuchos::RCP<Thyra_LinearOp> A = mgr_->mass_linear_op->linear_op();
+  Teuchos::RCP<Thyra_MultiVector>    x = node_projected_ip_field;
+  Teuchos::RCP<Thyra_MultiVector>    b = mgr_->ip_field;
 
   // Compute the column norms of the right-hand side b. If b = 0, no need to
   // proceed.
-  Teuchos::Array<MT> norm_b(Albany::getNumVectors(mgr_->ip_field));
+  Teuchos::Array<MT> norm_b(num_vecs);
   Thyra::norms_2(*b, norm_b());
   bool b_is_zero = true;
-  for (int i = 0; i < Albany::getNumVectors(mgr_->ip_field); ++i)
+  for (int i = 0; i < num_vecs; ++i)
     if (norm_b[i] != 0) {
       b_is_zero = false;
       break;
     }
   if (b_is_zero) return;
 
-  Thyra::SolveStatus<ST> solveStatus = Thyra::solve(*nsA, Thyra::NOTRANS, *b, x.ptr());
+  if (mgr_->lumped_corrected == true) {
+    // x_{k+1} = x_k + D^{-1} (b - M x_k) with D the lumped mass and x_0 = 0,
+    // so x_1 is the lumped projection. Each step is one product with M. The
+    // row-sum lumped mass is positive for linear elements only.
+    Teuchos::RCP<Thyra_MultiVector> r = Thyra::createMembers(A->range(), num_vecs);
+    for (int k = 0; k <= mgr_->num_corrections; ++k) {
+      Thyra::assign(r.ptr(), *b);
+      A->apply(Thyra::NOTRANS, *x, r.ptr(), -1.0, 1.0);
+      for (int i = 0; i < num_vecs; ++i) {
+        Thyra::ele_wise_prod<ST>(1.0, *mgr_->inv_lumped_mass, *r->col(i), x->col(i).ptr());
+      }
+    }
+  } else {
+    Thyra::SolveStatus<ST> solveStatus = Thyra::solve(*mgr_->mass_solver, Thyra::NOTRANS, *b, x.ptr());
+  }
   {  // Store the overlapped vector data back in stk.
     Teuchos::RCP<Thyra_VectorSpace const> const ovl_space =
         (p_state_mgr_->getStateInfoStruct()->getNodalDataBase()->getNodalDataVector()->getOverlappedVectorSpace());
-    Teuchos::RCP<Thyra_VectorSpace const> const space = node_projected_ip_field->col(0)->space();
-    Teuchos::RCP<Thyra_MultiVector>             npif =
+    Teuchos::RCP<Thyra_MultiVector> npif =
         Thyra::createMembers(ovl_space, Albany::getNumVectors(node_projected_ip_field));
     npif->assign(0.0);
     // IKT, note to self: cas_manager arguments are (owned, overlapped)
-    auto cas_manager = Albany::createCombineAndScatterManager(space, ovl_space);
+    if (mgr_->store_cas_manager == Teuchos::null) {
+      Teuchos::RCP<Thyra_VectorSpace const> const space = node_projected_ip_field->col(0)->space();
+      mgr_->store_cas_manager                           = Albany::createCombineAndScatterManager(space, ovl_space);
+    }
     // IKT, not to self: we are going from owned space (node_projected_ip_field)
     // to overlap space (npif) -> use scatter method Arguments of scatter are
     // (src, tgt)
-    cas_manager->scatter(node_projected_ip_field, npif, Albany::CombineMode::ADD);
+    mgr_->store_cas_manager->scatter(node_projected_ip_field, npif, Albany::CombineMode::ADD);
     p_state_mgr_->getStateInfoStruct()->getNodalDataBase()->getNodalDataVector()->saveNodalDataState(
         npif, mgr_->ndb_start);
   }
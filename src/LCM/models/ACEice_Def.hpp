@@ -182,6 +182,12 @@ ACEiceMiniKernel<EvalT, Traits>::ACEiceMiniKernel(
   // exposure time
   addStateVariable(
       "ACE Exposure Time", dl->qp_scalar, "scalar", 0.0, false, p->get<bool>("Output ACE Exposure Time", true));
+
+  // old states read by init
+  Fp_old_id_             = addStateHandle(Fp_string + "_old");
+  eqps_old_id_           = addStateHandle(eqps_string + "_old");
+  T_old_id_              = addStateHandle("ACE Temperature_old");
+  ice_saturation_old_id_ = addStateHandle("ACE_Ice_Saturation_old");
 }
 
 template <typename EvalT, typename Traits>
@@ -224,10 +230,10 @@ ACEiceMiniKernel<EvalT, Traits>::init(
   exposure_time_    = *output_fields["ACE Exposure Time"];
 
   // get State Variables
-  Fp_old_             = (*workset.stateArrayPtr)[Fp_string + "_old"];
-  eqps_old_           = (*workset.stateArrayPtr)[eqps_string + "_old"];
-  T_old_              = (*workset.stateArrayPtr)["ACE Temperature_old"];
-  ice_saturation_old_ = (*workset.stateArrayPtr)["ACE_Ice_Saturation_old"];
+  Fp_old_             = getStateArray(workset, Fp_old_id_);
+  eqps_old_           = getStateArray(workset, eqps_old_id_);
+  T_old_              = getStateArray(workset, T_old_id_);
+  ice_saturation_old_ = getStateArray(workset, ice_saturation_old_id_);
 
   auto& disc                    = *workset.disc;
   auto& stk_disc                = dynamic_cast<Albany::STKDiscretization&>(disc);
@@ -46,7 +46,9 @@ struct ACEpermafrostMiniKernel : public ParallelKernel<EvalT, Traits>
   using BaseKernel::have_temperature_;
   using BaseKernel::ref_temperature_;
 
+  using BaseKernel::addStateHandle;
   using BaseKernel::addStateVariable;
+  using BaseKernel::getStateArray;
   using BaseKernel::setDependentField;
   using BaseKernel::setEvaluatedField;
 
@@ -54,6 +56,9 @@ struct ACEpermafrostMiniKernel : public ParallelKernel<EvalT, Traits>
   /// a global load step reduction
   using BaseKernel::nox_status_test_;
 
+  /// The points of a cell accumulate into failed_(cell).
+  static constexpr bool has_cell_reduction = true;
+
   // Input constant MDFields
   ConstScalarField def_grad_;
   ConstScalarField delta_time_;
@@ -89,6 +94,12 @@ struct ACEpermafrostMiniKernel : public ParallelKernel<EvalT, Traits>
   Albany::MDArray T_old_;
   Albany::MDArray ice_saturation_old_;
 
+  // Ids of the old states above, see addStateHandle
+  int Fp_old_id_{-1};
+  int eqps_old_id_{-1};
+  int T_old_id_{-1};
+  int ice_saturation_old_id_{-1};
+
   bool                       have_cell_boundary_indicator_{false};
   Teuchos::ArrayRCP<double*> cell_boundary_indicator_;
 
@@ -214,11 +214,11 @@ AnisotropicViscoplasticModel<EvalT, Traits>::computeState(
         int     count     = 0;
         dgam              = 0.0;
 
-        LocalNonlinearSolver<EvalT, Traits> solver;
+        LocalNonlinearSolver<EvalT, Traits, 1> solver;
 
-        std::vector<ScalarT> F(1);
-        std::vector<ScalarT> dFdX(1);
-        std::vector<ScalarT> X(1);
+        std::array<ScalarT, 1> F{};
+        std::array<ScalarT, 1> dFdX{};
+        std::array<ScalarT, 1> X{};
 
         F[0]    = f;
         X[0]    = 0.0;
@@ -221,9 +221,9 @@ CapImplicitModel<EvalT, Traits>::computeState(
         bool    converged  = false;
         int     iter       = 0;
 
-        std::vector<ScalarT>                R(13);
-        std::vector<ScalarT>                dRdX(13 * 13);
-        LocalNonlinearSolver<EvalT, Traits> solver;
+        std::vector<ScalarT>                    R(13);
+        std::vector<ScalarT>                    dRdX(13 * 13);
+        LocalNonlinearSolver<EvalT, Traits, 13> solver;
 
         while (!converged) {
           // assemble residual vector and local Jacobian
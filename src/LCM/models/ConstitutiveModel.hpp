@@ -151,6 +151,13 @@ class ConstitutiveModel
     state_var_output_flags_.push_back(output_flag);
   }
 
+  ///
+  /// Look up the handles of the states added with addStateHandle. Called
+  /// from postRegistrationSetup, once every state is registered.
+  ///
+  void
+  resolveStateHandles(typename Traits::SetupData d);
+
   ///
   /// Deal with fields
   ///
@@ -301,6 +308,20 @@ class ConstitutiveModel
  protected:
   friend class ParallelKernel<EvalT, Traits>;
 
+  ///
+  /// Add a state read by computeState. Returns the id to pass to
+  /// getStateArray, its handle is filled in by resolveStateHandles.
+  ///
+  int
+  addStateHandle(std::string const& name);
+
+  ///
+  /// State array added with addStateHandle as id, found through the
+  /// workset handle table without any string lookup.
+  ///
+  Albany::MDArray&
+  getStateArray(Workset workset, int id);
+
   ///
   /// Number of dimensions
   ///
@@ -323,6 +344,13 @@ class ConstitutiveModel
 
   std::vector<bool> state_var_output_flags_;
 
+  ///
+  /// Names and handles of the states added with addStateHandle
+  ///
+  std::vector<std::string> state_handle_names_;
+
+  std::vector<int> state_handles_;
+
   ///
   /// Map of field names
   ///
@@ -34,6 +34,7 @@
 #include "NeohookeanModel.hpp"
 #include "NewtonianFluidModel.hpp"
 #include "OrtizPandolfiModel.hpp"
+#include "ParallelJ2Model.hpp"
 #include "ParallelNeohookeanModel.hpp"
 #include "Phalanx_DataLayout.hpp"
 #include "RIHMRModel.hpp"
@@ -214,6 +215,9 @@ ConstitutiveModelInterface<EvalT, Traits>::postRegistrationSetup(
   for (auto& pair : eval_fields_map_) {
     this->utils.setFieldData(*(pair.second), fm);
   }
+
+  // states read by the model
+  model_->resolveStateHandles(d);
 }
 
 template <typename EvalT, typename Traits>
@@ -262,6 +266,8 @@ ConstitutiveModelInterface<EvalT, Traits>::initializeModel(
     model = rcp(new CreepModel<EvalT, Traits>(p, dl));
   } else if (model_name == "J2") {
     model = rcp(new J2Model<EvalT, Traits>(p, dl));
+  } else if (model_name == "Parallel J2") {
+    model = rcp(new ParallelJ2Model<EvalT, Traits>(p, dl));
   } else if (model_name == "Newtonian Fluid") {
     model = rcp(new NewtonianFluidModel<EvalT, Traits>(p, dl));
   } else if (model_name == "CrystalPlasticity") {
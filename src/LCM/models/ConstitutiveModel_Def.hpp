@@ -112,6 +112,38 @@ class computeVolumeAverageKernel
   }
 };
 
+template <typename EvalT, typename Traits>
+void
+ConstitutiveModel<EvalT, Traits>::resolveStateHandles(typename Traits::SetupData d)
+{
+  for (std::size_t id = 0; id < state_handle_names_.size(); ++id) {
+    state_handles_[id] = d.get_state_handle(state_handle_names_[id]);
+  }
+}
+
+template <typename EvalT, typename Traits>
+int
+ConstitutiveModel<EvalT, Traits>::addStateHandle(std::string const& name)
+{
+  state_handle_names_.push_back(name);
+  state_handles_.push_back(-1);
+  return state_handles_.size() - 1;
+}
+
+template <typename EvalT, typename Traits>
+Albany::MDArray&
+ConstitutiveModel<EvalT, Traits>::getStateArray(Workset workset, int id)
+{
+  Albany::StateHandleArray* const handle_array = workset.stateHandleArrayPtr;
+
+  // Worksets assembled by hand may only carry the name-based arrays
+  if (handle_array == nullptr) return (*workset.stateArrayPtr)[state_handle_names_[id]];
+
+  int const handle = state_handles_[id];
+  ALBANY_ASSERT(handle >= 0, "Unregistered state variable: " + state_handle_names_[id]);
+  return (*handle_array)[handle];
+}
+
 template <typename EvalT, typename Traits>
 void
 ConstitutiveModel<EvalT, Traits>::computeVolumeAverage(Workset workset, DepFieldMap dep_fields, FieldMap eval_fields)
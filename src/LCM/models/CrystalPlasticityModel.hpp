@@ -45,8 +45,14 @@ class CrystalPlasticityKernel : public ParallelKernel<EvalT, Traits>
   /// load step reduction
   using BaseKernel::nox_status_test_;
 
+  /// The points write the shared NOX status test.
+  static constexpr bool has_cell_reduction = true;
+
+  using BaseKernel::addStateHandle;
+  using BaseKernel::addStateHandleArray;
   using BaseKernel::addStateVariable;
   using BaseKernel::extractEvaluatedFieldArray;
+  using BaseKernel::getStateArray;
   using BaseKernel::setDependentField;
   using BaseKernel::setEvaluatedField;
 
@@ -155,6 +161,10 @@ class CrystalPlasticityKernel : public ParallelKernel<EvalT, Traits>
   /// Vector of structs holding slip system data
   std::vector<CP::SlipSystem<CP::MAX_DIM>> slip_systems_;
 
+  /// Slip systems rotated into the lattice orientation of each cell of the
+  /// current workset (or of the element block), num_slip_ per orientation
+  std::vector<CP::SlipSystem<CP::MAX_DIM>> rotated_slip_systems_;
+
   /// Flags for reading lattice orientations from file
   bool read_orientations_from_mesh_{false};
 
@@ -264,6 +274,10 @@ class CrystalPlasticityKernel : public ParallelKernel<EvalT, Traits>
 
   Albany::MDArray previous_defgrad_;
 
+  int previous_plastic_deformation_id_{-1};
+
+  int previous_defgrad_id_{-1};
+
   RealType dt_{0.0};
 
   Teuchos::ArrayRCP<RealType*> rotation_matrix_transpose_;
@@ -346,6 +346,13 @@ CrystalPlasticityKernel<EvalT, Traits>::CrystalPlasticityKernel(
   // residual iterations
   addStateVariable(
       residual_iter_string_, dl->qp_scalar, "scalar", 0.0, false, p->get<bool>("Output CP_Residual_Iter", false));
+
+  // old states read by init
+  previous_plastic_deformation_id_ = addStateHandle(Fp_string_ + "_old");
+  previous_defgrad_id_             = addStateHandle(F_string_ + "_old");
+  addStateHandleArray("gamma", num_slip_);
+  addStateHandleArray("gamma_dot", num_slip_);
+  addStateHandleArray("tau_hard", num_slip_);
 }
 
 // Initialize state for computing the constitutive response of the material
@@ -371,6 +378,32 @@ CrystalPlasticityKernel<EvalT, Traits>::init(
     ALBANY_ASSERT(rotation_matrix_transpose_.is_null() == false, "Rotation matrix not found on genesis mesh");
   }
 
+  // Rotate the slip systems once per cell (or once per block) here instead of
+  // once per integration point in the kernel. The kernel reads them through a
+  // non-owning view. The storage keeps its capacity between worksets.
+  int const num_orientations = read_orientations_from_mesh_ ? workset.numCells : 1;
+  rotated_slip_systems_.resize(num_orientations * num_slip_);
+  for (int cell = 0; cell < num_orientations; ++cell) {
+    minitensor::Tensor<RealType, CP::MAX_DIM> orientation_matrix(CP::MAX_DIM);
+    if (read_orientations_from_mesh_) {
+      for (int i = 0; i < CP::MAX_DIM; ++i) {
+        for (int j = 0; j < CP::MAX_DIM; ++j) {
+          orientation_matrix(i, j) = rotation_matrix_transpose_[cell][i * CP::MAX_DIM + j];
+        }
+      }
+    } else {
+      orientation_matrix = element_block_orientation_;
+    }
+    for (int num_ss = 0; num_ss < num_slip_; ++num_ss) {
+      auto& slip_system = rotated_slip_systems_[cell * num_slip_ + num_ss];
+
+      slip_system            = slip_systems_[num_ss];
+      slip_system.s_         = orientation_matrix * slip_systems_[num_ss].s_;
+      slip_system.n_         = orientation_matrix * slip_systems_[num_ss].n_;
+      slip_system.projector_ = minitensor::dyad(slip_system.s_, slip_system.n_);
+    }
+  }
+
   // extract dependent MDFields
   def_grad_ = *dep_fields[F_string_];
   if (write_data_file_) {
@@ -406,8 +439,8 @@ CrystalPlasticityKernel<EvalT, Traits>::init(
 
   // get state variables
 
-  previous_plastic_deformation_ = (*workset.stateArrayPtr)[Fp_string_ + "_old"];
-  previous_defgrad_             = (*workset.stateArrayPtr)[F_string_ + "_old"];
+  previous_plastic_deformation_ = getStateArray(workset, previous_plastic_deformation_id_);
+  previous_defgrad_             = getStateArray(workset, previous_defgrad_id_);
 
   dt_ = SSV::eval(delta_time_(0));
 
@@ -431,10 +464,12 @@ CrystalPlasticityKernel<EvalT, Traits>::operator()(int cell, int pt) const
     }
     return;
   }
-  // TODO: In the future for CUDA this should be moved out of the kernel because
-  // it uses dynamic allocation for the buffer. It should also be modified to
-  // use cudaMalloc.
-  utility::StaticAllocator allocator(1024 * 1024);
+  // The arena is owned by the calling thread and only cleared here, so the
+  // buffer is allocated once per thread instead of once per point.
+  // TODO: The arena is host memory from operator new. For CUDA it has to move
+  // out of the kernel into device memory, one buffer per team, which the
+  // (cell, pt) kernel interface has no way to request yet.
+  utility::StaticAllocator& allocator = utility::threadLocalAllocator(1024 * 1024);
 
   // Known quantities
   minitensor::Tensor<RealType, CP::MAX_DIM> Fp_n(num_dims_);
@@ -475,7 +510,10 @@ CrystalPlasticityKernel<EvalT, Traits>::operator()(int cell, int pt) const
 
   minitensor::Tensor<RealType, CP::MAX_DIM> orientation_matrix(CP::MAX_DIM);
 
-  std::vector<CP::SlipSystem<CP::MAX_DIM>> element_slip_systems = slip_systems_;
+  int const orientation_index = read_orientations_from_mesh_ ? cell : 0;
+
+  CP::SlipSystemView<CP::MAX_DIM> const element_slip_systems(
+      &rotated_slip_systems_[orientation_index * num_slip_], num_slip_);
 
   if (have_temperature_) {
     RealType const tlocal = SSV::eval(temperature_(cell, pt));
@@ -512,16 +550,9 @@ CrystalPlasticityKernel<EvalT, Traits>::operator()(int cell, int pt) const
     orientation_matrix = element_block_orientation_;
   }
 
-  // Set the rotated elasticity tensor, slip normals, slip directions,
-  // and projection operator
+  // Set the rotated elasticity tensor. Slip normals, slip directions,
+  // and projection operators were rotated in init().
   C = minitensor::kronecker(orientation_matrix, C_unrotated);
-  for (int num_ss = 0; num_ss < num_slip_; ++num_ss) {
-    auto& slip_system = element_slip_systems.at(num_ss);
-
-    slip_system.s_         = orientation_matrix * slip_systems_.at(num_ss).s_;
-    slip_system.n_         = orientation_matrix * slip_systems_.at(num_ss).n_;
-    slip_system.projector_ = minitensor::dyad(slip_system.s_, slip_system.n_);
-  }
 
   // Copy data from Albany fields into local data structures
   for (int i(0); i < num_dims_; ++i) {
@@ -188,9 +188,9 @@ DruckerPragerModel<EvalT, Traits>::computeState(
         X[2] = alpha;
         X[3] = deq;
 
-        LocalNonlinearSolver<EvalT, Traits> solver;
-        int                                 iter = 0;
-        ScalarT                             norm_residual0(0.0), norm_residual(0.0), relative_residual(0.0);
+        LocalNonlinearSolver<EvalT, Traits, 4> solver;
+        int                                    iter = 0;
+        ScalarT                                norm_residual0(0.0), norm_residual(0.0), relative_residual(0.0);
 
         // local N-R loop
         while (true) {
@@ -152,11 +152,11 @@ GursonHMRModel<EvalT, Traits>::computeState(
   ScalarT fvoid, eq, es, isoH, Phi, dgam, Ybar;
 
   // local unknowns and residual vectors
-  std::vector<ScalarT>                X(4);
-  std::vector<ScalarT>                R(4);
-  std::vector<ScalarT>                dRdX(16);
-  ScalarT                             norm_residual0(0.0), norm_residual(0.0), relative_residual(0.0);
-  LocalNonlinearSolver<EvalT, Traits> solver;
+  std::vector<ScalarT>                   X(4);
+  std::vector<ScalarT>                   R(4);
+  std::vector<ScalarT>                   dRdX(16);
+  ScalarT                                norm_residual0(0.0), norm_residual(0.0), relative_residual(0.0);
+  LocalNonlinearSolver<EvalT, Traits, 4> solver;
 
   for (int cell(0); cell < workset.numCells; ++cell) {
     for (int pt(0); pt < num_pts_; ++pt) {
@@ -168,7 +168,7 @@ GursonModel<EvalT, Traits>::computeState(
         X[2] = fvoid;
         X[3] = eq;
 
-        LocalNonlinearSolver<EvalT, Traits> solver;
+        LocalNonlinearSolver<EvalT, Traits, 4> solver;
 
         int     iter = 0;
         ScalarT norm_residual0(0.0), norm_residual(0.0), relative_residual(0.0);
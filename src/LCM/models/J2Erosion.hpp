@@ -48,7 +48,9 @@ struct J2ErosionKernel : public ParallelKernel<EvalT, Traits>
   using BaseKernel::heat_capacity_;
   using BaseKernel::ref_temperature_;
 
+  using BaseKernel::addStateHandle;
   using BaseKernel::addStateVariable;
+  using BaseKernel::getStateArray;
   using BaseKernel::setDependentField;
   using BaseKernel::setEvaluatedField;
 
@@ -56,6 +58,9 @@ struct J2ErosionKernel : public ParallelKernel<EvalT, Traits>
   /// a global load step reduction
   using BaseKernel::nox_status_test_;
 
+  /// The points of a cell accumulate into failed_(cell, 0).
+  static constexpr bool has_cell_reduction = true;
+
   // Input constant MDFields
   ConstScalarField def_grad_;
   ConstScalarField delta_time_;
@@ -80,6 +85,10 @@ struct J2ErosionKernel : public ParallelKernel<EvalT, Traits>
   Albany::MDArray Fp_old_;
   Albany::MDArray eqps_old_;
 
+  // Ids of the old states above, see addStateHandle
+  int Fp_old_id_{-1};
+  int eqps_old_id_{-1};
+
   bool                       have_cell_boundary_indicator_{false};
   Teuchos::ArrayRCP<double*> cell_boundary_indicator_;
 
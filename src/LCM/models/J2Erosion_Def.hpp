@@ -87,6 +87,10 @@ J2ErosionKernel<EvalT, Traits>::J2ErosionKernel(
   }
 
   addStateVariable("failure_state", dl->cell_scalar, "scalar", 0.0, false, p->get<bool>("Output failure_state", true));
+
+  // old states read by init
+  Fp_old_id_   = addStateHandle(Fp_string + "_old");
+  eqps_old_id_ = addStateHandle(eqps_string + "_old");
 }
 
 template <typename EvalT, typename Traits>
@@ -130,8 +134,8 @@ J2ErosionKernel<EvalT, Traits>::init(
   }
 
   // get State Variables
-  Fp_old_   = (*workset.stateArrayPtr)[Fp_string + "_old"];
-  eqps_old_ = (*workset.stateArrayPtr)[eqps_string + "_old"];
+  Fp_old_   = getStateArray(workset, Fp_old_id_);
+  eqps_old_ = getStateArray(workset, eqps_old_id_);
 
   auto& disc                    = *workset.disc;
   auto& stk_disc                = dynamic_cast<Albany::STKDiscretization&>(disc);
@@ -48,7 +48,9 @@ struct J2MiniKernel : public ParallelKernel<EvalT, Traits>
   using BaseKernel::heat_capacity_;
   using BaseKernel::ref_temperature_;
 
+  using BaseKernel::addStateHandle;
   using BaseKernel::addStateVariable;
+  using BaseKernel::getStateArray;
   using BaseKernel::setDependentField;
   using BaseKernel::setEvaluatedField;
 
@@ -76,6 +78,10 @@ struct J2MiniKernel : public ParallelKernel<EvalT, Traits>
   Albany::MDArray Fp_old_;
   Albany::MDArray eqps_old_;
 
+  // Ids of the old states above, see addStateHandle
+  int Fp_old_id_{-1};
+  int eqps_old_id_{-1};
+
   // Saturation hardening constraints
   RealType sat_mod_;
   RealType sat_exp_;
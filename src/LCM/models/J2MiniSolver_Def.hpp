@@ -65,6 +65,10 @@ J2MiniKernel<EvalT, Traits>::J2MiniKernel(
     addStateVariable(
         source_string, dl->qp_scalar, "scalar", 0.0, false, p->get<bool>("Output Mechanical Source", false));
   }
+
+  // old states read by init
+  Fp_old_id_   = addStateHandle(Fp_string + "_old");
+  eqps_old_id_ = addStateHandle(eqps_string + "_old");
 }
 
 template <typename EvalT, typename Traits>
@@ -100,8 +104,8 @@ J2MiniKernel<EvalT, Traits>::init(Workset& workset, FieldMap<ScalarT const>& dep
   }
 
   // get State Variables
-  Fp_old_   = (*workset.stateArrayPtr)[Fp_string + "_old"];
-  eqps_old_ = (*workset.stateArrayPtr)[eqps_string + "_old"];
+  Fp_old_   = getStateArray(workset, Fp_old_id_);
+  eqps_old_ = getStateArray(workset, eqps_old_id_);
 }
 
 namespace {
@@ -86,6 +86,10 @@ J2Model<EvalT, Traits>::J2Model(Teuchos::ParameterList* p, const Teuchos::RCP<Al
     this->state_var_old_state_flags_.push_back(false);
     this->state_var_output_flags_.push_back(p->get<bool>("Output Mechanical Source", false));
   }
+
+  // old states read by computeState
+  Fp_old_id_   = this->addStateHandle(Fp_string + "_old");
+  eqps_old_id_ = this->addStateHandle(eqps_string + "_old");
 }
 template <typename EvalT, typename Traits>
 void
@@ -119,8 +123,8 @@ J2Model<EvalT, Traits>::computeState(typename Traits::EvalData workset, DepField
   }
 
   // get State Variables
-  Albany::MDArray Fpold   = (*workset.stateArrayPtr)[Fp_string + "_old"];
-  Albany::MDArray eqpsold = (*workset.stateArrayPtr)[eqps_string + "_old"];
+  Albany::MDArray Fpold   = this->getStateArray(workset, Fp_old_id_);
+  Albany::MDArray eqpsold = this->getStateArray(workset, eqps_old_id_);
 
   ScalarT kappa, mu, mubar, K, Y;
   ScalarT Jm23, trace, smag2, smag, f, p, dgam;
@@ -190,11 +194,11 @@ J2Model<EvalT, Traits>::computeState(typename Traits::EvalData workset, DepField
 
         int const num_max_iter = 30;
 
-        LocalNonlinearSolver<EvalT, Traits> solver;
+        LocalNonlinearSolver<EvalT, Traits, 1> solver;
 
-        std::vector<ScalarT> F(1);
-        std::vector<ScalarT> dFdX(1);
-        std::vector<ScalarT> X(1);
+        std::array<ScalarT, 1> F{};
+        std::array<ScalarT, 1> dFdX{};
+        std::array<ScalarT, 1> X{};
 
         F[0] = f;
         X[0] = 0.0;
@@ -4,8 +4,11 @@
 
 #include <MiniTensor.h>
 
+#include <algorithm>
+
 #include "Albany_Macros.hpp"
 #include "Phalanx_DataLayout.hpp"
+#include "utility/math/TensorPack.hpp"
 
 namespace LCM {
 
@@ -60,74 +63,101 @@ NeohookeanModel<EvalT, Traits>::computeState(
   auto energy  = *eval_fields["Energy"];
   auto tangent = *eval_fields["Material Tangent"];
 
-  ScalarT kappa;
-  ScalarT mu, mubar;
-  ScalarT Jm13, Jm53, Jm23;
-  ScalarT smag;
-
-  minitensor::Tensor<ScalarT> F(num_dims_), b(num_dims_), sigma(num_dims_);
-  minitensor::Tensor<ScalarT> I(minitensor::eye<ScalarT>(num_dims_));
-  minitensor::Tensor<ScalarT> s(num_dims_), n(num_dims_);
-
-  minitensor::Tensor4<ScalarT> dsigmadb;
-  minitensor::Tensor4<ScalarT> I1(minitensor::identity_1<ScalarT>(num_dims_));
-  minitensor::Tensor4<ScalarT> I3(minitensor::identity_3<ScalarT>(num_dims_));
-
-  for (int cell(0); cell < workset.numCells; ++cell) {
-    for (int pt(0); pt < num_pts_; ++pt) {
-      auto const& E  = elastic_modulus(cell, pt);
-      auto const& nu = poissons_ratio(cell, pt);
-      auto const& J  = jac_det(cell, pt);
-      kappa          = E / (3.0 * (1.0 - 2.0 * nu));
-      mu             = E / (2.0 * (1.0 + nu));
-      Jm13           = 1.0 / std::cbrt(J);
-      Jm23           = Jm13 * Jm13;
-      Jm53           = Jm23 * Jm23 * Jm13;
-
-      F.fill(def_grad, cell, pt, 0, 0);
-
-      // Mechanical deformation gradient
-      auto Fm = minitensor::Tensor<ScalarT>(F);
-      if (have_temperature_) {
-        // Compute the mechanical deformation gradient Fm based on the
-        // multiplicative decomposition of the deformation gradient
-        //            F = Fm.Ft => Fm = F.inv(Ft)
-        // where Ft is the thermal part of F, given as
-        //     Ft = Le * I = exp(alpha * dtemp) * I
-        // Le = exp(alpha*dtemp) is the thermal stretch and alpha the
-        // coefficient of thermal expansion.
-        ScalarT dtemp           = temperature_(cell, pt) - ref_temperature_;
-        ScalarT thermal_stretch = std::exp(expansion_coeff_ * dtemp);
-        Fm /= thermal_stretch;
-      }
-      b     = Fm * minitensor::transpose(Fm);
-      mubar = (1.0 / 3.0) * mu * Jm23 * minitensor::trace(b);
-      sigma = 0.5 * kappa * (J - 1.0 / J) * I + mu * Jm53 * minitensor::dev(b);
+  using ScalarPack = util::Pack<ScalarT, util::PACK_WIDTH>;
+  using TensorPack = util::Tensor2Pack<ScalarT>;
+
+  TensorPack const I(util::identity_pack<ScalarT>(num_dims_));
+
+  // Material points are evaluated util::PACK_WIDTH at a time, taken across
+  // cells, so that the tensor algebra runs in SIMD lanes. A partial last
+  // pack repeats its last point and stores nothing from the repeated lanes.
+  int const num_points = workset.numCells * num_pts_;
+
+  for (int first(0); first < num_points; first += util::PACK_WIDTH) {
+    int const num_lanes = std::min(util::PACK_WIDTH, num_points - first);
+
+    int        cells[util::PACK_WIDTH];
+    int        pts[util::PACK_WIDTH];
+    ScalarPack E, nu, J;
+    TensorPack F(num_dims_);
+
+    for (int lane(0); lane < util::PACK_WIDTH; ++lane) {
+      int const point = first + std::min(lane, num_lanes - 1);
+      int const cell  = point / num_pts_;
+      int const pt    = point % num_pts_;
+      cells[lane]     = cell;
+      pts[lane]       = pt;
+      E[lane]         = elastic_modulus(cell, pt);
+      nu[lane]        = poissons_ratio(cell, pt);
+      J[lane]         = jac_det(cell, pt);
+      F.load(lane, def_grad, cell, pt);
+    }
 
-      for (int i = 0; i < num_dims_; ++i) {
-        for (int j = 0; j < num_dims_; ++j) {
-          stress(cell, pt, i, j) = sigma(i, j);
-        }
+    ScalarPack const kappa = E / (3.0 * (1.0 - 2.0 * nu));
+    ScalarPack const mu    = E / (2.0 * (1.0 + nu));
+    ScalarPack const Jm13  = 1.0 / util::cbrt(J);
+    ScalarPack const Jm23  = Jm13 * Jm13;
+    ScalarPack const Jm53  = Jm23 * Jm23 * Jm13;
+
+    // Mechanical deformation gradient
+    TensorPack Fm(F);
+    if (have_temperature_) {
+      // Compute the mechanical deformation gradient Fm based on the
+      // multiplicative decomposition of the deformation gradient
+      //            F = Fm.Ft => Fm = F.inv(Ft)
+      // where Ft is the thermal part of F, given as
+      //     Ft = Le * I = exp(alpha * dtemp) * I
+      // Le = exp(alpha*dtemp) is the thermal stretch and alpha the
+      // coefficient of thermal expansion.
+      ScalarPack dtemp;
+      for (int lane(0); lane < util::PACK_WIDTH; ++lane) {
+        dtemp[lane] = temperature_(cells[lane], pts[lane]) - ref_temperature_;
       }
+      ScalarPack const thermal_stretch = util::exp(expansion_coeff_ * dtemp);
+      Fm                               = Fm / thermal_stretch;
+    }
 
-      if (compute_energy_ == true) {
-        energy(cell, pt) =
-            0.5 * kappa * (0.5 * (J * J - 1.0) - std::log(J)) + 0.5 * mu * (Jm23 * minitensor::trace(b) - 3.0);
-      }
+    TensorPack const b     = Fm * util::transpose(Fm);
+    ScalarPack const mubar = (1.0 / 3.0) * mu * Jm23 * util::trace(b);
+    TensorPack const sigma = 0.5 * kappa * (J - 1.0 / J) * I + mu * Jm53 * util::dev(b);
 
-      if (compute_tangent_ == true) {
-        s    = minitensor::dev(sigma);
-        smag = minitensor::norm(s);
-        n    = s / smag;
+    for (int lane(0); lane < num_lanes; ++lane) {
+      sigma.store(lane, stress, cells[lane], pts[lane]);
+    }
 
-        dsigmadb = kappa * J * J * I3 - kappa * (J * J - 1.0) * I1 + 2.0 * mubar * (I1 - (1.0 / 3.0) * I3) -
-                   2.0 / 3.0 * smag * (minitensor::tensor(n, I) + minitensor::tensor(I, n));
+    if (compute_energy_ == true) {
+      ScalarPack const W =
+          0.5 * kappa * (0.5 * (J * J - 1.0) - util::log(J)) + 0.5 * mu * (Jm23 * util::trace(b) - 3.0);
+      for (int lane(0); lane < num_lanes; ++lane) {
+        energy(cells[lane], pts[lane]) = W[lane];
+      }
+    }
 
-        for (int i = 0; i < num_dims_; ++i) {
-          for (int j = 0; j < num_dims_; ++j) {
-            for (int k = 0; k < num_dims_; ++k) {
-              for (int l = 0; l < num_dims_; ++l) {
-                tangent(cell, pt, i, j, k, l) = dsigmadb(i, j, k, l);
+    if (compute_tangent_ == true) {
+      TensorPack const s    = util::dev(sigma);
+      ScalarPack const smag = util::norm(s);
+      TensorPack const n    = s / smag;
+      ScalarPack const JJ   = J * J;
+
+      // Same expression as the minitensor form
+      //   kappa J^2 I3 - kappa (J^2 - 1) I1 + 2 mubar (I1 - I3 / 3)
+      //   - 2/3 smag (n x I + I x n)
+      // evaluated one component at a time.
+      for (int i = 0; i < num_dims_; ++i) {
+        for (int j = 0; j < num_dims_; ++j) {
+          for (int k = 0; k < num_dims_; ++k) {
+            for (int l = 0; l < num_dims_; ++l) {
+              RealType const I1   = (i == k && j == l) ? 1.0 : 0.0;
+              RealType const I3   = (i == j && k == l) ? 1.0 : 0.0;
+              RealType const I_ij = (i == j) ? 1.0 : 0.0;
+              RealType const I_kl = (k == l) ? 1.0 : 0.0;
+
+              ScalarPack const dsigmadb = I3 * kappa * JJ - I1 * kappa * (JJ - 1.0) +
+                                          2.0 * (I1 - (1.0 / 3.0) * I3) * mubar -
+                                          2.0 / 3.0 * smag * (I_kl * n(i, j) + I_ij * n(k, l));
+
+              for (int lane(0); lane < num_lanes; ++lane) {
+                tangent(cells[lane], pts[lane], i, j, k, l) = dsigmadb[lane];
               }
             }
           }
@@ -122,11 +122,11 @@ RIHMRModel<EvalT, Traits>::computeState(typename Traits::EvalData workset, DepFi
   ScalarT sq23 = std::sqrt(2.0 / 3.0);
 
   // local unknowns and residual vectors
-  std::vector<ScalarT>                R(2);
-  std::vector<ScalarT>                X(2);
-  std::vector<ScalarT>                dRdX(4);
-  ScalarT                             normR0(0.0), normR(0.0), conv(0.0);
-  LocalNonlinearSolver<EvalT, Traits> solver;
+  std::vector<ScalarT>                   R(2);
+  std::vector<ScalarT>                   X(2);
+  std::vector<ScalarT>                   dRdX(4);
+  ScalarT                                normR0(0.0), normR(0.0), conv(0.0);
+  LocalNonlinearSolver<EvalT, Traits, 2> solver;
 
   for (int cell = 0; cell < workset.numCells; ++cell) {
     for (int pt = 0; pt < num_pts_; ++pt) {
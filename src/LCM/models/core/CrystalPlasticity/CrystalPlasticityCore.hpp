@@ -6,6 +6,8 @@
 #define CrystalPlasticityCore_hpp
 
 #include <MiniNonlinearSolver.hpp>
+#include <stdexcept>
+#include <vector>
 
 #include "CrystalPlasticityFwd.hpp"
 #include "FlowRule.hpp"
@@ -32,6 +34,59 @@ struct SlipSystem
   RealType state_hardening_initial_;
 };
 
+//! Non-owning, read-only view of a contiguous range of slip systems.
+//! Lets integrators work on slip systems stored in per-cell scratch
+//! storage without copying them into a std::vector first.
+template <minitensor::Index NumDimT>
+class SlipSystemView
+{
+ public:
+  SlipSystemView(SlipSystem<NumDimT> const* data, std::size_t size) : data_(data), size_(size) {}
+
+  SlipSystemView(std::vector<SlipSystem<NumDimT>> const& slip_systems)
+      : data_(slip_systems.data()), size_(slip_systems.size())
+  {
+  }
+
+  std::size_t
+  size() const
+  {
+    return size_;
+  }
+
+  SlipSystem<NumDimT> const&
+  operator[](std::size_t i) const
+  {
+    return data_[i];
+  }
+
+  SlipSystem<NumDimT> const&
+  at(std::size_t i) const
+  {
+    if (i >= size_) {
+      throw std::out_of_range("SlipSystemView::at");
+    }
+    return data_[i];
+  }
+
+  SlipSystem<NumDimT> const*
+  begin() const
+  {
+    return data_;
+  }
+
+  SlipSystem<NumDimT> const*
+  end() const
+  {
+    return data_ + size_;
+  }
+
+ private:
+  SlipSystem<NumDimT> const* data_;
+
+  std::size_t size_;
+};
+
 // Slip system family - collection of slip systems grouped by flow and
 // hardening characteristics
 template <minitensor::Index NumDimT, minitensor::Index NumSlipT>
@@ -167,7 +222,7 @@ expectFiniteTensor(minitensor::Tensor<T, N> const& A, std::string const& msg);
 template <minitensor::Index NumDimT, minitensor::Index NumSlipT, typename ArgT>
 void
 applySlipIncrement(
-    std::vector<SlipSystem<NumDimT>> const&       slip_systems,
+    SlipSystemView<NumDimT>                       slip_systems,
     RealType                                      dt,
     minitensor::Vector<RealType, NumSlipT> const& slip_n,
     minitensor::Vector<ArgT, NumSlipT> const&     slip_np1,
@@ -179,7 +234,7 @@ applySlipIncrement(
 template <minitensor::Index NumDimT, minitensor::Index NumSlipT, typename ArgT>
 void
 updateHardness(
-    std::vector<SlipSystem<NumDimT>> const&           slip_systems,
+    SlipSystemView<NumDimT>                           slip_systems,
     std::vector<SlipFamily<NumDimT, NumSlipT>> const& slip_families,
     RealType                                          dt,
     minitensor::Vector<ArgT, NumSlipT> const&         rate_slip,
@@ -194,7 +249,7 @@ updateHardness(
 template <minitensor::Index NumDimT, minitensor::Index NumSlipT, typename ArgT>
 void
 updateSlip(
-    std::vector<SlipSystem<NumDimT>> const&           slip_systems,
+    SlipSystemView<NumDimT>                           slip_systems,
     std::vector<SlipFamily<NumDimT, NumSlipT>> const& slip_families,
     RealType                                          dt,
     minitensor::Vector<ArgT, NumSlipT> const&         slip_resistance,
@@ -207,7 +262,7 @@ updateSlip(
 template <minitensor::Index NumDimT, minitensor::Index NumSlipT, typename ArgT>
 void
 computeStress(
-    std::vector<SlipSystem<NumDimT>> const&   slip_systems,
+    SlipSystemView<NumDimT>                   slip_systems,
     minitensor::Tensor4<ArgT, NumDimT> const& C,
     minitensor::Tensor<ArgT, NumDimT> const&  F,
     minitensor::Tensor<ArgT, NumDimT> const&  Fp,
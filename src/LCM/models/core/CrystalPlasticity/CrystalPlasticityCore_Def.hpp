@@ -49,7 +49,7 @@ CP::expectFiniteTensor(minitensor::Tensor<T, N> const& A, std::string const& msg
 template <minitensor::Index NumDimT, minitensor::Index NumSlipT, typename ArgT>
 void
 CP::applySlipIncrement(
-    std::vector<CP::SlipSystem<NumDimT>> const&   slip_systems,
+    CP::SlipSystemView<NumDimT>                   slip_systems,
     RealType                                      dt,
     minitensor::Vector<RealType, NumSlipT> const& slip_n,
     minitensor::Vector<ArgT, NumSlipT> const&     slip_np1,
@@ -99,7 +99,7 @@ CP::applySlipIncrement(
 template <minitensor::Index NumDimT, minitensor::Index NumSlipT, typename ArgT>
 void
 CP::updateHardness(
-    std::vector<CP::SlipSystem<NumDimT>> const&           slip_systems,
+    CP::SlipSystemView<NumDimT>                           slip_systems,
     std::vector<CP::SlipFamily<NumDimT, NumSlipT>> const& slip_families,
     RealType                                              dt,
     minitensor::Vector<ArgT, NumSlipT> const&             rate_slip,
@@ -113,12 +113,16 @@ CP::updateHardness(
 
     auto type_hardening_law = slip_family.getHardeningLawType();
 
-    HardeningLawFactory<NumDimT, NumSlipT> hardening_law_factory;
-
-    auto phardening = hardening_law_factory.template createHardeningLaw<ArgT>(type_hardening_law);
-
-    phardening->harden(
-        slip_family, slip_systems, dt, rate_slip, state_hardening_n, state_hardening_np1, slip_resistance, failed);
+    CP::harden(
+        type_hardening_law,
+        slip_family,
+        slip_systems,
+        dt,
+        rate_slip,
+        state_hardening_n,
+        state_hardening_np1,
+        slip_resistance,
+        failed);
   }
 
   return;
@@ -130,7 +134,7 @@ CP::updateHardness(
 template <minitensor::Index NumDimT, minitensor::Index NumSlipT, typename ArgT>
 void
 CP::updateSlip(
-    std::vector<CP::SlipSystem<NumDimT>> const&           slip_systems,
+    CP::SlipSystemView<NumDimT>                           slip_systems,
     std::vector<CP::SlipFamily<NumDimT, NumSlipT>> const& slip_families,
     RealType                                              dt,
     minitensor::Vector<ArgT, NumSlipT> const&             slip_resistance,
@@ -144,12 +148,8 @@ CP::updateSlip(
 
     auto type_flow_rule = slip_family.getFlowRuleType();
 
-    FlowRuleFactory flow_rule_factory;
-
-    auto pflow = flow_rule_factory.template createFlowRule<ArgT>(type_flow_rule);
-
-    ArgT rate_slip =
-        pflow->computeRateSlip(slip_family.pflow_parameters_, shear[ss_index], slip_resistance[ss_index], failed);
+    ArgT rate_slip = CP::computeRateSlip(
+        type_flow_rule, *slip_family.pflow_parameters_, shear[ss_index], slip_resistance[ss_index], failed);
 
     // return with failed immediately if slip increment is too large
     if (std::abs(rate_slip) > slip_family.pflow_parameters_->max_incr_) {
@@ -169,14 +169,14 @@ CP::updateSlip(
 template <minitensor::Index NumDimT, minitensor::Index NumSlipT, typename ArgT>
 void
 CP::computeStress(
-    std::vector<CP::SlipSystem<NumDimT>> const& slip_systems,
-    minitensor::Tensor4<ArgT, NumDimT> const&   C,
-    minitensor::Tensor<ArgT, NumDimT> const&    F,
-    minitensor::Tensor<ArgT, NumDimT> const&    Fp,
-    minitensor::Tensor<ArgT, NumDimT>&          sigma,
-    minitensor::Tensor<ArgT, NumDimT>&          S,
-    minitensor::Vector<ArgT, NumSlipT>&         shear,
-    bool&                                       failed)
+    CP::SlipSystemView<NumDimT>               slip_systems,
+    minitensor::Tensor4<ArgT, NumDimT> const& C,
+    minitensor::Tensor<ArgT, NumDimT> const&  F,
+    minitensor::Tensor<ArgT, NumDimT> const&  Fp,
+    minitensor::Tensor<ArgT, NumDimT>&        sigma,
+    minitensor::Tensor<ArgT, NumDimT>&        S,
+    minitensor::Vector<ArgT, NumSlipT>&       shear,
+    bool&                                     failed)
 {
   minitensor::Index const num_dim = F.get_dimension();
 
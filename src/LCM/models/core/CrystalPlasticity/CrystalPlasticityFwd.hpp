@@ -72,6 +72,9 @@ struct HardeningParameterBase;
 template <minitensor::Index NumDimT>
 struct SlipSystem;
 
+template <minitensor::Index NumDimT>
+class SlipSystemView;
+
 template <minitensor::Index NumDimT, minitensor::Index NumSlipT>
 struct SlipFamily;
 }  // namespace CP
@@ -47,7 +47,7 @@ struct FlowParameterBase
   }
 
   RealType
-  getParameter(ParamIndex const index_param)
+  getParameter(ParamIndex const index_param) const
   {
     return flow_params_[index_param];
   }
@@ -219,6 +219,24 @@ class FlowRuleFactory
   mutable utility::StaticStackAllocator<sizeof(std::uintptr_t)> allocator_;
 };
 
+/**
+ *  Statically dispatched flow rule.
+ *
+ *  Computes the same slip rate as the flow rule returned by FlowRuleFactory
+ *  for type_flow_rule, but switches on the type instead of going through a
+ *  virtual call, so that the flow rule can be inlined into the slip loops.
+ *
+ *  \tparam ArgT The scalar type for computing the slip rate.
+ */
+template <typename ArgT>
+ArgT
+computeRateSlip(
+    FlowRuleType             type_flow_rule,
+    FlowParameterBase const& flow_parameters,
+    ArgT const&              shear,
+    ArgT const&              slip_resistance,
+    bool&                    failed);
+
 /**
  *  Power Law flow rule.
  *
@@ -227,12 +245,18 @@ class FlowRuleFactory
 template <typename ArgT>
 struct PowerLawFlowRule final : public FlowRuleBase<ArgT>
 {
+  static ArgT
+  evaluate(FlowParameterBase const& flow_parameters, ArgT const& shear, ArgT const& slip_resistance, bool& failed);
+
   virtual ArgT
   computeRateSlip(
       std::shared_ptr<FlowParameterBase> const& pflow_parameters,
       ArgT const&                               shear,
       ArgT const&                               slip_resistance,
-      bool&                                     failed);
+      bool&                                     failed)
+  {
+    return evaluate(*pflow_parameters, shear, slip_resistance, failed);
+  }
 
   virtual ~PowerLawFlowRule() {}
 };
@@ -245,12 +269,18 @@ struct PowerLawFlowRule final : public FlowRuleBase<ArgT>
 template <typename ArgT>
 struct ThermalActivationFlowRule final : public FlowRuleBase<ArgT>
 {
+  static ArgT
+  evaluate(FlowParameterBase const& flow_parameters, ArgT const& shear, ArgT const& slip_resistance, bool& failed);
+
   virtual ArgT
   computeRateSlip(
       std::shared_ptr<FlowParameterBase> const& pflow_parameters,
       ArgT const&                               shear,
       ArgT const&                               slip_resistance,
-      bool&                                     failed);
+      bool&                                     failed)
+  {
+    return evaluate(*pflow_parameters, shear, slip_resistance, failed);
+  }
 
   virtual ~ThermalActivationFlowRule() {}
 };
@@ -263,12 +293,18 @@ struct ThermalActivationFlowRule final : public FlowRuleBase<ArgT>
 template <typename ArgT>
 struct PowerLawDragFlowRule final : public FlowRuleBase<ArgT>
 {
+  static ArgT
+  evaluate(FlowParameterBase const& flow_parameters, ArgT const& shear, ArgT const& slip_resistance, bool& failed);
+
   virtual ArgT
   computeRateSlip(
       std::shared_ptr<FlowParameterBase> const& pflow_parameters,
       ArgT const&                               shear,
       ArgT const&                               slip_resistance,
-      bool&                                     failed);
+      bool&                                     failed)
+  {
+    return evaluate(*pflow_parameters, shear, slip_resistance, failed);
+  }
 
   virtual ~PowerLawDragFlowRule() {}
 };
@@ -281,12 +317,18 @@ struct PowerLawDragFlowRule final : public FlowRuleBase<ArgT>
 template <typename ArgT>
 struct NoFlowRule final : public FlowRuleBase<ArgT>
 {
+  static ArgT
+  evaluate(FlowParameterBase const& flow_parameters, ArgT const& shear, ArgT const& slip_resistance, bool& failed);
+
   virtual ArgT
   computeRateSlip(
       std::shared_ptr<FlowParameterBase> const& pflow_parameters,
       ArgT const&                               shear,
       ArgT const&                               slip_resistance,
-      bool&                                     failed);
+      bool&                                     failed)
+  {
+    return evaluate(*pflow_parameters, shear, slip_resistance, failed);
+  }
 
   virtual ~NoFlowRule() {}
 };
@@ -50,25 +50,57 @@ CP::FlowRuleFactory::createFlowRule(FlowRuleType type_flow_rule) const
   return nullptr;
 }
 
+// Statically dispatched flow rule
+template <typename ArgT>
+inline ArgT
+CP::computeRateSlip(
+    CP::FlowRuleType             type_flow_rule,
+    CP::FlowParameterBase const& flow_parameters,
+    ArgT const&                  shear,
+    ArgT const&                  slip_resistance,
+    bool&                        failed)
+{
+  switch (type_flow_rule) {
+    default:
+      std::cerr << __PRETTY_FUNCTION__ << '\n';
+      std::cerr << "ERROR: Unknown flow rule\n";
+      exit(1);
+      break;
+
+    case FlowRuleType::POWER_LAW:
+      return PowerLawFlowRule<ArgT>::evaluate(flow_parameters, shear, slip_resistance, failed);
+
+    case FlowRuleType::POWER_LAW_DRAG:
+      return PowerLawDragFlowRule<ArgT>::evaluate(flow_parameters, shear, slip_resistance, failed);
+
+    case FlowRuleType::THERMAL_ACTIVATION:
+      return ThermalActivationFlowRule<ArgT>::evaluate(flow_parameters, shear, slip_resistance, failed);
+
+    case FlowRuleType::UNDEFINED: return NoFlowRule<ArgT>::evaluate(flow_parameters, shear, slip_resistance, failed);
+  }
+
+  return 0.;
+}
+
 // Power law flow rule
 template <typename ArgT>
 ArgT
-CP::PowerLawFlowRule<ArgT>::computeRateSlip(
-    std::shared_ptr<CP::FlowParameterBase> const& pflow_parameters,
-    ArgT const&                                   shear,
-    ArgT const&                                   slip_resistance,
-    bool&                                         failed)
+CP::PowerLawFlowRule<ArgT>::evaluate(
+    CP::FlowParameterBase const& flow_parameters,
+    ArgT const&                  shear,
+    ArgT const&                  slip_resistance,
+    bool&                        failed)
 {
   using Params = PowerLawFlowParameters;
 
   // Material properties
-  RealType const m = pflow_parameters->getParameter(Params::EXPONENT_RATE);
+  RealType const m = flow_parameters.getParameter(Params::EXPONENT_RATE);
 
-  RealType const g0 = pflow_parameters->getParameter(Params::RATE_SLIP_REFERENCE);
+  RealType const g0 = flow_parameters.getParameter(Params::RATE_SLIP_REFERENCE);
 
-  RealType const min_tol = pflow_parameters->min_tol_;
+  RealType const min_tol = flow_parameters.min_tol_;
 
-  RealType const max_tol = pflow_parameters->max_tol_;
+  RealType const max_tol = flow_parameters.max_tol_;
 
   ArgT const ratio_stress = shear / slip_resistance;
 
@@ -94,26 +126,26 @@ CP::PowerLawFlowRule<ArgT>::computeRateSlip(
 // Thermally-activated flow rule
 template <typename ArgT>
 ArgT
-CP::ThermalActivationFlowRule<ArgT>::computeRateSlip(
-    std::shared_ptr<CP::FlowParameterBase> const& pflow_parameters,
-    ArgT const&                                   shear,
-    ArgT const&                                   slip_resistance,
-    bool&                                         failed)
+CP::ThermalActivationFlowRule<ArgT>::evaluate(
+    CP::FlowParameterBase const& flow_parameters,
+    ArgT const&                  shear,
+    ArgT const&                  slip_resistance,
+    bool&                        failed)
 {
   using Params = ThermalActivationFlowParameters;
 
   // Material properties
-  RealType const g0 = pflow_parameters->getParameter(Params::RATE_SLIP_REFERENCE);
+  RealType const g0 = flow_parameters.getParameter(Params::RATE_SLIP_REFERENCE);
 
-  RealType const F0 = pflow_parameters->getParameter(Params::ENERGY_ACTIVATION);
+  RealType const F0 = flow_parameters.getParameter(Params::ENERGY_ACTIVATION);
 
-  RealType const s_t = pflow_parameters->getParameter(Params::RESISTANCE_THERMAL);
+  RealType const s_t = flow_parameters.getParameter(Params::RESISTANCE_THERMAL);
 
-  RealType const p = pflow_parameters->getParameter(Params::EXPONENT_P);
+  RealType const p = flow_parameters.getParameter(Params::EXPONENT_P);
 
-  RealType const q = pflow_parameters->getParameter(Params::EXPONENT_Q);
+  RealType const q = flow_parameters.getParameter(Params::EXPONENT_Q);
 
-  RealType const min_tol = pflow_parameters->min_tol_;
+  RealType const min_tol = flow_parameters.min_tol_;
 
   ArgT const ratio_stress = std::max(0.0, (std::fabs(shear) - slip_resistance) / s_t);
 
@@ -133,24 +165,24 @@ CP::ThermalActivationFlowRule<ArgT>::computeRateSlip(
 // Power law with Drag flow rule
 template <typename ArgT>
 ArgT
-CP::PowerLawDragFlowRule<ArgT>::computeRateSlip(
-    std::shared_ptr<CP::FlowParameterBase> const& pflow_parameters,
-    ArgT const&                                   shear,
-    ArgT const&                                   slip_resistance,
-    bool&                                         failed)
+CP::PowerLawDragFlowRule<ArgT>::evaluate(
+    CP::FlowParameterBase const& flow_parameters,
+    ArgT const&                  shear,
+    ArgT const&                  slip_resistance,
+    bool&                        failed)
 {
   using Params = PowerLawDragFlowParameters;
 
   // Material properties
-  RealType const m = pflow_parameters->getParameter(Params::EXPONENT_RATE);
+  RealType const m = flow_parameters.getParameter(Params::EXPONENT_RATE);
 
-  RealType const g0 = pflow_parameters->getParameter(Params::RATE_SLIP_REFERENCE);
+  RealType const g0 = flow_parameters.getParameter(Params::RATE_SLIP_REFERENCE);
 
-  RealType const coefficient_drag = pflow_parameters->getParameter(Params::COEFFICIENT_DRAG);
+  RealType const coefficient_drag = flow_parameters.getParameter(Params::COEFFICIENT_DRAG);
 
-  RealType const min_tol = pflow_parameters->min_tol_;
+  RealType const min_tol = flow_parameters.min_tol_;
 
-  RealType const max_tol = pflow_parameters->max_tol_;
+  RealType const max_tol = flow_parameters.max_tol_;
 
   ArgT const ratio_stress = shear / slip_resistance;
 
@@ -206,11 +238,11 @@ CP::PowerLawDragFlowRule<ArgT>::computeRateSlip(
 // No flow rule
 template <typename ArgT>
 ArgT
-CP::NoFlowRule<ArgT>::computeRateSlip(
-    std::shared_ptr<CP::FlowParameterBase> const& pflow_parameters,
-    ArgT const&                                   shear,
-    ArgT const&                                   slip_resistance,
-    bool&                                         failed)
+CP::NoFlowRule<ArgT>::evaluate(
+    CP::FlowParameterBase const& flow_parameters,
+    ArgT const&                  shear,
+    ArgT const&                  slip_resistance,
+    bool&                        failed)
 {
   return 0.;
 }
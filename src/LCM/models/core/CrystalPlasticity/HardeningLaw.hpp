@@ -49,8 +49,8 @@ struct HardeningParameterBase
 
   virtual void
   createLatentMatrix(
-      SlipFamily<NumDimT, NumSlipT>&          slip_family,
-      std::vector<SlipSystem<NumDimT>> const& slip_systems) = 0;
+      SlipFamily<NumDimT, NumSlipT>& slip_family,
+      SlipSystemView<NumDimT>        slip_systems) = 0;
 
   void
   setParameter(ParamIndex const index_param, RealType const value_param)
@@ -59,7 +59,7 @@ struct HardeningParameterBase
   }
 
   RealType
-  getParameter(ParamIndex const index_param)
+  getParameter(ParamIndex const index_param) const
   {
     return hardening_params_[index_param];
   }
@@ -118,7 +118,7 @@ struct LinearMinusRecoveryHardeningParameters final : public HardeningParameterB
   }
 
   virtual void
-  createLatentMatrix(SlipFamily<NumDimT, NumSlipT>& slip_family, std::vector<SlipSystem<NumDimT>> const& slip_systems)
+  createLatentMatrix(SlipFamily<NumDimT, NumSlipT>& slip_family, SlipSystemView<NumDimT> slip_systems)
       override;
 
   virtual void
@@ -184,7 +184,7 @@ struct SaturationHardeningParameters final : public HardeningParameterBase<NumDi
   }
 
   virtual void
-  createLatentMatrix(SlipFamily<NumDimT, NumSlipT>& slip_family, std::vector<SlipSystem<NumDimT>> const& slip_systems)
+  createLatentMatrix(SlipFamily<NumDimT, NumSlipT>& slip_family, SlipSystemView<NumDimT> slip_systems)
       override;
 
   virtual void
@@ -240,7 +240,7 @@ struct DislocationDensityHardeningParameters final : public HardeningParameterBa
   }
 
   virtual void
-  createLatentMatrix(SlipFamily<NumDimT, NumSlipT>& slip_family, std::vector<SlipSystem<NumDimT>> const& slip_systems)
+  createLatentMatrix(SlipFamily<NumDimT, NumSlipT>& slip_family, SlipSystemView<NumDimT> slip_systems)
       override;
 
   virtual void
@@ -274,7 +274,7 @@ struct NoHardeningParameters final : public HardeningParameterBase<NumDimT, NumS
   }
 
   virtual void
-  createLatentMatrix(SlipFamily<NumDimT, NumSlipT>& slip_family, std::vector<SlipSystem<NumDimT>> const& slip_systems)
+  createLatentMatrix(SlipFamily<NumDimT, NumSlipT>& slip_family, SlipSystemView<NumDimT> slip_systems)
       override;
 
   virtual void
@@ -302,7 +302,7 @@ struct HardeningLawBase
   virtual void
   harden(
       SlipFamily<NumDimT, NumSlipT> const&          slip_family,
-      std::vector<SlipSystem<NumDimT>> const&       slip_systems,
+      SlipSystemView<NumDimT>                       slip_systems,
       RealType                                      dt,
       minitensor::Vector<ArgT, NumSlipT> const&     rate_slip,
       minitensor::Vector<RealType, NumSlipT> const& state_hardening_n,
@@ -330,6 +330,31 @@ class HardeningLawFactory
   mutable utility::StaticStackAllocator<sizeof(std::uintptr_t)> allocator_;
 };
 
+/**
+ *  Statically dispatched hardening law.
+ *
+ *  Evolves the hardness exactly as the hardening law returned by
+ *  HardeningLawFactory for type_hardening_law, but switches on the type
+ *  instead of going through a virtual call, so that the hardening law can be
+ *  inlined into the caller.
+ *
+ *	\tparam	NumDimT		Static number of elements in a slip system
+ *	\tparam NumSlipT	Static number of slip systems in a slip family
+ *	\tparam ArgT		Scalar type used for hardening
+ */
+template <minitensor::Index NumDimT, minitensor::Index NumSlipT, typename ArgT>
+void
+harden(
+    HardeningLawType                              type_hardening_law,
+    SlipFamily<NumDimT, NumSlipT> const&          slip_family,
+    SlipSystemView<NumDimT>                       slip_systems,
+    RealType                                      dt,
+    minitensor::Vector<ArgT, NumSlipT> const&     rate_slip,
+    minitensor::Vector<RealType, NumSlipT> const& state_hardening_n,
+    minitensor::Vector<ArgT, NumSlipT>&           state_hardening_np1,
+    minitensor::Vector<ArgT, NumSlipT>&           slip_resistance,
+    bool&                                         failed);
+
 /**
  *  Linear hardening with recovery law.
  *
@@ -340,16 +365,31 @@ class HardeningLawFactory
 template <minitensor::Index NumDimT, minitensor::Index NumSlipT, typename ArgT>
 struct LinearMinusRecoveryHardeningLaw final : public HardeningLawBase<NumDimT, NumSlipT, ArgT>
 {
+  static void
+  evaluate(
+      SlipFamily<NumDimT, NumSlipT> const&          slip_family,
+      SlipSystemView<NumDimT>                       slip_systems,
+      RealType                                      dt,
+      minitensor::Vector<ArgT, NumSlipT> const&     rate_slip,
+      minitensor::Vector<RealType, NumSlipT> const& state_hardening_n,
+      minitensor::Vector<ArgT, NumSlipT>&           state_hardening_np1,
+      minitensor::Vector<ArgT, NumSlipT>&           slip_resistance,
+      bool&                                         failed);
+
   virtual void
   harden(
       SlipFamily<NumDimT, NumSlipT> const&          slip_family,
-      std::vector<SlipSystem<NumDimT>> const&       slip_systems,
+      SlipSystemView<NumDimT>                       slip_systems,
       RealType                                      dt,
       minitensor::Vector<ArgT, NumSlipT> const&     rate_slip,
       minitensor::Vector<RealType, NumSlipT> const& state_hardening_n,
       minitensor::Vector<ArgT, NumSlipT>&           state_hardening_np1,
       minitensor::Vector<ArgT, NumSlipT>&           slip_resistance,
-      bool&                                         failed);
+      bool&                                         failed)
+  {
+    evaluate(
+        slip_family, slip_systems, dt, rate_slip, state_hardening_n, state_hardening_np1, slip_resistance, failed);
+  }
 
   virtual ~LinearMinusRecoveryHardeningLaw() {}
 };
@@ -364,16 +404,31 @@ struct LinearMinusRecoveryHardeningLaw final : public HardeningLawBase<NumDimT,
 template <minitensor::Index NumDimT, minitensor::Index NumSlipT, typename ArgT>
 struct SaturationHardeningLaw final : public HardeningLawBase<NumDimT, NumSlipT, ArgT>
 {
+  static void
+  evaluate(
+      SlipFamily<NumDimT, NumSlipT> const&          slip_family,
+      SlipSystemView<NumDimT>                       slip_systems,
+      RealType                                      dt,
+      minitensor::Vector<ArgT, NumSlipT> const&     rate_slip,
+      minitensor::Vector<RealType, NumSlipT> const& state_hardening_n,
+      minitensor::Vector<ArgT, NumSlipT>&           state_hardening_np1,
+      minitensor::Vector<ArgT, NumSlipT>&           slip_resistance,
+      bool&                                         failed);
+
   virtual void
   harden(
       SlipFamily<NumDimT, NumSlipT> const&          slip_family,
-      std::vector<SlipSystem<NumDimT>> const&       slip_systems,
+      SlipSystemView<NumDimT>                       slip_systems,
       RealType                                      dt,
       minitensor::Vector<ArgT, NumSlipT> const&     rate_slip,
       minitensor::Vector<RealType, NumSlipT> const& state_hardening_n,
       minitensor::Vector<ArgT, NumSlipT>&           state_hardening_np1,
       minitensor::Vector<ArgT, NumSlipT>&           slip_resistance,
-      bool&                                         failed);
+      bool&                                         failed)
+  {
+    evaluate(
+        slip_family, slip_systems, dt, rate_slip, state_hardening_n, state_hardening_np1, slip_resistance, failed);
+  }
 
   virtual ~SaturationHardeningLaw() {}
 };
@@ -388,16 +443,31 @@ struct SaturationHardeningLaw final : public HardeningLawBase<NumDimT, NumSlipT,
 template <minitensor::Index NumDimT, minitensor::Index NumSlipT, typename ArgT>
 struct DislocationDensityHardeningLaw final : public HardeningLawBase<NumDimT, NumSlipT, ArgT>
 {
+  static void
+  evaluate(
+      SlipFamily<NumDimT, NumSlipT> const&          slip_family,
+      SlipSystemView<NumDimT>                       slip_systems,
+      RealType                                      dt,
+      minitensor::Vector<ArgT, NumSlipT> const&     rate_slip,
+      minitensor::Vector<RealType, NumSlipT> const& state_hardening_n,
+      minitensor::Vector<ArgT, NumSlipT>&           state_hardening_np1,
+      minitensor::Vector<ArgT, NumSlipT>&           slip_resistance,
+      bool&                                         failed);
+
   virtual void
   harden(
       SlipFamily<NumDimT, NumSlipT> const&          slip_family,
-      std::vector<SlipSystem<NumDimT>> const&       slip_systems,
+      SlipSystemView<NumDimT>                       slip_systems,
       RealType                                      dt,
       minitensor::Vector<ArgT, NumSlipT> const&     rate_slip,
       minitensor::Vector<RealType, NumSlipT> const& state_hardening_n,
       minitensor::Vector<ArgT, NumSlipT>&           state_hardening_np1,
       minitensor::Vector<ArgT, NumSlipT>&           slip_resistance,
-      bool&                                         failed);
+      bool&                                         failed)
+  {
+    evaluate(
+        slip_family, slip_systems, dt, rate_slip, state_hardening_n, state_hardening_np1, slip_resistance, failed);
+  }
 
   virtual ~DislocationDensityHardeningLaw() {}
 };
@@ -412,16 +482,31 @@ struct DislocationDensityHardeningLaw final : public HardeningLawBase<NumDimT, N
 template <minitensor::Index NumDimT, minitensor::Index NumSlipT, typename ArgT>
 struct NoHardeningLaw final : public HardeningLawBase<NumDimT, NumSlipT, ArgT>
 {
+  static void
+  evaluate(
+      SlipFamily<NumDimT, NumSlipT> const&          slip_family,
+      SlipSystemView<NumDimT>                       slip_systems,
+      RealType                                      dt,
+      minitensor::Vector<ArgT, NumSlipT> const&     rate_slip,
+      minitensor::Vector<RealType, NumSlipT> const& state_hardening_n,
+      minitensor::Vector<ArgT, NumSlipT>&           state_hardening_np1,
+      minitensor::Vector<ArgT, NumSlipT>&           slip_resistance,
+      bool&                                         failed);
+
   virtual void
   harden(
       SlipFamily<NumDimT, NumSlipT> const&          slip_family,
-      std::vector<SlipSystem<NumDimT>> const&       slip_systems,
+      SlipSystemView<NumDimT>                       slip_systems,
       RealType                                      dt,
       minitensor::Vector<ArgT, NumSlipT> const&     rate_slip,
       minitensor::Vector<RealType, NumSlipT> const& state_hardening_n,
       minitensor::Vector<ArgT, NumSlipT>&           state_hardening_np1,
       minitensor::Vector<ArgT, NumSlipT>&           slip_resistance,
-      bool&                                         failed);
+      bool&                                         failed)
+  {
+    evaluate(
+        slip_family, slip_systems, dt, rate_slip, state_hardening_n, state_hardening_np1, slip_resistance, failed);
+  }
 
   virtual ~NoHardeningLaw() {}
 };
@@ -67,12 +67,55 @@ CP::HardeningLawFactory<NumDimT, NumSlipT>::createHardeningLaw(HardeningLawType
   return nullptr;
 }
 
+// Statically dispatched hardening law
+template <minitensor::Index NumDimT, minitensor::Index NumSlipT, typename ArgT>
+inline void
+CP::harden(
+    CP::HardeningLawType                          type_hardening_law,
+    CP::SlipFamily<NumDimT, NumSlipT> const&      slip_family,
+    CP::SlipSystemView<NumDimT>                   slip_systems,
+    RealType                                      dt,
+    minitensor::Vector<ArgT, NumSlipT> const&     rate_slip,
+    minitensor::Vector<RealType, NumSlipT> const& state_hardening_n,
+    minitensor::Vector<ArgT, NumSlipT>&           state_hardening_np1,
+    minitensor::Vector<ArgT, NumSlipT>&           slip_resistance,
+    bool&                                         failed)
+{
+  switch (type_hardening_law) {
+    default:
+      std::cerr << __PRETTY_FUNCTION__ << '\n';
+      std::cerr << "ERROR: Unknown hardening law\n";
+      exit(1);
+      break;
+
+    case HardeningLawType::LINEAR_MINUS_RECOVERY:
+      LinearMinusRecoveryHardeningLaw<NumDimT, NumSlipT, ArgT>::evaluate(
+          slip_family, slip_systems, dt, rate_slip, state_hardening_n, state_hardening_np1, slip_resistance, failed);
+      break;
+
+    case HardeningLawType::SATURATION:
+      SaturationHardeningLaw<NumDimT, NumSlipT, ArgT>::evaluate(
+          slip_family, slip_systems, dt, rate_slip, state_hardening_n, state_hardening_np1, slip_resistance, failed);
+      break;
+
+    case HardeningLawType::DISLOCATION_DENSITY:
+      DislocationDensityHardeningLaw<NumDimT, NumSlipT, ArgT>::evaluate(
+          slip_family, slip_systems, dt, rate_slip, state_hardening_n, state_hardening_np1, slip_resistance, failed);
+      break;
+
+    case HardeningLawType::UNDEFINED:
+      NoHardeningLaw<NumDimT, NumSlipT, ArgT>::evaluate(
+          slip_family, slip_systems, dt, rate_slip, state_hardening_n, state_hardening_np1, slip_resistance, failed);
+      break;
+  }
+}
+
 // Linear hardening with recovery
 template <minitensor::Index NumDimT, minitensor::Index NumSlipT>
 void
 CP::LinearMinusRecoveryHardeningParameters<NumDimT, NumSlipT>::createLatentMatrix(
-    CP::SlipFamily<NumDimT, NumSlipT>&          slip_family,
-    std::vector<CP::SlipSystem<NumDimT>> const& slip_systems)
+    CP::SlipFamily<NumDimT, NumSlipT>& slip_family,
+    CP::SlipSystemView<NumDimT>        slip_systems)
 {
   slip_family.latent_matrix_.set_dimension(slip_family.num_slip_sys_);
   slip_family.latent_matrix_.fill(minitensor::Filler::ONES);
@@ -82,9 +125,9 @@ CP::LinearMinusRecoveryHardeningParameters<NumDimT, NumSlipT>::createLatentMatri
 
 template <minitensor::Index NumDimT, minitensor::Index NumSlipT, typename ArgT>
 void
-CP::LinearMinusRecoveryHardeningLaw<NumDimT, NumSlipT, ArgT>::harden(
+CP::LinearMinusRecoveryHardeningLaw<NumDimT, NumSlipT, ArgT>::evaluate(
     CP::SlipFamily<NumDimT, NumSlipT> const&      slip_family,
-    std::vector<CP::SlipSystem<NumDimT>> const&   slip_systems,
+    CP::SlipSystemView<NumDimT>                   slip_systems,
     RealType                                      dt,
     minitensor::Vector<ArgT, NumSlipT> const&     rate_slip,
     minitensor::Vector<RealType, NumSlipT> const& state_hardening_n,
@@ -149,8 +192,8 @@ CP::LinearMinusRecoveryHardeningLaw<NumDimT, NumSlipT, ArgT>::harden(
 template <minitensor::Index NumDimT, minitensor::Index NumSlipT>
 void
 CP::SaturationHardeningParameters<NumDimT, NumSlipT>::createLatentMatrix(
-    CP::SlipFamily<NumDimT, NumSlipT>&          slip_family,
-    std::vector<CP::SlipSystem<NumDimT>> const& slip_systems)
+    CP::SlipFamily<NumDimT, NumSlipT>& slip_family,
+    CP::SlipSystemView<NumDimT>        slip_systems)
 {
   slip_family.latent_matrix_.set_dimension(slip_family.num_slip_sys_);
   slip_family.latent_matrix_.fill(minitensor::Filler::ZEROS);
@@ -171,9 +214,9 @@ CP::SaturationHardeningParameters<NumDimT, NumSlipT>::createLatentMatrix(
 
 template <minitensor::Index NumDimT, minitensor::Index NumSlipT, typename ArgT>
 void
-CP::SaturationHardeningLaw<NumDimT, NumSlipT, ArgT>::harden(
+CP::SaturationHardeningLaw<NumDimT, NumSlipT, ArgT>::evaluate(
     CP::SlipFamily<NumDimT, NumSlipT> const&      slip_family,
-    std::vector<CP::SlipSystem<NumDimT>> const&   slip_systems,
+    CP::SlipSystemView<NumDimT>                   slip_systems,
     RealType                                      dt,
     minitensor::Vector<ArgT, NumSlipT> const&     rate_slip,
     minitensor::Vector<RealType, NumSlipT> const& state_hardening_n,
@@ -276,8 +319,8 @@ CP::SaturationHardeningLaw<NumDimT, NumSlipT, ArgT>::harden(
 template <minitensor::Index NumDimT, minitensor::Index NumSlipT>
 void
 CP::DislocationDensityHardeningParameters<NumDimT, NumSlipT>::createLatentMatrix(
-    CP::SlipFamily<NumDimT, NumSlipT>&          slip_family,
-    std::vector<CP::SlipSystem<NumDimT>> const& slip_systems)
+    CP::SlipFamily<NumDimT, NumSlipT>& slip_family,
+    CP::SlipSystemView<NumDimT>        slip_systems)
 {
   minitensor::Index const num_dim = slip_systems[0].s_.get_dimension();
 
@@ -320,9 +363,9 @@ CP::DislocationDensityHardeningParameters<NumDimT, NumSlipT>::createLatentMatrix
 
 template <minitensor::Index NumDimT, minitensor::Index NumSlipT, typename ArgT>
 void
-CP::DislocationDensityHardeningLaw<NumDimT, NumSlipT, ArgT>::harden(
+CP::DislocationDensityHardeningLaw<NumDimT, NumSlipT, ArgT>::evaluate(
     CP::SlipFamily<NumDimT, NumSlipT> const&      slip_family,
-    std::vector<CP::SlipSystem<NumDimT>> const&   slip_systems,
+    CP::SlipSystemView<NumDimT>                   slip_systems,
     RealType                                      dt,
     minitensor::Vector<ArgT, NumSlipT> const&     rate_slip,
     minitensor::Vector<RealType, NumSlipT> const& state_hardening_n,
@@ -409,8 +452,8 @@ CP::DislocationDensityHardeningLaw<NumDimT, NumSlipT, ArgT>::harden(
 template <minitensor::Index NumDimT, minitensor::Index NumSlipT>
 void
 CP::NoHardeningParameters<NumDimT, NumSlipT>::createLatentMatrix(
-    CP::SlipFamily<NumDimT, NumSlipT>&          slip_family,
-    std::vector<CP::SlipSystem<NumDimT>> const& slip_systems)
+    CP::SlipFamily<NumDimT, NumSlipT>& slip_family,
+    CP::SlipSystemView<NumDimT>        slip_systems)
 {
   slip_family.latent_matrix_.set_dimension(slip_family.num_slip_sys_);
   slip_family.latent_matrix_.fill(minitensor::Filler::ZEROS);
@@ -420,9 +463,9 @@ CP::NoHardeningParameters<NumDimT, NumSlipT>::createLatentMatrix(
 
 template <minitensor::Index NumDimT, minitensor::Index NumSlipT, typename ArgT>
 void
-CP::NoHardeningLaw<NumDimT, NumSlipT, ArgT>::harden(
+CP::NoHardeningLaw<NumDimT, NumSlipT, ArgT>::evaluate(
     CP::SlipFamily<NumDimT, NumSlipT> const&      slip_family,
-    std::vector<CP::SlipSystem<NumDimT>> const&   slip_systems,
+    CP::SlipSystemView<NumDimT>                   slip_systems,
     RealType                                      dt,
     minitensor::Vector<ArgT, NumSlipT> const&     rate_slip,
     minitensor::Vector<RealType, NumSlipT> const& state_hardening_n,
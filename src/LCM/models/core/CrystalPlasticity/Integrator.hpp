@@ -20,7 +20,7 @@ class Integrator
   using ScalarT = typename EvalT::ScalarT;
   Integrator(
       Teuchos::RCP<NOX::StatusTest::ModelEvaluatorFlag>     nox_status_test,
-      std::vector<CP::SlipSystem<NumDimT>> const&           slip_systems,
+      CP::SlipSystemView<NumDimT>                           slip_systems,
       std::vector<CP::SlipFamily<NumDimT, NumSlipT>> const& slip_families,
       StateMechanical<ScalarT, NumDimT>&                    state_mechanical,
       StateInternal<ScalarT, NumSlipT>&                     state_internal,
@@ -88,7 +88,7 @@ class Integrator
 
   mutable RealType norm_residual_;
 
-  std::vector<SlipSystem<NumDimT>> const& slip_systems_;
+  SlipSystemView<NumDimT> slip_systems_;
 
   std::vector<SlipFamily<NumDimT, NumSlipT>> const& slip_families_;
 
@@ -119,7 +119,7 @@ class IntegratorFactory
       const RolMinimizer&                                   rol_minimizer,
       minitensor::StepType                                  step_type,
       Teuchos::RCP<NOX::StatusTest::ModelEvaluatorFlag>     nox_status_test,
-      std::vector<CP::SlipSystem<NumDimT>> const&           slip_systems,
+      CP::SlipSystemView<NumDimT>                           slip_systems,
       std::vector<CP::SlipFamily<NumDimT, NumSlipT>> const& slip_families,
       CP::StateMechanical<ScalarT, NumDimT>&                state_mechanical,
       CP::StateInternal<ScalarT, NumSlipT>&                 state_internal,
@@ -141,7 +141,7 @@ class IntegratorFactory
 
   Teuchos::RCP<NOX::StatusTest::ModelEvaluatorFlag> nox_status_test_;
 
-  std::vector<CP::SlipSystem<NumDimT>> const& slip_systems_;
+  CP::SlipSystemView<NumDimT> slip_systems_;
 
   std::vector<CP::SlipFamily<NumDimT, NumSlipT>> const& slip_families_;
 
@@ -165,7 +165,7 @@ class ExplicitIntegrator : public Integrator<EvalT, NumDimT, NumSlipT>
 
   ExplicitIntegrator(
       Teuchos::RCP<NOX::StatusTest::ModelEvaluatorFlag>     nox_status_test,
-      std::vector<CP::SlipSystem<NumDimT>> const&           slip_systems,
+      CP::SlipSystemView<NumDimT>                           slip_systems,
       std::vector<CP::SlipFamily<NumDimT, NumSlipT>> const& slip_families,
       StateMechanical<ScalarT, NumDimT>&                    state_mechanical,
       StateInternal<ScalarT, NumSlipT>&                     state_internal,
@@ -201,7 +201,7 @@ class ImplicitIntegrator : public Integrator<EvalT, NumDimT, NumSlipT>
       const RolMinimizer&                                   rol_minimizer,
       minitensor::StepType                                  step_type,
       Teuchos::RCP<NOX::StatusTest::ModelEvaluatorFlag>     nox_status_test,
-      std::vector<CP::SlipSystem<NumDimT>> const&           slip_systems,
+      CP::SlipSystemView<NumDimT>                           slip_systems,
       std::vector<CP::SlipFamily<NumDimT, NumSlipT>> const& slip_families,
       StateMechanical<ScalarT, NumDimT>&                    state_mechanical,
       StateInternal<ScalarT, NumSlipT>&                     state_internal,
@@ -245,7 +245,7 @@ class ImplicitSlipIntegrator : public ImplicitIntegrator<EvalT, NumDimT, NumSlip
       const RolMinimizer&                                   rol_minimizer,
       minitensor::StepType                                  step_type,
       Teuchos::RCP<NOX::StatusTest::ModelEvaluatorFlag>     nox_status_test,
-      std::vector<CP::SlipSystem<NumDimT>> const&           slip_systems,
+      CP::SlipSystemView<NumDimT>                           slip_systems,
       std::vector<CP::SlipFamily<NumDimT, NumSlipT>> const& slip_families,
       StateMechanical<ScalarT, NumDimT>&                    state_mechanical,
       StateInternal<ScalarT, NumSlipT>&                     state_internal,
@@ -284,7 +284,7 @@ class ImplicitSlipHardnessIntegrator : public ImplicitIntegrator<EvalT, NumDimT,
       const RolMinimizer&                                   rol_minimizer,
       minitensor::StepType                                  step_type,
       Teuchos::RCP<NOX::StatusTest::ModelEvaluatorFlag>     nox_status_test,
-      std::vector<CP::SlipSystem<NumDimT>> const&           slip_systems,
+      CP::SlipSystemView<NumDimT>                           slip_systems,
       std::vector<CP::SlipFamily<NumDimT, NumSlipT>> const& slip_families,
       StateMechanical<ScalarT, NumDimT>&                    state_mechanical,
       StateInternal<ScalarT, NumSlipT>&                     state_internal,
@@ -323,7 +323,7 @@ class ImplicitConstrainedSlipHardnessIntegrator : public ImplicitIntegrator<Eval
       const RolMinimizer&                                   rol_minimizer,
       minitensor::StepType                                  step_type,
       Teuchos::RCP<NOX::StatusTest::ModelEvaluatorFlag>     nox_status_test,
-      std::vector<CP::SlipSystem<NumDimT>> const&           slip_systems,
+      CP::SlipSystemView<NumDimT>                           slip_systems,
       std::vector<CP::SlipFamily<NumDimT, NumSlipT>> const& slip_families,
       StateMechanical<ScalarT, NumDimT>&                    state_mechanical,
       StateInternal<ScalarT, NumSlipT>&                     state_internal,
@@ -28,7 +28,7 @@ CP::IntegratorFactory<EvalT, NumDimT, NumSlipT>::IntegratorFactory(
     RolMinimizer const&                                   rol_minimizer,
     minitensor::StepType                                  step_type,
     Teuchos::RCP<NOX::StatusTest::ModelEvaluatorFlag>     nox_status_test,
-    std::vector<CP::SlipSystem<NumDimT>> const&           slip_systems,
+    CP::SlipSystemView<NumDimT>                           slip_systems,
     std::vector<CP::SlipFamily<NumDimT, NumSlipT>> const& slip_families,
     CP::StateMechanical<ScalarT, NumDimT>&                state_mechanical,
     CP::StateInternal<ScalarT, NumSlipT>&                 state_internal,
@@ -135,7 +135,7 @@ CP::IntegratorFactory<EvalT, NumDimT, NumSlipT>::operator()(
 template <typename EvalT, minitensor::Index NumDimT, minitensor::Index NumSlipT>
 CP::ExplicitIntegrator<EvalT, NumDimT, NumSlipT>::ExplicitIntegrator(
     Teuchos::RCP<NOX::StatusTest::ModelEvaluatorFlag>     nox_status_test,
-    std::vector<CP::SlipSystem<NumDimT>> const&           slip_systems,
+    CP::SlipSystemView<NumDimT>                           slip_systems,
     std::vector<CP::SlipFamily<NumDimT, NumSlipT>> const& slip_families,
     StateMechanical<ScalarT, NumDimT>&                    state_mechanical,
     StateInternal<ScalarT, NumSlipT>&                     state_internal,
@@ -274,7 +274,7 @@ CP::ImplicitIntegrator<EvalT, NumDimT, NumSlipT>::ImplicitIntegrator(
     RolMinimizer const&                                   rol_minimizer,
     minitensor::StepType                                  step_type,
     Teuchos::RCP<NOX::StatusTest::ModelEvaluatorFlag>     nox_status_test,
-    std::vector<CP::SlipSystem<NumDimT>> const&           slip_systems,
+    CP::SlipSystemView<NumDimT>                           slip_systems,
     std::vector<CP::SlipFamily<NumDimT, NumSlipT>> const& slip_families,
     StateMechanical<ScalarT, NumDimT>&                    state_mechanical,
     StateInternal<ScalarT, NumSlipT>&                     state_internal,
@@ -414,7 +414,7 @@ CP::ImplicitSlipIntegrator<EvalT, NumDimT, NumSlipT>::ImplicitSlipIntegrator(
     RolMinimizer const&                                   rol_minimizer,
     minitensor::StepType                                  step_type,
     Teuchos::RCP<NOX::StatusTest::ModelEvaluatorFlag>     nox_status_test,
-    std::vector<CP::SlipSystem<NumDimT>> const&           slip_systems,
+    CP::SlipSystemView<NumDimT>                           slip_systems,
     std::vector<CP::SlipFamily<NumDimT, NumSlipT>> const& slip_families,
     StateMechanical<ScalarT, NumDimT>&                    state_mechanical,
     StateInternal<ScalarT, NumSlipT>&                     state_internal,
@@ -547,7 +547,7 @@ CP::ImplicitSlipHardnessIntegrator<EvalT, NumDimT, NumSlipT>::ImplicitSlipHardne
     const RolMinimizer&                                   rol_minimizer,
     minitensor::StepType                                  step_type,
     Teuchos::RCP<NOX::StatusTest::ModelEvaluatorFlag>     nox_status_test,
-    std::vector<CP::SlipSystem<NumDimT>> const&           slip_systems,
+    CP::SlipSystemView<NumDimT>                           slip_systems,
     std::vector<CP::SlipFamily<NumDimT, NumSlipT>> const& slip_families,
     StateMechanical<ScalarT, NumDimT>&                    state_mechanical,
     StateInternal<ScalarT, NumSlipT>&                     state_internal,
@@ -701,7 +701,7 @@ CP::ImplicitConstrainedSlipHardnessIntegrator<EvalT, NumDimT, NumSlipT>::Implici
     const RolMinimizer&                                   rol_minimizer,
     minitensor::StepType                                  step_type,
     Teuchos::RCP<NOX::StatusTest::ModelEvaluatorFlag>     nox_status_test,
-    std::vector<CP::SlipSystem<NumDimT>> const&           slip_systems,
+    CP::SlipSystemView<NumDimT>                           slip_systems,
     std::vector<CP::SlipFamily<NumDimT, NumSlipT>> const& slip_families,
     StateMechanical<ScalarT, NumDimT>&                    state_mechanical,
     StateInternal<ScalarT, NumSlipT>&                     state_internal,
@@ -24,7 +24,7 @@ class ResidualSlipNLS
   //! Constructor.
   ResidualSlipNLS(
       minitensor::Tensor4<ScalarT, NumDimT> const&      C,
-      std::vector<SlipSystem<NumDimT>> const&           slip_systems,
+      SlipSystemView<NumDimT>                           slip_systems,
       std::vector<SlipFamily<NumDimT, NumSlipT>> const& slip_families,
       minitensor::Tensor<RealType, NumDimT> const&      Fp_n,
       minitensor::Vector<RealType, NumSlipT> const&     state_hardening_n,
@@ -60,7 +60,7 @@ class ResidualSlipNLS
 
   minitensor::Tensor4<ScalarT, NumDimT> const& C_;
 
-  std::vector<SlipSystem<NumDimT>> const& slip_systems_;
+  SlipSystemView<NumDimT> slip_systems_;
 
   std::vector<SlipFamily<NumDimT, NumSlipT>> const& slip_families_;
 
@@ -88,7 +88,7 @@ class Dissipation
  public:
   //! Constructor.
   Dissipation(
-      std::vector<CP::SlipSystem<NumDimT>> const&           slip_systems,
+      CP::SlipSystemView<NumDimT>                           slip_systems,
       std::vector<CP::SlipFamily<NumDimT, NumSlipT>> const& slip_families,
       minitensor::Vector<RealType, NumSlipT> const&         state_hardening_n,
       minitensor::Vector<RealType, NumSlipT> const&         slip_n,
@@ -122,7 +122,7 @@ class Dissipation
 
   RealType num_slip_;
 
-  std::vector<SlipSystem<NumDimT>> const& slip_systems_;
+  SlipSystemView<NumDimT> slip_systems_;
 
   std::vector<SlipFamily<NumDimT, NumSlipT>> const& slip_families_;
 
@@ -153,7 +153,7 @@ class ResidualSlipHardnessNLS : public minitensor::Function_Base<
   //! Constructor.
   ResidualSlipHardnessNLS(
       minitensor::Tensor4<ScalarT, NumDimT> const&      C,
-      std::vector<SlipSystem<NumDimT>> const&           slip_systems,
+      SlipSystemView<NumDimT>                           slip_systems,
       std::vector<SlipFamily<NumDimT, NumSlipT>> const& slip_families,
       minitensor::Tensor<RealType, NumDimT> const&      Fp_n,
       minitensor::Vector<RealType, NumSlipT> const&     state_hardening_n,
@@ -192,7 +192,7 @@ class ResidualSlipHardnessNLS : public minitensor::Function_Base<
 
   minitensor::Tensor4<ScalarT, NumDimT> const& C_;
 
-  std::vector<SlipSystem<NumDimT>> const& slip_systems_;
+  SlipSystemView<NumDimT> slip_systems_;
 
   std::vector<SlipFamily<NumDimT, NumSlipT>> const& slip_families_;
 
@@ -225,7 +225,7 @@ class ResidualSlipHardnessFN : public minitensor::Function_Base<
 
   ResidualSlipHardnessFN(
       minitensor::Tensor4<ScalarT, NumDimT> const&      C,
-      std::vector<SlipSystem<NumDimT>> const&           slip_systems,
+      SlipSystemView<NumDimT>                           slip_systems,
       std::vector<SlipFamily<NumDimT, NumSlipT>> const& slip_families,
       minitensor::Tensor<RealType, NumDimT> const&      Fp_n,
       minitensor::Vector<RealType, NumSlipT> const&     state_hardening_n,
@@ -261,7 +261,7 @@ class ResidualSlipHardnessFN : public minitensor::Function_Base<
 
   minitensor::Tensor4<ScalarT, NumDimT> const& C_;
 
-  std::vector<SlipSystem<NumDimT>> const& slip_systems_;
+  SlipSystemView<NumDimT> slip_systems_;
 
   std::vector<SlipFamily<NumDimT, NumSlipT>> const& slip_families_;
 
@@ -8,7 +8,7 @@
 template <minitensor::Index NumDimT, minitensor::Index NumSlipT, typename EvalT>
 CP::ResidualSlipNLS<NumDimT, NumSlipT, EvalT>::ResidualSlipNLS(
     minitensor::Tensor4<ScalarT, NumDimT> const&          C,
-    std::vector<CP::SlipSystem<NumDimT>> const&           slip_systems,
+    CP::SlipSystemView<NumDimT>                           slip_systems,
     std::vector<CP::SlipFamily<NumDimT, NumSlipT>> const& slip_families,
     minitensor::Tensor<RealType, NumDimT> const&          Fp_n,
     minitensor::Vector<RealType, NumSlipT> const&         state_hardening_n,
@@ -145,7 +145,7 @@ CP::ResidualSlipNLS<NumDimT, NumSlipT, EvalT>::hessian(minitensor::Vector<T, N>
 // Define nonlinear system for plastic power for slip update
 template <minitensor::Index NumDimT, minitensor::Index NumSlipT, typename EvalT>
 CP::Dissipation<NumDimT, NumSlipT, EvalT>::Dissipation(
-    std::vector<CP::SlipSystem<NumDimT>> const&           slip_systems,
+    CP::SlipSystemView<NumDimT>                           slip_systems,
     std::vector<CP::SlipFamily<NumDimT, NumSlipT>> const& slip_families,
     minitensor::Vector<RealType, NumSlipT> const&         state_hardening_n,
     minitensor::Vector<RealType, NumSlipT> const&         slip_n,
@@ -233,7 +233,7 @@ CP::Dissipation<NumDimT, NumSlipT, EvalT>::hessian(minitensor::Vector<T, N> cons
 template <minitensor::Index NumDimT, minitensor::Index NumSlipT, typename EvalT>
 CP::ResidualSlipHardnessNLS<NumDimT, NumSlipT, EvalT>::ResidualSlipHardnessNLS(
     minitensor::Tensor4<ScalarT, NumDimT> const&          C,
-    std::vector<CP::SlipSystem<NumDimT>> const&           slip_systems,
+    CP::SlipSystemView<NumDimT>                           slip_systems,
     std::vector<CP::SlipFamily<NumDimT, NumSlipT>> const& slip_families,
     minitensor::Tensor<RealType, NumDimT> const&          Fp_n,
     minitensor::Vector<RealType, NumSlipT> const&         state_hardening_n,
@@ -379,7 +379,7 @@ CP::ResidualSlipHardnessNLS<NumDimT, NumSlipT, EvalT>::hessian(minitensor::Vecto
 template <minitensor::Index NumDimT, minitensor::Index NumSlipT, typename EvalT>
 CP::ResidualSlipHardnessFN<NumDimT, NumSlipT, EvalT>::ResidualSlipHardnessFN(
     minitensor::Tensor4<ScalarT, NumDimT> const&          C,
-    std::vector<CP::SlipSystem<NumDimT>> const&           slip_systems,
+    CP::SlipSystemView<NumDimT>                           slip_systems,
     std::vector<CP::SlipFamily<NumDimT, NumSlipT>> const& slip_families,
     minitensor::Tensor<RealType, NumDimT> const&          Fp_n,
     minitensor::Vector<RealType, NumSlipT> const&         state_hardening_n,
@@ -17,6 +17,24 @@ namespace LCM {
 template <typename S>
 using FieldMap = std::map<std::string, Teuchos::RCP<PHX::MDField<S>>>;
 
+///
+/// How computeState maps (cell, point) pairs onto Kokkos threads,
+/// selected with the "Parallel Policy" material parameter.
+///
+/// CELL:    one thread per cell, points in a serial loop ("Cell").
+/// MDRANGE: one flat 2D range over all (cell, point) pairs ("MDRange").
+/// TEAM:    one team per cell, one team thread per point ("Team").
+///
+/// MDRANGE and TEAM run the points of a cell concurrently, so they are
+/// rejected for kernels with has_cell_reduction set.
+///
+enum class ParallelPolicy
+{
+  CELL,
+  MDRANGE,
+  TEAM
+};
+
 template <typename EvalT, typename Traits>
 struct ParallelKernel
 {
@@ -29,6 +47,12 @@ struct ParallelKernel
   using ScalarField      = PHX::MDField<ScalarT>;
   using ConstScalarField = PHX::MDField<ScalarT const>;
 
+  ///
+  /// Set by kernels whose points write to storage shared by the cell or the
+  /// workset without atomics. Those run only under ParallelPolicy::CELL.
+  ///
+  static constexpr bool has_cell_reduction = false;
+
  protected:
   ParallelKernel(ConstitutiveModel<EvalT, Traits>& model)
       : model_(model),
@@ -85,6 +109,25 @@ struct ParallelKernel
     model_.addStateVar(name, layout, init_type, init_value, old_state_flag, output_flag);
   }
 
+  int
+  addStateHandle(std::string const& name)
+  {
+    return model_.addStateHandle(name);
+  }
+
+  ///
+  /// Add the old states of the num fields that
+  /// extractEvaluatedFieldArray(field_name, ...) extracts
+  ///
+  void
+  addStateHandleArray(std::string const& field_name, std::size_t num);
+
+  Albany::MDArray&
+  getStateArray(Workset& workset, int id)
+  {
+    return model_.getStateArray(workset, id);
+  }
+
   void
   extractEvaluatedFieldArray(
       std::string const&                      field_name,
@@ -188,6 +231,9 @@ struct ParallelKernel
 
   RealType latent_heat_;
 
+  /// Ids of the old states extracted by extractEvaluatedFieldArray
+  std::map<std::string, std::vector<int>> old_state_ids_;
+
   /// Flag indicating failure in model calculation
   Teuchos::RCP<NOX::StatusTest::ModelEvaluatorFlag> nox_status_test_{Teuchos::null};
 };
@@ -221,6 +267,8 @@ class ParallelConstitutiveModel : public LCM::ConstitutiveModel<EvalT, Traits>
 
  protected:
   std::unique_ptr<EvalKernel> kernel_;
+
+  ParallelPolicy policy_{ParallelPolicy::CELL};
 };
 
 }  // namespace LCM
@@ -3,11 +3,13 @@
 // in the file license.txt in the top-level Albany directory.
 
 #include <Kokkos_Core.hpp>
+#include <type_traits>
 
 #include "Albany_Utils.hpp"
 #include "NOX_StatusTest_ModelEvaluatorFlag.hpp"
 #include "ParallelConstitutiveModel.hpp"
 #include "utility/Memory.hpp"
+#include "utility/ParameterEnum.hpp"
 #include "utility/PerformanceContext.hpp"
 #include "utility/TimeGuard.hpp"
 #include "utility/TimeMonitor.hpp"
@@ -20,6 +22,17 @@ inline ParallelConstitutiveModel<EvalT, Traits, Kernel>::ParallelConstitutiveMod
     const Teuchos::RCP<Albany::Layouts>& dl)
     : ConstitutiveModel<EvalT, Traits>(p, dl)
 {
+  static utility::ParameterEnum<ParallelPolicy> const policy_map(
+      "Parallel Policy",
+      ParallelPolicy::CELL,
+      {{"Cell", ParallelPolicy::CELL}, {"MDRange", ParallelPolicy::MDRANGE}, {"Team", ParallelPolicy::TEAM}});
+
+  policy_ = policy_map.get(p);
+
+  ALBANY_ASSERT(
+      policy_ == ParallelPolicy::CELL || EvalKernel::has_cell_reduction == false,
+      "Parallel Policy \"MDRange\" and \"Team\" run the points of a cell concurrently, "
+      "but this material model accumulates per cell. Use \"Cell\".");
   kernel_ = util::make_unique<EvalKernel>(*this, p, dl);
 }
 
@@ -38,9 +51,12 @@ ParallelConstitutiveModel<EvalT, Traits, Kernel>::computeState(
 
   kernel_->init(workset, dep_fields, eval_fields);
 
-  // Data may be set using CUDA UVM so we need to synchronize
+  // Data may be set using CUDA UVM so we need to synchronize, but only
+  // when the fields live outside host memory.
+  constexpr bool is_host_memory = std::is_same<typename PHX::Device::memory_space, Kokkos::HostSpace>::value;
+
   // transfer_time->start();
-  Kokkos::fence();
+  if (is_host_memory == false) Kokkos::fence();
 
   util::TimeGuard total_time_guard(kernel_time);
 
@@ -53,15 +69,55 @@ ParallelConstitutiveModel<EvalT, Traits, Kernel>::computeState(
   // supercomputers
   auto kernel_ptr = kernel_.get();
 
-  Kokkos::parallel_for(Kokkos::RangePolicy<Kokkos::Schedule<Kokkos::Dynamic>>(0, workset.numCells), [=](int cell) {
-    for (int pt = 0; pt < num_pts_; ++pt) {
-      (*kernel_ptr)(cell, pt);
+  int const num_cells = workset.numCells;
+  int const num_pts   = num_pts_;
+
+  switch (policy_) {
+    default: ALBANY_ABORT("Unknown parallel policy"); break;
+
+    case ParallelPolicy::CELL:
+      Kokkos::parallel_for(Kokkos::RangePolicy<Kokkos::Schedule<Kokkos::Dynamic>>(0, num_cells), [=](int cell) {
+        for (int pt = 0; pt < num_pts; ++pt) {
+          (*kernel_ptr)(cell, pt);
+        }
+      });
+      break;
+
+    case ParallelPolicy::MDRANGE:
+      Kokkos::parallel_for(
+          Kokkos::MDRangePolicy<Kokkos::Rank<2>>({0, 0}, {num_cells, num_pts}),
+          [=](int cell, int pt) { (*kernel_ptr)(cell, pt); });
+      break;
+
+    case ParallelPolicy::TEAM: {
+      using TeamPolicy = Kokkos::TeamPolicy<>;
+      using TeamMember = TeamPolicy::member_type;
+
+      Kokkos::parallel_for(TeamPolicy(num_cells, Kokkos::AUTO), [=](TeamMember const& team) {
+        int const cell = team.league_rank();
+        Kokkos::parallel_for(Kokkos::TeamThreadRange(team, num_pts), [=](int pt) { (*kernel_ptr)(cell, pt); });
+      });
+      break;
     }
-  });
+  }
 
   Kokkos::fence();
 }
 
+template <typename EvalT, typename Traits>
+inline void
+ParallelKernel<EvalT, Traits>::addStateHandleArray(std::string const& field_name, std::size_t num)
+{
+  std::vector<int>& ids = old_state_ids_[field_name];
+  ids.clear();
+
+  for (std::size_t i = 0; i < num; ++i) {
+    std::string const id = Albany::strint(field_name, i + 1, '_');
+
+    ids.push_back(addStateHandle(field_name_map_[id] + "_old"));
+  }
+}
+
 template <typename EvalT, typename Traits>
 inline void
 ParallelKernel<EvalT, Traits>::extractEvaluatedFieldArray(
@@ -78,13 +134,16 @@ ParallelKernel<EvalT, Traits>::extractEvaluatedFieldArray(
   old_state.clear();
   old_state.reserve(num);
 
+  std::vector<int> const& ids = old_state_ids_[field_name];
+  ALBANY_ASSERT(ids.size() == num, "Old states of " + field_name + " were not added");
+
   for (std::size_t i = 0; i < num; ++i) {
     std::string const id = Albany::strint(field_name, i + 1, '_');
 
     std::string const name = field_name_map_[id];
 
     state.emplace_back(eval_fields[name]);
-    old_state.emplace_back(&((*workset.stateArrayPtr)[name + "_old"]));
+    old_state.emplace_back(&getStateArray(workset, ids[i]));
   }
 }
 
@@ -0,0 +1,20 @@
+// Albany 3.0: Copyright 2016 National Technology & Engineering Solutions of
+// Sandia, LLC (NTESS). This Software is released under the BSD license detailed
+// in the file license.txt in the top-level Albany directory.
+
+#include "ParallelJ2Model.hpp"
+
+#include "PHAL_AlbanyTraits.hpp"
+#include "ParallelConstitutiveModel_Def.hpp"
+#include "ParallelJ2Model_Def.hpp"
+
+template <typename EvalT, typename Traits>
+LCM::ParallelJ2Model<EvalT, Traits>::ParallelJ2Model(
+    Teuchos::ParameterList*              p,
+    const Teuchos::RCP<Albany::Layouts>& dl)
+    : LCM::ParallelConstitutiveModel<EvalT, Traits, J2Kernel<EvalT, Traits>>(p, dl)
+{
+}
+
+PHAL_INSTANTIATE_TEMPLATE_CLASS(LCM::J2Kernel)
+PHAL_INSTANTIATE_TEMPLATE_CLASS(LCM::ParallelJ2Model)
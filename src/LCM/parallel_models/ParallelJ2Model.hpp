@@ -0,0 +1,114 @@
+// Albany 3.0: Copyright 2016 National Technology & Engineering Solutions of
+// Sandia, LLC (NTESS). This Software is released under the BSD license detailed
+// in the file license.txt in the top-level Albany directory.
+
+#if !defined(LCM_ParallelJ2Model_hpp)
+#define LCM_ParallelJ2Model_hpp
+
+#include "Albany_Layouts.hpp"
+#include "ParallelConstitutiveModel.hpp"
+#include "Phalanx_Evaluator_Derived.hpp"
+#include "Phalanx_Evaluator_WithBaseImpl.hpp"
+#include "Phalanx_MDField.hpp"
+#include "Phalanx_config.hpp"
+
+namespace LCM {
+
+///
+/// J2 plasticity kernel. Same radial return algorithm as J2Model,
+/// evaluated one (cell, point) at a time so that it can be driven by
+/// Kokkos::parallel_for from ParallelConstitutiveModel.
+///
+template <typename EvalT, typename Traits>
+struct J2Kernel : public ParallelKernel<EvalT, Traits>
+{
+  ///
+  /// Constructor
+  ///
+  J2Kernel(
+      ConstitutiveModel<EvalT, Traits>&    model,
+      Teuchos::ParameterList*              p,
+      Teuchos::RCP<Albany::Layouts> const& dl);
+
+  ///
+  /// No copy constructor
+  ///
+  J2Kernel(J2Kernel const&) = delete;
+
+  ///
+  /// No copy assignment
+  ///
+  J2Kernel&
+  operator=(J2Kernel const&) = delete;
+
+  using ScalarT          = typename EvalT::ScalarT;
+  using MeshScalarT      = typename EvalT::MeshScalarT;
+  using ScalarField      = PHX::MDField<ScalarT>;
+  using ConstScalarField = PHX::MDField<ScalarT const>;
+  using BaseKernel       = ParallelKernel<EvalT, Traits>;
+  using Workset          = typename BaseKernel::Workset;
+
+  using BaseKernel::field_name_map_;
+  using BaseKernel::num_dims_;
+  using BaseKernel::num_pts_;
+
+  // optional temperature support
+  using BaseKernel::density_;
+  using BaseKernel::expansion_coeff_;
+  using BaseKernel::have_temperature_;
+  using BaseKernel::heat_capacity_;
+  using BaseKernel::ref_temperature_;
+  using BaseKernel::temperature_;
+
+  using BaseKernel::addStateHandle;
+  using BaseKernel::addStateVariable;
+  using BaseKernel::getStateArray;
+  using BaseKernel::setDependentField;
+  using BaseKernel::setEvaluatedField;
+
+  // Dependent MDFields
+  ConstScalarField def_grad_;
+  ConstScalarField delta_time_;
+  ConstScalarField elastic_modulus_;
+  ConstScalarField hardening_modulus_;
+  ConstScalarField J_;
+  ConstScalarField poissons_ratio_;
+  ConstScalarField yield_strength_;
+
+  // Evaluated MDFields
+  ScalarField eqps_;
+  ScalarField Fp_;
+  ScalarField source_;
+  ScalarField stress_;
+  ScalarField yield_surf_;
+
+  Albany::MDArray Fp_old_;
+  Albany::MDArray eqps_old_;
+
+  // Ids of the old states above, see addStateHandle
+  int Fp_old_id_{-1};
+  int eqps_old_id_{-1};
+
+  // Saturation hardening constants
+  RealType sat_mod_;
+  RealType sat_exp_;
+
+  void
+  init(Workset& workset, FieldMap<ScalarT const>& dep_fields, FieldMap<ScalarT>& eval_fields);
+
+  KOKKOS_INLINE_FUNCTION
+  void
+  operator()(int cell, int pt) const;
+};
+
+//! \brief Parallel J2 Plasticity Constitutive Model
+template <typename EvalT, typename Traits>
+class ParallelJ2Model : public LCM::ParallelConstitutiveModel<EvalT, Traits, J2Kernel<EvalT, Traits>>
+{
+ public:
+  ParallelJ2Model(Teuchos::ParameterList* p, const Teuchos::RCP<Albany::Layouts>& dl);
+};
+
+}  // namespace LCM
+
+#endif
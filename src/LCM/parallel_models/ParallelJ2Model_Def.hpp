@@ -0,0 +1,278 @@
+// Albany 3.0: Copyright 2016 National Technology & Engineering Solutions of
+// Sandia, LLC (NTESS). This Software is released under the BSD license detailed
+// in the file license.txt in the top-level Albany directory.
+
+#if !defined(LCM_ParallelJ2Model_Def_hpp)
+#define LCM_ParallelJ2Model_Def_hpp
+
+#include <MiniTensor.h>
+
+#include "Albany_Macros.hpp"
+#include "LocalNonlinearSolver.hpp"
+#include "Phalanx_DataLayout.hpp"
+
+namespace LCM {
+
+template <typename EvalT, typename Traits>
+J2Kernel<EvalT, Traits>::J2Kernel(
+    ConstitutiveModel<EvalT, Traits>&    model,
+    Teuchos::ParameterList*              p,
+    Teuchos::RCP<Albany::Layouts> const& dl)
+    : BaseKernel(model),
+      sat_mod_(p->get<RealType>("Saturation Modulus", 0.0)),
+      sat_exp_(p->get<RealType>("Saturation Exponent", 0.0))
+{
+  // retrieve appropriate field name strings
+  std::string const cauchy_string       = field_name_map_["Cauchy_Stress"];
+  std::string const Fp_string           = field_name_map_["Fp"];
+  std::string const eqps_string         = field_name_map_["eqps"];
+  std::string const yieldSurface_string = field_name_map_["Yield_Surface"];
+  std::string const source_string       = field_name_map_["Mechanical_Source"];
+  std::string const F_string            = field_name_map_["F"];
+  std::string const J_string            = field_name_map_["J"];
+
+  // define the dependent fields
+  setDependentField(F_string, dl->qp_tensor);
+  setDependentField(J_string, dl->qp_scalar);
+  setDependentField("Poissons Ratio", dl->qp_scalar);
+  setDependentField("Elastic Modulus", dl->qp_scalar);
+  setDependentField("Yield Strength", dl->qp_scalar);
+  setDependentField("Hardening Modulus", dl->qp_scalar);
+  setDependentField("Delta Time", dl->workset_scalar);
+
+  // define the evaluated fields
+  setEvaluatedField(cauchy_string, dl->qp_tensor);
+  setEvaluatedField(Fp_string, dl->qp_tensor);
+  setEvaluatedField(eqps_string, dl->qp_scalar);
+  setEvaluatedField(yieldSurface_string, dl->qp_scalar);
+  if (have_temperature_ == true) {
+    setEvaluatedField(source_string, dl->qp_scalar);
+  }
+
+  // define the state variables
+
+  // stress
+  addStateVariable(cauchy_string, dl->qp_tensor, "scalar", 0.0, false, p->get<bool>("Output Cauchy Stress", false));
+
+  // Fp
+  addStateVariable(Fp_string, dl->qp_tensor, "identity", 0.0, true, p->get<bool>("Output Fp", false));
+
+  // eqps
+  addStateVariable(eqps_string, dl->qp_scalar, "scalar", 0.0, true, p->get<bool>("Output eqps", false));
+
+  // yield surface
+  addStateVariable(
+      yieldSurface_string, dl->qp_scalar, "scalar", 0.0, false, p->get<bool>("Output Yield Surface", false));
+
+  // mechanical source
+  if (have_temperature_ == true) {
+    addStateVariable(
+        source_string, dl->qp_scalar, "scalar", 0.0, false, p->get<bool>("Output Mechanical Source", false));
+  }
+
+  // old states read by init
+  Fp_old_id_   = addStateHandle(Fp_string + "_old");
+  eqps_old_id_ = addStateHandle(eqps_string + "_old");
+}
+
+template <typename EvalT, typename Traits>
+void
+J2Kernel<EvalT, Traits>::init(Workset& workset, FieldMap<ScalarT const>& dep_fields, FieldMap<ScalarT>& eval_fields)
+{
+  std::string const cauchy_string       = field_name_map_["Cauchy_Stress"];
+  std::string const Fp_string           = field_name_map_["Fp"];
+  std::string const eqps_string         = field_name_map_["eqps"];
+  std::string const yieldSurface_string = field_name_map_["Yield_Surface"];
+  std::string const source_string       = field_name_map_["Mechanical_Source"];
+  std::string const F_string            = field_name_map_["F"];
+  std::string const J_string            = field_name_map_["J"];
+
+  // extract dependent MDFields
+  def_grad_          = *dep_fields[F_string];
+  J_                 = *dep_fields[J_string];
+  poissons_ratio_    = *dep_fields["Poissons Ratio"];
+  elastic_modulus_   = *dep_fields["Elastic Modulus"];
+  yield_strength_    = *dep_fields["Yield Strength"];
+  hardening_modulus_ = *dep_fields["Hardening Modulus"];
+  delta_time_        = *dep_fields["Delta Time"];
+
+  // extract evaluated MDFields
+  stress_     = *eval_fields[cauchy_string];
+  Fp_         = *eval_fields[Fp_string];
+  eqps_       = *eval_fields[eqps_string];
+  yield_surf_ = *eval_fields[yieldSurface_string];
+
+  if (have_temperature_ == true) {
+    source_ = *eval_fields[source_string];
+  }
+
+  // get State Variables
+  Fp_old_   = getStateArray(workset, Fp_old_id_);
+  eqps_old_ = getStateArray(workset, eqps_old_id_);
+}
+
+//
+// The arithmetic below follows J2Model::computeState operation by
+// operation, so "Parallel J2" reproduces "J2" results exactly. Only the
+// storage differs: tensors have static capacity to keep the heap out of
+// the parallel region.
+//
+template <typename EvalT, typename Traits>
+KOKKOS_INLINE_FUNCTION void
+J2Kernel<EvalT, Traits>::operator()(int cell, int pt) const
+{
+  constexpr minitensor::Index MAX_DIM{3};
+
+  using Tensor = minitensor::Tensor<ScalarT, MAX_DIM>;
+
+  ScalarT const sq23(std::sqrt(2. / 3.));
+
+  Tensor       F(num_dims_);
+  Tensor const I(minitensor::eye<ScalarT, MAX_DIM>(num_dims_));
+  Tensor       Fpn(num_dims_);
+  Tensor       sigma(num_dims_);
+
+  ScalarT const kappa = elastic_modulus_(cell, pt) / (3. * (1. - 2. * poissons_ratio_(cell, pt)));
+  ScalarT const mu    = elastic_modulus_(cell, pt) / (2. * (1. + poissons_ratio_(cell, pt)));
+  ScalarT const K     = hardening_modulus_(cell, pt);
+  ScalarT const Y     = yield_strength_(cell, pt);
+  ScalarT const Jm23  = std::pow(J_(cell, pt), -2. / 3.);
+
+  // fill local tensors
+  F.fill(def_grad_, cell, pt, 0, 0);
+
+  // Mechanical deformation gradient
+  auto Fm = Tensor(F);
+  if (have_temperature_) {
+    // Compute the mechanical deformation gradient Fm based on the
+    // multiplicative decomposition of the deformation gradient
+    //            F = Fm.Ft => Fm = F.inv(Ft)
+    // where Ft is the thermal part of F, given as
+    //     Ft = Le * I = exp(alpha * dtemp) * I
+    // Le = exp(alpha*dtemp) is the thermal stretch and alpha the
+    // coefficient of thermal expansion.
+    ScalarT dtemp           = temperature_(cell, pt) - ref_temperature_;
+    ScalarT thermal_stretch = std::exp(expansion_coeff_ * dtemp);
+    Fm /= thermal_stretch;
+  }
+
+  for (int i{0}; i < num_dims_; ++i) {
+    for (int j{0}; j < num_dims_; ++j) {
+      Fpn(i, j) = ScalarT(Fp_old_(cell, pt, i, j));
+    }
+  }
+
+  // compute trial state
+  Tensor const  Fpinv = minitensor::inverse(Fpn);
+  Tensor const  Cpinv = Fpinv * minitensor::transpose(Fpinv);
+  Tensor const  be    = Jm23 * Fm * Cpinv * minitensor::transpose(Fm);
+  Tensor        s     = mu * minitensor::dev(be);
+  ScalarT const mubar = minitensor::trace(be) * mu / (num_dims_);
+
+  // check yield condition
+  ScalarT const smag = minitensor::norm(s);
+  ScalarT const f =
+      smag - sq23 * (Y + K * eqps_old_(cell, pt) + sat_mod_ * (1. - std::exp(-sat_exp_ * eqps_old_(cell, pt))));
+
+  if (f > 1E-12) {
+    // return mapping algorithm
+    bool    converged = false;
+    ScalarT H         = 0.0;
+    ScalarT dH        = 0.0;
+    ScalarT alpha     = 0.0;
+    ScalarT res       = 0.0;
+    int     count     = 0;
+
+    int const num_max_iter = 30;
+
+    // The local system lives on the stack, nothing is allocated per point
+    LocalNonlinearSolver<EvalT, Traits, 1> solver;
+
+    std::array<ScalarT, 1> R{};
+    std::array<ScalarT, 1> dRdX{};
+    std::array<ScalarT, 1> X{};
+
+    R[0] = f;
+    X[0] = 0.0;
+
+    dRdX[0] = (-2. * mubar) * (1. + H / (3. * mubar));
+    while (!converged && count <= num_max_iter) {
+      count++;
+      solver.solve(dRdX, X, R);
+      alpha   = eqps_old_(cell, pt) + sq23 * X[0];
+      H       = K * alpha + sat_mod_ * (1. - exp(-sat_exp_ * alpha));
+      dH      = K + sat_exp_ * sat_mod_ * exp(-sat_exp_ * alpha);
+      R[0]    = smag - (2. * mubar * X[0] + sq23 * (Y + H));
+      dRdX[0] = -2. * mubar * (1. + dH / (3. * mubar));
+
+      res = std::abs(R[0]);
+      if (res < 1.e-11 || res / Y < 1.E-11 || res / f < 1.E-11) converged = true;
+
+      ALBANY_PANIC(
+          count == num_max_iter,
+          std::endl
+              << "Error in return mapping, count = " << count << "\nres = " << res << "\nrelres  = " << res / f
+              << "\nrelres2 = " << res / Y << "\ng = " << R[0] << "\ndg = " << dRdX[0] << "\nalpha = " << alpha
+              << std::endl);
+    }
+
+    solver.computeFadInfo(dRdX, X, R);
+
+    ScalarT const dgam = X[0];
+
+    // plastic direction
+    Tensor const N = (1 / smag) * s;
+
+    // update s
+    s -= 2 * mubar * dgam * N;
+
+    // update eqps
+    eqps_(cell, pt) = alpha;
+
+    // mechanical source
+    if (have_temperature_ && delta_time_(0) > 0) {
+      source_(cell, pt) =
+          (sq23 * dgam / delta_time_(0) * (Y + H + temperature_(cell, pt))) / (density_ * heat_capacity_);
+    }
+
+    // exponential map to get Fpnew
+    Tensor const A     = dgam * N;
+    Tensor const expA  = minitensor::exp(A);
+    Tensor const Fpnew = expA * Fpn;
+
+    for (int i{0}; i < num_dims_; ++i) {
+      for (int j{0}; j < num_dims_; ++j) {
+        Fp_(cell, pt, i, j) = Fpnew(i, j);
+      }
+    }
+  } else {
+    eqps_(cell, pt) = eqps_old_(cell, pt);
+
+    if (have_temperature_) source_(cell, pt) = 0.0;
+
+    for (int i{0}; i < num_dims_; ++i) {
+      for (int j{0}; j < num_dims_; ++j) {
+        Fp_(cell, pt, i, j) = Fpn(i, j);
+      }
+    }
+  }
+
+  // update yield surface
+  yield_surf_(cell, pt) = Y + K * eqps_(cell, pt) + sat_mod_ * (1. - std::exp(-sat_exp_ * eqps_(cell, pt)));
+
+  // compute pressure
+  ScalarT const p = 0.5 * kappa * (J_(cell, pt) - 1. / (J_(cell, pt)));
+
+  // compute stress
+  sigma = p * I + s / J_(cell, pt);
+
+  for (int i{0}; i < num_dims_; ++i) {
+    for (int j{0}; j < num_dims_; ++j) {
+      stress_(cell, pt, i, j) = sigma(i, j);
+    }
+  }
+}
+
+}  // namespace LCM
+
+#endif
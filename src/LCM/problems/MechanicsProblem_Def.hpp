@@ -1778,7 +1778,8 @@ MechanicsProblem::constructEvaluators(
     p->set<std::string>("Determinant of F Name", J);
     p->set<std::string>("Temperature Name", temperature);
 
-    if (material_model_name == "J2" || material_model_name == "Elasto Viscoplastic") {
+    if (material_model_name == "J2" || material_model_name == "Parallel J2" ||
+        material_model_name == "Elasto Viscoplastic") {
       p->set<std::string>("Equivalent Plastic Strain Name", eqps);
       p->set<std::string>("Strain Rate Factor Name", strainRateFactor);
     }
@@ -2050,7 +2051,8 @@ MechanicsProblem::constructEvaluators(
 
     // Source
     // TODO: Make this more general
-    if ((have_mech_ || have_mech_eq_) && (material_model_name == "J2" || material_model_name == "CrystalPlasticity")) {
+    if ((have_mech_ || have_mech_eq_) && (material_model_name == "J2" || material_model_name == "Parallel J2" ||
+                                          material_model_name == "CrystalPlasticity")) {
       p->set<bool>("Have Source", true);
       p->set<std::string>("Source Name", mech_source);
     }
@@ -2081,7 +2083,8 @@ MechanicsProblem::constructEvaluators(
     p->set<std::string>("Weighted Gradient BF Name", "wGrad BF");
     p->set<std::string>("Gradient BF Name", "Grad BF");
     if ((have_mech_ || have_mech_eq_) &&
-        (material_model_name == "J2" || material_model_name == "Elasto Viscoplastic")) {
+        (material_model_name == "J2" || material_model_name == "Parallel J2" ||
+         material_model_name == "Elasto Viscoplastic")) {
       p->set<std::string>("Equivalent Plastic Strain Name", eqps);
       p->set<std::string>("Strain Rate Factor Name", strainRateFactor);
     }
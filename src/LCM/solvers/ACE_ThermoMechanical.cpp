@@ -4,7 +4,11 @@
 
 #include "ACE_ThermoMechanical.hpp"
 
+#include <Ioss_Field.h>
+
 #include <fstream>
+#include <stk_mesh/base/GetEntities.hpp>
+#include <stk_mesh/base/MetaData.hpp>
 
 #include "AAdapt_Erosion.hpp"
 #include "Albany_PiroObserver.hpp"
@@ -112,6 +116,8 @@ ACEThermoMechanical::ACEThermoMechanical(
   output_interval_  = alt_system_params_->get<int>("Exodus Write Interval", 1);
   std_init_guess_   = alt_system_params_->get<bool>("Standard Initial Guess", false);
 
+  in_memory_coupling_ = alt_system_params_->get<bool>("In-Memory Coupling", false);
+
   // Firewalls
   ALBANY_ASSERT(maximum_steps_ >= 1, "");
   ALBANY_ASSERT(final_time_ >= initial_time_, "");
@@ -208,6 +214,14 @@ ACEThermoMechanical::ACEThermoMechanical(
           "Constant' in 'Time Step Control' sublist.\n"};
       ALBANY_ASSERT(integrator_step_type == "Constant", msg);
     } else if (problem_type == MECHANICAL) {
+      // Meshes are adapted only by the trapezoid rule solve, which writes the
+      // adapted mesh to a file that the next step restarts from. Persistent
+      // apps never pick it up, and the field transfer needs the same mesh on
+      // both subdomains, so in-memory coupling excludes adaptation.
+      ALBANY_ASSERT(
+          in_memory_coupling_ == false || problem_params.isSublist("Adaptation") == false,
+          "ACE In-Memory Coupling does not support mesh adaptation.");
+
       auto const is_tempus         = piro_params.isSublist("Tempus");
       auto const is_trapezoid_rule = piro_params.isSublist("Trapezoid Rule");
       if (is_tempus == true) {
@@ -239,6 +253,14 @@ ACEThermoMechanical::ACEThermoMechanical(
     }
   }
 
+  // Persistent apps cannot change the trapezoid rule time interval nor
+  // pick up a mesh adapted by the solver.
+  if (in_memory_coupling_ == true && num_subdomains_ > 1) {
+    ALBANY_ASSERT(
+        mechanical_solver_ == MechanicalSolver::Tempus,
+        "ACE In-Memory Coupling requires Tempus for the mechanical solve.");
+  }
+
   // Parameters
   Teuchos::ParameterList& problem_params  = app_params->sublist("Problem");
   bool const              have_parameters = problem_params.isSublist("Parameters");
@@ -441,6 +463,50 @@ centered(std::string const& str, int width)
   return std::string(left, ' ') + str + std::string(right, ' ');
 }
 
+// Copy the Exodus output fields of one subdomain mesh into the fields with
+// the same name and rank of the other, matching entities by global id. This
+// is what writing 'from' to Exodus and restarting 'to' from that file does,
+// without the round trip through the file system. Both meshes must come from
+// the same input mesh with the same parallel decomposition.
+void
+transferMeshFields(Albany::AbstractSTKMeshStruct const& from, Albany::AbstractSTKMeshStruct& to)
+{
+  stk::mesh::MetaData const& from_meta = *from.metaData;
+  stk::mesh::BulkData const& from_bulk = *from.bulkData;
+  stk::mesh::MetaData const& to_meta   = *to.metaData;
+  stk::mesh::BulkData const& to_bulk   = *to.bulkData;
+
+  stk::mesh::Selector const to_select = to_meta.locally_owned_part() | to_meta.globally_shared_part();
+
+  for (auto const* from_field : from_meta.get_fields()) {
+    auto const* role = from_field->attribute<Ioss::Field::RoleType>();
+    if (role == nullptr || *role != Ioss::Field::TRANSIENT) continue;
+    if (from_field->type_is<double>() == false) continue;
+
+    stk::mesh::EntityRank const rank     = from_field->entity_rank();
+    stk::mesh::FieldBase const* to_field = to_meta.get_field(rank, from_field->name());
+    if (to_field == nullptr || to_field->type_is<double>() == false) continue;
+
+    std::vector<stk::mesh::Entity> to_entities;
+    stk::mesh::get_selected_entities(to_select & stk::mesh::selectField(*to_field), to_bulk.buckets(rank), to_entities);
+
+    for (auto const to_entity : to_entities) {
+      stk::mesh::Entity const from_entity = from_bulk.get_entity(rank, to_bulk.identifier(to_entity));
+      ALBANY_ASSERT(
+          from_bulk.is_valid(from_entity) == true,
+          "ACE In-Memory Coupling requires the same mesh and decomposition for all subdomains.");
+
+      std::size_t const num_from = stk::mesh::field_scalars_per_entity(*from_field, from_entity);
+      std::size_t const num_to   = stk::mesh::field_scalars_per_entity(*to_field, to_entity);
+      if (num_from != num_to) continue;
+
+      auto const* values = static_cast<double const*>(stk::mesh::field_data(*from_field, from_entity));
+      auto*       target = static_cast<double*>(stk::mesh::field_data(*to_field, to_entity));
+      std::copy(values, values + num_to, target);
+    }
+  }
+}
+
 void
 renameExodusFile(int const file_index, std::string& filename)
 {
@@ -463,9 +529,12 @@ ACEThermoMechanical::createThermalSolverAppDiscME(int const file_index, double c
   Teuchos::ParameterList& problem_params = params.sublist("Problem", true);
   Teuchos::ParameterList& disc_params    = params.sublist("Discretization", true);
   std::string             filename       = disc_params.get<std::string>("Exodus Output File Name");
-  renameExodusFile(file_index, filename);
-  *fos_ << "Renaming output file to - " << filename << '\n';
-  disc_params.set<std::string>("Exodus Output File Name", filename);
+  // In-memory coupling writes a single checkpoint file per subdomain.
+  if (in_memory_coupling_ == false) {
+    renameExodusFile(file_index, filename);
+    *fos_ << "Renaming output file to - " << filename << '\n';
+    disc_params.set<std::string>("Exodus Output File Name", filename);
+  }
   disc_params.set<std::string>("Exodus Solution Name", "temperature");
   disc_params.set<std::string>("Exodus SolutionDot Name", "temperature_dot");
   disc_params.set<bool>("Output DTK Field to Exodus", false);
@@ -517,7 +586,7 @@ ACEThermoMechanical::createThermalSolverAppDiscME(int const file_index, double c
   curr_x_[subdomain]             = Teuchos::null;
   prev_thermal_exo_outfile_name_ = filename;
   // Delete previously-written Exodus files to not have inundation of output files
-  if (file_index > 0 && ((file_index - 1) % output_interval_) != 0) {
+  if (in_memory_coupling_ == false && file_index > 0 && ((file_index - 1) % output_interval_) != 0) {
     deleteParallel(prev_mechanical_exo_outfile_name_, comm_);
   }
 }
@@ -534,9 +603,12 @@ ACEThermoMechanical::createMechanicalSolverAppDiscME(
   Teuchos::ParameterList& problem_params = params.sublist("Problem", true);
   Teuchos::ParameterList& disc_params    = params.sublist("Discretization", true);
   std::string             filename       = disc_params.get<std::string>("Exodus Output File Name");
-  renameExodusFile(file_index, filename);
-  *fos_ << "Renaming output file to - " << filename << '\n';
-  disc_params.set<std::string>("Exodus Output File Name", filename);
+  // In-memory coupling writes a single checkpoint file per subdomain.
+  if (in_memory_coupling_ == false) {
+    renameExodusFile(file_index, filename);
+    *fos_ << "Renaming output file to - " << filename << '\n';
+    disc_params.set<std::string>("Exodus Output File Name", filename);
+  }
   disc_params.set<std::string>("Exodus Solution Name", "disp");
   disc_params.set<std::string>("Exodus SolutionDot Name", "disp_dot");
   disc_params.set<std::string>("Exodus SolutionDotDot Name", "disp_dotdot");
@@ -547,28 +619,32 @@ ACEThermoMechanical::createMechanicalSolverAppDiscME(
       "'Exodus Write Interval' for Mechanics Problem must be 1!  This parameter is controlled by variables in coupled "
       "input file.");
 
-  // After the initial run, we will do restarts from the previously written Exodus output file.
-  // Change input Exodus file to previous thermal Exodus output file, for restarts.
-  disc_params.set<std::string>("Exodus Input File Name", prev_thermal_exo_outfile_name_);
   if (!disc_params.isParameter("Disable Exodus Output Initial Time")) {
     disc_params.set<bool>("Disable Exodus Output Initial Time", true);
   }
-  // Set restart index based on where we are in the simulation
-  if (file_index == 0) {  // Initially, restart index = 2, since initial file will have 2 snapshots
-                          // and the second one is the one we want to restart from
-    disc_params.set<int>("Restart Index", 2);
-  } else {
-    // Set restart index based on 'disable exodus output initial time' variable
-    // after initial time step
-    const bool disable_exo_out_init_time = disc_params.get<bool>("Disable Exodus Output Initial Time");
-    if (disable_exo_out_init_time == true) {
-      disc_params.set<int>("Restart Index", 1);
-    } else {
+  // With in-memory coupling the mesh is read from the original input file
+  // and the thermal fields are copied in by setupInMemorySubdomain.
+  if (in_memory_coupling_ == false) {
+    // After the initial run, we will do restarts from the previously written Exodus output file.
+    // Change input Exodus file to previous thermal Exodus output file, for restarts.
+    disc_params.set<std::string>("Exodus Input File Name", prev_thermal_exo_outfile_name_);
+    // Set restart index based on where we are in the simulation
+    if (file_index == 0) {  // Initially, restart index = 2, since initial file will have 2 snapshots
+                            // and the second one is the one we want to restart from
       disc_params.set<int>("Restart Index", 2);
+    } else {
+      // Set restart index based on 'disable exodus output initial time' variable
+      // after initial time step
+      const bool disable_exo_out_init_time = disc_params.get<bool>("Disable Exodus Output Initial Time");
+      if (disable_exo_out_init_time == true) {
+        disc_params.set<int>("Restart Index", 1);
+      } else {
+        disc_params.set<int>("Restart Index", 2);
+      }
     }
+    // Remove Initial Condition sublist
+    problem_params.remove("Initial Condition", true);
   }
-  // Remove Initial Condition sublist
-  problem_params.remove("Initial Condition", true);
   // Set flag to tell code that we have an ACE Sequential Thermomechanical Problem
   problem_params.set("ACE Sequential Thermomechanical", true, "ACE Sequential Thermomechanical Problem");
 
@@ -610,11 +686,41 @@ ACEThermoMechanical::createMechanicalSolverAppDiscME(
   curr_x_[subdomain]                = Teuchos::null;
   prev_mechanical_exo_outfile_name_ = filename;
   // Delete previously-written Exodus files to not have inundation of output files
-  if ((file_index % output_interval_) != 0) {
+  if (in_memory_coupling_ == false && (file_index % output_interval_) != 0) {
     deleteParallel(prev_thermal_exo_outfile_name_, comm_);
   }
 }
 
+void
+ACEThermoMechanical::setupInMemorySubdomain(
+    int const    subdomain,
+    int const    stop,
+    double const current_time,
+    double const next_time,
+    double const time_step) const
+{
+  auto const prob_type = prob_types_[subdomain];
+  if (apps_[subdomain].is_null() == true) {
+    if (prob_type == THERMAL) {
+      createThermalSolverAppDiscME(stop, current_time);
+    } else {
+      createMechanicalSolverAppDiscME(stop, current_time, next_time, time_step);
+    }
+  }
+
+  // Pick up the latest fields of the other subdomain, if it exists yet.
+  auto const other = prob_type == THERMAL ? 1 : 0;
+  if (other < num_subdomains_ && apps_[other].is_null() == false) {
+    discs_[other]->getStateArrays().syncNewStates();
+    transferMeshFields(*stk_mesh_structs_[other], *stk_mesh_structs_[subdomain]);
+  }
+
+  // Only the steps at the output interval are written as checkpoints.
+  auto& stk_mesh_struct             = *stk_mesh_structs_[subdomain];
+  stk_mesh_struct.exoOutputInterval = 1;
+  stk_mesh_struct.exoOutput         = do_outputs_init_[subdomain] == true && (stop + 1) % output_interval_ == 0;
+}
+
 bool
 ACEThermoMechanical::continueSolve() const
 {
@@ -660,10 +766,18 @@ ACEThermoMechanical::ThermoMechanicalLoopDynamics() const
         // Create new solvers, apps, discs and model evaluators
         auto const prob_type = prob_types_[subdomain];
         if (prob_type == THERMAL && failed_reattempt_thermal_ == false && failed_reattempt_mechanical_ == false) {
-          createThermalSolverAppDiscME(stop, current_time);
+          if (in_memory_coupling_ == true) {
+            setupInMemorySubdomain(subdomain, stop, current_time, next_time, time_step);
+          } else {
+            createThermalSolverAppDiscME(stop, current_time);
+          }
         }
         if (prob_type == MECHANICAL && failed_reattempt_mechanical_ == false) {
-          createMechanicalSolverAppDiscME(stop, current_time, next_time, time_step);
+          if (in_memory_coupling_ == true) {
+            setupInMemorySubdomain(subdomain, stop, current_time, next_time, time_step);
+          } else {
+            createMechanicalSolverAppDiscME(stop, current_time, next_time, time_step);
+          }
         }
 
         if (stop == 0) {
@@ -695,7 +809,7 @@ ACEThermoMechanical::ThermoMechanicalLoopDynamics() const
           AdvanceMechanicalDynamics(subdomain, is_initial_state, current_time, next_time, time_step);
           if (failed_reattempt_mechanical_ == false) {
             doDynamicInitialOutput(next_time, subdomain, stop);
-            renamePrevWrittenExoFiles(subdomain, stop);
+            if (in_memory_coupling_ == false) renamePrevWrittenExoFiles(subdomain, stop);
           }
         }
         if (prob_type == THERMAL) {
@@ -703,7 +817,7 @@ ACEThermoMechanical::ThermoMechanicalLoopDynamics() const
           AdvanceThermalDynamics(subdomain, is_initial_state, current_time, next_time, time_step);
           if (failed_reattempt_thermal_ == false && failed_reattempt_mechanical_ == false) {
             doDynamicInitialOutput(next_time, subdomain, stop);
-            renamePrevWrittenExoFiles(subdomain, stop);
+            if (in_memory_coupling_ == false) renamePrevWrittenExoFiles(subdomain, stop);
           }
         }
         if (failed_reattempt_thermal_ == true || failed_reattempt_mechanical_ == true) {
@@ -812,8 +926,10 @@ ACEThermoMechanical::ThermoMechanicalLoopDynamics() const
   }  // Time-step loop
 
   // Rename final Exodus output file
-  for (auto subdomain = 0; subdomain < num_subdomains_; ++subdomain) {
-    renamePrevWrittenExoFiles(subdomain, stop);
+  if (in_memory_coupling_ == false) {
+    for (auto subdomain = 0; subdomain < num_subdomains_; ++subdomain) {
+      renamePrevWrittenExoFiles(subdomain, stop);
+    }
   }
   return;
 }
@@ -853,6 +969,13 @@ ACEThermoMechanical::AdvanceThermalDynamics(
   auto& state_mgr = app.getStateMgr();
   fromTo(internal_states_[subdomain], state_mgr.getStateArrays());
 
+  // A persistent app starts from the last accepted step, not from its
+  // nominal values.
+  if (in_memory_coupling_ == true) {
+    piro_tempus_solver.setInitialState(
+        current_time, ics_x_[subdomain]->clone_v(), ics_xdot_[subdomain]->clone_v(), Teuchos::null);
+  }
+
   Teuchos::RCP<Tempus::SolutionHistory<ST>> solution_history;
   Teuchos::RCP<Tempus::SolutionState<ST>>   current_state;
 
@@ -916,6 +1039,16 @@ ACEThermoMechanical::AdvanceMechanicalDynamics(
 
     fromTo(internal_states_[subdomain], state_mgr.getStateArrays());
 
+    // A persistent app starts from the last accepted step, not from its
+    // nominal values.
+    if (in_memory_coupling_ == true) {
+      piro_tempus_solver.setInitialState(
+          current_time,
+          ics_x_[subdomain]->clone_v(),
+          ics_xdot_[subdomain]->clone_v(),
+          ics_xdotdot_[subdomain]->clone_v());
+    }
+
     Teuchos::RCP<Tempus::SolutionHistory<ST>> solution_history;
     Teuchos::RCP<Tempus::SolutionState<ST>>   current_state;
 
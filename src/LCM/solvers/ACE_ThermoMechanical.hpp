@@ -202,6 +202,16 @@ class ACEThermoMechanical : public Thyra::ResponseOnlyModelEvaluatorBase<ST>
       double const next_time,
       double const time_step) const;
 
+  // With in-memory coupling, create the subdomain app on first use and
+  // afterwards fill its mesh fields from the other subdomain.
+  void
+  setupInMemorySubdomain(
+      int const    subdomain,
+      int const    stop,
+      double const current_time,
+      double const next_time,
+      double const time_step) const;
+
   void
   doQuasistaticOutput(ST const time) const;
 
@@ -271,6 +281,12 @@ class ACEThermoMechanical : public Thyra::ResponseOnlyModelEvaluatorBase<ST>
 
   bool std_init_guess_{false};
 
+  // Keep both apps alive and pass fields between their meshes in memory
+  // instead of through Exodus restart files. Requires Tempus for the
+  // mechanical solve and no mesh adaptation, which happens only on the
+  // trapezoid rule path.
+  bool in_memory_coupling_{false};
+
   enum PROB_TYPE
   {
     THERMAL,
@@ -11,6 +11,7 @@
 #include "MiniTensor.h"
 #include "Piro_LOCASolver.hpp"
 #include "Piro_TempusSolver.hpp"
+#include "Teuchos_Time.hpp"
 
 namespace LCM {
 
@@ -41,6 +42,7 @@ SchwarzAlternating::SchwarzAlternating(
   increase_factor_  = alt_system_params.get<ST>("Amplification Factor", 1.0);
   output_interval_  = alt_system_params.get<int>("Exodus Write Interval", 1);
   std_init_guess_   = alt_system_params.get<bool>("Standard Initial Guess", false);
+  qs_init_guess_    = alt_system_params.get<bool>("Quasistatic Standard Initial Guess", false);
 
   tol_factor_vel_ = alt_system_params.get<ST>("Tolerance Factor Velocity", dt);
   tol_factor_acc_ = alt_system_params.get<ST>("Tolerance Factor Acceleration", dt2);
@@ -71,6 +73,18 @@ SchwarzAlternating::SchwarzAlternating(
     ALBANY_ABORT("Unknown Convergence Logical Operator");
   }
 
+  std::string ordering_str = alt_system_params.get<std::string>("Subdomain Ordering", "MULTIPLICATIVE");
+
+  std::transform(ordering_str.begin(), ordering_str.end(), ordering_str.begin(), ::toupper);
+
+  if (ordering_str == "MULTIPLICATIVE") {
+    ordering_ = SubdomainOrdering::MULTIPLICATIVE;
+  } else if (ordering_str == "ADDITIVE") {
+    ordering_ = SubdomainOrdering::ADDITIVE;
+  } else {
+    ALBANY_ABORT("Unknown Subdomain Ordering");
+  }
+
   // Firewalls
   ALBANY_ASSERT(min_iters_ >= 1, "");
   ALBANY_ASSERT(max_iters_ >= 1, "");
@@ -112,11 +126,18 @@ SchwarzAlternating::SchwarzAlternating(
   sub_outargs_.resize(num_subdomains_);
   curr_disp_.resize(num_subdomains_);
   prev_step_disp_.resize(num_subdomains_);
+  disp_ring_.resize(num_subdomains_);
+  disp_diff_.resize(num_subdomains_);
+  velo_diff_.resize(num_subdomains_);
+  acce_diff_.resize(num_subdomains_);
   internal_states_.resize(num_subdomains_);
-  // the following 9 arrays are for dynamics
+  // the following 12 arrays are for dynamics
   ics_disp_.resize(num_subdomains_);
   ics_velo_.resize(num_subdomains_);
   ics_acce_.resize(num_subdomains_);
+  tempus_ic_disp_.resize(num_subdomains_);
+  tempus_ic_velo_.resize(num_subdomains_);
+  tempus_ic_acce_.resize(num_subdomains_);
   prev_disp_.resize(num_subdomains_);
   prev_velo_.resize(num_subdomains_);
   prev_acce_.resize(num_subdomains_);
@@ -420,6 +441,12 @@ centered(std::string const& str, int width)
   return std::string(left, ' ') + str + std::string(right, ' ');
 }
 
+void
+allocateIfNull(Teuchos::RCP<Thyra_Vector>& vector, Teuchos::RCP<Thyra_VectorSpace const> const& space)
+{
+  if (vector == Teuchos::null) vector = Thyra::createMember(space);
+}
+
 }  // namespace
 
 void
@@ -479,10 +506,12 @@ SchwarzAlternating::continueSolve() const
 void
 SchwarzAlternating::reportFinals(std::ostream& os) const
 {
-  std::string const conv_str = converged_ == true ? "YES" : "NO";
+  std::string const conv_str     = converged_ == true ? "YES" : "NO";
+  std::string const ordering_str = ordering_ == SubdomainOrdering::ADDITIVE ? "ADDITIVE" : "MULTIPLICATIVE";
 
   os << '\n';
   os << "Schwarz Alternating Method converged: " << conv_str << '\n';
+  os << "Subdomain ordering :" << ordering_str << '\n';
   os << "Minimum iterations :" << min_iters_ << '\n';
   os << "Maximum iterations :" << max_iters_ << '\n';
   os << "Total iterations   :" << num_iter_ << '\n';
@@ -493,6 +522,54 @@ SchwarzAlternating::reportFinals(std::ostream& os) const
   os << std::endl;
 }
 
+void
+SchwarzAlternating::setSchwarzBoundaryData(
+    int const                               subdomain,
+    Teuchos::RCP<Thyra_Vector const> const& disp,
+    Teuchos::RCP<Thyra_Vector const> const& velo,
+    Teuchos::RCP<Thyra_Vector const> const& acce,
+    ST const                                time) const
+{
+  // The Schwarz BCs read the coupled solution from the application, and the
+  // DTK variants from the mesh database, so both are set.
+  auto& app  = *apps_[subdomain];
+  auto& disc = *app.getDiscretization();
+
+  app.setX(disp);
+  if (velo == Teuchos::null) {
+    disc.writeSolutionToMeshDatabase(*disp, time);
+    return;
+  }
+  app.setXdot(velo);
+  app.setXdotdot(acce);
+  disc.writeSolutionToMeshDatabase(*disp, *velo, *acce, time);
+}
+
+Teuchos::RCP<Thyra_Vector>
+SchwarzAlternating::nextDispBuffer(int const subdomain) const
+{
+  for (auto const& buffer : disp_ring_[subdomain]) {
+    bool const is_curr      = buffer.get() == curr_disp_[subdomain].get();
+    bool const is_prev_step = buffer.get() == prev_step_disp_[subdomain].get();
+    if (is_curr == false && is_prev_step == false) return buffer;
+  }
+  ALBANY_ABORT("No free solution buffer for subdomain " << subdomain);
+  return Teuchos::null;
+}
+
+void
+SchwarzAlternating::reportTotals(std::ostream& os, int const total_iters, double const total_time) const
+{
+  std::string const ordering_str = ordering_ == SubdomainOrdering::ADDITIVE ? "ADDITIVE" : "MULTIPLICATIVE";
+
+  os << '\n';
+  os << "Schwarz Alternating Method totals\n";
+  os << "Subdomain ordering :" << ordering_str << '\n';
+  os << "Schwarz iterations :" << total_iters << '\n';
+  os << "Wall time          :" << total_time << '\n';
+  os << std::endl;
+}
+
 // Schwarz Alternating loop, dynamic
 void
 SchwarzAlternating::SchwarzLoopDynamics() const
@@ -512,6 +589,9 @@ SchwarzAlternating::SchwarzLoopDynamics() const
   ST  time_step{initial_time_step_};
   int stop{0};
   ST  current_time{initial_time_};
+  int total_iters{0};
+
+  Teuchos::Time total_timer("Schwarz Alternating Dynamics", true);
 
   // Set ICs and PrevSoln vecs and write initial configuration to Exodus file
   setDynamicICVecsAndDoOutput(initial_time_);
@@ -544,23 +624,25 @@ SchwarzAlternating::SchwarzLoopDynamics() const
         fos << "Subdomain          :" << subdomain << '\n';
         fos << delim << std::endl;
 
-        // Restore solution from previous Schwarz iteration before solve
+        // Restore solution from previous Schwarz iteration before solve.
+        // The previous and current solutions are buffers that are allocated
+        // once and then swapped, the solve overwrites the current ones.
         if (is_initial_state == true) {
-          auto&       me        = dynamic_cast<Albany::ModelEvaluator&>(*model_evaluators_[subdomain]);
-          auto const& nv        = me.getNominalValues();
-          prev_disp_[subdomain] = Thyra::createMember(me.get_x_space());
+          auto&       me = dynamic_cast<Albany::ModelEvaluator&>(*model_evaluators_[subdomain]);
+          auto const& nv = me.getNominalValues();
+          allocateIfNull(prev_disp_[subdomain], me.get_x_space());
+          allocateIfNull(prev_velo_[subdomain], me.get_x_space());
+          allocateIfNull(prev_acce_[subdomain], me.get_x_space());
+          allocateIfNull(this_disp_[subdomain], me.get_x_space());
+          allocateIfNull(this_velo_[subdomain], me.get_x_space());
+          allocateIfNull(this_acce_[subdomain], me.get_x_space());
           Thyra::copy(*(nv.get_x()), prev_disp_[subdomain].ptr());
-          prev_velo_[subdomain] = Thyra::createMember(me.get_x_space());
           Thyra::copy(*(nv.get_x_dot()), prev_velo_[subdomain].ptr());
-          prev_acce_[subdomain] = Thyra::createMember(me.get_x_space());
           Thyra::copy(*(nv.get_x_dot_dot()), prev_acce_[subdomain].ptr());
         } else {
-          Thyra::put_scalar(0.0, prev_disp_[subdomain].ptr());
-          Thyra::copy(*this_disp_[subdomain], prev_disp_[subdomain].ptr());
-          Thyra::put_scalar(0.0, prev_velo_[subdomain].ptr());
-          Thyra::copy(*this_velo_[subdomain], prev_velo_[subdomain].ptr());
-          Thyra::put_scalar(0.0, prev_acce_[subdomain].ptr());
-          Thyra::copy(*this_acce_[subdomain], prev_acce_[subdomain].ptr());
+          std::swap(prev_disp_[subdomain], this_disp_[subdomain]);
+          std::swap(prev_velo_[subdomain], this_velo_[subdomain]);
+          std::swap(prev_acce_[subdomain], this_acce_[subdomain]);
         }
 
         // Solve for each subdomain
@@ -590,14 +672,17 @@ SchwarzAlternating::SchwarzLoopDynamics() const
 
         Teuchos::RCP<Tempus::SolutionHistory<ST>> solution_history;
         Teuchos::RCP<Tempus::SolutionState<ST>>   current_state;
-        Teuchos::RCP<Thyra_Vector>                ic_disp_rcp = Thyra::createMember(me.get_x_space());
 
-        Teuchos::RCP<Thyra_Vector> ic_velo_rcp = Thyra::createMember(me.get_x_space());
+        // Tempus may modify its initial state, so it gets copies of
+        // ics_disp_[subdomain], etc. in buffers kept for that purpose.
+        allocateIfNull(tempus_ic_disp_[subdomain], me.get_x_space());
+        allocateIfNull(tempus_ic_velo_[subdomain], me.get_x_space());
+        allocateIfNull(tempus_ic_acce_[subdomain], me.get_x_space());
 
-        Teuchos::RCP<Thyra_Vector> ic_acce_rcp = Thyra::createMember(me.get_x_space());
+        Teuchos::RCP<Thyra_Vector> ic_disp_rcp = tempus_ic_disp_[subdomain];
+        Teuchos::RCP<Thyra_Vector> ic_velo_rcp = tempus_ic_velo_[subdomain];
+        Teuchos::RCP<Thyra_Vector> ic_acce_rcp = tempus_ic_acce_[subdomain];
 
-        // set ic_disp_rcp, ic_velo_rcp and ic_acce_rcp
-        // by making copy of what is in ics_disp_[subdomain], etc.
         Thyra_Vector& ic_disp = *ics_disp_[subdomain];
         Thyra_Vector& ic_velo = *ics_velo_[subdomain];
         Thyra_Vector& ic_acce = *ics_acce_[subdomain];
@@ -614,12 +699,6 @@ SchwarzAlternating::SchwarzLoopDynamics() const
 
         solver.evalModel(in_args, out_args);
 
-        // Allocate current solution vectors
-
-        this_disp_[subdomain] = Thyra::createMember(me.get_x_space());
-        this_velo_[subdomain] = Thyra::createMember(me.get_x_space());
-        this_acce_[subdomain] = Thyra::createMember(me.get_x_space());
-
         // Check whether solver did OK.
 
         auto const status = piro_tempus_solver.getTempusIntegratorStatus();
@@ -640,16 +719,17 @@ SchwarzAlternating::SchwarzLoopDynamics() const
         Thyra::copy(*current_state->getXDot(), this_velo_[subdomain].ptr());
         Thyra::copy(*current_state->getXDotDot(), this_acce_[subdomain].ptr());
 
-        Teuchos::RCP<Thyra_Vector> disp_diff_rcp = Thyra::createMember(me.get_x_space());
-        Thyra::put_scalar<ST>(0.0, disp_diff_rcp.ptr());
+        allocateIfNull(disp_diff_[subdomain], me.get_x_space());
+        allocateIfNull(velo_diff_[subdomain], me.get_x_space());
+        allocateIfNull(acce_diff_[subdomain], me.get_x_space());
+
+        Teuchos::RCP<Thyra_Vector> disp_diff_rcp = disp_diff_[subdomain];
         Thyra::V_VpStV(disp_diff_rcp.ptr(), *this_disp_[subdomain], -1.0, *prev_disp_[subdomain]);
 
-        Teuchos::RCP<Thyra_Vector> velo_diff_rcp = Thyra::createMember(me.get_x_space());
-        Thyra::put_scalar<ST>(0.0, velo_diff_rcp.ptr());
+        Teuchos::RCP<Thyra_Vector> velo_diff_rcp = velo_diff_[subdomain];
         Thyra::V_VpStV(velo_diff_rcp.ptr(), *this_velo_[subdomain], -1.0, *prev_velo_[subdomain]);
 
-        Teuchos::RCP<Thyra_Vector> acce_diff_rcp = Thyra::createMember(me.get_x_space());
-        Thyra::put_scalar<ST>(0.0, acce_diff_rcp.ptr());
+        Teuchos::RCP<Thyra_Vector> acce_diff_rcp = acce_diff_[subdomain];
         Thyra::V_VpStV(acce_diff_rcp.ptr(), *this_acce_[subdomain], -1.0, *prev_acce_[subdomain]);
 
         // After solve, save solution and get info to check convergence
@@ -669,6 +749,13 @@ SchwarzAlternating::SchwarzLoopDynamics() const
         norms_final(subdomain) += dt2 * Thyra::norm(*this_acce_[subdomain]);
         norms_diff(subdomain) += dt2 * Thyra::norm(*acce_diff_rcp);
 
+        // With additive ordering the subdomains still to be solved in this
+        // iteration must see the previous iterate as boundary data.
+        if (ordering_ == SubdomainOrdering::ADDITIVE) {
+          setSchwarzBoundaryData(
+              subdomain, prev_disp_[subdomain], prev_velo_[subdomain], prev_acce_[subdomain], next_time);
+        }
+
       }  // Subdomains loop
 
       if (failed_ == true) {
@@ -678,6 +765,14 @@ SchwarzAlternating::SchwarzLoopDynamics() const
         break;
       }
 
+      // Exchange boundary data for the next additive iteration
+      if (ordering_ == SubdomainOrdering::ADDITIVE) {
+        for (auto subdomain = 0; subdomain < num_subdomains_; ++subdomain) {
+          setSchwarzBoundaryData(
+              subdomain, this_disp_[subdomain], this_velo_[subdomain], this_acce_[subdomain], next_time);
+        }
+      }
+
       norm_init_  = minitensor::norm(norms_init);
       norm_final_ = minitensor::norm(norms_final);
       norm_diff_  = minitensor::norm(norms_diff);
@@ -751,11 +846,8 @@ SchwarzAlternating::SchwarzLoopDynamics() const
 
       // Restore previous solutions
       for (auto subdomain = 0; subdomain < num_subdomains_; ++subdomain) {
-        Thyra::put_scalar(0.0, this_disp_[subdomain].ptr());
         Thyra::copy(*ics_disp_[subdomain], this_disp_[subdomain].ptr());
-        Thyra::put_scalar(0.0, this_velo_[subdomain].ptr());
         Thyra::copy(*ics_velo_[subdomain], this_velo_[subdomain].ptr());
-        Thyra::put_scalar(0.0, this_acce_[subdomain].ptr());
         Thyra::copy(*ics_acce_[subdomain], this_acce_[subdomain].ptr());
 
         // restore the state manager with the state variables from the previous
@@ -764,15 +856,10 @@ SchwarzAlternating::SchwarzLoopDynamics() const
         auto& state_mgr = app.getStateMgr();
         fromTo(internal_states_[subdomain], state_mgr.getStateArrays());
 
-        // restore the solution in the discretization so the schwarz solver gets
-        // the right boundary conditions!
-        Teuchos::RCP<Thyra_Vector const> disp_rcp_thyra = ics_disp_[subdomain];
-        Teuchos::RCP<Thyra_Vector const> velo_rcp_thyra = ics_velo_[subdomain];
-        Teuchos::RCP<Thyra_Vector const> acce_rcp_thyra = ics_acce_[subdomain];
-
-        Teuchos::RCP<Albany::AbstractDiscretization> const& app_disc = app.getDiscretization();
-
-        app_disc->writeSolutionToMeshDatabase(*disp_rcp_thyra, *velo_rcp_thyra, *acce_rcp_thyra, current_time);
+        // restore the solution in the application and the discretization so
+        // the schwarz solver gets the right boundary conditions!
+        setSchwarzBoundaryData(
+            subdomain, ics_disp_[subdomain], ics_velo_[subdomain], ics_acce_[subdomain], current_time);
       }
 
       // Jump to the beginning of the time-step loop without advancing
@@ -782,6 +869,8 @@ SchwarzAlternating::SchwarzLoopDynamics() const
 
     reportFinals(fos);
 
+    total_iters += num_iter_;
+
     // Update IC vecs and output solution to exodus file
 
     for (auto subdomain = 0; subdomain < num_subdomains_; ++subdomain) {
@@ -808,6 +897,8 @@ SchwarzAlternating::SchwarzLoopDynamics() const
 
   }  // Time-step loop
 
+  total_timer.stop();
+  reportTotals(fos, total_iters, total_timer.totalElapsedTime());
   return;
 }
 
@@ -824,11 +915,9 @@ SchwarzAlternating::setExplicitUpdateInitialGuessForSchwarz(ST const current_tim
     Thyra_Vector& ic_acce = *ics_acce_[subdomain];
 
     auto& me = dynamic_cast<Albany::ModelEvaluator&>(*model_evaluators_[subdomain]);
-    if (current_time == 0) {
-      this_disp_[subdomain] = Thyra::createMember(me.get_x_space());
-      this_velo_[subdomain] = Thyra::createMember(me.get_x_space());
-      this_acce_[subdomain] = Thyra::createMember(me.get_x_space());
-    }
+    allocateIfNull(this_disp_[subdomain], me.get_x_space());
+    allocateIfNull(this_velo_[subdomain], me.get_x_space());
+    allocateIfNull(this_acce_[subdomain], me.get_x_space());
 
     const ST aConst = time_step * time_step / 2.0;
     Thyra::V_StVpStV(this_disp_[subdomain].ptr(), time_step, ic_velo, aConst, ic_acce);
@@ -877,13 +966,13 @@ SchwarzAlternating::setDynamicICVecsAndDoOutput(ST const time) const
 
       auto const& nv = me.getNominalValues();
 
-      ics_disp_[subdomain] = Thyra::createMember(me.get_x_space());
+      allocateIfNull(ics_disp_[subdomain], me.get_x_space());
       Thyra::copy(*(nv.get_x()), ics_disp_[subdomain].ptr());
 
-      ics_velo_[subdomain] = Thyra::createMember(me.get_x_space());
+      allocateIfNull(ics_velo_[subdomain], me.get_x_space());
       Thyra::copy(*(nv.get_x_dot()), ics_velo_[subdomain].ptr());
 
-      ics_acce_[subdomain] = Thyra::createMember(me.get_x_space());
+      allocateIfNull(ics_acce_[subdomain], me.get_x_space());
       Thyra::copy(*(nv.get_x_dot_dot()), ics_acce_[subdomain].ptr());
 
       // Write initial condition to STK mesh
@@ -899,13 +988,13 @@ SchwarzAlternating::setDynamicICVecsAndDoOutput(ST const time) const
       Teuchos::RCP<Thyra_MultiVector> disp_mv = stk_disc.getSolutionMV();
 
       // Update ics_disp_ and its time-derivatives
-      ics_disp_[subdomain] = Thyra::createMember(disp_mv->col(0)->space());
+      allocateIfNull(ics_disp_[subdomain], disp_mv->col(0)->space());
       Thyra::copy(*disp_mv->col(0), ics_disp_[subdomain].ptr());
 
-      ics_velo_[subdomain] = Thyra::createMember(disp_mv->col(1)->space());
+      allocateIfNull(ics_velo_[subdomain], disp_mv->col(1)->space());
       Thyra::copy(*disp_mv->col(1), ics_velo_[subdomain].ptr());
 
-      ics_acce_[subdomain] = Thyra::createMember(disp_mv->col(2)->space());
+      allocateIfNull(ics_acce_[subdomain], disp_mv->col(2)->space());
       Thyra::copy(*disp_mv->col(2), ics_acce_[subdomain].ptr());
 
       if (do_outputs_[subdomain] == true) {  // write solution to Exodus
@@ -959,6 +1048,9 @@ SchwarzAlternating::SchwarzLoopQuasistatics() const
   ST  time_step{initial_time_step_};
   int stop{0};
   ST  current_time{initial_time_};
+  int total_iters{0};
+
+  Teuchos::Time total_timer("Schwarz Alternating Quasistatics", true);
 
   // Output initial configuration.
   doQuasistaticOutput(current_time);
@@ -992,9 +1084,14 @@ SchwarzAlternating::SchwarzLoopQuasistatics() const
       // extra logic is necessary for initial values in the
       // Schwarz and subdomain loops.
       if (stop == 0) {
-        auto& me = dynamic_cast<Albany::ModelEvaluator&>(*model_evaluators_[subdomain]);
+        auto& me   = dynamic_cast<Albany::ModelEvaluator&>(*model_evaluators_[subdomain]);
+        auto& ring = disp_ring_[subdomain];
+
+        for (auto& buffer : ring) {
+          if (buffer == Teuchos::null) buffer = Thyra::createMember(me.get_x_space());
+        }
 
-        auto zero_disp_rcp = Thyra::createMember(me.get_x_space());
+        auto zero_disp_rcp = ring[0];
         auto zero_disp_ptr = zero_disp_rcp.ptr();
 
         Thyra::put_scalar<ST>(0.0, zero_disp_ptr);
@@ -1035,10 +1132,13 @@ SchwarzAlternating::SchwarzLoopQuasistatics() const
         auto& state_mgr = app.getStateMgr();
         fromTo(internal_states_[subdomain], state_mgr.getStateArrays());
 
-        // Restore solution from previous time step
+        // Warm start the solver from the previous Schwarz iterate unless the
+        // solution at the previous step is asked. "Standard Initial Guess"
+        // only applies to dynamics, so existing quasistatic inputs keep the
+        // warm start.
         auto prev_step_disp_rcp = prev_step_disp_[subdomain];
 
-        nv.set_x(prev_disp_rcp);
+        nv.set_x(qs_init_guess_ == true ? prev_step_disp_rcp : prev_disp_rcp);
         me.setNominalValues(nv);
 
         // Target time
@@ -1065,15 +1165,17 @@ SchwarzAlternating::SchwarzLoopQuasistatics() const
           break;
         }
 
-        // Solver OK, extract solution
-        auto        curr_disp_rcp = thyra_nox_solver.get_current_x()->clone_v();
-        auto const& curr_disp     = *curr_disp_rcp;
+        // Solver OK, extract solution into the free buffer of the ring
+        auto curr_disp_rcp = nextDispBuffer(subdomain);
+        Thyra::copy(*thyra_nox_solver.get_current_x(), curr_disp_rcp.ptr());
+        auto const& curr_disp = *curr_disp_rcp;
 
         // Compute difference between previous and current solutions
-        auto disp_diff_rcp = Thyra::createMember(me.get_x_space());
+        allocateIfNull(disp_diff_[subdomain], me.get_x_space());
+
+        auto disp_diff_rcp = disp_diff_[subdomain];
         auto disp_diff_ptr = disp_diff_rcp.ptr();
 
-        Thyra::put_scalar<ST>(0.0, disp_diff_ptr);
         Thyra::V_VpStV(disp_diff_ptr, curr_disp, -1.0, prev_disp);
 
         auto& disp_diff = *disp_diff_rcp;
@@ -1084,6 +1186,12 @@ SchwarzAlternating::SchwarzLoopQuasistatics() const
         norms_final(subdomain) = Thyra::norm(curr_disp);
         norms_diff(subdomain)  = Thyra::norm(disp_diff);
 
+        // With additive ordering the subdomains still to be solved in this
+        // iteration must see the previous iterate as boundary data.
+        if (ordering_ == SubdomainOrdering::ADDITIVE) {
+          setSchwarzBoundaryData(subdomain, prev_disp_rcp, Teuchos::null, Teuchos::null, next_time);
+        }
+
       }  // Subdomain loop
 
       if (failed_ == true) {
@@ -1093,6 +1201,13 @@ SchwarzAlternating::SchwarzLoopQuasistatics() const
         break;
       }
 
+      // Exchange boundary data for the next additive iteration
+      if (ordering_ == SubdomainOrdering::ADDITIVE) {
+        for (auto subdomain = 0; subdomain < num_subdomains_; ++subdomain) {
+          setSchwarzBoundaryData(subdomain, curr_disp_[subdomain], Teuchos::null, Teuchos::null, next_time);
+        }
+      }
+
       norm_init_  = minitensor::norm(norms_init);
       norm_final_ = minitensor::norm(norms_final);
       norm_diff_  = minitensor::norm(norms_diff);
@@ -1176,12 +1291,9 @@ SchwarzAlternating::SchwarzLoopQuasistatics() const
 
         fromTo(internal_states_[subdomain], state_mgr.getStateArrays());
 
-        // Restore the solution in the discretization so the schwarz solver gets
-        // the right boundary conditions!
-        Teuchos::RCP<Thyra_Vector const>                    disp_rcp_thyra = curr_disp_[subdomain];
-        Teuchos::RCP<Albany::AbstractDiscretization> const& app_disc       = app.getDiscretization();
-
-        app_disc->writeSolutionToMeshDatabase(*disp_rcp_thyra, current_time);
+        // Restore the solution in the application and the discretization so
+        // the schwarz solver gets the right boundary conditions!
+        setSchwarzBoundaryData(subdomain, curr_disp_[subdomain], Teuchos::null, Teuchos::null, current_time);
       }
 
       // Jump to the beginning of the continuation loop without advancing
@@ -1191,6 +1303,8 @@ SchwarzAlternating::SchwarzLoopQuasistatics() const
 
     reportFinals(fos);
 
+    total_iters += num_iter_;
+
     // Output converged solution if at specified interval
 
     for (auto subdomain = 0; subdomain < num_subdomains_; ++subdomain) {
@@ -1216,6 +1330,9 @@ SchwarzAlternating::SchwarzLoopQuasistatics() const
     }
 
   }  // Continuation loop
+
+  total_timer.stop();
+  reportTotals(fos, total_iters, total_timer.totalElapsedTime());
 }
 
 }  // namespace LCM
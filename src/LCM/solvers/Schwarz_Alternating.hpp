@@ -6,6 +6,7 @@
 #if !defined(LCM_SchwarzAlternating_hpp)
 #define LCM_SchwarzAlternating_hpp
 
+#include <array>
 #include <functional>
 
 #include "Albany_AbstractDiscretization.hpp"
@@ -104,6 +105,24 @@ class SchwarzAlternating : public Thyra::ResponseOnlyModelEvaluatorBase<ST>
     OR
   };
 
+  ///
+  /// Order of the subdomain solves within a Schwarz iteration.
+  ///
+  /// MULTIPLICATIVE: each subdomain sees the boundary data that the
+  ///   subdomains before it produced in the same iteration.
+  /// ADDITIVE: every subdomain sees the boundary data of the previous
+  ///   iteration, and the new data is exchanged once all have solved.
+  ///   The subdomain solves of an iteration are then independent.
+  ///
+  /// Only the order changes: with either one the subdomains are solved one
+  /// after another on the full communicator.
+  ///
+  enum class SubdomainOrdering
+  {
+    MULTIPLICATIVE,
+    ADDITIVE
+  };
+
  private:
   /// Create operator form of dg/dx for distributed responses
   Teuchos::RCP<Thyra::LinearOpBase<ST>>
@@ -151,6 +170,24 @@ class SchwarzAlternating : public Thyra::ResponseOnlyModelEvaluatorBase<ST>
   void
   reportFinals(std::ostream& os) const;
 
+  void
+  reportTotals(std::ostream& os, int const total_iters, double const total_time) const;
+
+  /// Buffer of the quasistatic ring that holds neither the current iterate
+  /// nor the solution at the previous step, to receive the next solve.
+  Teuchos::RCP<Thyra_Vector>
+  nextDispBuffer(int const subdomain) const;
+
+  /// Make the given solution the boundary data that other subdomains see
+  /// from subdomain. Velocity and acceleration are only set for dynamics.
+  void
+  setSchwarzBoundaryData(
+      int const                               subdomain,
+      Teuchos::RCP<Thyra_Vector const> const& disp,
+      Teuchos::RCP<Thyra_Vector const> const& velo,
+      Teuchos::RCP<Thyra_Vector const> const& acce,
+      ST const                                time) const;
+
   std::vector<Teuchos::RCP<Thyra::ResponseOnlyModelEvaluatorBase<ST>>> solvers_;
   Teuchos::ArrayRCP<Teuchos::RCP<Albany::Application>>                 apps_;
   std::vector<Teuchos::RCP<Albany::AbstractSTKMeshStruct>>             stk_mesh_structs_;
@@ -185,15 +222,31 @@ class SchwarzAlternating : public Thyra::ResponseOnlyModelEvaluatorBase<ST>
   mutable ConvergenceCriterion       criterion_{ConvergenceCriterion::BOTH};
   mutable ConvergenceLogicalOperator operator_{ConvergenceLogicalOperator::AND};
 
+  SubdomainOrdering ordering_{SubdomainOrdering::MULTIPLICATIVE};
+
   mutable std::vector<Teuchos::RCP<Thyra::VectorBase<ST> const>> curr_disp_;
   mutable std::vector<Teuchos::RCP<Thyra::VectorBase<ST> const>> prev_step_disp_;
 
+  // Quasistatic solution buffers per subdomain. curr_disp_ and
+  // prev_step_disp_ point into the ring, so no vector is allocated or
+  // cloned inside the Schwarz loop.
+  mutable std::vector<std::array<Teuchos::RCP<Thyra::VectorBase<ST>>, 3>> disp_ring_;
+
+  // Differences between consecutive Schwarz iterates, allocated on first use
+  // like the buffers above. Velocity and acceleration are only for dynamics.
+  mutable std::vector<Teuchos::RCP<Thyra::VectorBase<ST>>> disp_diff_;
+  mutable std::vector<Teuchos::RCP<Thyra::VectorBase<ST>>> velo_diff_;
+  mutable std::vector<Teuchos::RCP<Thyra::VectorBase<ST>>> acce_diff_;
+
   mutable std::vector<Thyra::ModelEvaluatorBase::InArgs<ST>>   sub_inargs_;
   mutable std::vector<Thyra::ModelEvaluatorBase::OutArgs<ST>>  sub_outargs_;
   mutable std::vector<Teuchos::RCP<Thyra::ModelEvaluator<ST>>> model_evaluators_;
   mutable std::vector<Teuchos::RCP<Thyra::VectorBase<ST>>>     ics_disp_;
   mutable std::vector<Teuchos::RCP<Thyra::VectorBase<ST>>>     ics_velo_;
   mutable std::vector<Teuchos::RCP<Thyra::VectorBase<ST>>>     ics_acce_;
+  mutable std::vector<Teuchos::RCP<Thyra::VectorBase<ST>>>     tempus_ic_disp_;
+  mutable std::vector<Teuchos::RCP<Thyra::VectorBase<ST>>>     tempus_ic_velo_;
+  mutable std::vector<Teuchos::RCP<Thyra::VectorBase<ST>>>     tempus_ic_acce_;
   mutable std::vector<Teuchos::RCP<Thyra::VectorBase<ST>>>     prev_disp_;
   mutable std::vector<Teuchos::RCP<Thyra::VectorBase<ST>>>     prev_velo_;
   mutable std::vector<Teuchos::RCP<Thyra::VectorBase<ST>>>     prev_acce_;
@@ -209,6 +262,9 @@ class SchwarzAlternating : public Thyra::ResponseOnlyModelEvaluatorBase<ST>
   bool is_static_{false};
   bool is_dynamic_{false};
   bool std_init_guess_{false};
+  // Start quasistatic subdomain solves from the previous step solution
+  // instead of the previous Schwarz iterate
+  bool qs_init_guess_{false};
 };
 
 }  // namespace LCM
@@ -258,6 +258,7 @@ TEUCHOS_UNIT_TEST(HeliumODEs, test1)
   double end_time = 100.0;
   for (double time(0.0); time < end_time; time += delta_time[0]) {
     total_concentration[0] = 0.005;
+    stateMgr.markNewStatesWritten();
 
     // Call the evaluators, evaluateFields() computes things
     field_manager.preEvaluate<Residual>(workset);
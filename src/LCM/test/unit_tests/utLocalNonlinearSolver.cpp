@@ -4,6 +4,7 @@
 #include <LocalNonlinearSolver.hpp>
 #include <Sacado.hpp>
 #include <Teuchos_UnitTestHarness.hpp>
+#include <array>
 
 #include "PHAL_AlbanyTraits.hpp"
 
@@ -117,4 +118,122 @@ TEUCHOS_UNIT_TEST(LocalNonlinearSolver, Jacobian)
   TEST_COMPARE(fabs(X[0].val() - refX[0]), <=, 1.0e-15);
 }
 
+TEUCHOS_UNIT_TEST(LocalNonlinearSolver, FixedSizeResidual)
+{
+  typedef PHAL::AlbanyTraits                    Traits;
+  typedef PHAL::AlbanyTraits::Residual          EvalT;
+  typedef PHAL::AlbanyTraits::Residual::ScalarT ScalarT;
+
+  // local objective function and solution
+  std::array<ScalarT, 1>                      F{};
+  std::array<ScalarT, 1>                      dFdX{};
+  std::array<ScalarT, 1>                      X{};
+  LCM::LocalNonlinearSolver<EvalT, Traits, 1> solver;
+
+  // initialize X
+  X[0] = 1.0;
+
+  int  count(0);
+  bool converged = false;
+  while (!converged && count < 10) {
+    // objective function --> x^2 - 2 == 0
+    F[0]    = X[0] * X[0] - 2.0;
+    dFdX[0] = 2.0 * X[0];
+
+    solver.solve(dFdX, X, F);
+
+    if (fabs(F[0]) <= 1.0E-15) converged = true;
+
+    count++;
+  }
+
+  const RealType refX[] = {std::sqrt(2)};
+  TEST_COMPARE(fabs(X[0] - refX[0]), <=, 1.0e-15);
+}
+
+TEUCHOS_UNIT_TEST(LocalNonlinearSolver, FixedSizeJacobian)
+{
+  typedef PHAL::AlbanyTraits                    Traits;
+  typedef PHAL::AlbanyTraits::Jacobian          EvalT;
+  typedef PHAL::AlbanyTraits::Jacobian::ScalarT ScalarT;
+
+  // local objective function and solution
+  std::array<ScalarT, 1>                      F{};
+  std::array<ScalarT, 1>                      dFdX{};
+  std::array<ScalarT, 1>                      X{};
+  LCM::LocalNonlinearSolver<EvalT, Traits, 1> solver;
+
+  // initialize X
+  X[0] = 1.0;
+
+  ScalarT two(1, 0, 2.0);
+  int     count(0);
+  bool    converged = false;
+  while (!converged && count < 10) {
+    // objective function --> x^2 - 2 == 0
+    F[0]    = X[0] * X[0] - two;
+    dFdX[0] = 2.0 * X[0];
+
+    solver.solve(dFdX, X, F);
+
+    if (fabs(F[0]) <= 1.0E-15) converged = true;
+
+    count++;
+  }
+
+  F[0] = X[0] * X[0] - two;
+  solver.computeFadInfo(dFdX, X, F);
+
+  // x = sqrt(p) --> dx/dp = 1 / (2 sqrt(p))
+  const RealType refX[]    = {std::sqrt(2)};
+  const RealType refdXdP[] = {0.5 / std::sqrt(2)};
+  TEST_COMPARE(fabs(X[0].val() - refX[0]), <=, 1.0e-15);
+  TEST_COMPARE(fabs(X[0].dx(0) - refdXdP[0]), <=, 1.0e-15);
+}
+
+TEUCHOS_UNIT_TEST(LocalNonlinearSolver, FixedSizeMatchesLAPACK)
+{
+  typedef PHAL::AlbanyTraits                    Traits;
+  typedef PHAL::AlbanyTraits::Jacobian          EvalT;
+  typedef PHAL::AlbanyTraits::Jacobian::ScalarT ScalarT;
+
+  // one size solved inline and one that falls back to LAPACK
+  int const sizes[]       = {4, 13};
+  int const numGlobalVars = 3;
+
+  for (int n : sizes) {
+    std::vector<ScalarT> A(n * n);
+    std::vector<ScalarT> B(n);
+    for (int i = 0; i < n; ++i) {
+      B[i] = ScalarT(numGlobalVars, 0.1 * (i + 1));
+      for (int k = 0; k < numGlobalVars; ++k) B[i].fastAccessDx(k) = 0.01 * (i + k + 1);
+      for (int j = 0; j < n; ++j) A[i + n * j] = (i == j ? 4.0 : 0.0) + 1.0 / (i + 2 * j + 1);
+    }
+
+    std::vector<ScalarT> A_dynamic(A), B_dynamic(B), X_dynamic(n, 0.0);
+    std::vector<ScalarT> A_fixed(A), B_fixed(B), X_fixed(n, 0.0);
+
+    LCM::LocalNonlinearSolver<EvalT, Traits> dynamic_solver;
+    dynamic_solver.solve(A_dynamic, X_dynamic, B_dynamic);
+    dynamic_solver.computeFadInfo(A, X_dynamic, B);
+
+    if (n == 4) {
+      LCM::LocalNonlinearSolver<EvalT, Traits, 4> fixed_solver;
+      fixed_solver.solve(A_fixed, X_fixed, B_fixed);
+      fixed_solver.computeFadInfo(A, X_fixed, B);
+    } else {
+      LCM::LocalNonlinearSolver<EvalT, Traits, 13> fixed_solver;
+      fixed_solver.solve(A_fixed, X_fixed, B_fixed);
+      fixed_solver.computeFadInfo(A, X_fixed, B);
+    }
+
+    for (int i = 0; i < n; ++i) {
+      TEST_COMPARE(fabs(X_fixed[i].val() - X_dynamic[i].val()), <=, 1.0e-14);
+      for (int k = 0; k < numGlobalVars; ++k) {
+        TEST_COMPARE(fabs(X_fixed[i].dx(k) - X_dynamic[i].dx(k)), <=, 1.0e-14);
+      }
+    }
+  }
+}
+
 }  // namespace
@@ -0,0 +1,293 @@
+// Albany 3.0: Copyright 2016 National Technology & Engineering Solutions of
+// Sandia, LLC (NTESS). This Software is released under the BSD license detailed
+// in the file license.txt in the top-level Albany directory.
+#include <Teuchos_UnitTestHarness.hpp>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <set>
+#include <vector>
+
+#include "../../utils/mortar/Moertel_BoxSearch.hpp"
+
+namespace {
+
+using Point = std::array<double, 3>;
+
+// A planar quad mesh of nx by ny cells on [x0, x0 + lx] x [0, ly] at z
+struct QuadMesh
+{
+  std::vector<Point>              nodes;
+  std::vector<std::array<int, 4>> quads;
+};
+
+QuadMesh
+quadMesh(int nx, int ny, double x0, double lx, double ly, double z)
+{
+  QuadMesh mesh;
+  for (int j = 0; j <= ny; ++j)
+    for (int i = 0; i <= nx; ++i) mesh.nodes.push_back({x0 + lx * i / nx, ly * j / ny, z});
+  for (int j = 0; j < ny; ++j)
+    for (int i = 0; i < nx; ++i) {
+      int const n = j * (nx + 1) + i;
+      mesh.quads.push_back({n, n + 1, n + nx + 2, n + nx + 1});
+    }
+  return mesh;
+}
+
+double
+distance(Point const& a, Point const& b)
+{
+  double d = 0.0;
+  for (int k = 0; k < 3; ++k) d += (a[k] - b[k]) * (a[k] - b[k]);
+  return std::sqrt(d);
+}
+
+// Largest node to node distance of a quad, as in OverlapT::QuickOverlapTest
+double
+diameter(QuadMesh const& mesh, int q)
+{
+  double diam = 0.0;
+  for (int i = 0; i < 4; ++i)
+    for (int j = i + 1; j < 4; ++j)
+      diam = std::max(diam, distance(mesh.nodes[mesh.quads[q][i]], mesh.nodes[mesh.quads[q][j]]));
+  return diam;
+}
+
+// The rough test of OverlapT::QuickOverlapTest
+bool
+roughOverlap(QuadMesh const& slave, int s, QuadMesh const& master, int m, double radius)
+{
+  double mindist = std::numeric_limits<double>::max();
+  for (int i = 0; i < 4; ++i)
+    for (int j = 0; j < 4; ++j)
+      mindist = std::min(mindist, distance(slave.nodes[slave.quads[s][i]], master.nodes[master.quads[m][j]]));
+  return mindist <= radius * (diameter(slave, s) + diameter(master, m));
+}
+
+// A fake distribution of an interface over nproc procs. Segments are
+// owned by x strips and a node is owned by the lowest proc among the
+// segments that use it, which is how InterfaceT leaves a node on one proc
+// only. Each proc box is the box of its own nodes grown by the halo width,
+// as in InterfaceT::HaloSegmentsAndNodes.
+struct Partition
+{
+  std::vector<std::vector<int>> segments[2];
+  std::vector<double>           boxes;
+};
+
+Partition
+partition(QuadMesh const* mesh, int nproc, double lx, double halowidth)
+{
+  Partition part;
+  part.boxes.resize(6 * nproc);
+  for (int proc = 0; proc < nproc; ++proc) MoertelT::EmptyBox(&part.boxes[6 * proc]);
+  for (int side = 0; side < 2; ++side) {
+    part.segments[side].resize(nproc);
+    std::vector<int> nodeowner(mesh[side].nodes.size(), nproc);
+    for (int q = 0; q < static_cast<int>(mesh[side].quads.size()); ++q) {
+      double xc = 0.0;
+      for (int i = 0; i < 4; ++i) xc += 0.25 * mesh[side].nodes[mesh[side].quads[q][i]][0];
+      int const proc = std::min(nproc - 1, static_cast<int>(nproc * xc / lx));
+      part.segments[side][proc].push_back(q);
+      for (int i = 0; i < 4; ++i) {
+        int& owner = nodeowner[mesh[side].quads[q][i]];
+        owner      = std::min(owner, proc);
+      }
+    }
+    for (int n = 0; n < static_cast<int>(nodeowner.size()); ++n)
+      MoertelT::AddToBox(&part.boxes[6 * nodeowner[n]], mesh[side].nodes[n], halowidth);
+  }
+  return part;
+}
+
+TEUCHOS_UNIT_TEST(MoertelBoxSearch, Boxes)
+{
+  double box[6];
+  MoertelT::EmptyBox(box);
+  double const other[6] = {0.0, 0.0, 0.0, 1.0, 1.0, 1.0};
+  TEST_EQUALITY(MoertelT::BoxesOverlap(box, other), false);
+
+  MoertelT::AddToBox(box, Point{1.0, 1.0, 1.0}, 0.5);
+  TEST_EQUALITY(MoertelT::BoxesOverlap(box, other), true);
+  TEST_EQUALITY(MoertelT::PointInBox(box, Point{0.5, 1.5, 1.0}), true);
+  TEST_EQUALITY(MoertelT::PointInBox(box, Point{0.4, 1.0, 1.0}), false);
+
+  double const far[6] = {1.6, 0.0, 0.0, 2.0, 1.0, 1.0};
+  TEST_EQUALITY(MoertelT::BoxesOverlap(box, far), false);
+}
+
+TEUCHOS_UNIT_TEST(MoertelBoxSearch, HaloNeighborsAreSymmetric)
+{
+  int const       nproc   = 5;
+  double const    lx      = 5.0;
+  double const    radius  = 2.5;
+  QuadMesh const  mesh[2] = {quadMesh(20, 4, 0.0, lx, 1.0, 0.0), quadMesh(13, 3, 0.0, lx, 1.0, 0.0)};
+  double const    maxdiam = std::sqrt(std::pow(lx / 13.0, 2) + std::pow(1.0 / 3.0, 2));
+  Partition const part    = partition(mesh, nproc, lx, (1.0 + 2.0 * radius) * maxdiam);
+
+  std::vector<std::set<int>> neighbors(nproc);
+  for (int proc = 0; proc < nproc; ++proc) {
+    std::vector<int> const list = MoertelT::HaloNeighbors(proc, nproc, &part.boxes[0]);
+    neighbors[proc].insert(list.begin(), list.end());
+    TEST_EQUALITY(neighbors[proc].count(proc), 0);
+  }
+  for (int proc = 0; proc < nproc; ++proc)
+    for (int other : neighbors[proc]) TEST_EQUALITY(neighbors[other].count(proc), 1);
+}
+
+// After the halo exchange every proc must hold each master segment the
+// rough test can accept for one of its own slave segments, otherwise
+// Integrate would miss that pair.
+TEUCHOS_UNIT_TEST(MoertelBoxSearch, HaloCoversRoughSearch)
+{
+  int const      nproc   = 4;
+  double const   lx      = 4.0;
+  double const   radius  = 2.5;
+  QuadMesh const mesh[2] = {quadMesh(16, 4, 0.0, lx, 1.0, 0.0), quadMesh(11, 3, 0.0, lx, 1.0, 0.0)};
+
+  double maxdiam = 0.0;
+  for (int side = 0; side < 2; ++side)
+    for (int q = 0; q < static_cast<int>(mesh[side].quads.size()); ++q)
+      maxdiam = std::max(maxdiam, diameter(mesh[side], q));
+
+  Partition const part = partition(mesh, nproc, lx, (1.0 + 2.0 * radius) * maxdiam);
+
+  for (int proc = 0; proc < nproc; ++proc) {
+    // own master segments plus those a neighbor sends because their box
+    // overlaps the box of proc
+    std::set<int> held(part.segments[1][proc].begin(), part.segments[1][proc].end());
+    for (int other : MoertelT::HaloNeighbors(proc, nproc, &part.boxes[0]))
+      for (int m : part.segments[1][other]) {
+        double mbox[6];
+        MoertelT::EmptyBox(mbox);
+        for (int i = 0; i < 4; ++i) MoertelT::AddToBox(mbox, mesh[1].nodes[mesh[1].quads[m][i]]);
+        if (MoertelT::BoxesOverlap(mbox, &part.boxes[6 * proc])) held.insert(m);
+      }
+
+    for (int s : part.segments[0][proc])
+      for (int m = 0; m < static_cast<int>(mesh[1].quads.size()); ++m)
+        if (roughOverlap(mesh[0], s, mesh[1], m, radius)) TEST_EQUALITY(held.count(m), 1);
+  }
+}
+
+// Box of each quad of mesh, grown by radius times its diagonal plus margin
+// as in InterfaceT::BroadPhaseSearch_3D
+std::vector<double>
+enlargedBoxes(QuadMesh const& mesh, double radius, double margin)
+{
+  std::vector<double> boxes(6 * mesh.quads.size());
+  for (std::size_t q = 0; q < mesh.quads.size(); ++q) {
+    double* box = &boxes[6 * q];
+    MoertelT::EmptyBox(box);
+    for (int i = 0; i < 4; ++i) MoertelT::AddToBox(box, mesh.nodes[mesh.quads[q][i]]);
+    MoertelT::EnlargeBox(box, radius, margin);
+  }
+  return boxes;
+}
+
+// Two warped, nonconforming quad meshes a small gap apart
+void
+warpedPair(QuadMesh* mesh)
+{
+  mesh[0] = quadMesh(9, 7, 0.0, 3.0, 2.0, 0.0);
+  mesh[1] = quadMesh(5, 4, 0.1, 3.0, 2.0, 0.05);
+  std::mt19937                           gen(5);
+  std::uniform_real_distribution<double> jitter(-0.05, 0.05);
+  for (int side = 0; side < 2; ++side)
+    for (Point& x : mesh[side].nodes) {
+      x[2] += 0.2 * std::sin(x[0]) * std::cos(x[1]);
+      for (int k = 0; k < 3; ++k) x[k] += jitter(gen);
+    }
+}
+
+TEUCHOS_UNIT_TEST(MoertelBoxSearch, GridMatchesAllPairs)
+{
+  std::mt19937                           gen(3);
+  std::uniform_real_distribution<double> corner(0.0, 10.0);
+  std::uniform_real_distribution<double> size(0.0, 1.5);
+
+  int const           nbox = 200;
+  std::vector<double> boxes(6 * nbox);
+  for (int b = 0; b < nbox; ++b) {
+    double* box = &boxes[6 * b];
+    for (int k = 0; k < 3; ++k) {
+      box[k]     = corner(gen);
+      box[3 + k] = box[k] + size(gen);
+    }
+  }
+
+  MoertelT::BoxGrid grid(&boxes[0], nbox);
+  std::vector<int>  found;
+
+  for (int query = 0; query < 100; ++query) {
+    double box[6];
+    for (int k = 0; k < 3; ++k) {
+      box[k]     = corner(gen) - 1.0;
+      box[3 + k] = box[k] + 2.0 * size(gen);
+    }
+
+    std::vector<int> all;
+    for (int b = 0; b < nbox; ++b)
+      if (MoertelT::BoxesOverlap(box, &boxes[6 * b])) all.push_back(b);
+
+    found.clear();
+    grid.Overlapping(box, found);
+    TEST_COMPARE_ARRAYS(found, all);
+  }
+}
+
+// Every pair the rough test of OverlapT accepts has to be a broad phase
+// candidate, otherwise Integrate_3D would skip it
+TEUCHOS_UNIT_TEST(MoertelBoxSearch, CandidatesCoverRoughSearch)
+{
+  double const radius = 2.5;
+  QuadMesh     mesh[2];
+  warpedPair(mesh);
+
+  std::vector<double> const boxes[2] = {enlargedBoxes(mesh[0], radius, 0.0), enlargedBoxes(mesh[1], radius, 0.0)};
+  MoertelT::BoxGrid         grid(&boxes[1][0], mesh[1].quads.size());
+  std::vector<int>          found;
+
+  for (int s = 0; s < static_cast<int>(mesh[0].quads.size()); ++s) {
+    found.clear();
+    grid.Overlapping(&boxes[0][6 * s], found);
+    std::set<int> const candidates(found.begin(), found.end());
+    for (int m = 0; m < static_cast<int>(mesh[1].quads.size()); ++m)
+      if (roughOverlap(mesh[0], s, mesh[1], m, radius)) TEST_EQUALITY(candidates.count(m), 1);
+  }
+}
+
+// Candidates found with a margin stay complete while no node coordinate
+// moves further than the reuse criterion of BroadPhaseSearch_3D allows
+TEUCHOS_UNIT_TEST(MoertelBoxSearch, CandidatesCoverMotionWithinMargin)
+{
+  double const radius = 2.5;
+  double const margin = 0.1;
+  QuadMesh     mesh[2];
+  warpedPair(mesh);
+
+  std::vector<double> const boxes[2] = {enlargedBoxes(mesh[0], radius, margin),
+                                        enlargedBoxes(mesh[1], radius, margin)};
+  MoertelT::BoxGrid         grid(&boxes[1][0], mesh[1].quads.size());
+
+  // move the master side towards the slave side and shear it
+  double const maxdisp = margin / (1.0 + 2.0 * std::sqrt(3.0) * radius);
+  QuadMesh     moved   = mesh[1];
+  for (Point& x : moved.nodes) {
+    x[0] += maxdisp * std::cos(3.0 * x[1]);
+    x[2] -= maxdisp;
+  }
+
+  std::vector<int> found;
+  for (int s = 0; s < static_cast<int>(mesh[0].quads.size()); ++s) {
+    found.clear();
+    grid.Overlapping(&boxes[0][6 * s], found);
+    std::set<int> const candidates(found.begin(), found.end());
+    for (int m = 0; m < static_cast<int>(moved.quads.size()); ++m)
+      if (roughOverlap(mesh[0], s, moved, m, radius)) TEST_EQUALITY(candidates.count(m), 1);
+  }
+}
+
+}  // namespace
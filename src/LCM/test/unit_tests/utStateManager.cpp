@@ -0,0 +1,92 @@
+// Albany 3.0: Copyright 2016 National Technology & Engineering Solutions of
+// Sandia, LLC (NTESS). This Software is released under the BSD license detailed
+// in the file license.txt in the top-level Albany directory.
+#include <Teuchos_ParameterList.hpp>
+#include <Teuchos_UnitTestHarness.hpp>
+
+#include "Albany_STKDiscretization.hpp"
+#include "Albany_StateManager.hpp"
+#include "Albany_TmplSTKMeshStruct.hpp"
+#include "Albany_Utils.hpp"
+#include "PHAL_AlbanyTraits.hpp"
+
+namespace {
+
+TEUCHOS_UNIT_TEST(StateManager, UpdateStatesTwice)
+{
+  int const                                     workset_size = 1;
+  int const                                     num_pts      = 1;
+  std::string const                             block_name   = "Block0";
+  Teuchos::RCP<PHX::MDALayout<Cell, QuadPoint>> qp_scalar =
+      Teuchos::rcp(new PHX::MDALayout<Cell, QuadPoint>(workset_size, num_pts));
+
+  // One state with an old state
+  Albany::StateManager stateMgr;
+  stateMgr.registerStateVariable("eqps", qp_scalar, block_name, "scalar", 0.0, true);
+
+  // Create a discretization, as required by the StateManager
+  Teuchos::RCP<Teuchos::ParameterList> discretizationParameterList =
+      Teuchos::rcp(new Teuchos::ParameterList("Discretization"));
+  discretizationParameterList->set<int>("1D Elements", workset_size);
+  discretizationParameterList->set<int>("2D Elements", 1);
+  discretizationParameterList->set<int>("3D Elements", 1);
+  discretizationParameterList->set<std::string>("Method", "STK3D");
+  discretizationParameterList->set<int>("Number Of Time Derivatives", 0);
+  discretizationParameterList->set<std::string>("Exodus Output File Name", "utStateManager.exo");
+  Teuchos::RCP<Teuchos_Comm const> commT             = Albany::createTeuchosCommFromMpiComm(MPI_COMM_WORLD);
+  int                              numberOfEquations = 3;
+  Albany::AbstractFieldContainer::FieldContainerRequirements req;
+  Teuchos::RCP<Albany::AbstractSTKMeshStruct>                stkMeshStruct =
+      Teuchos::rcp(new Albany::TmplSTKMeshStruct<3>(discretizationParameterList, Teuchos::null, commT));
+  stkMeshStruct->setFieldAndBulkData(
+      commT,
+      discretizationParameterList,
+      numberOfEquations,
+      req,
+      stateMgr.getStateInfoStruct(),
+      stkMeshStruct->getMeshSpecs()[0]->worksetSize);
+  Teuchos::RCP<Albany::AbstractDiscretization> discretization =
+      Teuchos::rcp(new Albany::STKDiscretization(discretizationParameterList, stkMeshStruct, commT));
+  auto& stk_disc = static_cast<Albany::STKDiscretization&>(*discretization);
+  stk_disc.updateMesh();
+  stateMgr.setupStateArrays(discretization);
+
+  // Reading or writing the arrays does not count as an evaluation, only
+  // markNewStatesWritten does
+  auto old_value = [&stateMgr]() { return stateMgr.getStateArrays().elemStateArrays[0].at("eqps_old")(0, 0); };
+
+  // Evaluate, then update twice: the second update must not trade the
+  // arrays back
+  stateMgr.getStateArray(Albany::StateManager::ELEM, 0).at("eqps")(0, 0) = 1.0;
+  stateMgr.markNewStatesWritten();
+  stateMgr.updateStates();
+  TEST_EQUALITY(old_value(), 1.0);
+  stateMgr.updateStates();
+  TEST_EQUALITY(old_value(), 1.0);
+
+  // The next evaluation advances the old state again
+  stateMgr.getStateArray(Albany::StateManager::ELEM, 0).at("eqps")(0, 0) = 2.0;
+  stateMgr.markNewStatesWritten();
+  stateMgr.updateStates();
+  TEST_EQUALITY(old_value(), 2.0);
+  stateMgr.updateStates();
+  TEST_EQUALITY(old_value(), 2.0);
+
+  // Handing out the arrays without a fill, as output and responses do, must
+  // not trade them
+  stateMgr.getStateArray(Albany::StateManager::ELEM, 0);
+  stateMgr.getStateHandleArray(0);
+  stateMgr.updateStates();
+  TEST_EQUALITY(old_value(), 2.0);
+
+  // A workset that cached its array pointer keeps advancing
+  Albany::StateArray* const cached = &stateMgr.getStateArray(Albany::StateManager::ELEM, 0);
+  for (int step = 3; step < 6; ++step) {
+    cached->at("eqps")(0, 0) = step;
+    stateMgr.markNewStatesWritten();
+    stateMgr.updateStates();
+    TEST_EQUALITY(old_value(), static_cast<double>(step));
+  }
+}
+
+}  // namespace
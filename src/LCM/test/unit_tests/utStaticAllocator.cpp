@@ -5,6 +5,7 @@
 #include <gtest/gtest.h>
 
 #include <iostream>
+#include <thread>
 
 #include "../../../utility/StaticAllocator.hpp"
 
@@ -108,6 +109,42 @@ TEST(StaticPointerTest, Move)
   ASSERT_FALSE(active);
 }
 
+TEST(ThreadLocalAllocatorTest, ReusedAndCleared)
+{
+  auto& alloc1 = threadLocalAllocator(1024);
+
+  auto tarray1 = alloc1.create<TestArray<1024>>();
+  ASSERT_NE(tarray1, StaticPointer<TestArray<1024>>());
+
+  // Same thread gets the same buffer back, cleared
+  auto& alloc2 = threadLocalAllocator(1024);
+  ASSERT_EQ(&alloc1, &alloc2);
+
+  auto tarray2 = alloc2.create<TestArray<1024>>();
+  ASSERT_EQ(tarray1.get(), tarray2.get());
+  tarray1.release();
+}
+
+TEST(ThreadLocalAllocatorTest, Grow)
+{
+  threadLocalAllocator(128);
+
+  auto& alloc = threadLocalAllocator(2048);
+  ASSERT_GE(alloc.capacity(), 2048);
+  ASSERT_NO_THROW(alloc.create<TestArray<2048>>());
+}
+
+TEST(ThreadLocalAllocatorTest, PerThread)
+{
+  StaticAllocator* main_alloc  = &threadLocalAllocator(256);
+  StaticAllocator* other_alloc = nullptr;
+
+  std::thread other([&other_alloc]() { other_alloc = &threadLocalAllocator(256); });
+  other.join();
+
+  ASSERT_NE(main_alloc, other_alloc);
+}
+
 }  // namespace
 
 int
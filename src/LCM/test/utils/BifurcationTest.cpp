@@ -17,6 +17,7 @@
 #include <Teuchos_ParameterList.hpp>
 #include <Teuchos_RCP.hpp>
 #include <Teuchos_as.hpp>
+#include <chrono>
 #include <iomanip>
 #include <iostream>
 #include <random>
@@ -24,6 +25,7 @@
 
 #include "Albany_Layouts.hpp"
 #include "Albany_MaterialDatabase.hpp"
+#include "BifurcationSweep.hpp"
 #include "LocalNonlinearSolver.hpp"
 #include "Phalanx_Evaluator_Derived.hpp"
 #include "Phalanx_Evaluator_WithBaseImpl.hpp"
@@ -306,6 +308,48 @@ cartesian_sweep(minitensor::Tensor4<double, 3> const& CC)
   return;
 }
 
+// Time the uniform and the coarse to fine sweeps of a parametrization with
+// 2 / interval + 1 points per parameter.
+template <typename Parametrization, minitensor::Index N>
+void
+sweep_benchmark(
+    std::string const&                    name,
+    minitensor::Tensor4<double, 3> const& CC,
+    double const                          domain_min,
+    double const                          domain_max,
+    double const                          interval)
+{
+  int const                                num_repeats = 20;
+  minitensor::Index const                  p_number    = std::floor(1.0 / interval);
+  minitensor::Vector<double, N>            grid_min;
+  minitensor::Vector<double, N>            grid_max;
+  minitensor::Vector<minitensor::Index, N> num_points;
+  for (minitensor::Index i = 0; i < N; ++i) {
+    grid_min(i)   = domain_min;
+    grid_max(i)   = domain_max;
+    num_points(i) = 2 * p_number + 1;
+  }
+
+  std::cout << std::scientific << std::setprecision(8);
+  for (bool const adaptive : {false, true}) {
+    minitensor::Vector<double, N> arg_minimum;
+    minitensor::Vector<double, 3> direction;
+    double                        minimum = 0.0;
+
+    auto const start = std::chrono::steady_clock::now();
+    for (int k = 0; k < num_repeats; ++k) {
+      minimum = LCM::bifurcation_grid_sweep<Parametrization>(
+          CC, grid_min, grid_max, num_points, adaptive, arg_minimum, direction);
+    }
+    auto const                          end     = std::chrono::steady_clock::now();
+    std::chrono::duration<double> const elapsed = end - start;
+
+    std::cout << name << (adaptive == true ? " coarse to fine" : " uniform        ") << " interval " << interval
+              << " minimum " << minimum << " at " << arg_minimum << " time per sweep "
+              << elapsed.count() / num_repeats << " s\n";
+  }
+}
+
 minitensor::Vector<D2FadType, 3>
 spherical_get_normal(minitensor::Vector<D2FadType, 2>& parameters)
 {
@@ -1006,5 +1050,27 @@ main(int ac, char* av[])
   // std::cout << "Time cost: " << timeuse << std::endl;
   // std::cout << std::endl;
 
+  // Compare the uniform sweeps with the coarse to fine ones.
+  std::cout << "\n*** SWEEP BENCHMARK ***\n";
+  double const pi = std::acos(-1.0);
+  for (double const interval : {0.05, 0.02}) {
+    sweep_benchmark<minitensor::SphericalParametrization<double, 3>, 2>("Spherical    ", tangent, 0.0, pi, interval);
+    sweep_benchmark<minitensor::StereographicParametrization<double, 3>, 2>(
+        "Stereographic", tangent, -1.0, 1.0, interval);
+    sweep_benchmark<minitensor::ProjectiveParametrization<double, 3>, 3>("Projective   ", tangent, -1.0, 1.0, interval);
+  }
+
+  // The lower bound is what is paid per point when it proves ellipticity.
+  {
+    int const  num_repeats = 1000;
+    double     lower_bound = 0.0;
+    auto const start       = std::chrono::steady_clock::now();
+    for (int k = 0; k < num_repeats; ++k) lower_bound = LCM::min_detA_lower_bound(tangent);
+    auto const                          end     = std::chrono::steady_clock::now();
+    std::chrono::duration<double> const elapsed = end - start;
+
+    std::cout << "Lower bound of min det(A): " << lower_bound << " time " << elapsed.count() / num_repeats << " s\n";
+  }
+
   return 0;
 }
@@ -0,0 +1,381 @@
+// Albany 3.0: Copyright 2016 National Technology & Engineering Solutions of
+// Sandia, LLC (NTESS). This Software is released under the BSD license detailed
+// in the file license.txt in the top-level Albany directory.
+// Micro-benchmark for the per integration point setup of the crystal
+// plasticity kernel on a 24-slip FCC crystal, the 12 {111}<110> systems in
+// both senses. Times the setup the kernel did before, a fresh 1 MB
+// StaticAllocator and a rotated copy of the slip systems at every point,
+// against the current one, the thread-local arena and a view of slip systems
+// rotated once per cell. Each point then resolves a fixed stress and updates
+// hardness and slips, and both paths must give identical slips.
+
+#include <MiniTensor.h>
+#include <Teuchos_CommandLineProcessor.hpp>
+#include <Teuchos_GlobalMPISession.hpp>
+#include <Teuchos_ParameterList.hpp>
+#include <Teuchos_Time.hpp>
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "Albany_Utils.hpp"
+#include "KokkosGuard.hpp"
+#include "PHAL_AlbanyTraits.hpp"
+#include "../../../utility/StaticAllocator.hpp"
+#include "core/CrystalPlasticity/CrystalPlasticityCore.hpp"
+#include "core/CrystalPlasticity/ParameterReader.hpp"
+
+namespace {
+
+using SlipSystems  = std::vector<CP::SlipSystem<CP::MAX_DIM>>;
+using SlipFamilies = std::vector<CP::SlipFamily<CP::MAX_DIM, CP::MAX_SLIP>>;
+using Rotation     = minitensor::Tensor<RealType, CP::MAX_DIM>;
+
+// Same arena size as CrystalPlasticityKernel::operator().
+std::size_t const arena_size = 1024 * 1024;
+
+//
+// One slip family with power law flow and linear minus recovery hardening
+// over the 24 FCC slip systems.
+//
+Teuchos::ParameterList
+fccParameters()
+{
+  Teuchos::ParameterList p;
+
+  p.set<int>("Number of Slip Families", 1);
+  p.set<int>("Number of Slip Systems", 24);
+
+  Teuchos::ParameterList& family = p.sublist("Slip System Family 0");
+
+  Teuchos::ParameterList& flow = family.sublist("Flow Rule");
+  flow.set<std::string>("Type", "Power Law");
+  flow.set<RealType>("Reference Slip Rate", 1.0e-3);
+  flow.set<RealType>("Rate Exponent", 50.0);
+
+  Teuchos::ParameterList& hardening = family.sublist("Hardening Law");
+  hardening.set<std::string>("Type", "Linear Minus Recovery");
+  hardening.set<RealType>("Hardening Modulus", 10.0);
+  hardening.set<RealType>("Recovery Modulus", 0.0);
+  hardening.set<RealType>("Initial Hardening State", 1.0);
+
+  RealType const normals[4][3] = {{1, 1, 1}, {-1, 1, 1}, {-1, -1, 1}, {1, -1, 1}};
+
+  RealType const directions[4][3][3] = {
+      {{-1, 1, 0}, {0, -1, 1}, {1, 0, -1}},
+      {{-1, -1, 0}, {1, 0, 1}, {0, 1, -1}},
+      {{1, -1, 0}, {0, 1, 1}, {-1, 0, -1}},
+      {{1, 1, 0}, {-1, 0, 1}, {0, -1, -1}}};
+
+  int num_ss = 0;
+  for (RealType const sense : {1.0, -1.0}) {
+    for (int plane = 0; plane < 4; ++plane) {
+      for (int dir = 0; dir < 3; ++dir) {
+        Teuchos::ParameterList& ss_list = p.sublist(Albany::strint("Slip System", ++num_ss));
+
+        Teuchos::Array<RealType> s(3);
+        Teuchos::Array<RealType> n(3);
+        for (int i = 0; i < 3; ++i) {
+          s[i] = sense * directions[plane][dir][i];
+          n[i] = normals[plane][i];
+        }
+        ss_list.set<int>("Slip Family", 0);
+        ss_list.set<Teuchos::Array<RealType>>("Slip Direction", s);
+        ss_list.set<Teuchos::Array<RealType>>("Slip Normal", n);
+      }
+    }
+  }
+  return p;
+}
+
+//
+// Same slip system setup as CrystalPlasticityModel, without the elasticity
+// and integrator parts that this benchmark does not exercise.
+//
+void
+readSlipSystems(Teuchos::ParameterList& p, SlipSystems& slip_systems, SlipFamilies& slip_families)
+{
+  int const num_family = p.get<int>("Number of Slip Families", 1);
+  int const num_slip   = p.get<int>("Number of Slip Systems", 0);
+
+  CP::ParameterReader<PHAL::AlbanyTraits::Residual, PHAL::AlbanyTraits> preader(&p);
+
+  slip_families.reserve(num_family);
+  for (int num_fam(0); num_fam < num_family; ++num_fam) {
+    slip_families.emplace_back(preader.getSlipFamily(num_fam));
+  }
+
+  slip_systems.resize(num_slip);
+  for (int num_ss = 0; num_ss < num_slip; ++num_ss) {
+    Teuchos::ParameterList ss_list = p.sublist(Albany::strint("Slip System", num_ss + 1));
+
+    auto& slip_system              = slip_systems[num_ss];
+    slip_system.slip_family_index_ = ss_list.get<int>("Slip Family", 0);
+
+    auto& slip_family = slip_families[slip_system.slip_family_index_];
+    slip_family.slip_system_indices_[slip_family.num_slip_sys_] = num_ss;
+    slip_family.num_slip_sys_++;
+
+    std::vector<RealType> const s = ss_list.get<Teuchos::Array<RealType>>("Slip Direction").toVector();
+    std::vector<RealType> const n = ss_list.get<Teuchos::Array<RealType>>("Slip Normal").toVector();
+
+    minitensor::Vector<RealType, CP::MAX_DIM> s_unit(CP::MAX_DIM);
+    minitensor::Vector<RealType, CP::MAX_DIM> n_unit(CP::MAX_DIM);
+    for (int i = 0; i < CP::MAX_DIM; ++i) {
+      s_unit[i] = s[i];
+      n_unit[i] = n[i];
+    }
+    slip_system.s_         = minitensor::unit(s_unit);
+    slip_system.n_         = minitensor::unit(n_unit);
+    slip_system.projector_ = minitensor::dyad(slip_system.s_, slip_system.n_);
+
+    auto const index_param = slip_family.phardening_parameters_->param_map_["Initial Hardening State"];
+
+    slip_system.state_hardening_initial_ =
+        ss_list.get<RealType>("Initial Hardening State", slip_family.phardening_parameters_->getParameter(index_param));
+  }
+
+  for (auto& slip_family : slip_families) {
+    slip_family.phardening_parameters_->setValueAsymptotic();
+    slip_family.phardening_parameters_->createLatentMatrix(slip_family, slip_systems);
+    slip_family.slip_system_indices_.set_dimension(slip_family.num_slip_sys_);
+  }
+}
+
+//
+// A different lattice orientation for every cell, as when orientations are
+// read from the mesh.
+//
+Rotation
+cellRotation(int cell)
+{
+  RealType const a = 0.1 * (cell % 31);
+  RealType const b = 0.2 * (cell % 17);
+
+  Rotation Rz(CP::MAX_DIM, minitensor::Filler::ZEROS);
+  Rz(0, 0) = std::cos(a);
+  Rz(0, 1) = -std::sin(a);
+  Rz(1, 0) = std::sin(a);
+  Rz(1, 1) = std::cos(a);
+  Rz(2, 2) = 1.0;
+
+  Rotation Rx(CP::MAX_DIM, minitensor::Filler::ZEROS);
+  Rx(0, 0) = 1.0;
+  Rx(1, 1) = std::cos(b);
+  Rx(1, 2) = -std::sin(b);
+  Rx(2, 1) = std::sin(b);
+  Rx(2, 2) = std::cos(b);
+
+  return Rz * Rx;
+}
+
+void
+rotateSlipSystems(Rotation const& rotation, SlipSystems const& slip_systems, CP::SlipSystem<CP::MAX_DIM>* rotated)
+{
+  for (std::size_t num_ss = 0; num_ss < slip_systems.size(); ++num_ss) {
+    auto& slip_system = rotated[num_ss];
+
+    slip_system            = slip_systems[num_ss];
+    slip_system.s_         = rotation * slip_systems[num_ss].s_;
+    slip_system.n_         = rotation * slip_systems[num_ss].n_;
+    slip_system.projector_ = minitensor::dyad(slip_system.s_, slip_system.n_);
+  }
+}
+
+//
+// The work that follows the setup at every point: resolve a fixed stress on
+// the rotated slip systems and update hardness and slips. The arena holds the
+// slip rate, as the integrator the kernel creates in it would.
+//
+void
+updatePoint(
+    utility::StaticAllocator&       allocator,
+    CP::SlipSystemView<CP::MAX_DIM> slip_systems,
+    SlipFamilies const&             slip_families,
+    Rotation const&                 sigma,
+    std::vector<RealType>::iterator slips)
+{
+  minitensor::Index const num_slip = slip_systems.size();
+  RealType const          dt       = 1.0e-3;
+
+  auto rate_slip = allocator.create<minitensor::Vector<RealType, CP::MAX_SLIP>>(num_slip, minitensor::Filler::ZEROS);
+
+  minitensor::Vector<RealType, CP::MAX_SLIP> slip_n(num_slip, minitensor::Filler::ZEROS);
+  minitensor::Vector<RealType, CP::MAX_SLIP> state_hardening_n(num_slip);
+  minitensor::Vector<RealType, CP::MAX_SLIP> state_hardening_np1(num_slip);
+  minitensor::Vector<RealType, CP::MAX_SLIP> slip_resistance(num_slip);
+  minitensor::Vector<RealType, CP::MAX_SLIP> shear(num_slip);
+  minitensor::Vector<RealType, CP::MAX_SLIP> slip_np1(num_slip);
+
+  for (minitensor::Index s = 0; s < num_slip; ++s) {
+    state_hardening_n[s] = slip_systems[s].state_hardening_initial_;
+    shear[s]             = minitensor::dotdot(slip_systems[s].projector_, sigma);
+  }
+
+  bool failed{false};
+
+  CP::updateHardness(
+      slip_systems, slip_families, dt, *rate_slip, state_hardening_n, state_hardening_np1, slip_resistance, failed);
+
+  CP::updateSlip(slip_systems, slip_families, dt, slip_resistance, shear, slip_n, slip_np1, failed);
+
+  for (minitensor::Index s = 0; s < num_slip; ++s) {
+    *slips++ = slip_np1[s];
+  }
+}
+
+//
+// Times one setup path over num_cells cells of num_points points and returns
+// the slips it produced, flattened.
+//
+template <typename Setup>
+std::vector<RealType>
+runPath(
+    std::string const&  label,
+    Setup               setup,
+    SlipSystems const&  slip_systems,
+    SlipFamilies const& slip_families,
+    int                 num_cells,
+    int                 num_points)
+{
+  Rotation sigma(CP::MAX_DIM, minitensor::Filler::ZEROS);
+  sigma(0, 0) = 1.2;
+  sigma(1, 1) = -0.4;
+  sigma(0, 1) = sigma(1, 0) = 0.3;
+  sigma(1, 2) = sigma(2, 1) = 0.2;
+
+  std::vector<RealType> slips(static_cast<std::size_t>(num_cells) * num_points * slip_systems.size());
+
+  Teuchos::Time timer(label);
+  timer.start(true);
+  setup(slip_systems, slip_families, sigma, num_cells, num_points, slips);
+  timer.stop();
+
+  double const points = static_cast<double>(num_cells) * num_points;
+  std::cout << std::setw(24) << std::left << label << std::setw(12) << std::right << timer.totalElapsedTime()
+            << " s  " << std::setw(14) << points / timer.totalElapsedTime() << " points/s" << std::endl;
+
+  return slips;
+}
+
+//
+// Before: the kernel built a fresh arena and a rotated copy of the slip
+// systems at every point.
+//
+void
+setupPerPoint(
+    SlipSystems const&     slip_systems,
+    SlipFamilies const&    slip_families,
+    Rotation const&        sigma,
+    int                    num_cells,
+    int                    num_points,
+    std::vector<RealType>& slips)
+{
+  auto out = slips.begin();
+  for (int cell = 0; cell < num_cells; ++cell) {
+    Rotation const rotation = cellRotation(cell);
+    for (int pt = 0; pt < num_points; ++pt) {
+      utility::StaticAllocator allocator(arena_size);
+
+      SlipSystems element_slip_systems = slip_systems;
+      rotateSlipSystems(rotation, slip_systems, element_slip_systems.data());
+
+      updatePoint(allocator, CP::SlipSystemView<CP::MAX_DIM>(element_slip_systems), slip_families, sigma, out);
+      out += slip_systems.size();
+    }
+  }
+}
+
+//
+// After: the slip systems are rotated once per cell, as in init(), and every
+// point reuses the thread-local arena.
+//
+void
+setupPerCell(
+    SlipSystems const&     slip_systems,
+    SlipFamilies const&    slip_families,
+    Rotation const&        sigma,
+    int                    num_cells,
+    int                    num_points,
+    std::vector<RealType>& slips)
+{
+  std::size_t const num_slip = slip_systems.size();
+
+  SlipSystems rotated_slip_systems(num_cells * num_slip);
+  for (int cell = 0; cell < num_cells; ++cell) {
+    rotateSlipSystems(cellRotation(cell), slip_systems, &rotated_slip_systems[cell * num_slip]);
+  }
+
+  auto out = slips.begin();
+  for (int cell = 0; cell < num_cells; ++cell) {
+    CP::SlipSystemView<CP::MAX_DIM> const element_slip_systems(&rotated_slip_systems[cell * num_slip], num_slip);
+    for (int pt = 0; pt < num_points; ++pt) {
+      utility::StaticAllocator& allocator = utility::threadLocalAllocator(arena_size);
+
+      updatePoint(allocator, element_slip_systems, slip_families, sigma, out);
+      out += num_slip;
+    }
+  }
+}
+
+}  // anonymous namespace
+
+int
+main(int ac, char* av[])
+{
+  KokkosGuard kokkos(ac, av);
+
+  Teuchos::CommandLineProcessor command_line_processor;
+
+  command_line_processor.setDocString(
+      "Crystal Plasticity Arena.\n"
+      "Compares per point and per cell setup of the crystal plasticity\n"
+      "kernel on a 24-slip FCC crystal.\n");
+
+  int num_cells = 10000;
+  command_line_processor.setOption("ncells", &num_cells, "Number of Cells");
+
+  int num_points = 8;
+  command_line_processor.setOption("npoints", &num_points, "Number of Points per Cell");
+
+  command_line_processor.recogniseAllOptions(true);
+  command_line_processor.throwExceptions(false);
+
+  Teuchos::CommandLineProcessor::EParseCommandLineReturn parse_return = command_line_processor.parse(ac, av);
+
+  if (parse_return == Teuchos::CommandLineProcessor::PARSE_HELP_PRINTED) {
+    return 0;
+  }
+
+  if (parse_return != Teuchos::CommandLineProcessor::PARSE_SUCCESSFUL) {
+    return 1;
+  }
+
+  Teuchos::GlobalMPISession mpi_session(&ac, &av);
+
+  Teuchos::ParameterList param_list = fccParameters();
+
+  SlipSystems  slip_systems;
+  SlipFamilies slip_families;
+  readSlipSystems(param_list, slip_systems, slip_families);
+
+  std::cout << std::setprecision(6);
+  std::cout << "Slip systems: " << slip_systems.size() << ", cells: " << num_cells << ", points per cell: " << num_points
+            << std::endl;
+
+  std::vector<RealType> const before =
+      runPath("Per point setup", setupPerPoint, slip_systems, slip_families, num_cells, num_points);
+  std::vector<RealType> const after =
+      runPath("Per cell setup", setupPerCell, slip_systems, slip_families, num_cells, num_points);
+
+  RealType max_diff = 0.0;
+  for (std::size_t i = 0; i < before.size(); ++i) {
+    max_diff = std::max(max_diff, std::abs(before[i] - after[i]));
+  }
+  std::cout << "Max slip difference: " << max_diff << std::endl;
+
+  return max_diff == 0.0 ? 0 : 1;
+}
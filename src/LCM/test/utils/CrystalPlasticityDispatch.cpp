@@ -0,0 +1,339 @@
+// Albany 3.0: Copyright 2016 National Technology & Engineering Solutions of
+// Sandia, LLC (NTESS). This Software is released under the BSD license detailed
+// in the file license.txt in the top-level Albany directory.
+// Micro-benchmark for crystal plasticity flow rule and hardening law dispatch.
+// Reads the slip families and slip systems of a MaterialPointSimulator input
+// and times the per-slip updates through the virtual factory path against the
+// statically dispatched CP::updateSlip and CP::updateHardness, for the
+// Residual and Jacobian scalar types. Both paths must give identical results.
+
+#include <MiniTensor.h>
+#include <Teuchos_CommandLineProcessor.hpp>
+#include <Teuchos_GlobalMPISession.hpp>
+#include <Teuchos_ParameterList.hpp>
+#include <Teuchos_RCP.hpp>
+#include <Teuchos_Time.hpp>
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "Albany_MaterialDatabase.hpp"
+#include "Albany_Utils.hpp"
+#include "KokkosGuard.hpp"
+#include "PHAL_AlbanyTraits.hpp"
+#include "core/CrystalPlasticity/CrystalPlasticityCore.hpp"
+#include "core/CrystalPlasticity/ParameterReader.hpp"
+
+namespace {
+
+using SlipSystems  = std::vector<CP::SlipSystem<CP::MAX_DIM>>;
+using SlipFamilies = std::vector<CP::SlipFamily<CP::MAX_DIM, CP::MAX_SLIP>>;
+
+//
+// Same slip system setup as CrystalPlasticityModel, without the elasticity
+// and integrator parts that this benchmark does not exercise.
+//
+void
+readSlipSystems(Teuchos::ParameterList& p, SlipSystems& slip_systems, SlipFamilies& slip_families)
+{
+  int const num_family = p.get<int>("Number of Slip Families", 1);
+  int const num_slip   = p.get<int>("Number of Slip Systems", 0);
+
+  CP::ParameterReader<PHAL::AlbanyTraits::Residual, PHAL::AlbanyTraits> preader(&p);
+
+  slip_families.reserve(num_family);
+  for (int num_fam(0); num_fam < num_family; ++num_fam) {
+    slip_families.emplace_back(preader.getSlipFamily(num_fam));
+  }
+
+  slip_systems.resize(num_slip);
+  for (int num_ss = 0; num_ss < num_slip; ++num_ss) {
+    Teuchos::ParameterList ss_list = p.sublist(Albany::strint("Slip System", num_ss + 1));
+
+    auto& slip_system              = slip_systems[num_ss];
+    slip_system.slip_family_index_ = ss_list.get<int>("Slip Family", 0);
+
+    auto& slip_family = slip_families[slip_system.slip_family_index_];
+    slip_family.slip_system_indices_[slip_family.num_slip_sys_] = num_ss;
+    slip_family.num_slip_sys_++;
+
+    std::vector<RealType> const s = ss_list.get<Teuchos::Array<RealType>>("Slip Direction").toVector();
+    std::vector<RealType> const n = ss_list.get<Teuchos::Array<RealType>>("Slip Normal").toVector();
+
+    minitensor::Vector<RealType, CP::MAX_DIM> s_unit(CP::MAX_DIM);
+    minitensor::Vector<RealType, CP::MAX_DIM> n_unit(CP::MAX_DIM);
+    for (int i = 0; i < CP::MAX_DIM; ++i) {
+      s_unit[i] = s[i];
+      n_unit[i] = n[i];
+    }
+    slip_system.s_         = minitensor::unit(s_unit);
+    slip_system.n_         = minitensor::unit(n_unit);
+    slip_system.projector_ = minitensor::dyad(slip_system.s_, slip_system.n_);
+
+    auto const index_param = slip_family.phardening_parameters_->param_map_["Initial Hardening State"];
+
+    slip_system.state_hardening_initial_ =
+        ss_list.get<RealType>("Initial Hardening State", slip_family.phardening_parameters_->getParameter(index_param));
+  }
+
+  for (auto& slip_family : slip_families) {
+    slip_family.phardening_parameters_->setValueAsymptotic();
+    slip_family.phardening_parameters_->createLatentMatrix(slip_family, slip_systems);
+    slip_family.slip_system_indices_.set_dimension(slip_family.num_slip_sys_);
+  }
+}
+
+inline RealType
+seedValue(RealType const&, int, int, RealType value)
+{
+  return value;
+}
+
+inline FadType
+seedValue(FadType const&, int num_derivs, int index, RealType value)
+{
+  return FadType(num_derivs, index % num_derivs, value);
+}
+
+//
+// The dispatch that CP::updateSlip and CP::updateHardness used before they
+// were devirtualized: one factory and one virtual call per slip system and
+// per slip family.
+//
+template <typename ArgT>
+bool
+updateVirtual(
+    SlipSystems const&                                slip_systems,
+    SlipFamilies const&                               slip_families,
+    RealType                                          dt,
+    minitensor::Vector<ArgT, CP::MAX_SLIP> const&     shear,
+    minitensor::Vector<RealType, CP::MAX_SLIP> const& slip_n,
+    minitensor::Vector<RealType, CP::MAX_SLIP> const& state_hardening_n,
+    minitensor::Vector<ArgT, CP::MAX_SLIP>&           slip_np1,
+    minitensor::Vector<ArgT, CP::MAX_SLIP>&           state_hardening_np1,
+    minitensor::Vector<ArgT, CP::MAX_SLIP>&           slip_resistance)
+{
+  bool failed{false};
+
+  minitensor::Vector<ArgT, CP::MAX_SLIP> const rate_slip_n = (slip_np1 - slip_n) / dt;
+
+  for (auto const& slip_family : slip_families) {
+    CP::HardeningLawFactory<CP::MAX_DIM, CP::MAX_SLIP> hardening_law_factory;
+
+    auto phardening = hardening_law_factory.template createHardeningLaw<ArgT>(slip_family.getHardeningLawType());
+
+    phardening->harden(
+        slip_family, slip_systems, dt, rate_slip_n, state_hardening_n, state_hardening_np1, slip_resistance, failed);
+  }
+
+  for (unsigned int ss_index(0); ss_index < slip_systems.size(); ++ss_index) {
+    auto const& slip_family = slip_families[slip_systems[ss_index].slip_family_index_];
+
+    CP::FlowRuleFactory flow_rule_factory;
+
+    auto pflow = flow_rule_factory.template createFlowRule<ArgT>(slip_family.getFlowRuleType());
+
+    ArgT const rate_slip =
+        pflow->computeRateSlip(slip_family.pflow_parameters_, shear[ss_index], slip_resistance[ss_index], failed);
+
+    if (std::abs(rate_slip) > slip_family.pflow_parameters_->max_incr_) return true;
+
+    slip_np1[ss_index] = slip_n[ss_index] + dt * rate_slip;
+  }
+
+  return failed;
+}
+
+template <typename ArgT>
+bool
+updateStatic(
+    SlipSystems const&                                slip_systems,
+    SlipFamilies const&                               slip_families,
+    RealType                                          dt,
+    minitensor::Vector<ArgT, CP::MAX_SLIP> const&     shear,
+    minitensor::Vector<RealType, CP::MAX_SLIP> const& slip_n,
+    minitensor::Vector<RealType, CP::MAX_SLIP> const& state_hardening_n,
+    minitensor::Vector<ArgT, CP::MAX_SLIP>&           slip_np1,
+    minitensor::Vector<ArgT, CP::MAX_SLIP>&           state_hardening_np1,
+    minitensor::Vector<ArgT, CP::MAX_SLIP>&           slip_resistance)
+{
+  bool failed{false};
+
+  minitensor::Vector<ArgT, CP::MAX_SLIP> const rate_slip_n = (slip_np1 - slip_n) / dt;
+
+  CP::updateHardness(
+      CP::SlipSystemView<CP::MAX_DIM>(slip_systems),
+      slip_families,
+      dt,
+      rate_slip_n,
+      state_hardening_n,
+      state_hardening_np1,
+      slip_resistance,
+      failed);
+
+  CP::updateSlip(
+      CP::SlipSystemView<CP::MAX_DIM>(slip_systems),
+      slip_families,
+      dt,
+      slip_resistance,
+      shear,
+      slip_n,
+      slip_np1,
+      failed);
+
+  return failed;
+}
+
+//
+// Times one dispatch path and returns the slips it produced, flattened.
+//
+template <typename ArgT, typename Update>
+std::vector<RealType>
+runPath(
+    std::string const&  label,
+    Update              update,
+    SlipSystems const&  slip_systems,
+    SlipFamilies const& slip_families,
+    int                 num_reps,
+    int                 num_derivs)
+{
+  minitensor::Index const num_slip = slip_systems.size();
+  RealType const          dt       = 1.0e-3;
+
+  minitensor::Vector<RealType, CP::MAX_SLIP> slip_n(num_slip, minitensor::Filler::ZEROS);
+  minitensor::Vector<RealType, CP::MAX_SLIP> state_hardening_n(num_slip);
+  minitensor::Vector<ArgT, CP::MAX_SLIP>     shear(num_slip);
+  minitensor::Vector<ArgT, CP::MAX_SLIP>     slip_np1(num_slip);
+  minitensor::Vector<ArgT, CP::MAX_SLIP>     state_hardening_np1(num_slip);
+  minitensor::Vector<ArgT, CP::MAX_SLIP>     slip_resistance(num_slip);
+
+  for (minitensor::Index s = 0; s < num_slip; ++s) {
+    state_hardening_n[s] = slip_systems[s].state_hardening_initial_;
+  }
+
+  std::vector<RealType> result;
+  result.reserve(num_reps * num_slip);
+
+  bool failed{false};
+
+  Teuchos::Time timer(label);
+  timer.start(true);
+  for (int rep = 0; rep < num_reps; ++rep) {
+    // Resolved shears of both signs, below and above the initial hardness.
+    for (minitensor::Index s = 0; s < num_slip; ++s) {
+      RealType const value = state_hardening_n[s] * (0.5 + 0.01 * ((rep + 3 * s) % 60)) * (s % 2 == 0 ? 1.0 : -1.0);
+      shear[s]             = seedValue(ArgT(), num_derivs, s, value);
+      slip_np1[s]          = seedValue(ArgT(), num_derivs, s, 1.0e-6 * value);
+    }
+
+    failed = update(
+                 slip_systems,
+                 slip_families,
+                 dt,
+                 shear,
+                 slip_n,
+                 state_hardening_n,
+                 slip_np1,
+                 state_hardening_np1,
+                 slip_resistance) ||
+             failed;
+
+    for (minitensor::Index s = 0; s < num_slip; ++s) {
+      result.push_back(Sacado::ScalarValue<ArgT>::eval(slip_np1[s]));
+    }
+  }
+  timer.stop();
+
+  double const updates = static_cast<double>(num_reps) * num_slip;
+  std::cout << std::setw(24) << std::left << label << std::setw(12) << std::right << timer.totalElapsedTime()
+            << " s  " << std::setw(14) << updates / timer.totalElapsedTime() << " slips/s"
+            << (failed == true ? "  (failed)" : "") << std::endl;
+
+  return result;
+}
+
+template <typename ArgT>
+bool
+comparePaths(
+    std::string const&  type_name,
+    SlipSystems const&  slip_systems,
+    SlipFamilies const& slip_families,
+    int                 num_reps,
+    int                 num_derivs)
+{
+  std::vector<RealType> const virtual_slips =
+      runPath<ArgT>("Virtual " + type_name, updateVirtual<ArgT>, slip_systems, slip_families, num_reps, num_derivs);
+  std::vector<RealType> const static_slips =
+      runPath<ArgT>("Static " + type_name, updateStatic<ArgT>, slip_systems, slip_families, num_reps, num_derivs);
+
+  RealType max_diff = 0.0;
+  for (std::size_t i = 0; i < virtual_slips.size(); ++i) {
+    max_diff = std::max(max_diff, std::abs(virtual_slips[i] - static_slips[i]));
+  }
+  std::cout << "Max slip difference (" << type_name << "): " << max_diff << std::endl;
+  return max_diff == 0.0;
+}
+
+}  // anonymous namespace
+
+int
+main(int ac, char* av[])
+{
+  KokkosGuard kokkos(ac, av);
+
+  Teuchos::CommandLineProcessor command_line_processor;
+
+  command_line_processor.setDocString(
+      "Crystal Plasticity Dispatch.\n"
+      "Compares virtual and static flow rule and hardening law dispatch\n"
+      "over the slip systems of a Material Point Simulator input.\n");
+
+  std::string input_file = "materials.xml";
+  command_line_processor.setOption("input", &input_file, "Input File Name");
+
+  int num_reps = 100000;
+  command_line_processor.setOption("nreps", &num_reps, "Number of Repetitions");
+
+  int num_derivs = 24;
+  command_line_processor.setOption("nderivs", &num_derivs, "Number of Derivatives for Jacobian");
+
+  command_line_processor.recogniseAllOptions(true);
+  command_line_processor.throwExceptions(false);
+
+  Teuchos::CommandLineProcessor::EParseCommandLineReturn parse_return = command_line_processor.parse(ac, av);
+
+  if (parse_return == Teuchos::CommandLineProcessor::PARSE_HELP_PRINTED) {
+    return 0;
+  }
+
+  if (parse_return != Teuchos::CommandLineProcessor::PARSE_SUCCESSFUL) {
+    return 1;
+  }
+
+  Teuchos::GlobalMPISession        mpi_session(&ac, &av);
+  Teuchos::RCP<Teuchos_Comm const> commT = Albany::createTeuchosCommFromMpiComm(Albany_MPI_COMM_WORLD);
+
+  Albany::MaterialDatabase material_db(input_file, commT);
+
+  std::string const element_block_name = "Block0";
+  std::string const mat_name           = material_db.getElementBlockParam<std::string>(element_block_name, "material");
+
+  Teuchos::ParameterList& param_list = material_db.getElementBlockSublist(element_block_name, mat_name);
+
+  SlipSystems  slip_systems;
+  SlipFamilies slip_families;
+  readSlipSystems(param_list, slip_systems, slip_families);
+
+  ALBANY_PANIC(slip_systems.empty() == true, "No slip systems defined for block: " + element_block_name);
+
+  std::cout << std::setprecision(6);
+  std::cout << "Slip systems: " << slip_systems.size() << ", slip families: " << slip_families.size() << std::endl;
+
+  bool const residual_match = comparePaths<RealType>("Residual", slip_systems, slip_families, num_reps, num_derivs);
+  bool const jacobian_match = comparePaths<FadType>("Jacobian", slip_systems, slip_families, num_reps, num_derivs);
+
+  return residual_match == true && jacobian_match == true ? 0 : 1;
+}
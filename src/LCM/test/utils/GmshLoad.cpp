@@ -0,0 +1,440 @@
+// Albany 3.0: Copyright 2016 National Technology & Engineering Solutions of
+// Sandia, LLC (NTESS). This Software is released under the BSD license detailed
+// in the file license.txt in the top-level Albany directory.
+// Gmsh load benchmark.
+// Writes a structured tetrahedral mesh of the unit cube as ASCII and binary
+// Gmsh 4.1 files and times reading them with the parallel Gmsh reader, each
+// rank parsing its share of the nodes and elements. For reference, rank 0
+// also reads the ASCII file line by line with string streams, as the serial
+// reader does. The ASCII and binary reads must give the same mesh.
+
+#include <Teuchos_CommHelpers.hpp>
+#include <Teuchos_CommandLineProcessor.hpp>
+#include <Teuchos_DefaultComm.hpp>
+#include <Teuchos_GlobalMPISession.hpp>
+#include <Teuchos_Time.hpp>
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "Albany_GmshReader.hpp"
+#include "KokkosGuard.hpp"
+#include "Kokkos_Core.hpp"
+
+namespace {
+
+struct BenchmarkSetup
+{
+  int         elements_per_side{50};
+  int         num_reps{3};
+  std::string prefix{"gmsh_load"};
+  bool        keep_files{false};
+};
+
+//
+// Unit cube split in n x n x n hexahedra and each one in six tetrahedra
+// around its main diagonal. The boundary triangles are grouped by face of
+// the cube, so there is one side block per face.
+//
+struct TetMesh
+{
+  explicit TetMesh(int const n);
+
+  std::vector<double>                           coordinates;
+  std::vector<std::array<GO, 4>>                tetrahedra;
+  std::array<std::vector<std::array<GO, 3>>, 6> faces;
+};
+
+TetMesh::TetMesh(int const n)
+{
+  int const    nodes_per_side = n + 1;
+  double const h              = 1.0 / n;
+
+  for (int k = 0; k < nodes_per_side; ++k) {
+    for (int j = 0; j < nodes_per_side; ++j) {
+      for (int i = 0; i < nodes_per_side; ++i) {
+        coordinates.push_back(i * h);
+        coordinates.push_back(j * h);
+        coordinates.push_back(k * h);
+      }
+    }
+  }
+
+  // Gmsh node tags start at 1.
+  auto const node_tag = [&](int const i, int const j, int const k) -> GO {
+    return 1 + i + nodes_per_side * (j + nodes_per_side * k);
+  };
+
+  for (int k = 0; k < n; ++k) {
+    for (int j = 0; j < n; ++j) {
+      for (int i = 0; i < n; ++i) {
+        GO const v0 = node_tag(i, j, k);
+        GO const v1 = node_tag(i + 1, j, k);
+        GO const v2 = node_tag(i + 1, j + 1, k);
+        GO const v3 = node_tag(i, j + 1, k);
+        GO const v4 = node_tag(i, j, k + 1);
+        GO const v5 = node_tag(i + 1, j, k + 1);
+        GO const v6 = node_tag(i + 1, j + 1, k + 1);
+        GO const v7 = node_tag(i, j + 1, k + 1);
+
+        tetrahedra.push_back({v0, v1, v2, v6});
+        tetrahedra.push_back({v0, v2, v3, v6});
+        tetrahedra.push_back({v0, v3, v7, v6});
+        tetrahedra.push_back({v0, v7, v4, v6});
+        tetrahedra.push_back({v0, v4, v5, v6});
+        tetrahedra.push_back({v0, v5, v1, v6});
+
+        // Faces of the tetrahedra on the boundary of the cube.
+        if (k == 0) {
+          faces[0].push_back({v0, v1, v2});
+          faces[0].push_back({v0, v2, v3});
+        }
+        if (k == n - 1) {
+          faces[1].push_back({v4, v5, v6});
+          faces[1].push_back({v4, v6, v7});
+        }
+        if (j == 0) {
+          faces[2].push_back({v0, v1, v5});
+          faces[2].push_back({v0, v5, v4});
+        }
+        if (j == n - 1) {
+          faces[3].push_back({v3, v2, v6});
+          faces[3].push_back({v3, v6, v7});
+        }
+        if (i == 0) {
+          faces[4].push_back({v0, v3, v7});
+          faces[4].push_back({v0, v7, v4});
+        }
+        if (i == n - 1) {
+          faces[5].push_back({v1, v2, v6});
+          faces[5].push_back({v1, v6, v5});
+        }
+      }
+    }
+  }
+}
+
+std::size_t
+number_sides(TetMesh const& mesh)
+{
+  std::size_t number{0};
+  for (auto&& face : mesh.faces) number += face.size();
+  return number;
+}
+
+void
+write_ascii(std::string const& file_name, TetMesh const& mesh)
+{
+  std::ofstream ofile(file_name);
+
+  std::size_t const number_nodes    = mesh.coordinates.size() / 3;
+  std::size_t const number_elements = mesh.tetrahedra.size() + number_sides(mesh);
+
+  ofile << std::setprecision(std::numeric_limits<double>::max_digits10);
+  ofile << "$MeshFormat\n4.1 0 8\n$EndMeshFormat\n";
+
+  ofile << "$Nodes\n1 " << number_nodes << " 1 " << number_nodes << '\n';
+  ofile << "3 1 0 " << number_nodes << '\n';
+  for (std::size_t i = 0; i < number_nodes; ++i) {
+    ofile << i + 1 << '\n';
+  }
+  for (std::size_t i = 0; i < number_nodes; ++i) {
+    double const* x = &mesh.coordinates[3 * i];
+    ofile << x[0] << ' ' << x[1] << ' ' << x[2] << '\n';
+  }
+  ofile << "$EndNodes\n";
+
+  ofile << "$Elements\n" << 1 + mesh.faces.size() << ' ' << number_elements << " 1 " << number_elements << '\n';
+
+  GO tag{1};
+
+  for (std::size_t f = 0; f < mesh.faces.size(); ++f) {
+    ofile << "2 " << f + 1 << " 2 " << mesh.faces[f].size() << '\n';
+    for (auto&& triangle : mesh.faces[f]) {
+      ofile << tag++ << ' ' << triangle[0] << ' ' << triangle[1] << ' ' << triangle[2] << '\n';
+    }
+  }
+
+  ofile << "3 1 4 " << mesh.tetrahedra.size() << '\n';
+  for (auto&& tetrahedron : mesh.tetrahedra) {
+    ofile << tag++ << ' ' << tetrahedron[0] << ' ' << tetrahedron[1] << ' ' << tetrahedron[2] << ' ' << tetrahedron[3]
+          << '\n';
+  }
+  ofile << "$EndElements\n";
+}
+
+template <typename T>
+void
+write_binary(std::ofstream& ofile, T const value)
+{
+  ofile.write(reinterpret_cast<char const*>(&value), sizeof(T));
+}
+
+template <typename Block>
+void
+write_binary_block(
+    std::ofstream& ofile,
+    int const      dimension,
+    int const      entity,
+    int const      type,
+    Block const&   block,
+    GO&            tag)
+{
+  write_binary<int>(ofile, dimension);
+  write_binary<int>(ofile, entity);
+  write_binary<int>(ofile, type);
+  write_binary<std::uint64_t>(ofile, block.size());
+  for (auto&& element : block) {
+    write_binary<std::uint64_t>(ofile, tag++);
+    for (auto&& node : element) write_binary<std::uint64_t>(ofile, node);
+  }
+}
+
+void
+write_binary(std::string const& file_name, TetMesh const& mesh)
+{
+  std::ofstream ofile(file_name, std::ios::binary);
+
+  std::size_t const number_nodes    = mesh.coordinates.size() / 3;
+  std::size_t const number_elements = mesh.tetrahedra.size() + number_sides(mesh);
+
+  ofile << "$MeshFormat\n4.1 1 8\n";
+  write_binary<int>(ofile, 1);
+  ofile << "\n$EndMeshFormat\n";
+
+  ofile << "$Nodes\n";
+  write_binary<std::uint64_t>(ofile, 1);
+  write_binary<std::uint64_t>(ofile, number_nodes);
+  write_binary<std::uint64_t>(ofile, 1);
+  write_binary<std::uint64_t>(ofile, number_nodes);
+  write_binary<int>(ofile, 3);
+  write_binary<int>(ofile, 1);
+  write_binary<int>(ofile, 0);
+  write_binary<std::uint64_t>(ofile, number_nodes);
+  for (std::size_t i = 0; i < number_nodes; ++i) {
+    write_binary<std::uint64_t>(ofile, i + 1);
+  }
+  ofile.write(reinterpret_cast<char const*>(mesh.coordinates.data()), mesh.coordinates.size() * sizeof(double));
+  ofile << "\n$EndNodes\n";
+
+  ofile << "$Elements\n";
+  write_binary<std::uint64_t>(ofile, 1 + mesh.faces.size());
+  write_binary<std::uint64_t>(ofile, number_elements);
+  write_binary<std::uint64_t>(ofile, 1);
+  write_binary<std::uint64_t>(ofile, number_elements);
+
+  GO tag{1};
+
+  for (std::size_t f = 0; f < mesh.faces.size(); ++f) {
+    write_binary_block(ofile, 2, f + 1, 2, mesh.faces[f], tag);
+  }
+  write_binary_block(ofile, 3, 1, 4, mesh.tetrahedra, tag);
+  ofile << "\n$EndElements\n";
+}
+
+// Line by line string stream parsing of the whole ASCII file. Returns the
+// number of elements read.
+std::size_t
+stream_read(std::string const& file_name, std::vector<double>& coordinates, std::vector<GO>& connectivity)
+{
+  std::ifstream ifile(file_name);
+  std::string   line;
+
+  while (std::getline(ifile, line) && line != "$Nodes") {
+  }
+
+  std::size_t num_blocks{0}, num_nodes{0}, min_tag{0}, max_tag{0};
+  std::getline(ifile, line);
+  std::stringstream(line) >> num_blocks >> num_nodes >> min_tag >> max_tag;
+
+  coordinates.resize(3 * (max_tag + 1));
+
+  for (std::size_t b = 0; b < num_blocks; ++b) {
+    int         dimension{0}, entity{0}, parametric{0};
+    std::size_t number{0};
+    std::getline(ifile, line);
+    std::stringstream(line) >> dimension >> entity >> parametric >> number;
+
+    std::vector<std::size_t> tags(number);
+    for (auto&& tag : tags) ifile >> tag;
+    for (auto&& tag : tags) ifile >> coordinates[3 * tag] >> coordinates[3 * tag + 1] >> coordinates[3 * tag + 2];
+  }
+
+  while (std::getline(ifile, line) && line != "$Elements") {
+  }
+
+  std::size_t num_elements{0};
+  std::getline(ifile, line);
+  std::stringstream(line) >> num_blocks >> num_elements >> min_tag >> max_tag;
+
+  connectivity.clear();
+
+  std::size_t elements_read{0};
+
+  while (elements_read < num_elements && std::getline(ifile, line)) {
+    int         dimension{0}, entity{0}, type{0};
+    std::size_t number{0};
+    std::stringstream(line) >> dimension >> entity >> type >> number;
+
+    for (std::size_t i = 0; i < number; ++i) {
+      std::getline(ifile, line);
+      std::stringstream ss(line);
+      GO                tag{0}, node{0};
+      ss >> tag;
+      while (ss >> node) connectivity.push_back(node);
+    }
+    elements_read += number;
+  }
+
+  return elements_read;
+}
+
+int
+count_mismatches(Albany::GmshReader const& a, Albany::GmshReader const& b)
+{
+  int mismatches{0};
+
+  if (a.getCellNodes() != b.getCellNodes()) ++mismatches;
+  if (a.getSideIds() != b.getSideIds()) ++mismatches;
+  if (a.getSideNodes() != b.getSideNodes()) ++mismatches;
+  if (a.getSideTags() != b.getSideTags()) ++mismatches;
+  if (a.getSideCells() != b.getSideCells()) ++mismatches;
+  if (a.getNodeTags() != b.getNodeTags()) ++mismatches;
+  if (a.getCoordinates() != b.getCoordinates()) ++mismatches;
+
+  return mismatches;
+}
+
+}  // anonymous namespace
+
+int
+main(int ac, char* av[])
+{
+  Teuchos::GlobalMPISession mpi_session(&ac, &av);
+
+  KokkosGuard kokkos(ac, av);
+
+  auto const comm = Teuchos::DefaultComm<int>::getComm();
+  int const  rank = comm->getRank();
+  int const  size = comm->getSize();
+
+  Teuchos::CommandLineProcessor command_line_processor;
+
+  command_line_processor.setDocString(
+      "Gmsh Load.\n"
+      "Times parallel reading of ASCII and binary Gmsh 4.1 files.\n");
+
+  BenchmarkSetup setup;
+  command_line_processor.setOption("nside", &setup.elements_per_side, "Number of Hexahedra per Side");
+  command_line_processor.setOption("nreps", &setup.num_reps, "Number of Repetitions");
+  command_line_processor.setOption("prefix", &setup.prefix, "Prefix of the Mesh File Names");
+  command_line_processor.setOption("keep", "remove", &setup.keep_files, "Keep the Mesh Files");
+
+  command_line_processor.recogniseAllOptions(true);
+  command_line_processor.throwExceptions(false);
+
+  Teuchos::CommandLineProcessor::EParseCommandLineReturn parse_return = command_line_processor.parse(ac, av);
+
+  if (parse_return == Teuchos::CommandLineProcessor::PARSE_HELP_PRINTED) {
+    return 0;
+  }
+
+  if (parse_return != Teuchos::CommandLineProcessor::PARSE_SUCCESSFUL) {
+    return 1;
+  }
+
+  setup.num_reps = std::max(setup.num_reps, 1);
+
+  std::string const ascii_name  = setup.prefix + "_ascii.msh";
+  std::string const binary_name = setup.prefix + "_binary.msh";
+
+  std::size_t number_elements{0};
+
+  if (rank == 0) {
+    TetMesh const mesh(setup.elements_per_side);
+    write_ascii(ascii_name, mesh);
+    write_binary(binary_name, mesh);
+    number_elements = mesh.tetrahedra.size() + number_sides(mesh);
+  }
+
+  comm->barrier();
+
+  // Serial reference on rank 0.
+  Teuchos::Time stream_timer("Stream", false);
+
+  if (rank == 0) {
+    std::vector<double> coordinates;
+    std::vector<GO>     connectivity;
+    stream_timer.start();
+    std::size_t const elements_read = stream_read(ascii_name, coordinates, connectivity);
+    stream_timer.stop();
+    if (elements_read != number_elements) {
+      std::cout << "Stream read " << elements_read << " of " << number_elements << " elements\n";
+    }
+  }
+
+  Albany::GmshReader ascii_reader(ascii_name, comm);
+  Albany::GmshReader binary_reader(binary_name, comm);
+
+  double ascii_time{0.0};
+  double binary_time{0.0};
+
+  for (int rep = 0; rep < setup.num_reps; ++rep) {
+    comm->barrier();
+    Teuchos::Time ascii_timer("ASCII", true);
+    Albany::GmshReader(ascii_name, comm).read();
+    ascii_timer.stop();
+
+    comm->barrier();
+    Teuchos::Time binary_timer("Binary", true);
+    Albany::GmshReader(binary_name, comm).read();
+    binary_timer.stop();
+
+    ascii_time += ascii_timer.totalElapsedTime();
+    binary_time += binary_timer.totalElapsedTime();
+  }
+
+  ascii_reader.read();
+  binary_reader.read();
+
+  int const local_mismatches = count_mismatches(ascii_reader, binary_reader);
+  int       mismatches{0};
+  Teuchos::reduceAll(*comm, Teuchos::REDUCE_SUM, local_mismatches, Teuchos::outArg(mismatches));
+
+  double const local_times[2] = {ascii_time / setup.num_reps, binary_time / setup.num_reps};
+  double       times[2]       = {0.0, 0.0};
+  Teuchos::reduceAll(*comm, Teuchos::REDUCE_MAX, 2, local_times, times);
+
+  if (rank == 0) {
+    double const stream_time = stream_timer.totalElapsedTime();
+
+    std::cout << std::setprecision(6);
+    std::cout << "Ranks                   : " << size << '\n';
+    std::cout << "Threads per rank        : " << Kokkos::DefaultHostExecutionSpace::concurrency() << '\n';
+    std::cout << "Cells                   : " << ascii_reader.getNumberCells() << '\n';
+    std::cout << "Elements in file        : " << number_elements << '\n';
+    std::cout << "Stream read time (s)    : " << stream_time << '\n';
+    std::cout << "ASCII read time (s)     : " << times[0] << '\n';
+    std::cout << "Binary read time (s)    : " << times[1] << '\n';
+    std::cout << "ASCII speedup           : " << (times[0] > 0.0 ? stream_time / times[0] : 0.0) << '\n';
+    std::cout << "Binary speedup          : " << (times[1] > 0.0 ? stream_time / times[1] : 0.0) << '\n';
+    std::cout << "ASCII/binary mismatches : " << mismatches << '\n';
+  }
+
+  comm->barrier();
+
+  if (rank == 0 && setup.keep_files == false) {
+    std::remove(ascii_name.c_str());
+    std::remove(binary_name.c_str());
+  }
+
+  return mismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,295 @@
+// Albany 3.0: Copyright 2016 National Technology & Engineering Solutions of
+// Sandia, LLC (NTESS). This Software is released under the BSD license detailed
+// in the file license.txt in the top-level Albany directory.
+// Throughput benchmark for the J2 constitutive models.
+// Drives "J2" and "Parallel J2" directly over a synthetic workset for the
+// Residual and Jacobian evaluation types, reports material point updates per
+// second and checks that both models produce the same stress. Every model is
+// timed twice over the same worksets, once finding its old states by name
+// and once through the state handle tables, to expose the lookup overhead.
+
+#include <Teuchos_CommandLineProcessor.hpp>
+#include <Teuchos_GlobalMPISession.hpp>
+#include <Teuchos_ParameterList.hpp>
+#include <Teuchos_RCP.hpp>
+#include <Teuchos_Time.hpp>
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "Albany_Layouts.hpp"
+#include "Albany_StateInfoStruct.hpp"
+#include "FieldNameMap.hpp"
+#include "J2Model.hpp"
+#include "KokkosGuard.hpp"
+#include "PHAL_AlbanyTraits.hpp"
+#include "PHAL_Setup.hpp"
+#include "PHAL_Workset.hpp"
+#include "ParallelJ2Model.hpp"
+
+namespace {
+
+struct BenchmarkSetup
+{
+  int num_cells{64};
+  int num_worksets{128};
+  int num_pts{8};
+  int num_reps{10};
+  int num_derivs{24};
+
+  std::string policy{"Cell"};
+};
+
+inline RealType
+seedValue(RealType const&, int, int, RealType value)
+{
+  return value;
+}
+
+inline FadType
+seedValue(FadType const&, int num_derivs, int index, RealType value)
+{
+  return FadType(num_derivs, index, value);
+}
+
+template <typename ScalarT>
+PHX::MDField<ScalarT>
+createField(std::string const& name, Teuchos::RCP<PHX::DataLayout> const& layout, int num_derivs)
+{
+  using ViewFactory = PHX::KokkosViewFactory<ScalarT, PHX::Device::array_layout, PHX::Device>;
+
+  PHX::MDField<ScalarT>             field(name, layout);
+  std::vector<PHX::index_size_type> derivative_dimensions{static_cast<PHX::index_size_type>(num_derivs)};
+  field.setFieldData(ViewFactory::buildView(field.fieldTag(), derivative_dimensions));
+  return field;
+}
+
+//
+// Runs one model over synthetic worksets and returns the Cauchy stress
+// values of the last workset, flattened, for comparison against other models.
+//
+template <typename EvalT, typename Model>
+std::vector<RealType>
+runModel(std::string const& label, BenchmarkSetup const& setup)
+{
+  using ScalarT          = typename EvalT::ScalarT;
+  using ScalarField      = PHX::MDField<ScalarT>;
+  using ConstScalarField = PHX::MDField<ScalarT const>;
+
+  int const num_dims  = 3;
+  int const num_nodes = 8;
+  int const num_cells = setup.num_cells;
+  int const num_pts   = setup.num_pts;
+
+  Teuchos::RCP<Albany::Layouts> dl =
+      Teuchos::rcp(new Albany::Layouts(num_cells, num_nodes, num_nodes, num_pts, num_dims));
+
+  LCM::FieldNameMap      field_name_map(false);
+  Teuchos::ParameterList p;
+  p.set<Teuchos::RCP<std::map<std::string, std::string>>>("Name Map", field_name_map.getMap());
+  p.set<RealType>("Saturation Modulus", 100.0);
+  p.set<RealType>("Saturation Exponent", 10.0);
+  p.set<std::string>("Parallel Policy", setup.policy);
+
+  Model model(&p, dl);
+
+  // Dependent fields. Material parameters are constant, the deformation
+  // gradient varies per cell and point so that some points yield and
+  // some do not.
+  typename Model::DepFieldMap dep_fields;
+  for (auto const& entry : model.getDependentFieldMap()) {
+    auto field = createField<ScalarT>(entry.first, entry.second, setup.num_derivs);
+
+    dep_fields[entry.first] = Teuchos::rcp(new ConstScalarField(field));
+
+    ScalarT value = 0.0;
+    if (entry.first == "Elastic Modulus") value = 200.0e3;
+    if (entry.first == "Poissons Ratio") value = 0.3;
+    if (entry.first == "Yield Strength") value = 250.0;
+    if (entry.first == "Hardening Modulus") value = 1000.0;
+    if (entry.first == "Delta Time") value = 1.0;
+    field.deep_copy(value);
+  }
+
+  std::string const F_string = (*field_name_map.getMap())["F"];
+  std::string const J_string = (*field_name_map.getMap())["J"];
+
+  ScalarField def_grad = createField<ScalarT>(F_string, dl->qp_tensor, setup.num_derivs);
+  ScalarField J        = createField<ScalarT>(J_string, dl->qp_scalar, setup.num_derivs);
+  for (int cell = 0; cell < num_cells; ++cell) {
+    for (int pt = 0; pt < num_pts; ++pt) {
+      RealType const stretch = 1.0 + 0.004 * ((cell * num_pts + pt) % 5);
+      RealType const shear   = 0.001 * ((cell + pt) % 7);
+      for (int i = 0; i < num_dims; ++i) {
+        for (int j = 0; j < num_dims; ++j) {
+          RealType const value = i == j ? (i == 0 ? stretch : 1.0 / std::sqrt(stretch)) : (i < j ? shear : 0.0);
+          def_grad(cell, pt, i, j) = seedValue(ScalarT(), setup.num_derivs, i * num_dims + j, value);
+        }
+      }
+      J(cell, pt) = def_grad(cell, pt, 0, 0) * def_grad(cell, pt, 1, 1) * def_grad(cell, pt, 2, 2);
+    }
+  }
+  dep_fields[F_string] = Teuchos::rcp(new ConstScalarField(def_grad));
+  dep_fields[J_string] = Teuchos::rcp(new ConstScalarField(J));
+
+  typename Model::FieldMap eval_fields;
+  for (auto const& entry : model.getEvaluatedFieldMap()) {
+    eval_fields[entry.first] =
+        Teuchos::rcp(new ScalarField(createField<ScalarT>(entry.first, entry.second, setup.num_derivs)));
+  }
+
+  // States of every workset, laid out and handled as the state manager
+  // would lay them out and hand them out.
+  std::vector<std::vector<double>> storage;
+  Albany::StateArrays              state_arrays;
+  state_arrays.elemStateArrays.resize(setup.num_worksets);
+  for (int sv = 0; sv < model.getNumStateVariables(); ++sv) {
+    std::vector<std::string> names{model.getStateVarName(sv)};
+    if (model.getStateVarOldStateFlag(sv) == true) names.push_back(names.front() + "_old");
+    for (auto const& name : names) {
+      int const handle                = state_arrays.stateHandles.size();
+      state_arrays.stateHandles[name] = handle;
+    }
+  }
+  storage.reserve(setup.num_worksets * state_arrays.stateHandles.size());
+  for (int ws = 0; ws < setup.num_worksets; ++ws) {
+    for (int sv = 0; sv < model.getNumStateVariables(); ++sv) {
+      std::vector<std::string> names{model.getStateVarName(sv)};
+      if (model.getStateVarOldStateFlag(sv) == true) names.push_back(names.front() + "_old");
+      for (auto const& name : names) {
+        bool const  is_tensor = model.getStateVarLayout(sv)->rank() == 4;
+        std::size_t size      = num_cells * num_pts * (is_tensor == true ? num_dims * num_dims : 1);
+        storage.emplace_back(size, 0.0);
+        double* data = storage.back().data();
+        if (is_tensor == true) {
+          Albany::MDArray array(data, num_cells, num_pts, num_dims, num_dims);
+          if (model.getStateVarInitType(sv) == "identity") {
+            for (int cell = 0; cell < num_cells; ++cell) {
+              for (int pt = 0; pt < num_pts; ++pt) {
+                for (int i = 0; i < num_dims; ++i) array(cell, pt, i, i) = 1.0;
+              }
+            }
+          }
+          state_arrays.elemStateArrays[ws][name] = array;
+        } else {
+          state_arrays.elemStateArrays[ws][name] = Albany::MDArray(data, num_cells, num_pts);
+        }
+      }
+    }
+  }
+  state_arrays.buildStateHandleArrays();
+
+  PHAL::Setup setup_data;
+  setup_data.init_state_handles(state_arrays.stateHandles);
+  model.resolveStateHandles(setup_data);
+
+  PHAL::Workset workset;
+  workset.numCells = num_cells;
+
+  double const updates = static_cast<double>(num_cells) * num_pts * setup.num_worksets * setup.num_reps;
+
+  for (bool const use_handles : {false, true}) {
+    auto const evaluate = [&]() {
+      for (int ws = 0; ws < setup.num_worksets; ++ws) {
+        workset.stateArrayPtr       = &state_arrays.elemStateArrays[ws];
+        workset.stateHandleArrayPtr = use_handles == true ? &state_arrays.elemStateHandleArrays[ws] : nullptr;
+        model.computeState(workset, dep_fields, eval_fields);
+      }
+    };
+
+    // Warm up once, then time.
+    evaluate();
+
+    std::string const lookup_label = label + (use_handles == true ? " (handles)" : " (names)");
+    Teuchos::Time     timer(lookup_label);
+    timer.start(true);
+    for (int rep = 0; rep < setup.num_reps; ++rep) {
+      evaluate();
+    }
+    timer.stop();
+
+    std::cout << std::setw(36) << std::left << lookup_label << std::setw(12) << std::right
+              << timer.totalElapsedTime() << " s  " << std::setw(14) << updates / timer.totalElapsedTime()
+              << " points/s" << std::endl;
+  }
+
+  std::string const     cauchy = (*field_name_map.getMap())["Cauchy_Stress"];
+  ScalarField           stress = *eval_fields[cauchy];
+  std::vector<RealType> result;
+  result.reserve(num_cells * num_pts * num_dims * num_dims);
+  for (int cell = 0; cell < num_cells; ++cell) {
+    for (int pt = 0; pt < num_pts; ++pt) {
+      for (int i = 0; i < num_dims; ++i) {
+        for (int j = 0; j < num_dims; ++j) {
+          result.push_back(Sacado::ScalarValue<ScalarT>::eval(stress(cell, pt, i, j)));
+        }
+      }
+    }
+  }
+  return result;
+}
+
+template <typename EvalT>
+bool
+compareModels(std::string const& eval_name, BenchmarkSetup const& setup)
+{
+  using Traits = PHAL::AlbanyTraits;
+
+  std::vector<RealType> const serial = runModel<EvalT, LCM::J2Model<EvalT, Traits>>("J2 " + eval_name, setup);
+  std::vector<RealType> const parallel =
+      runModel<EvalT, LCM::ParallelJ2Model<EvalT, Traits>>("Parallel J2 " + eval_name, setup);
+
+  RealType max_diff = 0.0;
+  for (std::size_t i = 0; i < serial.size(); ++i) {
+    max_diff = std::max(max_diff, std::abs(serial[i] - parallel[i]));
+  }
+  std::cout << "Max stress difference (" << eval_name << "): " << max_diff << std::endl;
+  return max_diff == 0.0;
+}
+
+}  // anonymous namespace
+
+int
+main(int ac, char* av[])
+{
+  KokkosGuard kokkos(ac, av);
+
+  Teuchos::GlobalMPISession mpi_session(&ac, &av);
+
+  Teuchos::CommandLineProcessor command_line_processor;
+
+  command_line_processor.setDocString(
+      "J2 Throughput.\n"
+      "Compares serial and parallel J2 models for Residual and Jacobian.\n");
+
+  BenchmarkSetup setup;
+  command_line_processor.setOption("ncells", &setup.num_cells, "Number of Cells per Workset");
+  command_line_processor.setOption("nworksets", &setup.num_worksets, "Number of Worksets");
+  command_line_processor.setOption("npoints", &setup.num_pts, "Number of Gaussian Points");
+  command_line_processor.setOption("nreps", &setup.num_reps, "Number of Repetitions");
+  command_line_processor.setOption("nderivs", &setup.num_derivs, "Number of Derivatives for Jacobian");
+  command_line_processor.setOption("policy", &setup.policy, "Parallel Policy: Cell, MDRange or Team");
+
+  command_line_processor.recogniseAllOptions(true);
+  command_line_processor.throwExceptions(false);
+
+  Teuchos::CommandLineProcessor::EParseCommandLineReturn parse_return = command_line_processor.parse(ac, av);
+
+  if (parse_return == Teuchos::CommandLineProcessor::PARSE_HELP_PRINTED) {
+    return 0;
+  }
+
+  if (parse_return != Teuchos::CommandLineProcessor::PARSE_SUCCESSFUL) {
+    return 1;
+  }
+
+  std::cout << std::setprecision(6);
+
+  bool const residual_match = compareModels<PHAL::AlbanyTraits::Residual>("Residual", setup);
+  bool const jacobian_match = compareModels<PHAL::AlbanyTraits::Jacobian>("Jacobian", setup);
+
+  return residual_match == true && jacobian_match == true ? 0 : 1;
+}
@@ -0,0 +1,21 @@
+// Albany 3.0: Copyright 2016 National Technology & Engineering Solutions of
+// Sandia, LLC (NTESS). This Software is released under the BSD license detailed
+// in the file license.txt in the top-level Albany directory.
+
+#if !defined(LCM_KokkosGuard_hpp)
+#define LCM_KokkosGuard_hpp
+
+#include "Kokkos_Core.hpp"
+
+//
+// Initializes Kokkos for the scope of main() of the test drivers, and
+// finalizes it on exit. Declare it after Teuchos::GlobalMPISession.
+//
+struct KokkosGuard
+{
+  KokkosGuard(int ac, char* av[]) { Kokkos::initialize(ac, av); }
+
+  ~KokkosGuard() { Kokkos::finalize(); }
+};
+
+#endif  // LCM_KokkosGuard_hpp
@@ -27,7 +27,7 @@
 #include "ConstitutiveModelInterface.hpp"
 #include "ConstitutiveModelParameters.hpp"
 #include "FieldNameMap.hpp"
-#include "Kokkos_Core.hpp"
+#include "KokkosGuard.hpp"
 #include "ParallelSetField.hpp"
 #include "SetField.hpp"
 #include "utility/CounterMonitor.hpp"
@@ -36,13 +36,6 @@
 #include "utility/TimeMonitor.hpp"
 #include "utility/VariableMonitor.hpp"
 
-struct KokkosGuard
-{
-  KokkosGuard(int ac, char* av[]) { Kokkos::initialize(ac, av); }
-
-  ~KokkosGuard() { Kokkos::finalize(); }
-};
-
 int
 main(int ac, char* av[])
 {
@@ -307,6 +300,10 @@ main(int ac, char* av[])
 
     double parametrization_interval = mpsParams.get<double>("Parametrization Interval", 0.05);
 
+    bool adaptive_sweep = mpsParams.get<bool>("Parametrization Adaptive Sweep", false);
+
+    bool lower_bound_check = mpsParams.get<bool>("Parametrization Lower Bound Check", false);
+
     std::cout << "Bifurcation Check in Material Point Simulator:" << std::endl;
     std::cout << "Parametrization Type: " << parametrization_type << std::endl;
 
@@ -314,6 +311,8 @@ main(int ac, char* av[])
     bcPL.set<Teuchos::ParameterList*>("Material Parameters", &paramList);
     bcPL.set<std::string>("Parametrization Type Name", parametrization_type);
     bcPL.set<double>("Parametrization Interval Name", parametrization_interval);
+    bcPL.set<bool>("Parametrization Adaptive Sweep", adaptive_sweep);
+    bcPL.set<bool>("Parametrization Lower Bound Check", lower_bound_check);
     bcPL.set<std::string>("Material Tangent Name", "Material Tangent");
     bcPL.set<std::string>("Ellipticity Flag Name", "Ellipticity_Flag");
     bcPL.set<std::string>("Bifurcation Direction Name", "Direction");
@@ -359,6 +358,7 @@ main(int ac, char* av[])
   fieldManager.registerEvaluator<Residual>(ev);
   stateFieldManager.registerEvaluator<Residual>(ev);
   PHAL::Setup setupData;
+  setupData.init_state_handles(stateMgr.getStateHandles());
   // std::cout << "Calling postRegistrationSetup" << std::endl;
   fieldManager.postRegistrationSetup(setupData);
 
@@ -421,8 +421,9 @@ main(int ac, char* av[])
 
   // Create a workset
   PHAL::Workset workset;
-  workset.numCells      = workset_size;
-  workset.stateArrayPtr = &stateMgr.getStateArray(Albany::StateManager::ELEM, 0);
+  workset.numCells            = workset_size;
+  workset.stateArrayPtr       = &stateMgr.getStateArray(Albany::StateManager::ELEM, 0);
+  workset.stateHandleArrayPtr = &stateMgr.getStateHandleArray(0);
 
   // create MDFields
   PHX::MDField<ScalarT, Cell, QuadPoint, Dim, Dim> stressField("Cauchy_Stress", dl->qp_tensor);
@@ -497,6 +498,9 @@ main(int ac, char* av[])
     }
     // std::cout << "current strain\n" << current_strain << std::endl;
 
+    // This step's evaluation writes the new states
+    stateMgr.markNewStatesWritten();
+
     // Call the evaluators, evaluateFields() is the function that
     // computes stress based on deformation gradient
     compute_time->start();
@@ -614,8 +618,6 @@ main(int ac, char* av[])
 
     }  // end check bifurcation
 
-    stateMgr.updateStates();
-
     if (bifurcation_flag) {
       // break the loading step after adaptive time step loop
       break;
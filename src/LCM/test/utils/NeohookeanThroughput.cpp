@@ -0,0 +1,335 @@
+// Albany 3.0: Copyright 2016 National Technology & Engineering Solutions of
+// Sandia, LLC (NTESS). This Software is released under the BSD license detailed
+// in the file license.txt in the top-level Albany directory.
+// Throughput benchmark for the tensor pack ports.
+// Times the kinematics update F = I + grad u, J = det F one point at a time
+// with minitensor and util::PACK_WIDTH points at a time with tensor packs,
+// then drives "Neohookean" (tensor packs) and "Parallel Neohookean" (one
+// util::Tensor2 per point) over a synthetic workset for the Residual and
+// Jacobian evaluation types. Reports material point updates per second and
+// checks that both paths produce the same results.
+
+#include <MiniTensor.h>
+#include <Teuchos_CommandLineProcessor.hpp>
+#include <Teuchos_GlobalMPISession.hpp>
+#include <Teuchos_ParameterList.hpp>
+#include <Teuchos_RCP.hpp>
+#include <Teuchos_Time.hpp>
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "Albany_Layouts.hpp"
+#include "FieldNameMap.hpp"
+#include "KokkosGuard.hpp"
+#include "Kokkos_Core.hpp"
+#include "NeohookeanModel.hpp"
+#include "PHAL_AlbanyTraits.hpp"
+#include "PHAL_Workset.hpp"
+#include "ParallelNeohookeanModel.hpp"
+#include "utility/math/TensorPack.hpp"
+
+namespace {
+
+struct BenchmarkSetup
+{
+  int num_cells{1024};
+  int num_pts{8};
+  int num_reps{10};
+  int num_derivs{24};
+};
+
+/// Relative tolerance for comparisons. The pack path evaluates cbrt, exp
+/// and log through the same std:: functions, but in a different order.
+constexpr RealType TOLERANCE = 1.0e-12;
+
+inline RealType
+seedValue(RealType const&, int, int, RealType value)
+{
+  return value;
+}
+
+inline FadType
+seedValue(FadType const&, int num_derivs, int index, RealType value)
+{
+  return FadType(num_derivs, index, value);
+}
+
+inline RealType
+displacementGradient(int point, int i, int j)
+{
+  return i == j ? 0.004 * ((point + i) % 5) : (i < j ? 0.001 * ((point + j) % 7) : -0.0005 * (point % 3));
+}
+
+void
+printRate(std::string const& label, double seconds, double updates)
+{
+  std::cout << std::setw(36) << std::left << label << std::setw(12) << std::right << seconds << " s  "
+            << std::setw(14) << updates / seconds << " points/s" << std::endl;
+}
+
+RealType
+relativeDifference(std::vector<RealType> const& a, std::vector<RealType> const& b)
+{
+  RealType max_diff = 0.0;
+  for (std::size_t i = 0; i < a.size(); ++i) {
+    RealType const scale = std::max(1.0, std::abs(a[i]));
+    max_diff             = std::max(max_diff, std::abs(a[i] - b[i]) / scale);
+  }
+  return max_diff;
+}
+
+//
+// Kinematics: F = I + grad u and J = det F over all points, first with one
+// minitensor per point, then with one tensor pack per util::PACK_WIDTH
+// points. Returns true if both give the same J.
+//
+bool
+compareKinematics(BenchmarkSetup const& setup)
+{
+  using View3 = Kokkos::View<RealType***, Kokkos::HostSpace>;
+  using View1 = Kokkos::View<RealType*, Kokkos::HostSpace>;
+
+  int const num_dims   = 3;
+  int const num_points = setup.num_cells * setup.num_pts;
+
+  View3 grad_u("grad_u", num_points, num_dims, num_dims);
+  View3 def_grad("def_grad", num_points, num_dims, num_dims);
+  View1 J_scalar("J_scalar", num_points);
+  View1 J_pack("J_pack", num_points);
+
+  for (int point = 0; point < num_points; ++point) {
+    for (int i = 0; i < num_dims; ++i) {
+      for (int j = 0; j < num_dims; ++j) {
+        grad_u(point, i, j) = displacementGradient(point, i, j);
+      }
+    }
+  }
+
+  double const updates = static_cast<double>(num_points) * setup.num_reps;
+
+  Teuchos::Time scalar_timer("Kinematics minitensor");
+  scalar_timer.start(true);
+  for (int rep = 0; rep < setup.num_reps; ++rep) {
+    minitensor::Tensor<RealType> const I(minitensor::eye<RealType>(num_dims));
+    minitensor::Tensor<RealType>       gradu(num_dims);
+    minitensor::Tensor<RealType>       F(num_dims);
+    for (int point = 0; point < num_points; ++point) {
+      gradu.fill(grad_u, point, 0, 0);
+      F = I + gradu;
+      for (int i = 0; i < num_dims; ++i) {
+        for (int j = 0; j < num_dims; ++j) {
+          def_grad(point, i, j) = F(i, j);
+        }
+      }
+      J_scalar(point) = minitensor::det(F);
+    }
+  }
+  scalar_timer.stop();
+  printRate("Kinematics minitensor", scalar_timer.totalElapsedTime(), updates);
+
+  Teuchos::Time pack_timer("Kinematics tensor pack");
+  pack_timer.start(true);
+  for (int rep = 0; rep < setup.num_reps; ++rep) {
+    util::Tensor2Pack<RealType> const I(util::identity_pack<RealType>(num_dims));
+    util::Tensor2Pack<RealType>       gradu(num_dims);
+    for (int first = 0; first < num_points; first += util::PACK_WIDTH) {
+      int const num_lanes = std::min(util::PACK_WIDTH, num_points - first);
+      for (int lane = 0; lane < util::PACK_WIDTH; ++lane) {
+        gradu.load(lane, grad_u, first + std::min(lane, num_lanes - 1));
+      }
+      util::Tensor2Pack<RealType> const            F = I + gradu;
+      util::Pack<RealType, util::PACK_WIDTH> const J = util::det(F);
+      for (int lane = 0; lane < num_lanes; ++lane) {
+        F.store(lane, def_grad, first + lane);
+        J_pack(first + lane) = J[lane];
+      }
+    }
+  }
+  pack_timer.stop();
+  printRate("Kinematics tensor pack", pack_timer.totalElapsedTime(), updates);
+
+  RealType max_diff = 0.0;
+  for (int point = 0; point < num_points; ++point) {
+    max_diff = std::max(max_diff, std::abs(J_scalar(point) - J_pack(point)));
+  }
+  std::cout << "Max J difference: " << max_diff << std::endl;
+  return max_diff <= TOLERANCE;
+}
+
+template <typename ScalarT>
+PHX::MDField<ScalarT>
+createField(std::string const& name, Teuchos::RCP<PHX::DataLayout> const& layout, int num_derivs)
+{
+  using ViewFactory = PHX::KokkosViewFactory<ScalarT, PHX::Device::array_layout, PHX::Device>;
+
+  PHX::MDField<ScalarT>             field(name, layout);
+  std::vector<PHX::index_size_type> derivative_dimensions{static_cast<PHX::index_size_type>(num_derivs)};
+  field.setFieldData(ViewFactory::buildView(field.fieldTag(), derivative_dimensions));
+  return field;
+}
+
+//
+// Runs one model over a synthetic workset and returns the Cauchy stress
+// and material tangent values, flattened, for comparison against other
+// models.
+//
+template <typename EvalT, typename Model>
+std::vector<RealType>
+runModel(std::string const& label, BenchmarkSetup const& setup)
+{
+  using ScalarT          = typename EvalT::ScalarT;
+  using ScalarField      = PHX::MDField<ScalarT>;
+  using ConstScalarField = PHX::MDField<ScalarT const>;
+
+  int const num_dims  = 3;
+  int const num_nodes = 8;
+  int const num_cells = setup.num_cells;
+  int const num_pts   = setup.num_pts;
+
+  Teuchos::RCP<Albany::Layouts> dl =
+      Teuchos::rcp(new Albany::Layouts(num_cells, num_nodes, num_nodes, num_pts, num_dims));
+
+  LCM::FieldNameMap      field_name_map(false);
+  Teuchos::ParameterList p;
+  p.set<Teuchos::RCP<std::map<std::string, std::string>>>("Name Map", field_name_map.getMap());
+
+  Model model(&p, dl);
+
+  typename Model::DepFieldMap dep_fields;
+  for (auto const& entry : model.getDependentFieldMap()) {
+    auto field = createField<ScalarT>(entry.first, entry.second, setup.num_derivs);
+
+    dep_fields[entry.first] = Teuchos::rcp(new ConstScalarField(field));
+
+    ScalarT value = 0.0;
+    if (entry.first == "Elastic Modulus") value = 200.0e3;
+    if (entry.first == "Poissons Ratio") value = 0.3;
+    field.deep_copy(value);
+  }
+
+  std::string const F_string = (*field_name_map.getMap())["F"];
+  std::string const J_string = (*field_name_map.getMap())["J"];
+
+  ScalarField def_grad = createField<ScalarT>(F_string, dl->qp_tensor, setup.num_derivs);
+  ScalarField J        = createField<ScalarT>(J_string, dl->qp_scalar, setup.num_derivs);
+  for (int cell = 0; cell < num_cells; ++cell) {
+    for (int pt = 0; pt < num_pts; ++pt) {
+      minitensor::Tensor<ScalarT> F(num_dims);
+      for (int i = 0; i < num_dims; ++i) {
+        for (int j = 0; j < num_dims; ++j) {
+          RealType const value = (i == j ? 1.0 : 0.0) + displacementGradient(cell * num_pts + pt, i, j);
+
+          F(i, j)                  = seedValue(ScalarT(), setup.num_derivs, i * num_dims + j, value);
+          def_grad(cell, pt, i, j) = F(i, j);
+        }
+      }
+      J(cell, pt) = minitensor::det(F);
+    }
+  }
+  dep_fields[F_string] = Teuchos::rcp(new ConstScalarField(def_grad));
+  dep_fields[J_string] = Teuchos::rcp(new ConstScalarField(J));
+
+  typename Model::FieldMap eval_fields;
+  for (auto const& entry : model.getEvaluatedFieldMap()) {
+    eval_fields[entry.first] =
+        Teuchos::rcp(new ScalarField(createField<ScalarT>(entry.first, entry.second, setup.num_derivs)));
+  }
+
+  PHAL::Workset workset;
+  workset.numCells = num_cells;
+
+  // Warm up once, then time.
+  model.computeState(workset, dep_fields, eval_fields);
+
+  Teuchos::Time timer(label);
+  timer.start(true);
+  for (int rep = 0; rep < setup.num_reps; ++rep) {
+    model.computeState(workset, dep_fields, eval_fields);
+  }
+  timer.stop();
+
+  printRate(label, timer.totalElapsedTime(), static_cast<double>(num_cells) * num_pts * setup.num_reps);
+
+  std::string const     cauchy  = (*field_name_map.getMap())["Cauchy_Stress"];
+  ScalarField           stress  = *eval_fields[cauchy];
+  ScalarField           tangent = *eval_fields["Material Tangent"];
+  std::vector<RealType> result;
+  for (int cell = 0; cell < num_cells; ++cell) {
+    for (int pt = 0; pt < num_pts; ++pt) {
+      for (int i = 0; i < num_dims; ++i) {
+        for (int j = 0; j < num_dims; ++j) {
+          result.push_back(Sacado::ScalarValue<ScalarT>::eval(stress(cell, pt, i, j)));
+          for (int k = 0; k < num_dims; ++k) {
+            for (int l = 0; l < num_dims; ++l) {
+              result.push_back(Sacado::ScalarValue<ScalarT>::eval(tangent(cell, pt, i, j, k, l)));
+            }
+          }
+        }
+      }
+    }
+  }
+  return result;
+}
+
+template <typename EvalT>
+bool
+compareModels(std::string const& eval_name, BenchmarkSetup const& setup)
+{
+  using Traits = PHAL::AlbanyTraits;
+
+  std::vector<RealType> const pack =
+      runModel<EvalT, LCM::NeohookeanModel<EvalT, Traits>>("Neohookean " + eval_name, setup);
+  std::vector<RealType> const point =
+      runModel<EvalT, LCM::ParallelNeohookeanModel<EvalT, Traits>>("Parallel Neohookean " + eval_name, setup);
+
+  RealType const max_diff = relativeDifference(pack, point);
+  std::cout << "Max relative difference (" << eval_name << "): " << max_diff << std::endl;
+  return max_diff <= TOLERANCE;
+}
+
+}  // anonymous namespace
+
+int
+main(int ac, char* av[])
+{
+  KokkosGuard kokkos(ac, av);
+
+  Teuchos::GlobalMPISession mpi_session(&ac, &av);
+
+  Teuchos::CommandLineProcessor command_line_processor;
+
+  command_line_processor.setDocString(
+      "Neohookean Throughput.\n"
+      "Compares tensor pack and per point kinematics and Neohookean models.\n");
+
+  BenchmarkSetup setup;
+  command_line_processor.setOption("ncells", &setup.num_cells, "Number of Cells");
+  command_line_processor.setOption("npoints", &setup.num_pts, "Number of Gaussian Points");
+  command_line_processor.setOption("nreps", &setup.num_reps, "Number of Repetitions");
+  command_line_processor.setOption("nderivs", &setup.num_derivs, "Number of Derivatives for Jacobian");
+
+  command_line_processor.recogniseAllOptions(true);
+  command_line_processor.throwExceptions(false);
+
+  Teuchos::CommandLineProcessor::EParseCommandLineReturn parse_return = command_line_processor.parse(ac, av);
+
+  if (parse_return == Teuchos::CommandLineProcessor::PARSE_HELP_PRINTED) {
+    return 0;
+  }
+
+  if (parse_return != Teuchos::CommandLineProcessor::PARSE_SUCCESSFUL) {
+    return 1;
+  }
+
+  std::cout << std::setprecision(6);
+
+  bool const kinematics_match = compareKinematics(setup);
+  bool const residual_match   = compareModels<PHAL::AlbanyTraits::Residual>("Residual", setup);
+  bool const jacobian_match   = compareModels<PHAL::AlbanyTraits::Jacobian>("Jacobian", setup);
+
+  return kinematics_match == true && residual_match == true && jacobian_match == true ? 0 : 1;
+}
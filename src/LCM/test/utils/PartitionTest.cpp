@@ -5,13 +5,21 @@
 // Simple mesh partitioning program
 #include <LCMPartition.hpp>
 #include <Teuchos_CommandLineProcessor.hpp>
+#include <Teuchos_GlobalMPISession.hpp>
 #include <algorithm>
 #include <chrono>
 #include <iomanip>
 
+#include "KokkosGuard.hpp"
+#include "Kokkos_Core.hpp"
+
 int
 main(int ac, char* av[])
 {
+  Teuchos::GlobalMPISession mpi_session(&ac, &av);
+
+  KokkosGuard kokkos(ac, av);
+
   // Initialize Zoltan
   float version;
 
@@ -33,6 +41,13 @@ main(int ac, char* av[])
 
   command_line_processor.setOption("output", &output_file, "Output File Name");
 
+  // For scaling studies, partition a generated mesh of the unit cube
+  // instead of reading the input file.
+  int synthetic_elements = 0;
+
+  command_line_processor.setOption(
+      "synthetic-elements", &synthetic_elements, "Elements per Side of Generated Cube Mesh, 0 to Read Input");
+
   int const number_schemes = 6;
 
   LCM::PARTITION::Scheme const scheme_values[] = {
@@ -100,8 +115,10 @@ main(int ac, char* av[])
     return 1;
   }
 
-  // Read mesh
-  LCM::ConnectivityArray connectivity_array(input_file, output_file);
+  // Read or generate mesh
+  LCM::ConnectivityArray connectivity_array =
+      synthetic_elements > 0 ? LCM::ConnectivityArray(synthetic_elements, output_file)
+                             : LCM::ConnectivityArray(input_file, output_file);
 
   // Set extra parameters
   connectivity_array.setTolerance(tolerance);
@@ -206,6 +223,9 @@ main(int ac, char* av[])
   }
 
   std::chrono::duration<double> elapsed_seconds = end - start;
+  std::cout << "Number of Elements       : " << connectivity_array.getNumberElements() << '\n';
+  std::cout << "Number of Ranks          : " << mpi_session.getNProc() << '\n';
+  std::cout << "Number of Threads        : " << Kokkos::DefaultHostExecutionSpace::concurrency() << '\n';
   std::cout << std::scientific << std::setw(16) << std::setprecision(8);
   std::cout << "PARTITION TIME [s]: " << elapsed_seconds.count() << std::endl;
 
@@ -0,0 +1,257 @@
+// Albany 3.0: Copyright 2016 National Technology & Engineering Solutions of
+// Sandia, LLC (NTESS). This Software is released under the BSD license detailed
+// in the file license.txt in the top-level Albany directory.
+// Point location benchmark.
+// Builds a bounding volume hierarchy over a synthetic sheared hexahedral
+// mesh, locates random points with batched parallel queries and compares
+// the results and the time per point against a brute force search over all
+// elements for a subset of the points.
+
+#include <MiniTensor_Geometry.h>
+#include <Teuchos_CommandLineProcessor.hpp>
+#include <Teuchos_GlobalMPISession.hpp>
+#include <Teuchos_Time.hpp>
+#include <algorithm>
+#include <array>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "BoundingVolumeHierarchy.hpp"
+#include "KokkosGuard.hpp"
+
+namespace {
+
+using Point = minitensor::Vector<double, 3>;
+
+struct BenchmarkSetup
+{
+  int elements_per_side{100};
+  int num_points{1000000};
+  int num_brute{1000};
+  int num_reps{3};
+};
+
+//
+// Structured hexahedral mesh of the unit cube with a shear applied,
+// so that the elements are not aligned with the axes.
+//
+struct HexMesh
+{
+  explicit HexMesh(int const n);
+
+  Point
+  node(int const element, int const local_node) const
+  {
+    int const i = connectivity[element][local_node];
+    return Point(coordinates[3 * i], coordinates[3 * i + 1], coordinates[3 * i + 2]);
+  }
+
+  bool
+  contains(int const element, Point const& point) const
+  {
+    return minitensor::in_hexahedron(
+        point,
+        node(element, 0),
+        node(element, 1),
+        node(element, 2),
+        node(element, 3),
+        node(element, 4),
+        node(element, 5),
+        node(element, 6),
+        node(element, 7));
+  }
+
+  std::vector<double>             coordinates;
+  std::vector<std::array<int, 8>> connectivity;
+  std::vector<double>             lower;
+  std::vector<double>             upper;
+};
+
+HexMesh::HexMesh(int const n)
+{
+  int const    nodes_per_side = n + 1;
+  double const h              = 1.0 / n;
+  double const shear          = 0.25;
+
+  coordinates.reserve(3 * nodes_per_side * nodes_per_side * nodes_per_side);
+
+  for (int k = 0; k < nodes_per_side; ++k) {
+    for (int j = 0; j < nodes_per_side; ++j) {
+      for (int i = 0; i < nodes_per_side; ++i) {
+        double const x = i * h;
+        double const y = j * h;
+        double const z = k * h;
+        coordinates.push_back(x + shear * z);
+        coordinates.push_back(y + shear * z);
+        coordinates.push_back(z);
+      }
+    }
+  }
+
+  auto const node_id = [&](int const i, int const j, int const k) {
+    return i + nodes_per_side * (j + nodes_per_side * k);
+  };
+
+  connectivity.reserve(n * n * n);
+
+  for (int k = 0; k < n; ++k) {
+    for (int j = 0; j < n; ++j) {
+      for (int i = 0; i < n; ++i) {
+        connectivity.push_back({node_id(i, j, k),
+                                node_id(i + 1, j, k),
+                                node_id(i + 1, j + 1, k),
+                                node_id(i, j + 1, k),
+                                node_id(i, j, k + 1),
+                                node_id(i + 1, j, k + 1),
+                                node_id(i + 1, j + 1, k + 1),
+                                node_id(i, j + 1, k + 1)});
+      }
+    }
+  }
+
+  lower.reserve(3 * connectivity.size());
+  upper.reserve(3 * connectivity.size());
+
+  for (auto&& element_nodes : connectivity) {
+    for (int d = 0; d < 3; ++d) {
+      double min = coordinates[3 * element_nodes[0] + d];
+      double max = min;
+      for (auto&& node : element_nodes) {
+        min = std::min(min, coordinates[3 * node + d]);
+        max = std::max(max, coordinates[3 * node + d]);
+      }
+      lower.push_back(min);
+      upper.push_back(max);
+    }
+  }
+}
+
+}  // anonymous namespace
+
+int
+main(int ac, char* av[])
+{
+  KokkosGuard kokkos(ac, av);
+
+  Teuchos::GlobalMPISession mpi_session(&ac, &av);
+
+  Teuchos::CommandLineProcessor command_line_processor;
+
+  command_line_processor.setDocString(
+      "Point Location.\n"
+      "Compares bounding volume hierarchy and brute force point location.\n");
+
+  BenchmarkSetup setup;
+  command_line_processor.setOption("nside", &setup.elements_per_side, "Number of Elements per Side");
+  command_line_processor.setOption("npoints", &setup.num_points, "Number of Query Points");
+  command_line_processor.setOption("nbrute", &setup.num_brute, "Number of Points for Brute Force");
+  command_line_processor.setOption("nreps", &setup.num_reps, "Number of Repetitions");
+
+  command_line_processor.recogniseAllOptions(true);
+  command_line_processor.throwExceptions(false);
+
+  Teuchos::CommandLineProcessor::EParseCommandLineReturn parse_return = command_line_processor.parse(ac, av);
+
+  if (parse_return == Teuchos::CommandLineProcessor::PARSE_HELP_PRINTED) {
+    return 0;
+  }
+
+  if (parse_return != Teuchos::CommandLineProcessor::PARSE_SUCCESSFUL) {
+    return 1;
+  }
+
+  setup.num_reps = std::max(setup.num_reps, 1);
+
+  std::cout << std::setprecision(6);
+
+  HexMesh const mesh(setup.elements_per_side);
+
+  int const number_elements = mesh.connectivity.size();
+
+  Teuchos::Time build_timer("Build", true);
+
+  // Enlarge the boxes to cover the tolerance of the inclusion test.
+  LCM::BoundingVolumeHierarchy const bvh(3, mesh.lower, mesh.upper, 0.05);
+
+  build_timer.stop();
+
+  // Random points in a box somewhat larger than the mesh, so that some of
+  // them are outside.
+  std::mt19937                           generator(1);
+  std::uniform_real_distribution<double> distribution(-0.1, 1.35);
+
+  std::vector<double> points(3 * setup.num_points);
+
+  for (auto&& x : points) {
+    x = distribution(generator);
+  }
+
+  auto const point = [&](std::size_t const p) { return Point(points[3 * p], points[3 * p + 1], points[3 * p + 2]); };
+
+  auto const in_element = [&](int const element, std::size_t const p) { return mesh.contains(element, point(p)); };
+
+  std::vector<int> elements;
+
+  Teuchos::Time query_timer("Query", false);
+
+  for (int rep = 0; rep < setup.num_reps; ++rep) {
+    query_timer.start();
+    bvh.findElements(points, in_element, elements);
+    query_timer.stop();
+  }
+
+  // Brute force over a subset of the points.
+  int const number_brute = std::min(setup.num_brute, setup.num_points);
+
+  Teuchos::Time brute_timer("Brute", true);
+
+  int mismatches{0};
+
+  for (int p = 0; p < number_brute; ++p) {
+    Point const x = point(p);
+
+    int found{-1};
+
+    for (int element = 0; element < number_elements; ++element) {
+      if (mesh.contains(element, x) == true) {
+        found = element;
+        break;
+      }
+    }
+
+    bool const bvh_inside   = elements[p] >= 0;
+    bool const brute_inside = found >= 0;
+
+    if (bvh_inside != brute_inside) ++mismatches;
+  }
+
+  brute_timer.stop();
+
+  int number_inside{0};
+
+  for (auto&& element : elements) {
+    if (element >= 0) ++number_inside;
+  }
+
+  double const query_time = query_timer.totalElapsedTime() / setup.num_reps;
+  double const brute_time = brute_timer.totalElapsedTime();
+
+  double const query_per_point = query_time / setup.num_points;
+  double const brute_per_point = number_brute > 0 ? brute_time / number_brute : 0.0;
+
+  std::cout << "Elements              : " << number_elements << '\n';
+  std::cout << "Tree nodes            : " << bvh.getNumberNodes() << '\n';
+  std::cout << "Query points          : " << setup.num_points << '\n';
+  std::cout << "Points inside         : " << number_inside << '\n';
+  std::cout << "Build time (s)        : " << build_timer.totalElapsedTime() << '\n';
+  std::cout << "Query time (s)        : " << query_time << '\n';
+  std::cout << "Queries per second    : " << setup.num_points / query_time << '\n';
+  std::cout << "Brute force points    : " << number_brute << '\n';
+  std::cout << "Brute force time (s)  : " << brute_time << '\n';
+  std::cout << "Speedup per point     : " << (query_per_point > 0.0 ? brute_per_point / query_per_point : 0.0) << '\n';
+  std::cout << "Inside/outside errors : " << mismatches << '\n';
+
+  return mismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,179 @@
+// Albany 3.0: Copyright 2016 National Technology & Engineering Solutions of
+// Sandia, LLC (NTESS). This Software is released under the BSD license detailed
+// in the file license.txt in the top-level Albany directory.
+
+#if !defined(LCM_BifurcationSweep_hpp)
+#define LCM_BifurcationSweep_hpp
+
+#include <algorithm>
+#include <cmath>
+
+#include "MiniTensor.h"
+#include "Sacado.hpp"
+
+// Grid sweeps and bounds of the minimum of det(A(n)) over unit normals n,
+// where A(n) is the acoustic tensor of a material tangent. Shared by the
+// BifurcationCheck evaluator and its test driver.
+namespace LCM {
+
+//
+// Traverse a parametric grid of the acoustic tensor determinant, uniformly
+// or coarse to fine. The coarse pass takes every coarsening-th line of the
+// grid in each parameter. The fine pass covers the coarse cells next to the
+// coarse minimum at the original resolution. Both passes update the minimum
+// of the same parametrization.
+//
+template <typename ParametrizationT, typename T, minitensor::Index N>
+T
+bifurcation_grid_sweep(
+    minitensor::Tensor4<T, 3> const&                tangent,
+    minitensor::Vector<T, N> const&                 grid_min,
+    minitensor::Vector<T, N> const&                 grid_max,
+    minitensor::Vector<minitensor::Index, N> const& num_points,
+    bool const                                      adaptive,
+    minitensor::Vector<T, N>&                       arg_minimum,
+    minitensor::Vector<T, 3>&                       direction)
+{
+  ParametrizationT param(tangent);
+
+  if (adaptive == false) {
+    minitensor::ParametricGrid<T, N> grid(grid_min, grid_max, num_points);
+    grid.traverse(param);
+  } else {
+    minitensor::Index const coarsening = 4;
+
+    minitensor::Vector<minitensor::Index, N> coarse_num_points;
+    for (minitensor::Index i = 0; i < N; ++i) {
+      coarse_num_points(i) = num_points(i) > 1 ? (num_points(i) - 2) / coarsening + 2 : 1;
+    }
+
+    minitensor::ParametricGrid<T, N> coarse_grid(grid_min, grid_max, coarse_num_points);
+    coarse_grid.traverse(param);
+
+    minitensor::Vector<T, N>                 fine_min;
+    minitensor::Vector<T, N>                 fine_max;
+    minitensor::Vector<minitensor::Index, N> fine_num_points;
+    for (minitensor::Index i = 0; i < N; ++i) {
+      if (num_points(i) <= 1) {
+        fine_min(i)        = grid_min(i);
+        fine_max(i)        = grid_max(i);
+        fine_num_points(i) = num_points(i);
+        continue;
+      }
+      T const center   = (param.get_arg_minimum())(i);
+      T const coarse_h = (grid_max(i) - grid_min(i)) / (coarse_num_points(i) - 1.0);
+
+      fine_min(i) = center - coarse_h;
+      fine_max(i) = center + coarse_h;
+      if (fine_min(i) < grid_min(i)) fine_min(i) = grid_min(i);
+      if (fine_max(i) > grid_max(i)) fine_max(i) = grid_max(i);
+
+      double const span      = Sacado::ScalarValue<T>::eval(grid_max(i) - grid_min(i));
+      double const width     = Sacado::ScalarValue<T>::eval(fine_max(i) - fine_min(i));
+      double const intervals = width / span * (num_points(i) - 1.0);
+      fine_num_points(i)     = static_cast<minitensor::Index>(std::ceil(intervals - 1.0e-8)) + 1;
+    }
+
+    minitensor::ParametricGrid<T, N> fine_grid(fine_min, fine_max, fine_num_points);
+    fine_grid.traverse(param);
+  }
+
+  for (minitensor::Index i = 0; i < 3; ++i) {
+    direction(i) = (param.get_normal_minimum())(i);
+  }
+
+  for (minitensor::Index i = 0; i < N; ++i) {
+    arg_minimum(i) = (param.get_arg_minimum())(i);
+  }
+
+  return param.get_minimum();
+}
+
+//
+// Lower bound of det(A(n)) over all unit n from the spectra of the tangent
+// restricted to symmetric and skew tensors. Derivatives are dropped.
+//
+// For unit m and n, m.A(n).m = X:C:X with X = m (x) n. Split X into its
+// symmetric and skew parts S and W. Then |S|^2 + |W|^2 = 1 and
+// |S|^2 - |W|^2 = (m.n)^2 >= 0, and
+//   X:C:X >= p |S|^2 - 2 r |S||W| + q |W|^2,
+// where p and q are the smallest eigenvalues of C restricted to symmetric and
+// skew tensors, and r bounds the coupling between both. The minimum c of the
+// right-hand side over the admissible |S|, |W| bounds the smallest eigenvalue
+// of the symmetric part of every A(n), and if c > 0 then
+// det(A(n)) >= det(sym(A(n))) >= c^3 (Ostrowski-Taussky).
+//
+template <typename T>
+double
+min_detA_lower_bound(minitensor::Tensor4<T, 3> const& tangent)
+{
+  minitensor::Tensor4<double, 3> C;
+  for (minitensor::Index i = 0; i < 3; ++i) {
+    for (minitensor::Index j = 0; j < 3; ++j) {
+      for (minitensor::Index k = 0; k < 3; ++k) {
+        for (minitensor::Index l = 0; l < 3; ++l) {
+          C(i, j, k, l) = Sacado::ScalarValue<T>::eval(tangent(i, j, k, l));
+        }
+      }
+    }
+  }
+
+  // Orthonormal basis of 3x3 tensors, the symmetric ones first and then the
+  // skew ones.
+  double const            s         = 1.0 / std::sqrt(2.0);
+  minitensor::Index const pair_i[3] = {0, 1, 0};
+  minitensor::Index const pair_j[3] = {1, 2, 2};
+
+  minitensor::Tensor<double, 3> B[9];
+  for (minitensor::Index a = 0; a < 9; ++a) B[a] = minitensor::Tensor<double, 3>(minitensor::Filler::ZEROS);
+  for (minitensor::Index a = 0; a < 3; ++a) {
+    B[a](a, a)                     = 1.0;
+    B[a + 3](pair_i[a], pair_j[a]) = s;
+    B[a + 3](pair_j[a], pair_i[a]) = s;
+    B[a + 6](pair_i[a], pair_j[a]) = s;
+    B[a + 6](pair_j[a], pair_i[a]) = -s;
+  }
+
+  // Symmetric part of C in this basis.
+  minitensor::Tensor<double, 3> CB[9];
+  for (minitensor::Index a = 0; a < 9; ++a) CB[a] = minitensor::dotdot(C, B[a]);
+  double M[9][9];
+  for (minitensor::Index a = 0; a < 9; ++a) {
+    for (minitensor::Index b = 0; b < 9; ++b) {
+      M[a][b] = 0.5 * (minitensor::dotdot(B[a], CB[b]) + minitensor::dotdot(B[b], CB[a]));
+    }
+  }
+
+  minitensor::Tensor<double, 6> P(minitensor::Filler::ZEROS);
+  minitensor::Tensor<double, 3> Q(minitensor::Filler::ZEROS);
+  double                        r2 = 0.0;
+  for (minitensor::Index a = 0; a < 6; ++a) {
+    for (minitensor::Index b = 0; b < 6; ++b) P(a, b) = M[a][b];
+    for (minitensor::Index b = 6; b < 9; ++b) r2 += M[a][b] * M[a][b];
+  }
+  for (minitensor::Index a = 6; a < 9; ++a) {
+    for (minitensor::Index b = 6; b < 9; ++b) Q(a - 6, b - 6) = M[a][b];
+  }
+
+  minitensor::Tensor<double, 6> const P_eig = minitensor::eig_sym(P).second;
+  minitensor::Tensor<double, 3> const Q_eig = minitensor::eig_sym(Q).second;
+
+  double p = P_eig(0, 0);
+  for (minitensor::Index a = 1; a < 6; ++a) p = std::min(p, P_eig(a, a));
+  double q = Q_eig(0, 0);
+  for (minitensor::Index a = 1; a < 3; ++a) q = std::min(q, Q_eig(a, a));
+  double const r = std::sqrt(r2);
+
+  // With |S| = cos(t) and |W| = sin(t), t in [0, pi/4], the bound is
+  // (p + q) / 2 + (p - q) / 2 cos(2t) - r sin(2t).
+  double const mean = 0.5 * (p + q);
+  double const half = 0.5 * (p - q);
+  double       c    = std::min(p, mean - r);
+  if (half < 0.0) c = std::min(c, mean - std::sqrt(half * half + r * r));
+
+  return c > 0.0 ? c * c * c : 0.0;
+}
+
+}  // namespace LCM
+
+#endif  // LCM_BifurcationSweep_hpp
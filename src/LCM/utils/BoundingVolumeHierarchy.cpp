@@ -0,0 +1,123 @@
+// Albany 3.0: Copyright 2016 National Technology & Engineering Solutions of
+// Sandia, LLC (NTESS). This Software is released under the BSD license detailed
+// in the file license.txt in the top-level Albany directory.
+
+#include "BoundingVolumeHierarchy.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
+#include "Albany_Macros.hpp"
+
+namespace LCM {
+
+BoundingVolumeHierarchy::BoundingVolumeHierarchy(
+    int const                  dimension,
+    std::vector<double> const& lower,
+    std::vector<double> const& upper,
+    double const               tolerance)
+    : dimension_(dimension), lower_(lower), upper_(upper)
+{
+  ALBANY_ASSERT(0 < dimension && dimension <= MAX_DIMENSION, "Invalid dimension for bounding volume hierarchy");
+  ALBANY_ASSERT(lower.size() == upper.size(), "Mismatched lower and upper box corners");
+  ALBANY_ASSERT(lower.size() % dimension == 0, "Box corners are not a multiple of the dimension");
+
+  std::size_t const number_elements = lower.size() / dimension;
+
+  centroids_.resize(lower.size());
+
+  for (std::size_t k = 0; k < lower.size(); ++k) {
+    double const span = upper_[k] - lower_[k];
+
+    lower_[k] -= tolerance * span;
+    upper_[k] += tolerance * span;
+    centroids_[k] = 0.5 * (lower_[k] + upper_[k]);
+  }
+
+  element_order_.resize(number_elements);
+  std::iota(element_order_.begin(), element_order_.end(), 0);
+
+  if (number_elements == 0) return;
+
+  nodes_.reserve(2 * (number_elements / LEAF_SIZE + 1));
+  build(0, number_elements, 0);
+}
+
+// Build the subtree over element_order_[begin, end) and return its index.
+int
+BoundingVolumeHierarchy::build(int const begin, int const end, int const depth)
+{
+  ALBANY_ASSERT(depth < MAX_DEPTH, "Bounding volume hierarchy is too deep");
+
+  Node node;
+
+  node.lower.fill(std::numeric_limits<double>::max());
+  node.upper.fill(std::numeric_limits<double>::lowest());
+
+  std::array<double, MAX_DIMENSION> centroid_lower;
+  std::array<double, MAX_DIMENSION> centroid_upper;
+
+  centroid_lower.fill(std::numeric_limits<double>::max());
+  centroid_upper.fill(std::numeric_limits<double>::lowest());
+
+  for (int i = begin; i < end; ++i) {
+    int const offset = dimension_ * element_order_[i];
+
+    for (int j = 0; j < dimension_; ++j) {
+      node.lower[j]     = std::min(node.lower[j], lower_[offset + j]);
+      node.upper[j]     = std::max(node.upper[j], upper_[offset + j]);
+      centroid_lower[j] = std::min(centroid_lower[j], centroids_[offset + j]);
+      centroid_upper[j] = std::max(centroid_upper[j], centroids_[offset + j]);
+    }
+  }
+
+  int const index = nodes_.size();
+
+  nodes_.emplace_back(node);
+
+  if (end - begin <= LEAF_SIZE) {
+    nodes_[index].begin = begin;
+    nodes_[index].end   = end;
+    return index;
+  }
+
+  // Split at the median centroid along the longest axis of the centroids.
+  int axis = 0;
+
+  for (int j = 1; j < dimension_; ++j) {
+    double const span      = centroid_upper[j] - centroid_lower[j];
+    double const axis_span = centroid_upper[axis] - centroid_lower[axis];
+
+    if (span > axis_span) axis = j;
+  }
+
+  int const middle = begin + (end - begin) / 2;
+
+  auto const first = element_order_.begin();
+
+  std::nth_element(first + begin, first + middle, first + end, [&](int const a, int const b) {
+    return centroids_[dimension_ * a + axis] < centroids_[dimension_ * b + axis];
+  });
+
+  int const left  = build(begin, middle, depth + 1);
+  int const right = build(middle, end, depth + 1);
+
+  nodes_[index].left  = left;
+  nodes_[index].right = right;
+
+  return index;
+}
+
+void
+BoundingVolumeHierarchy::findCandidates(double const* point, std::vector<int>& candidates) const
+{
+  auto const collect = [&](int const element) {
+    candidates.push_back(element);
+    return false;
+  };
+
+  findElement(point, collect);
+}
+
+}  // namespace LCM
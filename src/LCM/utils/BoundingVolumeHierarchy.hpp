@@ -0,0 +1,137 @@
+// Albany 3.0: Copyright 2016 National Technology & Engineering Solutions of
+// Sandia, LLC (NTESS). This Software is released under the BSD license detailed
+// in the file license.txt in the top-level Albany directory.
+
+#if !defined(LCM_BoundingVolumeHierarchy_hpp)
+#define LCM_BoundingVolumeHierarchy_hpp
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+namespace LCM {
+
+///
+/// Bounding volume hierarchy of axis-aligned element boxes for point
+/// location. The tree is built once per mesh by recursive median splits
+/// along the longest axis of the box centroids. A query only descends into
+/// the boxes that contain the point and hands the candidate elements to an
+/// exact inclusion test supplied by the caller, so the same tree serves
+/// any element type.
+///
+class BoundingVolumeHierarchy
+{
+ public:
+  static constexpr int MAX_DIMENSION = 3;
+
+  static constexpr int MAX_DEPTH = 64;
+
+  static constexpr int LEAF_SIZE = 4;
+
+  ///
+  /// \param dimension Space dimension, at most MAX_DIMENSION
+  /// \param lower Lower box corners, dimension entries per element
+  /// \param upper Upper box corners, dimension entries per element
+  /// \param tolerance Each box is enlarged on every side by this fraction
+  /// of its span
+  ///
+  BoundingVolumeHierarchy(
+      int const                  dimension,
+      std::vector<double> const& lower,
+      std::vector<double> const& upper,
+      double const               tolerance = 0.0);
+
+  ///
+  /// \return Space dimension
+  ///
+  int
+  getDimension() const
+  {
+    return dimension_;
+  }
+
+  ///
+  /// \return Number of elements in the hierarchy
+  ///
+  std::size_t
+  getNumberElements() const
+  {
+    return element_order_.size();
+  }
+
+  ///
+  /// \return Number of tree nodes
+  ///
+  std::size_t
+  getNumberNodes() const
+  {
+    return nodes_.size();
+  }
+
+  ///
+  /// Append the elements whose box contains the point to candidates.
+  ///
+  void
+  findCandidates(double const* point, std::vector<int>& candidates) const;
+
+  ///
+  /// \param point Query point, dimension entries
+  /// \param in_element Exact test, in_element(element) is true if the
+  /// element contains the point
+  /// \return First candidate element that passes in_element, -1 if none
+  ///
+  template <typename InElement>
+  int
+  findElement(double const* point, InElement const& in_element) const;
+
+  ///
+  /// Batched findElement, run in parallel on the host.
+  /// \param points Query points, dimension entries per point
+  /// \param in_element Exact test, in_element(element, point_index) is true
+  /// if the element contains the point. Must be safe to call concurrently.
+  /// \param elements Upon return, the element found for each point or -1
+  ///
+  template <typename InElement>
+  void
+  findElements(std::vector<double> const& points, InElement const& in_element, std::vector<int>& elements) const;
+
+ private:
+  struct Node
+  {
+    std::array<double, MAX_DIMENSION> lower;
+    std::array<double, MAX_DIMENSION> upper;
+
+    // Children of interior nodes, -1 for leaves
+    int left{-1};
+    int right{-1};
+
+    // Range into element_order_ of leaves
+    int begin{0};
+    int end{0};
+  };
+
+  int
+  build(int const begin, int const end, int const depth);
+
+  bool
+  inBox(double const* lower, double const* upper, double const* point) const
+  {
+    for (int i = 0; i < dimension_; ++i) {
+      if (point[i] < lower[i] || upper[i] < point[i]) return false;
+    }
+    return true;
+  }
+
+  int                 dimension_{0};
+  std::vector<double> lower_;
+  std::vector<double> upper_;
+  std::vector<double> centroids_;
+  std::vector<int>    element_order_;
+  std::vector<Node>   nodes_;
+};
+
+}  // namespace LCM
+
+#include "BoundingVolumeHierarchy_Def.hpp"
+
+#endif  // LCM_BoundingVolumeHierarchy_hpp
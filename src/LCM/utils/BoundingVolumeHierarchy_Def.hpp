@@ -0,0 +1,65 @@
+// Albany 3.0: Copyright 2016 National Technology & Engineering Solutions of
+// Sandia, LLC (NTESS). This Software is released under the BSD license detailed
+// in the file license.txt in the top-level Albany directory.
+
+#include <Kokkos_Core.hpp>
+
+namespace LCM {
+
+template <typename InElement>
+int
+BoundingVolumeHierarchy::findElement(double const* point, InElement const& in_element) const
+{
+  if (nodes_.empty() == true) return -1;
+
+  // Depth first, the depth of the tree is bounded by MAX_DEPTH and each
+  // visited node leaves at most one sibling behind on the stack.
+  std::array<int, MAX_DEPTH + 1> stack;
+
+  int top      = 0;
+  stack[top++] = 0;
+
+  while (top > 0) {
+    Node const& node = nodes_[stack[--top]];
+
+    if (inBox(node.lower.data(), node.upper.data(), point) == false) continue;
+
+    if (node.left < 0) {
+      for (int i = node.begin; i < node.end; ++i) {
+        int const element = element_order_[i];
+        int const offset  = dimension_ * element;
+
+        if (inBox(&lower_[offset], &upper_[offset], point) == false) continue;
+        if (in_element(element) == true) return element;
+      }
+      continue;
+    }
+
+    stack[top++] = node.right;
+    stack[top++] = node.left;
+  }
+
+  return -1;
+}
+
+template <typename InElement>
+void
+BoundingVolumeHierarchy::findElements(
+    std::vector<double> const& points,
+    InElement const&           in_element,
+    std::vector<int>&          elements) const
+{
+  std::size_t const number_points = points.size() / dimension_;
+
+  elements.resize(number_points);
+
+  using Policy = Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>;
+
+  Kokkos::parallel_for(Policy(0, number_points), [&](std::size_t const point) {
+    auto const in_element_for_point = [&](int const element) { return in_element(element, point); };
+
+    elements[point] = findElement(&points[dimension_ * point], in_element_for_point);
+  });
+}
+
+}  // namespace LCM
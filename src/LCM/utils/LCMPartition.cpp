@@ -4,13 +4,18 @@
 
 #include "LCMPartition.hpp"
 
+#include <Kokkos_Core.hpp>
+#include <Teuchos_Time.hpp>
 #include <algorithm>
+#include <array>
 #include <boost/graph/adjacency_list.hpp>
 #include <boost/graph/connected_components.hpp>
 #include <cstdlib>
 #include <fstream>
 #include <iomanip>
 #include <iterator>
+#include <limits>
+#include <numeric>
 #include <sstream>
 #include <string>
 
@@ -382,6 +387,32 @@ traverseTree(Tree& tree, Visitor const& visitor)
   return;
 }
 
+namespace {
+
+// Visit the top levels of a tree like visitTreeNode, but instead of
+// visiting the nodes at the given depth collect them, so that those
+// subtrees can be visited concurrently.
+template <typename Node, typename Visitor>
+void
+collectSubtrees(Node& node, Visitor const& visitor, minitensor::Index const depth, std::vector<Node>& subtrees)
+{
+  if (visitor.pre_stop(node) == true) return;
+
+  if (depth == 0) {
+    subtrees.push_back(node);
+    return;
+  }
+
+  visitor(node);
+
+  if (visitor.post_stop(node) == true) return;
+
+  collectSubtrees(node->left, visitor, depth - 1, subtrees);
+  collectSubtrees(node->right, visitor, depth - 1, subtrees);
+}
+
+}  // anonymous namespace
+
 // Output visitor for KDTree node.
 template <typename Node>
 void
@@ -617,10 +648,74 @@ ConnectivityArray::ConnectivityArray()
   return;
 }
 
+namespace {
+
+// Discretization parameters common to all meshes read by the array.
+Teuchos::RCP<Teuchos::ParameterList>
+discretization_parameters(std::string const& method, std::string const& output_file)
+{
+  Teuchos::RCP<Teuchos::ParameterList> params = Teuchos::rcp(new Teuchos::ParameterList("params"));
+
+  Teuchos::RCP<Teuchos::ParameterList> disc_params = Teuchos::sublist(params, "Discretization");
+
+  disc_params->set<std::string>("Method", method);
+  disc_params->set<std::string>("Exodus Output File Name", output_file);
+  // Max of 10000 workset size -- automatically resized down
+  disc_params->set<int>("Workset Size", 10000);
+  disc_params->set<int>("Number Of Time Derivatives", 0);
+
+  return params;
+}
+
+// Read the mesh from an Exodus file.
+Teuchos::RCP<Teuchos::ParameterList>
+exodus_parameters(std::string const& input_file, std::string const& output_file)
+{
+  Teuchos::RCP<Teuchos::ParameterList> params = discretization_parameters("Exodus", output_file);
+
+  params->sublist("Discretization").set<std::string>("Exodus Input File Name", input_file);
+
+  return params;
+}
+
+// Generate a structured hexahedral mesh of the unit cube.
+Teuchos::RCP<Teuchos::ParameterList>
+cube_parameters(int const elements_per_side, std::string const& output_file)
+{
+  Teuchos::RCP<Teuchos::ParameterList> params = discretization_parameters("STK3D", output_file);
+
+  Teuchos::ParameterList& disc_params = params->sublist("Discretization");
+
+  disc_params.set<int>("1D Elements", elements_per_side);
+  disc_params.set<int>("2D Elements", elements_per_side);
+  disc_params.set<int>("3D Elements", elements_per_side);
+
+  return params;
+}
+
+}  // anonymous namespace
+
 // Build array specifying input and output
 // \param input_file Exodus II input fine name
 // \param output_file Exodus II output fine name
 ConnectivityArray::ConnectivityArray(std::string const& input_file, std::string const& output_file)
+    : ConnectivityArray(exodus_parameters(input_file, output_file))
+{
+  return;
+}
+
+// Build array for a structured hexahedral mesh of the unit cube
+// \param elements_per_side Number of elements along each side
+// \param output_file Exodus II output fine name
+ConnectivityArray::ConnectivityArray(int const elements_per_side, std::string const& output_file)
+    : ConnectivityArray(cube_parameters(elements_per_side, output_file))
+{
+  return;
+}
+
+// Build array from the parameters of the discretization
+// \param params Parameters with a Discretization sublist
+ConnectivityArray::ConnectivityArray(Teuchos::RCP<Teuchos::ParameterList> const& params)
     : type_(minitensor::ELEMENT::UNKNOWN),
       dimension_(0),
       discretization_ptr_(Teuchos::null),
@@ -631,24 +726,9 @@ ConnectivityArray::ConnectivityArray(std::string const& input_file, std::string
 {
   using Albany::StateStruct;
 
-  // Teuchos::GlobalMPISession mpiSession(&argc,&argv);
-
-  Teuchos::RCP<Teuchos::ParameterList> params = rcp(new Teuchos::ParameterList("params"));
-
-  // Create discretization object
-  Teuchos::RCP<Teuchos::ParameterList> disc_params = Teuchos::sublist(params, "Discretization");
-
-  // set Method to Exodus and set input file name
-  disc_params->set<std::string>("Method", "Exodus");
-  disc_params->set<std::string>("Exodus Input File Name", input_file);
-  disc_params->set<std::string>("Exodus Output File Name", output_file);
-  // Max of 10000 workset size -- automatically resized down
-  disc_params->set<int>("Workset Size", 10000);
-  disc_params->set<int>("Number Of Time Derivatives", 0);
+  comm_ = Albany::createTeuchosCommFromMpiComm(Albany_MPI_COMM_WORLD);
 
-  Teuchos::RCP<Teuchos_Comm const> communicator = Albany::createTeuchosCommFromMpiComm(Albany_MPI_COMM_WORLD);
-
-  Albany::DiscretizationFactory disc_factory(params, communicator);
+  Albany::DiscretizationFactory disc_factory(params, comm_);
 
   Teuchos::ArrayRCP<Teuchos::RCP<Albany::MeshSpecsStruct>> mesh_specs = disc_factory.createMeshSpecs();
 
@@ -1116,6 +1196,147 @@ ConnectivityArray::boundingBox() const
   return std::make_pair(min, max);
 }
 
+// \return Centroids of the elements, dimension entries per element,
+// in the order of the connectivity array
+std::vector<double>
+ConnectivityArray::getCentroidCoordinates() const
+{
+  minitensor::Index const dimension = getDimension();
+
+  std::vector<IDList const*> element_nodes;
+
+  element_nodes.reserve(connectivity_.size());
+
+  for (auto&& element_conn : connectivity_) {
+    element_nodes.push_back(&element_conn.second);
+  }
+
+  std::vector<double> coordinates(dimension * element_nodes.size(), 0.0);
+
+  using Policy = Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>;
+
+  Kokkos::parallel_for(Policy(0, element_nodes.size()), [&](std::size_t const element) {
+    IDList const& node_list = *element_nodes[element];
+
+    double* const centroid = &coordinates[dimension * element];
+
+    for (auto&& node : node_list) {
+      PointMap::const_iterator nodes_iter = nodes_.find(node);
+
+      ALBANY_EXPECT(nodes_iter != nodes_.end());
+
+      minitensor::Vector<double> const& point = (*nodes_iter).second;
+
+      for (minitensor::Index i = 0; i < dimension; ++i) {
+        centroid[i] += point(i);
+      }
+    }
+
+    for (minitensor::Index i = 0; i < dimension; ++i) {
+      centroid[i] /= node_list.size();
+    }
+  });
+
+  return coordinates;
+}
+
+// \return Bounding box for the nodes of all ranks
+std::pair<minitensor::Vector<double>, minitensor::Vector<double>>
+ConnectivityArray::globalBoundingBox() const
+{
+  minitensor::Vector<double> lower_corner;
+
+  minitensor::Vector<double> upper_corner;
+
+  boost::tie(lower_corner, upper_corner) = boundingBox();
+
+  minitensor::Index const N = lower_corner.get_dimension();
+
+  std::vector<double> lower(N);
+
+  std::vector<double> upper(N);
+
+  for (minitensor::Index i = 0; i < N; ++i) {
+    lower[i] = lower_corner(i);
+    upper[i] = upper_corner(i);
+  }
+
+  reduceOverRanks(Teuchos::REDUCE_MIN, lower);
+  reduceOverRanks(Teuchos::REDUCE_MAX, upper);
+
+  for (minitensor::Index i = 0; i < N; ++i) {
+    lower_corner(i) = lower[i];
+    upper_corner(i) = upper[i];
+  }
+
+  return std::make_pair(lower_corner, upper_corner);
+}
+
+// Concatenate the centers of all ranks, in rank order, so that all
+// ranks iterate on the same set of centers.
+// \param local_centers Centers found by this rank
+// \return Centers of all ranks
+std::vector<minitensor::Vector<double>>
+ConnectivityArray::gatherCenters(std::vector<minitensor::Vector<double>> const& local_centers) const
+{
+  if (comm_.is_null() == true || comm_->getSize() == 1) return local_centers;
+
+  int const number_ranks = comm_->getSize();
+
+  int const number_local = local_centers.size();
+
+  std::vector<int> counts(number_ranks);
+
+  Teuchos::gatherAll(*comm_, 1, &number_local, number_ranks, counts.data());
+
+  int const offset = std::accumulate(counts.begin(), counts.begin() + comm_->getRank(), 0);
+
+  int const number_centers = std::accumulate(counts.begin(), counts.end(), 0);
+
+  minitensor::Index const dimension = getDimension();
+
+  // Each rank fills its own slots, the sum over ranks assembles the rest.
+  std::vector<double> coordinates(dimension * number_centers, 0.0);
+
+  for (int i = 0; i < number_local; ++i) {
+    for (minitensor::Index j = 0; j < dimension; ++j) {
+      coordinates[dimension * (offset + i) + j] = local_centers[i](j);
+    }
+  }
+
+  reduceOverRanks(Teuchos::REDUCE_SUM, coordinates);
+
+  std::vector<minitensor::Vector<double>> centers(number_centers, minitensor::Vector<double>(dimension));
+
+  for (int i = 0; i < number_centers; ++i) {
+    for (minitensor::Index j = 0; j < dimension; ++j) {
+      centers[i](j) = coordinates[dimension * i + j];
+    }
+  }
+
+  return centers;
+}
+
+// Reduce values over all ranks in place
+// \param reduction Type of reduction
+// \param values Local values upon entry, reduced values upon return
+void
+ConnectivityArray::reduceOverRanks(Teuchos::EReductionType const reduction, std::vector<double>& values) const
+{
+  if (comm_.is_null() == true || comm_->getSize() == 1) return;
+
+  std::vector<double> const local_values = values;
+
+  Teuchos::reduceAll(*comm_, reduction, static_cast<int>(values.size()), local_values.data(), values.data());
+}
+
+// \return Whether this rank prints the partitioner progress
+bool
+ConnectivityArray::isRootRank() const
+{
+  return comm_.is_null() == true || comm_->getRank() == 0;
+}
+
 namespace {
 
 boost::tuple<minitensor::Index, double, double>
@@ -1393,6 +1614,19 @@ ConnectivityArray::isInsideMeshByElement(minitensor::Vector<double> const& point
     return false;
   }
 
+  // Use the bounding volume hierarchy if available
+  if (bvh_ != nullptr) {
+    std::array<double, BoundingVolumeHierarchy::MAX_DIMENSION> coordinates;
+
+    for (minitensor::Index i = 0; i < dimension_; ++i) {
+      coordinates[i] = point(i);
+    }
+
+    auto const in_element = [&](int const element) { return isInsideBVHElement(element, point); };
+
+    return bvh_->findElement(coordinates.data(), in_element) >= 0;
+  }
+
   // Now check element by element
   for (auto&& element_nodes : connectivity_) {
     IDList const& node_list = element_nodes.second;
@@ -1406,13 +1640,16 @@ ConnectivityArray::isInsideMeshByElement(minitensor::Vector<double> const& point
       nodes.push_back((*nodes_iter).second);
     }
 
+    bool is_inside = false;
+
     switch (type_) {
       case minitensor::ELEMENT::TETRAHEDRAL:
-        return in_tetrahedron(point, nodes[0], nodes[1], nodes[2], nodes[3]);
+        is_inside = in_tetrahedron(point, nodes[0], nodes[1], nodes[2], nodes[3]);
         break;
 
       case minitensor::ELEMENT::HEXAHEDRAL:
-        return in_hexahedron(point, nodes[0], nodes[1], nodes[2], nodes[3], nodes[4], nodes[5], nodes[6], nodes[7]);
+        is_inside =
+            in_hexahedron(point, nodes[0], nodes[1], nodes[2], nodes[3], nodes[4], nodes[5], nodes[6], nodes[7]);
         break;
 
       default:
@@ -1420,11 +1657,121 @@ ConnectivityArray::isInsideMeshByElement(minitensor::Vector<double> const& point
         exit(1);
         break;
     }
+
+    if (is_inside == true) return true;
   }
 
   return false;
 }
 
+// Bounding volume hierarchy of the elements for exact point
+// location. Built once, then used by isInsideMeshByElement
+// and locatePoints.
+void
+ConnectivityArray::createBVH()
+{
+  if (bvh_ != nullptr) return;
+
+  minitensor::Index const number_elements = connectivity_.size();
+
+  bvh_element_ids_.clear();
+  bvh_element_ids_.reserve(number_elements);
+
+  bvh_element_nodes_.clear();
+  bvh_element_nodes_.reserve(number_elements);
+
+  std::vector<double> lower;
+  std::vector<double> upper;
+
+  lower.reserve(number_elements * dimension_);
+  upper.reserve(number_elements * dimension_);
+
+  for (auto&& element_conn : connectivity_) {
+    IDList const& node_list = element_conn.second;
+
+    std::vector<minitensor::Vector<double>> element_nodes;
+
+    for (IDList::size_type i = 0; i < node_list.size(); ++i) {
+      PointMap::const_iterator nodes_iter = nodes_.find(node_list[i]);
+
+      ALBANY_EXPECT(nodes_iter != nodes_.end());
+
+      element_nodes.push_back((*nodes_iter).second);
+    }
+
+    minitensor::Vector<double> min;
+
+    minitensor::Vector<double> max;
+
+    boost::tie(min, max) = minitensor::bounding_box<double>(element_nodes.begin(), element_nodes.end());
+
+    for (minitensor::Index i = 0; i < dimension_; ++i) {
+      lower.push_back(min(i));
+      upper.push_back(max(i));
+    }
+
+    bvh_element_ids_.push_back(element_conn.first);
+    bvh_element_nodes_.push_back(element_nodes);
+  }
+
+  // Enlarge the boxes so that points that pass the inclusion tests
+  // within their tolerance are not lost.
+  double const box_tolerance = 0.05;
+
+  bvh_ = std::make_shared<BoundingVolumeHierarchy>(dimension_, lower, upper, box_tolerance);
+}
+
+// Locate many points at once, in parallel.
+std::vector<int>
+ConnectivityArray::locatePoints(std::vector<minitensor::Vector<double>> const& points)
+{
+  createBVH();
+
+  std::vector<double> coordinates;
+
+  coordinates.reserve(points.size() * dimension_);
+
+  for (auto&& point : points) {
+    for (minitensor::Index i = 0; i < dimension_; ++i) {
+      coordinates.push_back(point(i));
+    }
+  }
+
+  auto const in_element = [&](int const element, std::size_t const point) {
+    return isInsideBVHElement(element, points[point]);
+  };
+
+  std::vector<int> elements;
+
+  bvh_->findElements(coordinates, in_element, elements);
+
+  for (auto&& element : elements) {
+    if (element >= 0) element = bvh_element_ids_[element];
+  }
+
+  return elements;
+}
+
+// Exact test of whether element number element of the
+// bounding volume hierarchy contains the point.
+bool
+ConnectivityArray::isInsideBVHElement(int const element, minitensor::Vector<double> const& point) const
+{
+  std::vector<minitensor::Vector<double>> const& nodes = bvh_element_nodes_[element];
+
+  switch (type_) {
+    case minitensor::ELEMENT::TETRAHEDRAL: return in_tetrahedron(point, nodes[0], nodes[1], nodes[2], nodes[3]);
+
+    case minitensor::ELEMENT::HEXAHEDRAL:
+      return in_hexahedron(point, nodes[0], nodes[1], nodes[2], nodes[3], nodes[4], nodes[5], nodes[6], nodes[7]);
+
+    default: break;
+  }
+
+  ALBANY_ABORT("Unknown element type in point location.");
+  return false;
+}
+
 // \param length_scale Length scale for partitioning for
 // variational non-local regularization
 // \return Number of partitions defined as total volume
@@ -1598,6 +1945,63 @@ ConnectivityArray::partition(const PARTITION::Scheme partition_scheme, double co
   return partitions_;
 }
 
+// Anonymous namespace for helper functions
+namespace {
+
+// Copy points into a single array, dimension entries per point.
+std::vector<double>
+flatten_points(std::vector<minitensor::Vector<double>> const& points)
+{
+  std::vector<double> coordinates;
+
+  if (points.empty() == true) return coordinates;
+
+  minitensor::Index const dimension = points[0].get_dimension();
+
+  coordinates.reserve(dimension * points.size());
+
+  for (auto&& point : points) {
+    for (minitensor::Index i = 0; i < dimension; ++i) {
+      coordinates.push_back(point(i));
+    }
+  }
+
+  return coordinates;
+}
+
+// Given a point and centers stored with dimension entries each:
+// Return the index of the center closest to the point.
+// Same as closest_point, without temporaries in the inner loop.
+minitensor::Index
+closest_center(double const* point, std::vector<double> const& centers, minitensor::Index const dimension)
+{
+  minitensor::Index const number_centers = centers.size() / dimension;
+
+  minitensor::Index closest_index{0};
+
+  double minimum_distance = std::numeric_limits<double>::max();
+
+  for (minitensor::Index c = 0; c < number_centers; ++c) {
+    double const* const center = &centers[dimension * c];
+
+    double s = 0.0;
+
+    for (minitensor::Index i = 0; i < dimension; ++i) {
+      double const d = center[i] - point[i];
+      s += d * d;
+    }
+
+    if (s < minimum_distance) {
+      closest_index    = c;
+      minimum_distance = s;
+    }
+  }
+
+  return closest_index;
+}
+
+}  // anonymous namespace
+
 // \param Collection of centers
 // \return Partition map that assigns each element to the
 // closest center to its centroid
@@ -1606,6 +2010,8 @@ ConnectivityArray::partitionByCenters(std::vector<minitensor::Vector<double>> co
 {
   minitensor::Index const number_partitions = centers.size();
 
+  minitensor::Index const dimension = getDimension();
+
   // Partition map.
   std::map<int, int> partitions;
 
@@ -1616,33 +2022,42 @@ ConnectivityArray::partitionByCenters(std::vector<minitensor::Vector<double>> co
     unassigned_partitions.insert(partition);
   }
 
-  // Determine number of nodes that define element topology
-  minitensor::Index const nodes_per_element = getNodesPerElement();
+  // Find the closest center to each element centroid in parallel.
+  std::vector<double> const element_centroids = getCentroidCoordinates();
 
-  std::ofstream centroids_ofs("centroids.csv");
+  std::vector<double> const center_coordinates = flatten_points(centers);
 
-  centroids_ofs << "X,Y,Z" << '\n';
+  std::vector<minitensor::Index> closest_centers(connectivity_.size());
 
-  for (auto&& element_conn : connectivity_) {
-    int const& element = element_conn.first;
+  using Policy = Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>;
 
-    IDList const& node_list = element_conn.second;
+  Kokkos::parallel_for(Policy(0, closest_centers.size()), [&](std::size_t const i) {
+    closest_centers[i] = closest_center(&element_centroids[dimension * i], center_coordinates, dimension);
+  });
 
-    std::vector<minitensor::Vector<double>> element_nodes;
+  // Only the root rank writes the centroids, those of its own elements
+  // when running on several ranks.
+  bool const write_files = isRootRank();
 
-    for (IDList::size_type i = 0; i < nodes_per_element; ++i) {
-      PointMap::const_iterator nodes_iter = nodes_.find(node_list[i]);
+  std::ofstream centroids_ofs;
 
-      ALBANY_EXPECT(nodes_iter != nodes_.end());
+  if (write_files == true) {
+    centroids_ofs.open("centroids.csv");
+    centroids_ofs << "X,Y,Z" << '\n';
+  }
 
-      element_nodes.push_back((*nodes_iter).second);
-    }
+  minitensor::Index index{0};
 
-    minitensor::Vector<double> const element_centroid = centroid(element_nodes);
+  for (auto&& element_conn : connectivity_) {
+    int const& element = element_conn.first;
 
-    centroids_ofs << element_centroid << '\n';
+    if (write_files == true) {
+      minitensor::Vector<double> const element_centroid(dimension, &element_centroids[dimension * index]);
 
-    minitensor::Index const partition = closest_point(element_centroid, centers);
+      centroids_ofs << element_centroid << '\n';
+    }
+
+    minitensor::Index const partition = closest_centers[index];
 
     partitions[element] = partition;
 
@@ -1651,6 +2066,8 @@ ConnectivityArray::partitionByCenters(std::vector<minitensor::Vector<double>> co
     if (it != unassigned_partitions.end()) {
       unassigned_partitions.erase(it);
     }
+
+    ++index;
   }
 
   if (unassigned_partitions.size() > 0) {
@@ -1662,10 +2079,12 @@ ConnectivityArray::partitionByCenters(std::vector<minitensor::Vector<double>> co
     }
   }
 
-  std::ofstream generators_ofs("centers.csv");
-  generators_ofs << "X,Y,Z" << '\n';
-  for (minitensor::Index i = 0; i < centers.size(); ++i) {
-    generators_ofs << centers[i] << '\n';
+  if (write_files == true) {
+    std::ofstream generators_ofs("centers.csv");
+    generators_ofs << "X,Y,Z" << '\n';
+    for (minitensor::Index i = 0; i < centers.size(); ++i) {
+      generators_ofs << centers[i] << '\n';
+    }
   }
 
   return partitions;
@@ -1883,34 +2302,42 @@ ConnectivityArray::partitionGeometric(double const length_scale)
 std::map<int, int>
 ConnectivityArray::partitionKMeans(double const length_scale)
 {
+  bool const print = isRootRank();
+
   // Create initial centers
-  std::cout << '\n';
-  std::cout << "Partition with initializer ..." << '\n';
+  if (print == true) {
+    std::cout << '\n';
+    std::cout << "Partition with initializer ..." << '\n';
+  }
 
   // Partition with initializer
   PARTITION::Scheme const initializer_scheme = getInitializerScheme();
 
   partition(initializer_scheme, length_scale);
 
-  // Compute partition centroids and use those as initial centers
-
-  std::vector<minitensor::Vector<double>> centers = getPartitionCentroids();
+  // Compute partition centroids and use those as initial centers.
+  // All ranks iterate on the centers of all ranks.
+  std::vector<minitensor::Vector<double>> centers = gatherCenters(getPartitionCentroids());
 
   minitensor::Index const number_partitions = centers.size();
 
+  minitensor::Index const dimension = getDimension();
+
   minitensor::Vector<double> lower_corner;
 
   minitensor::Vector<double> upper_corner;
 
-  boost::tie(lower_corner, upper_corner) = boundingBox();
+  boost::tie(lower_corner, upper_corner) = globalBoundingBox();
 
-  lower_corner_ = lower_corner;
-  upper_corner_ = upper_corner;
+  // The element centroids of this rank are the points to cluster.
+  std::vector<double> const points = getCentroidCoordinates();
 
-  createGrid();
+  minitensor::Index const number_points = points.size() / dimension;
 
   // K-means iteration
-  std::cout << "Main K-means Iteration." << '\n';
+  if (print == true) {
+    std::cout << "Main K-means Iteration." << '\n';
+  }
 
   minitensor::Index const max_iterations = getMaximumIterations();
 
@@ -1928,39 +2355,76 @@ ConnectivityArray::partitionKMeans(double const length_scale)
     steps[i] = diagonal_distance;
   }
 
-  minitensor::Index const number_points = domain_points_.size();
+  // Generator of each point, none before the first iteration.
+  std::vector<minitensor::Index> point_to_generator(number_points, number_partitions);
+
+  // Coordinate sum and point count of each cluster, followed by the
+  // number of reassigned points, so that a single reduction over
+  // ranks per iteration suffices.
+  minitensor::Index const stride = dimension + 1;
+
+  std::vector<double> sums(stride * number_partitions + 1);
+
+  using Policy = Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>;
+
+  Teuchos::Time total_timer("K-means", true);
+
+  Teuchos::Time iteration_timer("K-means Iteration");
 
   while (step_norm >= tolerance && number_iterations < max_iterations) {
+    iteration_timer.start(true);
+
+    std::vector<double> const center_coordinates = flatten_points(centers);
+
     // Assign points to closest generators
-    std::vector<minitensor::Index> point_to_generator(number_points);
+    minitensor::Index number_reassigned{0};
 
-    for (minitensor::Index i = 0; i < domain_points_.size(); ++i) {
-      point_to_generator[i] = closest_point(domain_points_[i], centers);
-    }
+    Kokkos::parallel_reduce(
+        Policy(0, number_points),
+        [&](std::size_t const p, minitensor::Index& reassigned) {
+          minitensor::Index const c = closest_center(&points[dimension * p], center_coordinates, dimension);
+
+          if (c != point_to_generator[p]) ++reassigned;
+
+          point_to_generator[p] = c;
+        },
+        number_reassigned);
 
-    // Determine cluster of points for each generator
-    std::vector<std::vector<minitensor::Vector<double>>> clusters;
+    // Add up the cluster of points of each generator on all ranks
+    std::fill(sums.begin(), sums.end(), 0.0);
 
-    clusters.resize(number_partitions);
+    for (minitensor::Index p = 0; p < number_points; ++p) {
+      double* const sum = &sums[stride * point_to_generator[p]];
 
-    for (minitensor::Index p = 0; p < point_to_generator.size(); ++p) {
-      minitensor::Index const c = point_to_generator[p];
+      for (minitensor::Index j = 0; j < dimension; ++j) {
+        sum[j] += points[dimension * p + j];
+      }
 
-      clusters[c].push_back(domain_points_[p]);
+      sum[dimension] += 1.0;
     }
 
+    sums.back() = number_reassigned;
+
+    reduceOverRanks(Teuchos::REDUCE_SUM, sums);
+
     // Compute centroids of each cluster and set generators to
     // these centroids.
-    for (minitensor::Index i = 0; i < clusters.size(); ++i) {
+    for (minitensor::Index i = 0; i < number_partitions; ++i) {
+      double const* const sum = &sums[stride * i];
+
+      double const count = sum[dimension];
+
       // If center is empty then generator does not move.
-      if (clusters[i].size() == 0) {
+      if (count == 0.0) {
         steps[i] = 0.0;
-        std::cout << "Iteration: " << number_iterations;
-        std::cout << ", center " << i << " has zero points." << '\n';
+        if (print == true) {
+          std::cout << "Iteration: " << number_iterations;
+          std::cout << ", center " << i << " has zero points." << '\n';
+        }
         continue;
       }
 
-      minitensor::Vector<double> const cluster_centroid = centroid(clusters[i]);
+      minitensor::Vector<double> const cluster_centroid = minitensor::Vector<double>(dimension, sum) / count;
 
       // Update the generator
       minitensor::Vector<double> const old_generator = centers[i];
@@ -1972,13 +2436,27 @@ ConnectivityArray::partitionKMeans(double const length_scale)
 
     step_norm = norm(minitensor::Vector<double>(number_partitions, &steps[0]));
 
-    std::cout << "Iteration: " << number_iterations;
-    std::cout << ". Step: " << step_norm << ". Tol: " << tolerance;
-    std::cout << '\n';
+    double const iteration_time = iteration_timer.stop();
+
+    if (print == true) {
+      std::cout << "Iteration: " << number_iterations;
+      std::cout << ". Step: " << step_norm << ". Tol: " << tolerance;
+      std::cout << ". Reassigned: " << static_cast<std::size_t>(sums.back());
+      std::cout << ". Time: " << iteration_time;
+      std::cout << '\n';
+    }
 
     ++number_iterations;
   }
 
+  total_timer.stop();
+
+  if (print == true) {
+    std::cout << (step_norm < tolerance ? "Converged" : "Not converged");
+    std::cout << " after " << number_iterations << " iterations. ";
+    std::cout << "Time: " << total_timer.totalElapsedTime() << '\n';
+  }
+
   // Partition map.
   std::map<int, int> partitions = partitionByCenters(centers);
 
@@ -1992,9 +2470,13 @@ ConnectivityArray::partitionKMeans(double const length_scale)
 std::map<int, int>
 ConnectivityArray::partitionKDTree(double const length_scale)
 {
+  bool const print = isRootRank();
+
   // Create initial centers
-  std::cout << '\n';
-  std::cout << "Partition with initializer ..." << '\n';
+  if (print == true) {
+    std::cout << '\n';
+    std::cout << "Partition with initializer ..." << '\n';
+  }
 
   // Partition with initializer
   // PARTITION::Scheme const
@@ -2003,37 +2485,61 @@ ConnectivityArray::partitionKDTree(double const length_scale)
 
   partition(initializer_scheme, length_scale);
 
-  // Compute partition centroids and use those as initial centers
-  std::vector<minitensor::Vector<double>> center_positions = getPartitionCentroids();
+  // Compute partition centroids and use those as initial centers.
+  // All ranks iterate on the centers of all ranks.
+  std::vector<minitensor::Vector<double>> center_positions = gatherCenters(getPartitionCentroids());
 
   minitensor::Index const number_partitions = center_positions.size();
 
+  minitensor::Index const dimension = getDimension();
+
   // Initialize centers
-  std::cout << "Main K-means Iteration." << '\n';
+  if (print == true) {
+    std::cout << "Main K-means Iteration." << '\n';
+  }
 
   std::vector<ClusterCenter> centers(number_partitions);
 
+  std::set<minitensor::Index> all_centers;
+
   for (minitensor::Index i = 0; i < number_partitions; ++i) {
     centers[i].position          = center_positions[i];
     centers[i].weighted_centroid = 0.0 * center_positions[i];
+    all_centers.insert(i);
   }
 
   minitensor::Vector<double> lower_corner;
 
   minitensor::Vector<double> upper_corner;
 
-  boost::tie(lower_corner, upper_corner) = boundingBox();
+  boost::tie(lower_corner, upper_corner) = globalBoundingBox();
 
-  lower_corner_ = lower_corner;
-  upper_corner_ = upper_corner;
+  // The element centroids of this rank are the points to cluster.
+  if (domain_points_.empty() == true) {
+    std::vector<double> const coordinates = getCentroidCoordinates();
 
-  createGrid();
+    minitensor::Index const number_points = coordinates.size() / dimension;
+
+    domain_points_.reserve(number_points);
+
+    for (minitensor::Index p = 0; p < number_points; ++p) {
+      domain_points_.emplace_back(dimension, &coordinates[dimension * p]);
+    }
+  }
 
   // Create KDTree
   KDTree<KDTreeNode> kdtree(domain_points_, number_partitions);
 
   FilterVisitor<std::shared_ptr<KDTreeNode>, ClusterCenter> filter_visitor(domain_points_, centers);
 
+  // The top of the tree is filtered serially, the subtrees below
+  // split_depth concurrently. Enough subtrees to balance the threads.
+  minitensor::Index const number_threads = Kokkos::DefaultHostExecutionSpace::concurrency();
+
+  minitensor::Index split_depth{0};
+
+  while ((1U << split_depth) < 4 * number_threads) ++split_depth;
+
   // K-means iteration
   minitensor::Index const max_iterations = getMaximumIterations();
 
@@ -2051,7 +2557,32 @@ ConnectivityArray::partitionKDTree(double const length_scale)
     steps[i] = diagonal_distance;
   }
 
+  // Weighted centroid and count of each center, reduced over ranks.
+  minitensor::Index const stride = dimension + 1;
+
+  std::vector<double> sums(stride * number_partitions);
+
+  auto const add_to_sums = [&](std::vector<ClusterCenter> const& partial_centers) {
+    for (minitensor::Index i = 0; i < number_partitions; ++i) {
+      ClusterCenter const& center = partial_centers[i];
+
+      for (minitensor::Index j = 0; j < dimension; ++j) {
+        sums[stride * i + j] += center.weighted_centroid(j);
+      }
+
+      sums[stride * i + dimension] += center.count;
+    }
+  };
+
+  using Policy = Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>;
+
+  Teuchos::Time total_timer("K-means", true);
+
+  Teuchos::Time iteration_timer("K-means Iteration");
+
   while (step_norm >= tolerance && number_iterations < max_iterations) {
+    iteration_timer.start(true);
+
     // Initialize centers
     for (minitensor::Index i = 0; i < number_partitions; ++i) {
       ClusterCenter& center = centers[i];
@@ -2060,21 +2591,52 @@ ConnectivityArray::partitionKDTree(double const length_scale)
       center.count = 0;
     }
 
-    traverseTree(kdtree, filter_visitor);
+    std::vector<ClusterCenter> const empty_centers = centers;
+
+    // Filtering narrows down the candidates of each node,
+    // every iteration starts over from all the centers.
+    kdtree.get_root()->candidate_centers = all_centers;
+
+    std::vector<std::shared_ptr<KDTreeNode>> subtrees;
+
+    collectSubtrees(kdtree.get_root(), filter_visitor, split_depth, subtrees);
+
+    // Each subtree accumulates into its own copy of the centers.
+    std::vector<std::vector<ClusterCenter>> subtree_centers(subtrees.size(), empty_centers);
+
+    Kokkos::parallel_for(Policy(0, subtrees.size()), [&](std::size_t const s) {
+      FilterVisitor<std::shared_ptr<KDTreeNode>, ClusterCenter> subtree_visitor(domain_points_, subtree_centers[s]);
+
+      visitTreeNode(subtrees[s], subtree_visitor);
+    });
+
+    std::fill(sums.begin(), sums.end(), 0.0);
+
+    add_to_sums(centers);
+
+    for (auto&& partial_centers : subtree_centers) {
+      add_to_sums(partial_centers);
+    }
+
+    reduceOverRanks(Teuchos::REDUCE_SUM, sums);
 
     // Update centers
-    for (minitensor::Index i = 0; i < centers.size(); ++i) {
+    for (minitensor::Index i = 0; i < number_partitions; ++i) {
       ClusterCenter& center = centers[i];
 
+      double const count = sums[stride * i + dimension];
+
       // If cluster is empty then center does not move.
-      if (center.count == 0) {
+      if (count == 0.0) {
         steps[i] = 0.0;
-        std::cout << "Iteration: " << number_iterations;
-        std::cout << ", center " << i << " has zero points." << '\n';
+        if (print == true) {
+          std::cout << "Iteration: " << number_iterations;
+          std::cout << ", center " << i << " has zero points." << '\n';
+        }
         continue;
       }
 
-      minitensor::Vector<double> const new_position = center.weighted_centroid / center.count;
+      minitensor::Vector<double> const new_position = minitensor::Vector<double>(dimension, &sums[stride * i]) / count;
 
       steps[i] = norm(new_position - center.position);
 
@@ -2083,13 +2645,26 @@ ConnectivityArray::partitionKDTree(double const length_scale)
 
     step_norm = norm(minitensor::Vector<double>(number_partitions, &steps[0]));
 
-    std::cout << "Iteration: " << number_iterations;
-    std::cout << ". Step: " << step_norm << ". Tol: " << tolerance;
-    std::cout << '\n';
+    double const iteration_time = iteration_timer.stop();
+
+    if (print == true) {
+      std::cout << "Iteration: " << number_iterations;
+      std::cout << ". Step: " << step_norm << ". Tol: " << tolerance;
+      std::cout << ". Time: " << iteration_time;
+      std::cout << '\n';
+    }
 
     ++number_iterations;
   }
 
+  total_timer.stop();
+
+  if (print == true) {
+    std::cout << (step_norm < tolerance ? "Converged" : "Not converged");
+    std::cout << " after " << number_iterations << " iterations. ";
+    std::cout << "Time: " << total_timer.totalElapsedTime() << '\n';
+  }
+
   for (minitensor::Index i = 0; i < number_partitions; i++) {
     center_positions[i] = centers[i].position;
   }
@@ -13,6 +13,7 @@
 #include <Albany_DiscretizationFactory.hpp>
 #include <Albany_STKDiscretization.hpp>
 #include <Albany_Utils.hpp>
+#include <Teuchos_CommHelpers.hpp>
 #include <iostream>
 #include <iterator>
 #include <map>
@@ -20,6 +21,8 @@
 #include <set>
 #include <vector>
 
+#include "BoundingVolumeHierarchy.hpp"
+
 namespace LCM {
 
 ///
@@ -235,6 +238,14 @@ class ConnectivityArray
   ///
   ConnectivityArray(std::string const& input_file, std::string const& output_file);
 
+  ///
+  /// Build array for a structured hexahedral mesh of the unit cube.
+  /// Mostly for scaling studies of the partitioning schemes.
+  /// \param elements_per_side Number of elements along each side
+  /// \param output_file Exodus II output file name
+  ///
+  ConnectivityArray(int const elements_per_side, std::string const& output_file);
+
   ///
   /// \return Number of nodes on the array
   ///
@@ -403,6 +414,24 @@ class ConnectivityArray
   bool
   isInsideMeshByElement(minitensor::Vector<double> const& point) const;
 
+  ///
+  /// Bounding volume hierarchy of the elements for exact point
+  /// location. Built once, then used by isInsideMeshByElement
+  /// and locatePoints.
+  ///
+  void
+  createBVH();
+
+  ///
+  /// Locate many points at once, in parallel. Creates the
+  /// bounding volume hierarchy if needed.
+  /// \param points Query points
+  /// \return ID of an element that contains each point,
+  /// -1 for points outside the mesh
+  ///
+  std::vector<int>
+  locatePoints(std::vector<minitensor::Vector<double>> const& points);
+
   ///
   /// \param length_scale Length scale for partitioning for
   /// variational non-local regularization
@@ -618,6 +647,30 @@ class ConnectivityArray
       int*          ierr);
 
  private:
+  // Build array from the parameters of the discretization.
+  explicit ConnectivityArray(Teuchos::RCP<Teuchos::ParameterList> const& params);
+
+  // Centroids of the elements, dimension entries per element,
+  // in the order of the connectivity array.
+  std::vector<double>
+  getCentroidCoordinates() const;
+
+  // Bounding box of the nodes of all ranks.
+  std::pair<minitensor::Vector<double>, minitensor::Vector<double>>
+  globalBoundingBox() const;
+
+  // Concatenate the centers of all ranks, in rank order.
+  std::vector<minitensor::Vector<double>>
+  gatherCenters(std::vector<minitensor::Vector<double>> const& local_centers) const;
+
+  // Reduce values over all ranks in place.
+  void
+  reduceOverRanks(Teuchos::EReductionType const reduction, std::vector<double>& values) const;
+
+  // Whether this rank prints the partitioner progress.
+  bool
+  isRootRank() const;
+
   // The type of elements in the mesh (assumed that all are of same type)
   minitensor::ELEMENT::Type type_;
 
@@ -633,6 +686,9 @@ class ConnectivityArray
   // Teuchos pointer to corresponding discretization
   Teuchos::RCP<Albany::AbstractDiscretization> discretization_ptr_;
 
+  // Communicator of the discretization, null if not distributed
+  Teuchos::RCP<Teuchos_Comm const> comm_;
+
   // Partitions if mesh is partitioned; otherwise empty
   std::map<int, int> partitions_;
 
@@ -640,11 +696,24 @@ class ConnectivityArray
   // of whether a point is inside the domain or not.
   std::vector<std::vector<std::vector<bool>>> grid_;
 
-  // Points in the domain according to the grid.
+  // Points clustered by the K-means partitioners, the element centroids.
   std::vector<minitensor::Vector<double>> domain_points_;
 
   bool has_grid_{false};
 
+  // Exact test of whether element number element of the
+  // bounding volume hierarchy contains the point.
+  bool
+  isInsideBVHElement(int const element, minitensor::Vector<double> const& point) const;
+
+  // Bounding volume hierarchy of the elements, and element IDs
+  // and nodes in the order in which the hierarchy numbers them.
+  std::shared_ptr<BoundingVolumeHierarchy> bvh_{nullptr};
+
+  std::vector<int> bvh_element_ids_;
+
+  std::vector<std::vector<minitensor::Vector<double>>> bvh_element_nodes_;
+
   // Size of background grid cell
   minitensor::Vector<double> cell_size_;
 
@@ -7,6 +7,7 @@
 
 #include <Sacado.hpp>
 #include <Teuchos_LAPACK.hpp>
+#include <array>
 
 #include "PHAL_AlbanyTraits.hpp"
 
@@ -29,11 +30,36 @@ class LocalNonlinearSolver_Base
   computeFadInfo(std::vector<ScalarT>& A, std::vector<ScalarT>& X, std::vector<ScalarT>& B);
 };
 
+///
+/// Dense LU factorization with partial pivoting for local systems of
+/// compile-time size N, stored column major as in LAPACK. Systems up to
+/// MAX_INLINE_SIZE are factored inline, larger ones fall back to LAPACK.
+/// All storage is supplied by the caller.
+///
+template <int N>
+struct LocalLU
+{
+  static constexpr int MAX_INLINE_SIZE = 8;
+
+  static void
+  factor(Teuchos::LAPACK<int, RealType>& lapack, RealType* A, int* IPIV);
+
+  static void
+  solve(Teuchos::LAPACK<int, RealType>& lapack, RealType const* A, int const* IPIV, RealType* B);
+};
+
 // -----------------------------------------------------------------------------
 // Specializations
 // -----------------------------------------------------------------------------
 
-template <typename EvalT, typename Traits>
+///
+/// N is the size of the local system. The default N = 0 sizes the system
+/// at run time from the arguments and solves it with LAPACK. A positive N
+/// fixes the size at compile time, in which case no temporaries are
+/// allocated on the heap. The fixed-size solvers also take std::array
+/// storage, so that the caller need not allocate either.
+///
+template <typename EvalT, typename Traits, int N = 0>
 class LocalNonlinearSolver;
 
 // -----------------------------------------------------------------------------
@@ -68,6 +94,62 @@ class LocalNonlinearSolver<PHAL::AlbanyTraits::Jacobian, Traits>
   computeFadInfo(std::vector<ScalarT>& A, std::vector<ScalarT>& X, std::vector<ScalarT>& B);
 };
 
+// -----------------------------------------------------------------------------
+// Residual, fixed size
+// -----------------------------------------------------------------------------
+template <typename Traits, int N>
+class LocalNonlinearSolver<PHAL::AlbanyTraits::Residual, Traits, N>
+    : public LocalNonlinearSolver_Base<PHAL::AlbanyTraits::Residual, Traits>
+{
+ public:
+  typedef typename PHAL::AlbanyTraits::Residual::ScalarT ScalarT;
+  using Matrix = std::array<ScalarT, N * N>;
+  using Vector = std::array<ScalarT, N>;
+  LocalNonlinearSolver();
+  void
+  solve(Matrix& A, Vector& X, Vector& B);
+  void
+  computeFadInfo(Matrix& A, Vector& X, Vector& B);
+  void
+  solve(std::vector<ScalarT>& A, std::vector<ScalarT>& X, std::vector<ScalarT>& B);
+  void
+  computeFadInfo(std::vector<ScalarT>& A, std::vector<ScalarT>& X, std::vector<ScalarT>& B);
+
+ private:
+  // Both storage forms end up here, with N * N and N contiguous values.
+  void
+  solveFixed(ScalarT* A, ScalarT* X, ScalarT* B);
+};
+
+// -----------------------------------------------------------------------------
+// Jacobian, fixed size
+// -----------------------------------------------------------------------------
+template <typename Traits, int N>
+class LocalNonlinearSolver<PHAL::AlbanyTraits::Jacobian, Traits, N>
+    : public LocalNonlinearSolver_Base<PHAL::AlbanyTraits::Jacobian, Traits>
+{
+ public:
+  typedef typename PHAL::AlbanyTraits::Jacobian::ScalarT ScalarT;
+  using Matrix = std::array<ScalarT, N * N>;
+  using Vector = std::array<ScalarT, N>;
+  LocalNonlinearSolver();
+  void
+  solve(Matrix& A, Vector& X, Vector& B);
+  void
+  computeFadInfo(Matrix& A, Vector& X, Vector& B);
+  void
+  solve(std::vector<ScalarT>& A, std::vector<ScalarT>& X, std::vector<ScalarT>& B);
+  void
+  computeFadInfo(std::vector<ScalarT>& A, std::vector<ScalarT>& X, std::vector<ScalarT>& B);
+
+ private:
+  // Both storage forms end up here, with N * N and N contiguous values.
+  void
+  solveFixed(ScalarT* A, ScalarT* X, ScalarT* B);
+  void
+  computeFadInfoFixed(ScalarT const* A, ScalarT* X, ScalarT const* B);
+};
+
 }  // namespace LCM
 
 #include "LocalNonlinearSolver_Def.hpp"
@@ -2,8 +2,76 @@
 // Sandia, LLC (NTESS). This Software is released under the BSD license detailed
 // in the file license.txt in the top-level Albany directory.
 
+#include <cmath>
+#include <utility>
+
+#include "Albany_Macros.hpp"
+
 namespace LCM {
 
+template <int N>
+void inline LocalLU<N>::factor(Teuchos::LAPACK<int, RealType>& lapack, RealType* A, int* IPIV)
+{
+  if (N > MAX_INLINE_SIZE) {
+    int info(0);
+    lapack.GETRF(N, N, A, N, IPIV, &info);
+    return;
+  }
+
+  for (int k(0); k < N; ++k) {
+    // pivot on the largest entry in column k
+    int p = k;
+    for (int i(k + 1); i < N; ++i) {
+      if (std::abs(A[i + N * k]) > std::abs(A[p + N * k])) p = i;
+    }
+    IPIV[k] = p;
+    if (p != k) {
+      for (int j(0); j < N; ++j) std::swap(A[k + N * j], A[p + N * j]);
+    }
+
+    // eliminate below the pivot
+    RealType const pivot = A[k + N * k];
+    for (int i(k + 1); i < N; ++i) {
+      A[i + N * k] /= pivot;
+    }
+    for (int j(k + 1); j < N; ++j) {
+      for (int i(k + 1); i < N; ++i) {
+        A[i + N * j] -= A[i + N * k] * A[k + N * j];
+      }
+    }
+  }
+}
+
+template <int N>
+void inline LocalLU<N>::solve(Teuchos::LAPACK<int, RealType>& lapack, RealType const* A, int const* IPIV, RealType* B)
+{
+  if (N > MAX_INLINE_SIZE) {
+    int info(0);
+    lapack.GETRS('N', N, 1, A, N, IPIV, B, N, &info);
+    return;
+  }
+
+  // apply the row interchanges
+  for (int k(0); k < N; ++k) {
+    if (IPIV[k] != k) std::swap(B[k], B[IPIV[k]]);
+  }
+
+  // forward substitution with unit lower triangle
+  for (int k(0); k < N; ++k) {
+    for (int i(k + 1); i < N; ++i) {
+      B[i] -= A[i + N * k] * B[k];
+    }
+  }
+
+  // back substitution with upper triangle
+  for (int k(N - 1); k >= 0; --k) {
+    B[k] /= A[k + N * k];
+    for (int i(0); i < k; ++i) {
+      B[i] -= A[i + N * k] * B[k];
+    }
+  }
+}
+
 template <typename EvalT, typename Traits>
 LocalNonlinearSolver_Base<EvalT, Traits>::LocalNonlinearSolver_Base() : lapack()
 {
@@ -138,4 +206,165 @@ LocalNonlinearSolver<PHAL::AlbanyTraits::Jacobian, Traits>::computeFadInfo(
   }
 }
 
+// -----------------------------------------------------------------------------
+// Residual, fixed size
+// -----------------------------------------------------------------------------
+template <typename Traits, int N>
+LocalNonlinearSolver<PHAL::AlbanyTraits::Residual, Traits, N>::LocalNonlinearSolver()
+    : LocalNonlinearSolver_Base<PHAL::AlbanyTraits::Residual, Traits>()
+{
+}
+
+template <typename Traits, int N>
+void inline LocalNonlinearSolver<PHAL::AlbanyTraits::Residual, Traits, N>::solve(Matrix& A, Vector& X, Vector& B)
+{
+  solveFixed(A.data(), X.data(), B.data());
+}
+
+template <typename Traits, int N>
+void
+LocalNonlinearSolver<PHAL::AlbanyTraits::Residual, Traits, N>::computeFadInfo(Matrix& A, Vector& X, Vector& B)
+{
+  // no-op
+}
+
+template <typename Traits, int N>
+void inline LocalNonlinearSolver<PHAL::AlbanyTraits::Residual, Traits, N>::solve(
+    std::vector<ScalarT>& A,
+    std::vector<ScalarT>& X,
+    std::vector<ScalarT>& B)
+{
+  ALBANY_EXPECT(B.size() == N && A.size() == N * N);
+  solveFixed(&A[0], &X[0], &B[0]);
+}
+
+template <typename Traits, int N>
+void
+LocalNonlinearSolver<PHAL::AlbanyTraits::Residual, Traits, N>::computeFadInfo(
+    std::vector<ScalarT>& A,
+    std::vector<ScalarT>& X,
+    std::vector<ScalarT>& B)
+{
+  // no-op
+}
+
+template <typename Traits, int N>
+void inline LocalNonlinearSolver<PHAL::AlbanyTraits::Residual, Traits, N>::solveFixed(
+    ScalarT* A,
+    ScalarT* X,
+    ScalarT* B)
+{
+  int IPIV[N];
+
+  // factor and solve in place, as GESV does
+  LocalLU<N>::factor(this->lapack, A, IPIV);
+  LocalLU<N>::solve(this->lapack, A, IPIV, B);
+
+  // increment the solution
+  for (int i(0); i < N; ++i) X[i] -= B[i];
+}
+
+// -----------------------------------------------------------------------------
+// Jacobian, fixed size
+// -----------------------------------------------------------------------------
+template <typename Traits, int N>
+LocalNonlinearSolver<PHAL::AlbanyTraits::Jacobian, Traits, N>::LocalNonlinearSolver()
+    : LocalNonlinearSolver_Base<PHAL::AlbanyTraits::Jacobian, Traits>()
+{
+}
+
+template <typename Traits, int N>
+void
+LocalNonlinearSolver<PHAL::AlbanyTraits::Jacobian, Traits, N>::solve(Matrix& A, Vector& X, Vector& B)
+{
+  solveFixed(A.data(), X.data(), B.data());
+}
+
+template <typename Traits, int N>
+void
+LocalNonlinearSolver<PHAL::AlbanyTraits::Jacobian, Traits, N>::computeFadInfo(Matrix& A, Vector& X, Vector& B)
+{
+  computeFadInfoFixed(A.data(), X.data(), B.data());
+}
+
+template <typename Traits, int N>
+void
+LocalNonlinearSolver<PHAL::AlbanyTraits::Jacobian, Traits, N>::solve(
+    std::vector<ScalarT>& A,
+    std::vector<ScalarT>& X,
+    std::vector<ScalarT>& B)
+{
+  ALBANY_EXPECT(B.size() == N && A.size() == N * N);
+  solveFixed(&A[0], &X[0], &B[0]);
+}
+
+template <typename Traits, int N>
+void
+LocalNonlinearSolver<PHAL::AlbanyTraits::Jacobian, Traits, N>::computeFadInfo(
+    std::vector<ScalarT>& A,
+    std::vector<ScalarT>& X,
+    std::vector<ScalarT>& B)
+{
+  ALBANY_EXPECT(B.size() == N && A.size() == N * N);
+  computeFadInfoFixed(&A[0], &X[0], &B[0]);
+}
+
+template <typename Traits, int N>
+void
+LocalNonlinearSolver<PHAL::AlbanyTraits::Jacobian, Traits, N>::solveFixed(ScalarT* A, ScalarT* X, ScalarT* B)
+{
+  int      IPIV[N];
+  RealType F[N];
+  RealType dFdX[N * N];
+
+  // fill F and dFdX
+  for (int i(0); i < N; ++i) {
+    F[i] = B[i].val();
+    for (int j(0); j < N; ++j) {
+      dFdX[i + N * j] = A[i + N * j].val();
+    }
+  }
+
+  LocalLU<N>::factor(this->lapack, dFdX, IPIV);
+  LocalLU<N>::solve(this->lapack, dFdX, IPIV, F);
+
+  // increment the solution
+  for (int i(0); i < N; ++i) X[i].val() -= F[i];
+}
+
+template <typename Traits, int N>
+void
+LocalNonlinearSolver<PHAL::AlbanyTraits::Jacobian, Traits, N>::computeFadInfoFixed(
+    ScalarT const* A,
+    ScalarT*       X,
+    ScalarT const* B)
+{
+  int const numGlobalVars = B[0].size();
+  ALBANY_PANIC(
+      numGlobalVars == 0,
+      "In LocalNonlinearSolver<Jacobian> the numGLobalVars is zero where it "
+      "should be positive\n");
+
+  int      IPIV[N];
+  RealType dBdX[N * N];
+  RealType dBdP[N];
+
+  // factor the jacobian once
+  for (int i(0); i < N; ++i) {
+    for (int j(0); j < N; ++j) {
+      dBdX[i + N * j] = A[i + N * j].val();
+    }
+  }
+  LocalLU<N>::factor(this->lapack, dBdX, IPIV);
+
+  for (int i(0); i < N; ++i) X[i].resize(numGlobalVars);
+
+  // solve for dXdP one parameter at a time
+  for (int j(0); j < numGlobalVars; ++j) {
+    for (int i(0); i < N; ++i) dBdP[i] = B[i].dx(j);
+    LocalLU<N>::solve(this->lapack, dBdX, IPIV, dBdP);
+    for (int i(0); i < N; ++i) X[i].fastAccessDx(j) = -dBdP[i];
+  }
+}
+
 }  // namespace LCM
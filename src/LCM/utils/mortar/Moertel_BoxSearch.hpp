@@ -0,0 +1,216 @@
+// Albany 3.0: Copyright 2016 National Technology & Engineering Solutions of
+// Sandia, LLC (NTESS). This Software is released under the BSD license detailed
+// in the file license.txt in the top-level Albany directory.
+
+#ifndef MOERTEL_BOXSEARCH_HPP
+#define MOERTEL_BOXSEARCH_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+/*!
+\brief Axis aligned bounding boxes used to find the halo of a distributed
+interface and the candidate segment pairs of the broad phase search.
+
+A box is stored as 6 consecutive doubles, the lower corner followed by the
+upper corner. An empty box has its lower corner above its upper corner and
+overlaps nothing.
+*/
+namespace MoertelT {
+
+//! Make box empty
+inline void
+EmptyBox(double* box)
+{
+  for (int k = 0; k < 3; ++k) {
+    box[k]     = std::numeric_limits<double>::max();
+    box[3 + k] = std::numeric_limits<double>::lowest();
+  }
+}
+
+//! Grow box to contain the cube of half size width around the point x
+template <class X>
+inline void
+AddToBox(double* box, X const& x, double width = 0.0)
+{
+  for (int k = 0; k < 3; ++k) {
+    box[k]     = std::min(box[k], static_cast<double>(x[k]) - width);
+    box[3 + k] = std::max(box[3 + k], static_cast<double>(x[k]) + width);
+  }
+}
+
+//! True if the closed boxes a and b intersect
+inline bool
+BoxesOverlap(double const* a, double const* b)
+{
+  for (int k = 0; k < 3; ++k)
+    if (a[3 + k] < b[k] || b[3 + k] < a[k]) return false;
+  return true;
+}
+
+//! True if the point x is inside the closed box a
+template <class X>
+inline bool
+PointInBox(double const* a, X const& x)
+{
+  for (int k = 0; k < 3; ++k)
+    if (x[k] < a[k] || a[3 + k] < x[k]) return false;
+  return true;
+}
+
+/*!
+\brief The procs whose box overlaps the one of proc myrank
+
+boxes holds the boxes of all nproc procs one after the other. Overlap is
+symmetric, so every proc in the list also lists myrank, which is what lets
+\ref MoertelT::InterfaceT::ExchangeHalo receive from exactly the procs it
+sends to.
+*/
+inline std::vector<int>
+HaloNeighbors(int myrank, int nproc, double const* boxes)
+{
+  std::vector<int> neighbors;
+  for (int proc = 0; proc < nproc; ++proc)
+    if (proc != myrank && BoxesOverlap(&boxes[6 * myrank], &boxes[6 * proc])) neighbors.push_back(proc);
+  return neighbors;
+}
+
+//! Length of the diagonal of a non empty box
+inline double
+BoxDiagonal(double const* box)
+{
+  double d = 0.0;
+  for (int k = 0; k < 3; ++k) d += (box[3 + k] - box[k]) * (box[3 + k] - box[k]);
+  return std::sqrt(d);
+}
+
+/*!
+\brief Grow the box of a segment to hold every segment the rough search can
+pair it with
+
+OverlapT::QuickOverlapTest accepts a pair of segments if two of their nodes
+are within radius times the sum of their diameters. A diameter is at most
+the diagonal of the box, so two boxes grown by radius times their diagonal
+overlap for every such pair. margin is added on top for motion.
+*/
+inline void
+EnlargeBox(double* box, double radius, double margin)
+{
+  double const enlarge = radius * BoxDiagonal(box) + margin;
+  for (int k = 0; k < 3; ++k) {
+    box[k] -= enlarge;
+    box[3 + k] += enlarge;
+  }
+}
+
+/*!
+\brief Uniform grid over a set of boxes to find the ones overlapping a
+query box without testing all of them
+
+The cells are about as large as the average box, the grid is coarsened if
+it would have many more cells than boxes. The boxes are referenced, not
+copied, and must outlive the grid.
+*/
+class BoxGrid
+{
+ public:
+  //! Grid over nbox boxes stored one after the other
+  BoxGrid(double const* boxes, int nbox) : boxes_(boxes), nbox_(nbox), stamp_(nbox, -1)
+  {
+    cell_ = 0.0;
+    for (int k = 0; k < 3; ++k) {
+      lo_[k] = std::numeric_limits<double>::max();
+      hi_[k] = std::numeric_limits<double>::lowest();
+    }
+
+    for (int b = 0; b < nbox_; ++b) {
+      double const* box  = &boxes_[6 * b];
+      double        size = 0.0;
+      for (int k = 0; k < 3; ++k) {
+        lo_[k] = std::min(lo_[k], box[k]);
+        hi_[k] = std::max(hi_[k], box[3 + k]);
+        size   = std::max(size, box[3 + k] - box[k]);
+      }
+      cell_ += size / nbox_;
+    }
+
+    if (!(cell_ > 0.0)) cell_ = 1.0;
+
+    // coarsen the grid if it has many more cells than boxes
+    while (true) {
+      long ncell = 1;
+      for (int k = 0; k < 3; ++k) {
+        n_[k] = nbox_ == 0 ? 1 : std::max(1, static_cast<int>(std::ceil((hi_[k] - lo_[k]) / cell_)));
+        ncell *= n_[k];
+      }
+      if (ncell <= 8L * nbox_ + 8L) break;
+      cell_ *= 2.0;
+    }
+
+    cells_.resize(n_[0] * n_[1] * n_[2]);
+
+    int first[3], last[3];
+    for (int b = 0; b < nbox_; ++b) {
+      CellRange(&boxes_[6 * b], first, last);
+      for (int i = first[0]; i <= last[0]; ++i)
+        for (int j = first[1]; j <= last[1]; ++j)
+          for (int k = first[2]; k <= last[2]; ++k) cells_[i + n_[0] * (j + n_[1] * k)].push_back(b);
+    }
+  }
+
+  //! Append to found the indices of the boxes that overlap box, each once
+  //! and in increasing order
+  void
+  Overlapping(double const* box, std::vector<int>& found)
+  {
+    if (nbox_ == 0) return;
+
+    ++query_;
+
+    std::size_t const start = found.size();
+    int               first[3], last[3];
+    CellRange(box, first, last);
+
+    for (int i = first[0]; i <= last[0]; ++i)
+      for (int j = first[1]; j <= last[1]; ++j)
+        for (int k = first[2]; k <= last[2]; ++k) {
+          std::vector<int> const& cellboxes = cells_[i + n_[0] * (j + n_[1] * k)];
+          for (std::size_t c = 0; c < cellboxes.size(); ++c) {
+            int const b = cellboxes[c];
+            if (stamp_[b] == query_) continue;
+            stamp_[b] = query_;
+            if (BoxesOverlap(box, &boxes_[6 * b])) found.push_back(b);
+          }
+        }
+
+    std::sort(found.begin() + start, found.end());
+  }
+
+ private:
+  // range of cells covered by a box, clamped to the grid
+  void
+  CellRange(double const* box, int* first, int* last) const
+  {
+    for (int k = 0; k < 3; ++k) {
+      double const top = n_[k] - 1;
+      first[k]         = static_cast<int>(std::min(top, std::max(0.0, std::floor((box[k] - lo_[k]) / cell_))));
+      last[k]          = static_cast<int>(std::min(top, std::max(0.0, std::floor((box[3 + k] - lo_[k]) / cell_))));
+    }
+  }
+
+  double const*                 boxes_;
+  int                           nbox_;
+  double                        lo_[3];
+  double                        hi_[3];
+  double                        cell_;
+  int                           n_[3];
+  std::vector<std::vector<int>> cells_;
+  std::vector<int>              stamp_;
+  int                           query_{0};
+};
+
+}  // namespace MoertelT
+
+#endif  // MOERTEL_BOXSEARCH_HPP
@@ -5,10 +5,12 @@
 #ifndef MOERTEL_INTERFACET_H
 #define MOERTEL_INTERFACET_H
 
+#include <array>
 #include <ctime>
 #include <iomanip>
 #include <iostream>
 #include <map>
+#include <vector>
 
 #include "Teuchos_Comm.hpp"
 #include "Teuchos_ParameterList.hpp"
@@ -18,6 +20,7 @@
 #include "Moertel_NodeT.hpp"
 #include "Moertel_ProjectorT.hpp"
 #include "Moertel_SegmentT.hpp"
+#include "Moertel_UtilsT.hpp"
 
 /*!
 \brief MoertelT: namespace of the Moertel package
@@ -254,6 +257,17 @@ class InterfaceT
     return isComplete_;
   }
 
+  /*!
+  \brief Returns true if each process only holds its own segments and nodes
+  plus a geometric halo, see \ref SetDistributed(bool flag, double halowidth)
+
+  */
+  bool
+  IsDistributed() const
+  {
+    return distributed_;
+  }
+
   /*!
   \brief Returns true if this interface has been successfully integrated and
   false otherwise
@@ -648,6 +662,35 @@ class InterfaceT
   bool
   Complete();
 
+  /*!
+  \brief Choose between redundant and distributed storage of the interface
+
+  By default \ref Complete() makes all segments and nodes of the interface
+  redundant on every process of \ref lComm(), so memory and setup time grow
+  with the global size of the interface.<br>
+  In distributed mode each process only holds the segments and nodes it owns
+  plus a halo: the segments and nodes within halowidth of the bounding box of
+  its own nodes, found by exchanging bounding boxes and then communicating
+  with the overlapping processes only. \ref GlobalNsegment() , \ref
+  GlobalNnode() , \ref GetNodeView() and \ref GetSegmentView() then refer to
+  the segments and nodes held by the calling process, and \ref NodePID(int nid)
+  const returns -1 without error for nodes outside of the halo.
+
+  The halo width has to cover the largest segment, the contact search
+  distance and the motion of the interface between calls to \ref Complete()
+  . With the rough search of OverlapT this is (1 + 2 * Rough_Search_Radius)
+  times the largest segment diameter plus that motion.
+
+  This method has to be called before \ref Complete()
+
+  \param flag : true for distributed, false for redundant storage
+  \param halowidth : width of the halo around the nodes of each process
+
+  \return True if successful, false otherwise
+  */
+  bool
+  SetDistributed(bool flag, double halowidth);
+
   /*!
   \brief Add a segment to the interface on either side 1 or 0
 
@@ -898,6 +941,11 @@ class InterfaceT
   //@}
 
  private:
+  // segments and nodes held in addition to the local ones, sorted by id in
+  // one contiguous array each
+  typedef MoertelT::IdArrayT<Teuchos::RCP<MoertelT::SEGMENT_TEMPLATE_CLASS(SegmentT)>> SegmentArray;
+  typedef MoertelT::IdArrayT<Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)>>    NodeArray;
+
   // don't want = operator
   InterfaceT
   operator=(InterfaceT const& old);
@@ -927,6 +975,28 @@ class InterfaceT
   bool
   RedundantNodes(int side);
 
+  // store my own segments and nodes plus those of other procs within the
+  // halo in rseg_ and rnode_, build the PID tables and the node->segment
+  // adjacency of them (distributed counterpart of RedundantSegments and
+  // RedundantNodes)
+  bool
+  HaloSegmentsAndNodes();
+
+  // exchange one buffer with each proc in neighbors_,
+  // recvbuf[i] is received from neighbors_[i]
+  bool
+  ExchangeHalo(std::vector<std::vector<double>>& sendbuf, std::vector<std::vector<double>>& recvbuf);
+
+  // round 0 sends bcast[0, blength) to all neighbors, round k > 0 copies
+  // what neighbors_[k - 1] sent into bcast and blength
+  bool
+  BroadcastHalo(int round, std::vector<double>& bcast, int& blength, std::vector<std::vector<double>>& recvbuf);
+
+  // send rows stored as (node id, size, size entries) in col and val to the
+  // neighbors owning the nodes and replace them by the rows received
+  bool
+  ExchangeRowsWithOwners(std::vector<int>& col, std::vector<double>& val, int& count);
+
   // (re)build the topology info between nodes and segments
   bool
   BuildNodeSegmentTopology();
@@ -975,6 +1045,10 @@ class InterfaceT
   bool
   Integrate_3D();
 
+  // find the master segments that might overlap each slave segment in 3D
+  bool
+  BroadPhaseSearch_3D();
+
   // integrate the overlap of 2 segments in 3D (master/slave contribution)
   bool Integrate_3D_Section(
       MoertelT::SEGMENT_TEMPLATE_CLASS(SegmentT) & sseg,
@@ -1004,20 +1078,26 @@ class InterfaceT
 
   std::map<int, Teuchos::RCP<MoertelT::SEGMENT_TEMPLATE_CLASS(SegmentT)>>
       seg_[2];  // local segments of interface (both sides)
-  std::map<int, Teuchos::RCP<MoertelT::SEGMENT_TEMPLATE_CLASS(SegmentT)>>
-                     rseg_[2];  // global segments of interface (both sides)
-  std::map<int, int> segPID_;   // maps all global seg ids to process holding segment
+  SegmentArray                     rseg_[2];  // global (or owned and halo) segments of interface (both sides)
+  std::vector<std::pair<int, int>> segPID_;   // (seg id, process holding segment) of rseg_, sorted by id
 
   std::map<int, Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)>>
       node_[2];  // local nodes of interface (both sides)
-  std::map<int, Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)>>
-                     rnode_[2];  // global nodes of interface (both sides)
-  std::map<int, int> nodePID_;   // maps all global node ids to process holding the node
+  NodeArray                        rnode_[2];  // global (or owned and halo) nodes of interface (both sides)
+  std::vector<std::pair<int, int>> nodePID_;   // (node id, process holding node) of rnode_, sorted by id
 
   MoertelT::MOERTEL_TEMPLATE_CLASS(
       FunctionT)::FunctionType primal_;  // the type of functions to be set as trace space function
   MoertelT::MOERTEL_TEMPLATE_CLASS(
       FunctionT)::FunctionType dual_;  // the type of functions to be set as LM space function
+
+  bool             distributed_;  // hold owned segments and nodes plus a halo only
+  double           halowidth_;    // width of the halo around the nodes of a process
+  std::vector<int> neighbors_;    // procs in lComm() whose halo overlaps mine
+
+  std::map<int, std::vector<int>>      bpcandidates_;  // candidate master segment ids of each slave segment
+  std::map<int, std::array<double, 3>> bpcoords_[2];   // node coordinates the candidates were found with
+  double                               bpmargin_;      // node displacement the candidates remain valid for
 };
 
 // Now, the explicit template function declarations (templated on dimension)
@@ -2,6 +2,8 @@
 // Sandia, LLC (NTESS). This Software is released under the BSD license detailed
 // in the file license.txt in the top-level Albany directory.
 
+#include <algorithm>
+
 #include "Moertel_InterfaceT.hpp"
 #include "Moertel_UtilsT.hpp"
 
@@ -178,8 +180,9 @@ bool MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::Complete()
 #endif
   }
 
-  // create a map of all nodes to there PID (process id)
-  if (lcomm_ != Teuchos::null)
+  // create a table of all nodes to there PID (process id)
+  // (in distributed mode the halo exchange builds it for the nodes held)
+  if (lcomm_ != Teuchos::null && !distributed_)
     for (int proc = 0; proc < lcomm_->getSize(); ++proc) {
       int lnnodes = 0;
       if (proc == lcomm_->getRank()) lnnodes = node_[0].size() + node_[1].size();
@@ -192,12 +195,12 @@ bool MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::Complete()
           for (curr = node_[side].begin(); curr != node_[side].end(); ++curr) ids[counter++] = curr->first;
       }
       Teuchos::broadcast<LO, int>(*lcomm_, proc, lnnodes, &ids[0]);
-      for (int i = 0; i < lnnodes; ++i) nodePID_.insert(std::pair<int, int>(ids[i], proc));
+      for (int i = 0; i < lnnodes; ++i) nodePID_.push_back(std::pair<int, int>(ids[i], proc));
       ids.clear();
     }
 
-  // create a map of all segments to there PID (process id)
-  if (lcomm_ != Teuchos::null)
+  // create a table of all segments to there PID (process id)
+  if (lcomm_ != Teuchos::null && !distributed_)
     for (int proc = 0; proc < lcomm_->getSize(); ++proc) {
       int lnsegs = 0;
       if (proc == lcomm_->getRank()) lnsegs = seg_[0].size() + seg_[1].size();
@@ -210,18 +213,37 @@ bool MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::Complete()
           for (curr = seg_[side].begin(); curr != seg_[side].end(); ++curr) ids[counter++] = curr->first;
       }
       Teuchos::broadcast<LO, int>(*lcomm_, proc, lnsegs, &ids[0]);
-      for (int i = 0; i < lnsegs; ++i) segPID_.insert(std::pair<int, int>(ids[i], proc));
+      for (int i = 0; i < lnsegs; ++i) segPID_.push_back(std::pair<int, int>(ids[i], proc));
       ids.clear();
     }
 
+  // sort the tables by id, an id given on more than one proc belongs to the
+  // lowest of them
+  for (int i = 0; i < 2; ++i) {
+    std::vector<std::pair<int, int>>& pids = i ? segPID_ : nodePID_;
+    std::sort(pids.begin(), pids.end());
+    pids.erase(
+        std::unique(
+            pids.begin(),
+            pids.end(),
+            [](std::pair<int, int> const& a, std::pair<int, int> const& b) { return a.first == b.first; }),
+        pids.end());
+  }
+
   // set isComplete_ flag
   // we set it here already as we will be using some methods that require it
   // from now on
   isComplete_ = true;
 
+  // segments and nodes are final now, any earlier broad phase search is void
+  bpcandidates_.clear();
+  bpcoords_[0].clear();
+  bpcoords_[1].clear();
+
   // make the nodes know there adjacent segments
+  // (in distributed mode the halo exchange does this)
   // find max number of nodes to a segment
-  if (lcomm_ != Teuchos::null) {
+  if (lcomm_ != Teuchos::null && !distributed_) {
     int lmaxnnode = 0;
     int gmaxnnode = 0;
     for (int side = 0; side < 2; ++side) {
@@ -288,8 +310,19 @@ bool MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::Complete()
     }  // for (int proc=0; proc<lcomm_->NumProc(); ++proc)
   }    // if (lComm())
 
+  // build the halo in distributed mode
+  if (lcomm_ != Teuchos::null && distributed_) {
+    if (!HaloSegmentsAndNodes()) {
+      std::stringstream oss;
+      oss << "***ERR*** MoertelT::Interface::Complete:\n"
+          << "***ERR*** building of halo segments and nodes failed\n"
+          << "***ERR*** file/line: " << __FILE__ << "/" << __LINE__ << "\n";
+      throw MoertelT::ReportError(oss);
+    }
+  }
+
   // build redundant segments and nodes
-  if (lcomm_ != Teuchos::null) {
+  if (lcomm_ != Teuchos::null && !distributed_) {
     int ok = 0;
     ok += RedundantSegments(0);
     ok += RedundantSegments(1);
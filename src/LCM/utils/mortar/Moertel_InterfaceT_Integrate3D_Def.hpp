@@ -2,15 +2,21 @@
 // Sandia, LLC (NTESS). This Software is released under the BSD license detailed
 // in the file license.txt in the top-level Albany directory.
 
+#include <algorithm>
+#include <array>
+#include <cmath>
 #include <ctime>
+#include <limits>
 #include <vector>
 
+#include "Moertel_BoxSearch.hpp"
 #include "Moertel_IntegratorT.hpp"
 #include "Moertel_InterfaceT.hpp"
 #include "Moertel_OverlapT.hpp"
 #include "Moertel_PnodeT.hpp"
 #include "Moertel_ProjectorT.hpp"
 #include "Moertel_SegmentT.hpp"
+#include "Moertel_Tolerances.hpp"
 #include "Moertel_UtilsT.hpp"
 
 double const CONSTRAINT_MATRIX_ZERO = 1.0e-11;
@@ -125,8 +131,13 @@ bool MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::Integrate_3D()
   int mside = MortarSide();
   int sside = OtherSide(mside);
 
+  // find candidate pairs by their bounding boxes instead of trying all pairs
+  bool const broadphase = intparams_->get("broad phase search", true);
+
+  if (broadphase && !BroadPhaseSearch_3D()) return false;
+
   // loop over all segments of slave side
-  std::map<int, Teuchos::RCP<MoertelT::SEGMENT_TEMPLATE_CLASS(SegmentT)>>::iterator scurr;
+  typename SegmentArray::iterator scurr;
 
   for (scurr = rseg_[sside].begin(); scurr != rseg_[sside].end(); ++scurr) {
     // the segment to be integrated
@@ -154,8 +165,20 @@ bool MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::Integrate_3D()
     // Teuchos::Time time(*lComm());
     // time.ResetStartTime();
 
+    // loop over the candidate segments on the master side
+    if (broadphase) {
+      std::map<int, std::vector<int>>::const_iterator candidates = bpcandidates_.find(actsseg->Id());
+
+      if (candidates == bpcandidates_.end()) continue;
+
+      for (size_t i = 0; i < candidates->second.size(); ++i)
+        Integrate_3D_Section(*actsseg, *rseg_[mside].find(candidates->second[i])->second);
+
+      continue;
+    }
+
     // loop over all segments on the master side
-    std::map<int, Teuchos::RCP<MoertelT::SEGMENT_TEMPLATE_CLASS(SegmentT)>>::iterator mcurr;
+    typename SegmentArray::iterator mcurr;
 
     for (mcurr = rseg_[mside].begin(); mcurr != rseg_[mside].end(); ++mcurr) {
       Teuchos::RCP<MoertelT::SEGMENT_TEMPLATE_CLASS(SegmentT)> actmseg = mcurr->second;
@@ -177,6 +200,151 @@ bool MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::Integrate_3D()
   return true;
 }
 
+/*----------------------------------------------------------------------*
+  |  find the master segments that might overlap each slave segment      |
+  |  (3D version), by their axis aligned bounding boxes enlarged by the  |
+  |  search radius times their diagonal and by a margin for motion.      |
+  |  The candidates are kept across calls as long as no node has moved   |
+  |  further than the margin allows for.                                 |
+ *----------------------------------------------------------------------*/
+MOERTEL_TEMPLATE_STATEMENT
+bool MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::BroadPhaseSearch_3D()
+{
+  // get the sides
+  int mside = MortarSide();
+  int sside = OtherSide(mside);
+
+  double const radius = intparams_->get("broad phase search radius", MOERTEL::Rough_Search_Radius);
+  double const margin = intparams_->get("broad phase reuse margin", MOERTEL::Broad_Phase_Reuse_Margin);
+
+  // A node coordinate that moves by d moves a box side by at most d and
+  // changes the box diagonal by at most 2 sqrt(3) d. If no node coordinate
+  // moved by more than bpmargin_ / (1 + 2 sqrt(3) radius), the enlarged box
+  // of every segment is still inside the one it had when the candidates
+  // were found, so the candidates are still complete.
+  bool   reuse   = !bpcoords_[0].empty() || !bpcoords_[1].empty();
+  double maxdisp = 0.0;
+
+  for (int side = 0; side < 2 && reuse; ++side) {
+    if (bpcoords_[side].size() != rnode_[side].size()) {
+      reuse = false;
+      break;
+    }
+
+    typename NodeArray::const_iterator ncurr;
+
+    for (ncurr = rnode_[side].begin(); ncurr != rnode_[side].end(); ++ncurr) {
+      std::map<int, std::array<double, 3>>::const_iterator old = bpcoords_[side].find(ncurr->first);
+
+      if (old == bpcoords_[side].end()) {
+        reuse = false;
+        break;
+      }
+
+      std::array<ST, DIM> const x = ncurr->second->XCoords();
+
+      for (int k = 0; k < 3; ++k) maxdisp = std::max(maxdisp, std::abs(x[k] - old->second[k]));
+    }
+  }
+
+  if (reuse && maxdisp * (1.0 + 2.0 * std::sqrt(3.0) * radius) <= bpmargin_) {
+    if (OutLevel() > 5) std::cout << "MoertelT::Interface " << Id() << ": reusing broad phase candidates\n";
+
+    return true;
+  }
+
+  // bounding boxes of the segments of both sides
+  std::vector<Teuchos::RCP<MoertelT::SEGMENT_TEMPLATE_CLASS(SegmentT)>> segs[2];
+  std::vector<double>                                                   boxes[2];
+  double                                                                minhalf = std::numeric_limits<double>::max();
+
+  for (int side = 0; side < 2; ++side) {
+    typename SegmentArray::const_iterator curr;
+
+    for (curr = rseg_[side].begin(); curr != rseg_[side].end(); ++curr) {
+      int const nnode                                 = curr->second->Nnode();
+      MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)** nodes = curr->second->Nodes();
+      double box[6];
+
+      MoertelT::EmptyBox(box);
+
+      for (int i = 0; i < nnode; ++i) MoertelT::AddToBox(box, nodes[i]->XCoords());
+
+      double half = 0.0;
+
+      for (int k = 0; k < 3; ++k) half = std::max(half, 0.5 * (box[3 + k] - box[k]));
+
+      minhalf = std::min(minhalf, half);
+
+      segs[side].push_back(curr->second);
+      boxes[side].insert(boxes[side].end(), box, box + 6);
+    }
+  }
+
+  // the margin is relative to the smallest segment on the interface
+  bpmargin_ = segs[0].empty() && segs[1].empty() ? 0.0 : margin * minhalf;
+
+  for (int side = 0; side < 2; ++side)
+    for (size_t b = 0; b < segs[side].size(); ++b) MoertelT::EnlargeBox(&boxes[side][6 * b], radius, bpmargin_);
+
+  // remember the node coordinates the candidates are found with
+  for (int side = 0; side < 2; ++side) {
+    bpcoords_[side].clear();
+
+    typename NodeArray::const_iterator ncurr;
+
+    for (ncurr = rnode_[side].begin(); ncurr != rnode_[side].end(); ++ncurr) {
+      std::array<ST, DIM> const x = ncurr->second->XCoords();
+      bpcoords_[side][ncurr->first] = {{x[0], x[1], x[2]}};
+    }
+  }
+
+  bpcandidates_.clear();
+
+  int const nmaster = segs[mside].size();
+  int const nslave  = segs[sside].size();
+
+  if (nmaster == 0 || nslave == 0) return true;
+
+  // query a grid over the master boxes with the box of each slave segment
+  // this proc integrates
+  MoertelT::BoxGrid grid(&boxes[mside][0], nmaster);
+  std::vector<int>  found;
+  size_t            npairs = 0;
+
+  for (int s = 0; s < nslave; ++s) {
+    int const nnode                                 = segs[sside][s]->Nnode();
+    MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)** nodes = segs[sside][s]->Nodes();
+    bool foundone                                   = false;
+
+    for (int i = 0; i < nnode; ++i)
+      if (NodePID(nodes[i]->Id()) == lcomm_->getRank()) {
+        foundone = true;
+        break;
+      }
+
+    if (!foundone) continue;
+
+    // in the order of the master segments in rseg_
+    found.clear();
+    grid.Overlapping(&boxes[sside][6 * s], found);
+
+    if (found.empty()) continue;
+
+    std::vector<int>& candidates = bpcandidates_[segs[sside][s]->Id()];
+
+    for (size_t c = 0; c < found.size(); ++c) candidates.push_back(segs[mside][found[c]]->Id());
+
+    npairs += found.size();
+  }
+
+  if (OutLevel() > 5)
+    std::cout << "MoertelT::Interface " << Id() << ": broad phase found " << npairs << " candidate pairs among "
+              << nslave << " slave and " << nmaster << " master segments\n";
+
+  return true;
+}
+
 /*----------------------------------------------------------------------*
   | integrate the master/slave side's contribution from the overlap      |
   | of 2 segments (3D version) IF there is an overlap                    |
@@ -267,7 +435,7 @@ bool MoertelT::MOERTEL_TEMPLATE_CLASS(
   int sside = OtherSide(mside);
 
   // loop over all slave nodes
-  std::map<int, Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)>>::iterator curr;
+  typename NodeArray::iterator curr;
 
   for (curr = rnode_[sside].begin(); curr != rnode_[sside].end(); ++curr) {
     // loop only my own nodes
@@ -533,13 +701,23 @@ bool MoertelT::MOERTEL_TEMPLATE_CLASS(
       // curr->second->Id() << " countM " << countM << std::endl;
     }  // for (curr=rnode_[sside].begin(); curr!=rnode_[sside].end(); ++curr)
 
+    // in distributed mode send the rows only to the owners of their nodes,
+    // which are all neighbors, and assemble what they sent me in one round
+    if (distributed_) {
+      ExchangeRowsWithOwners(colD_s, valD_s, countD);
+      ExchangeRowsWithOwners(colM_s, valM_s, countM);
+    }
+    int const nround = distributed_ ? 1 : lcomm_->getSize();
+
     // loop all processes in lComm and communicate and assemble
-    for (int proc = 0; proc < lcomm_->getSize(); ++proc) {
+    for (int proc = 0; proc < nround; ++proc) {
       // send sizes
       int countDr = countD;
       int countMr = countM;
-      Teuchos::broadcast<LO, int>(*lcomm_, proc, 1, &countDr);
-      Teuchos::broadcast<LO, int>(*lcomm_, proc, 1, &countMr);
+      if (!distributed_) {
+        Teuchos::broadcast<LO, int>(*lcomm_, proc, 1, &countDr);
+        Teuchos::broadcast<LO, int>(*lcomm_, proc, 1, &countMr);
+      }
       // allocate receive buffers
       std::vector<int>    colD_r(countDr);
       std::vector<double> valD_r(countDr);
@@ -547,7 +725,7 @@ bool MoertelT::MOERTEL_TEMPLATE_CLASS(
       std::vector<double> valM_r(countMr);
 
       // send data
-      if (proc == lcomm_->getRank()) {
+      if (distributed_ || proc == lcomm_->getRank()) {
         for (int i = 0; i < countDr; ++i) {
           colD_r[i] = colD_s[i];
           valD_r[i] = valD_s[i];
@@ -558,18 +736,18 @@ bool MoertelT::MOERTEL_TEMPLATE_CLASS(
           valM_r[i] = valM_s[i];
         }
       }
-      if (countDr > 0) {
+      if (!distributed_ && countDr > 0) {
         Teuchos::broadcast<LO, int>(*lcomm_, proc, countDr, &colD_r[0]);
         Teuchos::broadcast<LO, double>(*lcomm_, proc, countDr, &valD_r[0]);
       }
 
-      if (countMr > 0) {
+      if (!distributed_ && countMr > 0) {
         Teuchos::broadcast<LO, int>(*lcomm_, proc, countMr, &colM_r[0]);
         Teuchos::broadcast<LO, double>(*lcomm_, proc, countMr, &valM_r[0]);
       }
 
       // Assemble (remote procs only)
-      if (proc != lcomm_->getRank()) {
+      if (distributed_ || proc != lcomm_->getRank()) {
         // --------------------------------------------------- Assemble D
         for (int i = 0; i < countDr;) {
           int nodeid = colD_r[i];
@@ -791,7 +969,7 @@ bool MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::AssembleResidualVector()
   int sside = OtherSide(mside);
 
   // loop over all slave nodes
-  std::map<int, Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)>>::iterator curr;
+  typename NodeArray::iterator curr;
 
 #if defined(PDANDM)  // Save and print the D and M for debugging
   int              size = rnode_[sside].size();
@@ -1084,13 +1262,23 @@ bool MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::AssembleResidualVector()
       // curr->second->Id() << " countM " << countM << std::endl;
     }  // for (curr=rnode_[sside].begin(); curr!=rnode_[sside].end(); ++curr)
 
+    // in distributed mode send the rows only to the owners of their nodes,
+    // which are all neighbors, and assemble what they sent me in one round
+    if (distributed_) {
+      ExchangeRowsWithOwners(colD_s, valD_s, countD);
+      ExchangeRowsWithOwners(colM_s, valM_s, countM);
+    }
+    int const nround = distributed_ ? 1 : lcomm_->getSize();
+
     // loop all processes in lComm and communicate and assemble
-    for (int proc = 0; proc < lcomm_->getSize(); ++proc) {
+    for (int proc = 0; proc < nround; ++proc) {
       // send sizes
       int countDr = countD;
       int countMr = countM;
-      Teuchos::broadcast<LO, int>(*lcomm_, proc, 1, &countDr);
-      Teuchos::broadcast<LO, int>(*lcomm_, proc, 1, &countMr);
+      if (!distributed_) {
+        Teuchos::broadcast<LO, int>(*lcomm_, proc, 1, &countDr);
+        Teuchos::broadcast<LO, int>(*lcomm_, proc, 1, &countMr);
+      }
       // allocate receive buffers
       std::vector<int>    colD_r(countDr);
       std::vector<double> valD_r(countDr);
@@ -1098,7 +1286,7 @@ bool MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::AssembleResidualVector()
       std::vector<double> valM_r(countMr);
 
       // send data
-      if (proc == lcomm_->getRank()) {
+      if (distributed_ || proc == lcomm_->getRank()) {
         for (int i = 0; i < countDr; ++i) {
           colD_r[i] = colD_s[i];
           valD_r[i] = valD_s[i];
@@ -1110,13 +1298,15 @@ bool MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::AssembleResidualVector()
         }
       }
 
-      Teuchos::broadcast<LO, int>(*lcomm_, proc, countDr, &colD_r[0]);
-      Teuchos::broadcast<LO, double>(*lcomm_, proc, countDr, &valD_r[0]);
-      Teuchos::broadcast<LO, int>(*lcomm_, proc, countDr, &colM_r[0]);
-      Teuchos::broadcast<LO, double>(*lcomm_, proc, countDr, &valM_r[0]);
+      if (!distributed_) {
+        Teuchos::broadcast<LO, int>(*lcomm_, proc, countDr, &colD_r[0]);
+        Teuchos::broadcast<LO, double>(*lcomm_, proc, countDr, &valD_r[0]);
+        Teuchos::broadcast<LO, int>(*lcomm_, proc, countDr, &colM_r[0]);
+        Teuchos::broadcast<LO, double>(*lcomm_, proc, countDr, &valM_r[0]);
+      }
 
       // Assemble (remote procs only)
-      if (proc != lcomm_->getRank()) {
+      if (distributed_ || proc != lcomm_->getRank()) {
         // --------------------------------------------------- Assemble D
         for (int i = 0; i < countDr;) {
           int nodeid = colD_r[i];
@@ -245,7 +245,7 @@ bool MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::Integrate_2D()
   int sside = OtherSide(mside);
 
   // loop over all segments of slave side
-  std::map<int, Teuchos::RCP<MoertelT::SEGMENT_TEMPLATE_CLASS(SegmentT)>>::iterator scurr;
+  typename SegmentArray::iterator scurr;
   for (scurr = rseg_[sside].begin(); scurr != rseg_[sside].end(); ++scurr) {
     // the segment to be integrated
     Teuchos::RCP<MoertelT::SEGMENT_TEMPLATE_CLASS(SegmentT)> actsseg = scurr->second;
@@ -267,7 +267,7 @@ bool MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::Integrate_2D()
     if (!foundone) continue;
 
     // loop over all segments on the master side
-    std::map<int, Teuchos::RCP<MoertelT::SEGMENT_TEMPLATE_CLASS(SegmentT)>>::iterator mcurr;
+    typename SegmentArray::iterator mcurr;
     for (mcurr = rseg_[mside].begin(); mcurr != rseg_[mside].end(); ++mcurr) {
       Teuchos::RCP<MoertelT::SEGMENT_TEMPLATE_CLASS(SegmentT)> actmseg = mcurr->second;
 
@@ -26,7 +26,7 @@ bool MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::BuildNormals()
   if (lcomm_ == Teuchos::null) return true;
 
   // interface segments need to have at least one function on each side
-  std::map<int, Teuchos::RCP<MoertelT::SEGMENT_TEMPLATE_CLASS(SegmentT)>>::iterator curr;
+  typename SegmentArray::iterator curr;
   for (int side = 0; side < 2; ++side)
     for (curr = rseg_[side].begin(); curr != rseg_[side].end(); ++curr) {
       if (curr->second->Nfunctions() < 1) {
@@ -39,7 +39,7 @@ bool MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::BuildNormals()
     }
 
   // build nodal normals on both sides
-  std::map<int, Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)>>::iterator ncurr;
+  typename NodeArray::iterator ncurr;
 
   for (int side = 0; side < 2; ++side)
 
@@ -78,7 +78,7 @@ bool MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::Project()
   if (lcomm_ == Teuchos::null) return true;
 
   // interface segments need to have at least one function on each side
-  std::map<int, Teuchos::RCP<MoertelT::SEGMENT_TEMPLATE_CLASS(SegmentT)>>::iterator curr;
+  typename SegmentArray::iterator curr;
   for (int side = 0; side < 2; ++side)
     for (curr = rseg_[side].begin(); curr != rseg_[side].end(); ++curr)
       if (curr->second->Nfunctions() < 1) {
@@ -90,7 +90,7 @@ bool MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::Project()
       }
 
   // build nodal normals on both sides
-  std::map<int, Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)>>::iterator ncurr;
+  typename NodeArray::iterator ncurr;
   for (int side = 0; side < 2; ++side)
     for (ncurr = rnode_[side].begin(); ncurr != rnode_[side].end(); ++ncurr) {
 #if 0
@@ -170,7 +170,7 @@ bool MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::ProjectNodes_SlavetoMaster_No
   int sside = OtherSide(mside);
 
   // iterate over all nodes of the slave side and project those belonging to me
-  std::map<int, Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)>>::iterator scurr;
+  typename NodeArray::iterator scurr;
   for (scurr = rnode_[sside].begin(); scurr != rnode_[sside].end(); ++scurr) {
     Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)> snode = scurr->second;
     if (NodePID(snode->Id()) != lcomm_->getRank()) continue;
@@ -180,7 +180,7 @@ bool MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::ProjectNodes_SlavetoMaster_No
     Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)> closenode = Teuchos::null;
 
     // find a node on the master side, that is closest to me
-    std::map<int, Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)>>::iterator mcurr;
+    typename NodeArray::iterator mcurr;
     for (mcurr = rnode_[mside].begin(); mcurr != rnode_[mside].end(); ++mcurr) {
       Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)> mnode = mcurr->second;
       double const*                                         mx    = mnode->XCoords();
@@ -296,9 +296,14 @@ bool MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::ProjectNodes_SlavetoMaster_No
   lcomm_->barrier();
 
   // loop all slave nodes again and make the projections redundant
-  std::vector<double> bcast(4 * rnode_[sside].size());
-  for (int proc = 0; proc < lcomm_->getSize(); ++proc) {
-    int blength = 0;
+  std::vector<double> bcast(5 * rnode_[sside].size());
+  // in distributed mode only my neighbors hold my nodes, the first round
+  // sends my projections to them and the following ones read theirs
+  int const                        nround = distributed_ ? 1 + neighbors_.size() : lcomm_->getSize();
+  std::vector<std::vector<double>> recvbuf;
+  for (int round = 0; round < nround; ++round) {
+    int const proc    = distributed_ ? (round == 0 ? lcomm_->getRank() : neighbors_[round - 1]) : round;
+    int       blength = 0;
     if (proc == lcomm_->getRank()) {
       for (scurr = rnode_[sside].begin(); scurr != rnode_[sside].end(); ++scurr) {
         Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)> snode = scurr->second;
@@ -321,7 +326,7 @@ bool MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::ProjectNodes_SlavetoMaster_No
         bcast[blength] = pnode->Gap();
         ++blength;
       }
-      if (blength > (int)(4 * rnode_[sside].size())) {
+      if (blength > (int)(5 * rnode_[sside].size())) {
         std::stringstream oss;
         oss << "***ERR*** "
                "MoertelT::Interface::ProjectNodes_SlavetoMaster_NormalField:\n"
@@ -330,8 +335,13 @@ bool MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::ProjectNodes_SlavetoMaster_No
         throw MoertelT::ReportError(oss);
       }
     }
-    Teuchos::broadcast<LO, int>(*lcomm_, proc, 1, &blength);
-    Teuchos::broadcast<LO, double>(*lcomm_, proc, blength, &bcast[0]);
+    if (distributed_)
+      BroadcastHalo(round, bcast, blength, recvbuf);
+    else {
+      Teuchos::broadcast<LO, int>(*lcomm_, proc, 1, &blength);
+      if ((int)bcast.size() < blength) bcast.resize(blength);
+      Teuchos::broadcast<LO, double>(*lcomm_, proc, blength, &bcast[0]);
+    }
     if (proc != lcomm_->getRank()) {
       int i;
       for (i = 0; i < blength;) {
@@ -347,6 +357,8 @@ bool MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::ProjectNodes_SlavetoMaster_No
         Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)>    snode = GetNodeView(nid);
         Teuchos::RCP<MoertelT::SEGMENT_TEMPLATE_CLASS(SegmentT)> seg   = Teuchos::null;
         if (sid != -0.1) seg = GetSegmentView((int)sid);
+        // in distributed mode skip what is not in my halo
+        if (distributed_ && (snode == Teuchos::null || (sid != -0.1 && seg == Teuchos::null))) continue;
         if (snode == Teuchos::null) {
           std::stringstream oss;
           oss << "***ERR*** "
@@ -444,7 +456,7 @@ bool MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::ProjectNodes_MastertoSlave_No
   int sside = OtherSide(mside);
 
   // iterate over all nodes of the master side and project those belonging to me
-  std::map<int, Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)>>::iterator mcurr;
+  typename NodeArray::iterator mcurr;
   for (mcurr = rnode_[mside].begin(); mcurr != rnode_[mside].end(); ++mcurr) {
     Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)> mnode = mcurr->second;
     if (NodePID(mnode->Id()) != lcomm_->getRank()) continue;
@@ -454,7 +466,7 @@ bool MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::ProjectNodes_MastertoSlave_No
     Teuchos::RCP<MoertelT::(NodeT)> closenode = Teuchos::null;
 
     // find a node on the slave side that is closest to me
-    std::map<int, Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)>>::iterator scurr;
+    typename NodeArray::iterator scurr;
     for (scurr = rnode_[sside].begin(); scurr != rnode_[sside].end(); ++scurr) {
       Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)> snode = scurr->second;
       double const*                                         sx    = snode->XCoords();
@@ -581,8 +593,13 @@ bool MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::ProjectNodes_MastertoSlave_No
   // redundant
   int                 bsize = 7 * rnode_[mside].size();
   std::vector<double> bcast(bsize);
-  for (int proc = 0; proc < lcomm_->getSize(); ++proc) {
-    int blength = 0;
+  // in distributed mode only my neighbors hold my nodes, the first round
+  // sends my projections to them and the following ones read theirs
+  int const                        nround = distributed_ ? 1 + neighbors_.size() : lcomm_->getSize();
+  std::vector<std::vector<double>> recvbuf;
+  for (int round = 0; round < nround; ++round) {
+    int const proc    = distributed_ ? (round == 0 ? lcomm_->getRank() : neighbors_[round - 1]) : round;
+    int       blength = 0;
     if (proc == lcomm_->getRank()) {
       for (mcurr = rnode_[mside].begin(); mcurr != rnode_[mside].end(); ++mcurr) {
         Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)> mnode = mcurr->second;
@@ -620,8 +637,13 @@ bool MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::ProjectNodes_MastertoSlave_No
         throw MoertelT::ReportError(oss);
       }
     }
-    Teuchos::broadcast<LO, int>(*lcomm_, proc, 1, &blength);
-    Teuchos::broadcast<LO, double>(*lcomm_, proc, blength, &bcast[0]);
+    if (distributed_)
+      BroadcastHalo(round, bcast, blength, recvbuf);
+    else {
+      Teuchos::broadcast<LO, int>(*lcomm_, proc, 1, &blength);
+      if ((int)bcast.size() < blength) bcast.resize(blength);
+      Teuchos::broadcast<LO, double>(*lcomm_, proc, blength, &bcast[0]);
+    }
     if (proc != lcomm_->getRank()) {
       int i;
       for (i = 0; i < blength;) {
@@ -641,6 +663,8 @@ bool MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::ProjectNodes_MastertoSlave_No
         Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)>    mnode = GetNodeView(nid);
         Teuchos::RCP<MoertelT::SEGMENT_TEMPLATE_CLASS(SegmentT)> seg   = Teuchos::null;
         if (sid != -0.1) seg = GetSegmentView((int)sid);
+        // in distributed mode skip what is not in my halo
+        if (distributed_ && (mnode == Teuchos::null || (sid != -0.1 && seg == Teuchos::null))) continue;
         if (mnode == Teuchos::null) {
           std::stringstream oss;
           oss << "***ERR*** "
@@ -716,7 +740,7 @@ bool MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::ProjectNodes_MastertoSlave_Or
   int sside = OtherSide(mside);
 
   // iterate over all master nodes and project those belonging to me
-  std::map<int, Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)>>::iterator mcurr;
+  typename NodeArray::iterator mcurr;
   for (mcurr = rnode_[mside].begin(); mcurr != rnode_[mside].end(); ++mcurr) {
     Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)> mnode = mcurr->second;
     if (NodePID(mnode->Id()) != lcomm_->getRank()) continue;
@@ -726,7 +750,7 @@ bool MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::ProjectNodes_MastertoSlave_Or
     Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)> closenode = Teuchos::null;
 
     // find a node on the slave side that is closest to me
-    std::map<int, Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)>>::iterator scurr;
+    typename NodeArray::iterator scurr;
     for (scurr = rnode_[sside].begin(); scurr != rnode_[sside].end(); ++scurr) {
       Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)> snode = scurr->second;
       double const*                                         sx    = snode->XCoords();
@@ -816,8 +840,13 @@ bool MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::ProjectNodes_MastertoSlave_Or
   // loop all master nodes again and make projection redundant
   int                 bsize = 4 * rnode_[mside].size();
   std::vector<double> bcast(bsize);
-  for (int proc = 0; proc < lcomm_->getSize(); ++proc) {
-    int blength = 0;
+  // in distributed mode only my neighbors hold my nodes, the first round
+  // sends my projections to them and the following ones read theirs
+  int const                        nround = distributed_ ? 1 + neighbors_.size() : lcomm_->getSize();
+  std::vector<std::vector<double>> recvbuf;
+  for (int round = 0; round < nround; ++round) {
+    int const proc    = distributed_ ? (round == 0 ? lcomm_->getRank() : neighbors_[round - 1]) : round;
+    int       blength = 0;
     if (proc == lcomm_->getRank()) {
       for (mcurr = rnode_[mside].begin(); mcurr != rnode_[mside].end(); ++mcurr) {
         Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)> mnode = mcurr->second;
@@ -846,8 +875,13 @@ bool MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::ProjectNodes_MastertoSlave_Or
         throw MoertelT::ReportError(oss);
       }
     }  // if (proc==lComm()->MyPID())
-    Teuchos::broadcast<LO, int>(*lcomm_, proc, 1, &blength);
-    Teuchos::broadcast<LO, double>(*lcomm_, proc, blength, &bcast[0]);
+    if (distributed_)
+      BroadcastHalo(round, bcast, blength, recvbuf);
+    else {
+      Teuchos::broadcast<LO, int>(*lcomm_, proc, 1, &blength);
+      if ((int)bcast.size() < blength) bcast.resize(blength);
+      Teuchos::broadcast<LO, double>(*lcomm_, proc, blength, &bcast[0]);
+    }
     if (proc != lcomm_->getRank()) {
       int i;
       for (i = 0; i < blength;) {
@@ -862,6 +896,8 @@ bool MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::ProjectNodes_MastertoSlave_Or
         ++i;
         Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)>    mnode = GetNodeView(nid);
         Teuchos::RCP<MoertelT::SEGMENT_TEMPLATE_CLASS(SegmentT)> seg   = GetSegmentView(sid);
+        // in distributed mode skip what is not in my halo
+        if (distributed_ && (mnode == Teuchos::null || seg == Teuchos::null)) continue;
         if (mnode == Teuchos::null || seg == Teuchos::null) {
           std::stringstream oss;
           oss << "***ERR*** "
@@ -910,7 +946,7 @@ bool MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::ProjectNodes_SlavetoMaster_Or
   int sside = OtherSide(mside);
 
   // iterate over all nodes of the slave side and project those belonging to me
-  std::map<int, Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)>>::iterator scurr;
+  typename NodeArray::iterator scurr;
   for (scurr = rnode_[sside].begin(); scurr != rnode_[sside].end(); ++scurr) {
     Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)> snode = scurr->second;
 
@@ -925,7 +961,7 @@ bool MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::ProjectNodes_SlavetoMaster_Or
     Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)> closenode = Teuchos::null;
 
     // find a node on the master side, that is closest to me
-    std::map<int, Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)>>::iterator mcurr;
+    typename NodeArray::iterator mcurr;
     for (mcurr = rnode_[mside].begin(); mcurr != rnode_[mside].end(); ++mcurr) {
       Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)> mnode = mcurr->second;
       double const*                                         mx    = mnode->XCoords();
@@ -1002,8 +1038,13 @@ bool MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::ProjectNodes_SlavetoMaster_Or
   // loop all slave nodes again and make projections redundant
   if (lcomm_->getSize() > 1) {
     std::vector<double> bcast(10 * rnode_[sside].size());
-    for (int proc = 0; proc < lcomm_->getSize(); ++proc) {
-      int blength = 0;
+    // in distributed mode only my neighbors hold my nodes, the first round
+    // sends my projections to them and the following ones read theirs
+    int const                        nround = distributed_ ? 1 + neighbors_.size() : lcomm_->getSize();
+    std::vector<std::vector<double>> recvbuf;
+    for (int round = 0; round < nround; ++round) {
+      int const proc    = distributed_ ? (round == 0 ? lcomm_->getRank() : neighbors_[round - 1]) : round;
+      int       blength = 0;
       if (proc == lcomm_->getRank()) {
         for (scurr = rnode_[sside].begin(); scurr != rnode_[sside].end(); ++scurr) {
           Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)> snode = scurr->second;
@@ -1041,9 +1082,13 @@ bool MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::ProjectNodes_SlavetoMaster_Or
         }
       }  // if (proc==lComm()->MyPID())
 
-      Teuchos::broadcast<LO, int>(*lcomm_, proc, 1, &blength);
-      if (proc != lcomm_->getRank()) bcast.resize(blength);
-      Teuchos::broadcast<LO, double>(*lcomm_, proc, blength, &bcast[0]);
+      if (distributed_)
+        BroadcastHalo(round, bcast, blength, recvbuf);
+      else {
+        Teuchos::broadcast<LO, int>(*lcomm_, proc, 1, &blength);
+        if (proc != lcomm_->getRank()) bcast.resize(blength);
+        Teuchos::broadcast<LO, double>(*lcomm_, proc, blength, &bcast[0]);
+      }
 
       if (proc != lcomm_->getRank()) {
         int i;
@@ -1053,6 +1098,11 @@ bool MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::ProjectNodes_SlavetoMaster_Or
           Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)> snode  = GetNodeView(nid);
           int                                                   npnode = (int)bcast[i];
           ++i;
+          // in distributed mode skip what is not in my halo
+          if (distributed_ && snode == Teuchos::null) {
+            i += 5 * npnode;
+            continue;
+          }
           for (int j = 0; j < npnode; ++j) {
             int sid = (int)bcast[i];
             ++i;
@@ -1064,6 +1114,7 @@ bool MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::ProjectNodes_SlavetoMaster_Or
             double gap = bcast[i];
             ++i;
             Teuchos::RCP<MoertelT::SEGMENT_TEMPLATE_CLASS(SegmentT)> seg = GetSegmentView(sid);
+            if (distributed_ && seg == Teuchos::null) continue;
             MoertelT::MOERTEL_TEMPLATE_CLASS(ProjectedNodeT)* pnode =
                 new MoertelT::MOERTEL_TEMPLATE_CLASS(ProjectedNodeT)(*snode, xi, seg.get(), orthseg);
             snode->SetProjectedNode(pnode);
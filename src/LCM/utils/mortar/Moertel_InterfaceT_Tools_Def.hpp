@@ -2,6 +2,12 @@
 // Sandia, LLC (NTESS). This Software is released under the BSD license detailed
 // in the file license.txt in the top-level Albany directory.
 
+#include <Teuchos_CommHelpers.hpp>
+#include <algorithm>
+#include <limits>
+#include <set>
+
+#include "Moertel_BoxSearch.hpp"
 #include "Moertel_InterfaceT.hpp"
 #include "Moertel_PnodeT.hpp"
 #include "Moertel_ProjectorT.hpp"
@@ -24,7 +30,10 @@ MoertelT::MOERTEL_TEMPLATE_CLASS(
       mortarside_(-1),
       ptype_(MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::proj_continousnormalfield),
       primal_(MoertelT::MOERTEL_TEMPLATE_CLASS(FunctionT)::func_none),
-      dual_(MoertelT::MOERTEL_TEMPLATE_CLASS(FunctionT)::func_none)
+      dual_(MoertelT::MOERTEL_TEMPLATE_CLASS(FunctionT)::func_none),
+      distributed_(false),
+      halowidth_(0.0),
+      bpmargin_(0.0)
 {
   return;
 }
@@ -43,7 +52,11 @@ MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::InterfaceT(const MoertelT::MOERTEL
       mortarside_(old.mortarside_),
       ptype_(old.ptype_),
       primal_(old.primal_),
-      dual_(old.dual_)
+      dual_(old.dual_),
+      distributed_(old.distributed_),
+      halowidth_(old.halowidth_),
+      neighbors_(old.neighbors_),
+      bpmargin_(0.0)
 {
   // copy the nodes and segments
   for (int i = 0; i < 2; ++i) {
@@ -53,9 +66,11 @@ MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::InterfaceT(const MoertelT::MOERTEL
       Teuchos::RCP<MoertelT::SEGMENT_TEMPLATE_CLASS(SegmentT)> tmpseg = Teuchos::rcp(seg_curr->second->Clone());
       seg_[i].insert(std::pair<int, Teuchos::RCP<MoertelT::SEGMENT_TEMPLATE_CLASS(SegmentT)>>(tmpseg->Id(), tmpseg));
     }
-    // the global segment map
-    for (seg_curr = old.rseg_[i].begin(); seg_curr != old.rseg_[i].end(); ++seg_curr) {
-      Teuchos::RCP<MoertelT::SEGMENT_TEMPLATE_CLASS(SegmentT)> tmpseg = Teuchos::rcp(seg_curr->second->Clone());
+    // the global segment array
+    typename SegmentArray::const_iterator rseg_curr;
+    rseg_[i].reserve(old.rseg_[i].size());
+    for (rseg_curr = old.rseg_[i].begin(); rseg_curr != old.rseg_[i].end(); ++rseg_curr) {
+      Teuchos::RCP<MoertelT::SEGMENT_TEMPLATE_CLASS(SegmentT)> tmpseg = Teuchos::rcp(rseg_curr->second->Clone());
       rseg_[i].insert(std::pair<int, Teuchos::RCP<MoertelT::SEGMENT_TEMPLATE_CLASS(SegmentT)>>(tmpseg->Id(), tmpseg));
     }
     // the local node map
@@ -65,10 +80,12 @@ MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::InterfaceT(const MoertelT::MOERTEL
           Teuchos::rcp(new MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)(*(node_curr->second)));
       node_[i].insert(std::pair<int, Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)>>(tmpnode->Id(), tmpnode));
     }
-    // the global node map
-    for (node_curr = old.rnode_[i].begin(); node_curr != old.rnode_[i].end(); ++node_curr) {
+    // the global node array
+    typename NodeArray::const_iterator rnode_curr;
+    rnode_[i].reserve(old.rnode_[i].size());
+    for (rnode_curr = old.rnode_[i].begin(); rnode_curr != old.rnode_[i].end(); ++rnode_curr) {
       Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)> tmpnode =
-          Teuchos::rcp(new MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)(*(node_curr->second)));
+          Teuchos::rcp(new MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)(*(rnode_curr->second)));
       rnode_[i].insert(std::pair<int, Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)>>(tmpnode->Id(), tmpnode));
     }
   }
@@ -114,7 +131,7 @@ bool MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::PrintSegments() const
 {
   if (lcomm_ == Teuchos::null) return true;
 
-  std::map<int, Teuchos::RCP<MoertelT::SEGMENT_TEMPLATE_CLASS(SegmentT)>>::const_iterator curr;
+  typename SegmentArray::const_iterator curr;
   for (int j = 0; j < 2; ++j) {
     for (int k = 0; k < lComm()->getSize(); ++k) {
       if (lcomm_->getRank() == k) {
@@ -147,7 +164,7 @@ bool MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::PrintNodes() const
 {
   if (lcomm_ == Teuchos::null) return true;
 
-  std::map<int, Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)>>::const_iterator curr;
+  typename NodeArray::const_iterator curr;
 
   for (int j = 0; j < 2; ++j) {
     for (int k = 0; k < lcomm_->getSize(); ++k) {
@@ -382,11 +399,35 @@ bool MoertelT::MOERTEL_TEMPLATE_CLASS(
   for (scurr = seg_[side].begin(); scurr != seg_[side].end(); ++scurr) scurr->second->SetFunction(id, func);
 
   // if redundant segments are already build, set function there as well
-  for (scurr = rseg_[side].begin(); scurr != rseg_[side].end(); ++scurr) scurr->second->SetFunction(id, func);
+  typename SegmentArray::iterator rcurr;
+  for (rcurr = rseg_[side].begin(); rcurr != rseg_[side].end(); ++rcurr) rcurr->second->SetFunction(id, func);
 
   return true;
 }
 
+/*----------------------------------------------------------------------*
+ |  choose redundant or distributed storage of segments and nodes       |
+ *----------------------------------------------------------------------*/
+MOERTEL_TEMPLATE_STATEMENT
+bool MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::SetDistributed(bool flag, double halowidth)
+{
+  if (IsComplete()) {
+    std::cout << "***ERR*** MoertelT::InterfaceT::SetDistributed:\n"
+              << "***ERR*** Interface " << Id_ << ": Complete() was called before\n"
+              << "***ERR*** file/line: " << __FILE__ << "/" << __LINE__ << "\n";
+    return false;
+  }
+  if (flag && !(halowidth >= 0.0)) {
+    std::cout << "***ERR*** MoertelT::InterfaceT::SetDistributed:\n"
+              << "***ERR*** halo width " << halowidth << " must not be negative\n"
+              << "***ERR*** file/line: " << __FILE__ << "/" << __LINE__ << "\n";
+    return false;
+  }
+  distributed_ = flag;
+  halowidth_   = flag ? halowidth : 0.0;
+  return true;
+}
+
 /*----------------------------------------------------------------------*
  |  set the Mortar (Master) side of the interface                       |
  |                                                                      |
@@ -539,9 +580,12 @@ int MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::NodePID(int nid) const
     return (-1);
   }
 
-  std::map<int, int>::const_iterator curr = nodePID_.find(nid);
-  if (curr != nodePID_.end())
+  std::vector<std::pair<int, int>>::const_iterator curr =
+      std::lower_bound(nodePID_.begin(), nodePID_.end(), std::pair<int, int>(nid, std::numeric_limits<int>::min()));
+  if (curr != nodePID_.end() && curr->first == nid)
     return (curr->second);
+  else if (distributed_)
+    return (-1);  // not in the halo of this proc
   else {
     std::cout << "***ERR*** MoertelT::Interface::NodePID:\n"
               << "***ERR*** Proc/Intra-Proc " << gcomm_->getRank() << "/" << lcomm_->getRank() << ": Cannot find node "
@@ -574,9 +618,12 @@ int MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::SegPID(int sid) const
     return (-1);
   }
 
-  std::map<int, int>::const_iterator curr = segPID_.find(sid);
-  if (curr != segPID_.end())
+  std::vector<std::pair<int, int>>::const_iterator curr =
+      std::lower_bound(segPID_.begin(), segPID_.end(), std::pair<int, int>(sid, std::numeric_limits<int>::min()));
+  if (curr != segPID_.end() && curr->first == sid)
     return (curr->second);
+  else if (distributed_)
+    return (-1);  // not in the halo of this proc
   else {
     std::cout << "***ERR*** MoertelT::InterfaceT::SegPID:\n"
               << "***ERR*** Proc/Intra-Proc " << gcomm_->getRank() << "/" << lcomm_->getRank()
@@ -634,7 +681,7 @@ Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)> MoertelT::MOERTEL_TEMPLATE
   }
   if (lcomm_ == Teuchos::null) return Teuchos::null;
 
-  std::map<int, Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)>>::iterator curr = rnode_[0].find(nid);
+  typename NodeArray::iterator curr = rnode_[0].find(nid);
   if (curr != rnode_[0].end()) return (curr->second);
   curr = rnode_[1].find(nid);
   if (curr != rnode_[1].end()) return (curr->second);
@@ -659,8 +706,8 @@ MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT) * *MoertelT::MOERTEL_TEMPLATE_CLASS(Inte
   if (lcomm_ == Teuchos::null) return NULL;
 
   MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)** view = new MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)*[GlobalNnode()];
-  int                                                                            count = 0;
-  std::map<int, Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)>>::iterator curr;
+  int                          count = 0;
+  typename NodeArray::iterator curr;
   for (int i = 0; i < 2; ++i)
     for (curr = rnode_[i].begin(); curr != rnode_[i].end(); ++curr) {
       view[count] = curr->second.get();
@@ -685,8 +732,8 @@ bool MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::GetNodeView(
   if (lcomm_ == Teuchos::null) return false;
 
   nodes.resize(GlobalNnode());
-  int                                                                            count = 0;
-  std::map<int, Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)>>::iterator curr;
+  int                          count = 0;
+  typename NodeArray::iterator curr;
   for (int i = 0; i < 2; ++i)
     for (curr = rnode_[i].begin(); curr != rnode_[i].end(); ++curr) {
       nodes[count] = curr->second.get();
@@ -711,7 +758,7 @@ Teuchos::RCP<MoertelT::SEGMENT_TEMPLATE_CLASS(SegmentT)> MoertelT::MOERTEL_TEMPL
   }
   if (lcomm_ == Teuchos::null) return Teuchos::null;
 
-  std::map<int, Teuchos::RCP<MoertelT::SEGMENT_TEMPLATE_CLASS(SegmentT)>>::iterator curr = rseg_[0].find(sid);
+  typename SegmentArray::iterator curr = rseg_[0].find(sid);
   if (curr != rseg_[0].end()) return (curr->second);
   curr = rseg_[1].find(sid);
   if (curr != rseg_[1].end()) return (curr->second);
@@ -735,8 +782,8 @@ MoertelT::SEGMENT_TEMPLATE_CLASS(SegmentT) * *MoertelT::MOERTEL_TEMPLATE_CLASS(I
   if (lcomm_ == Teuchos::null) return NULL;
 
   MoertelT::SEGMENT_TEMPLATE_CLASS(SegmentT)** segs = new MoertelT::SEGMENT_TEMPLATE_CLASS(SegmentT)*[GlobalNsegment()];
-  std::map<int, Teuchos::RCP<MoertelT::SEGMENT_TEMPLATE_CLASS(SegmentT)>>::iterator curr;
-  int                                                                               count = 0;
+  typename SegmentArray::iterator curr;
+  int                             count = 0;
   for (int i = 0; i < 2; ++i)
     for (curr = rseg_[i].begin(); curr != rseg_[i].end(); ++curr) {
       segs[count] = curr->second.get();
@@ -765,7 +812,7 @@ int MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::GetSide(MoertelT::SEGMENT_TEMP
               << "***WRN*** file/line: " << __FILE__ << "/" << __LINE__ << "\n";
     return -1;
   }
-  std::map<int, Teuchos::RCP<MoertelT::SEGMENT_TEMPLATE_CLASS(SegmentT)>>::iterator curr = rseg_[0].find(seg->Id());
+  typename SegmentArray::iterator curr = rseg_[0].find(seg->Id());
   if (curr != rseg_[0].end()) return (0);
   curr = rseg_[1].find(seg->Id());
   if (curr != rseg_[1].end()) return (1);
@@ -791,7 +838,7 @@ int MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::GetSide(MoertelT::MOERTEL_TEMP
               << "***WRN*** file/line: " << __FILE__ << "/" << __LINE__ << "\n";
     return -1;
   }
-  std::map<int, Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)>>::iterator curr = rnode_[0].find(node->Id());
+  typename NodeArray::iterator curr = rnode_[0].find(node->Id());
   if (curr != rnode_[0].end()) return (0);
   curr = rnode_[1].find(node->Id());
   if (curr != rnode_[1].end()) return (1);
@@ -817,7 +864,7 @@ int MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::GetSide(int nodeid)
               << "***WRN*** file/line: " << __FILE__ << "/" << __LINE__ << "\n";
     return -1;
   }
-  std::map<int, Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)>>::iterator curr = rnode_[0].find(nodeid);
+  typename NodeArray::iterator curr = rnode_[0].find(nodeid);
   if (curr != rnode_[0].end()) return (0);
   curr = rnode_[1].find(nodeid);
   if (curr != rnode_[1].end()) return (1);
@@ -851,7 +898,7 @@ bool MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::RedundantSegments(int side)
   // send everybody who doesn't belong here out of here
   if (lcomm_ == Teuchos::null) return true;
 
-  std::map<int, Teuchos::RCP<MoertelT::SEGMENT_TEMPLATE_CLASS(SegmentT)>>* rmap = &(rseg_[side]);
+  SegmentArray* rmap = &(rseg_[side]);
   // check whether redundant map has been build before
   if (rmap->size() != 0) return true;
 
@@ -910,7 +957,7 @@ bool MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::RedundantSegments(int side)
           tmp->UnPack(&(bcast[count]));
           Teuchos::RCP<MoertelT::SEGMENT_TEMPLATE_CLASS(SegmentT)> tmp2 = Teuchos::rcp(tmp);
           count += bcast[count];
-          rmap->insert(std::pair<int, Teuchos::RCP<MoertelT::SEGMENT_TEMPLATE_CLASS(SegmentT)>>(tmp2->Id(), tmp2));
+          rmap->push_back(std::pair<int, Teuchos::RCP<MoertelT::SEGMENT_TEMPLATE_CLASS(SegmentT)>>(tmp2->Id(), tmp2));
         }
       }
     }
@@ -918,6 +965,9 @@ bool MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::RedundantSegments(int side)
     bcast.clear();
 
   }  // for (int proc=0; proc<lcomm_->NumProc(); ++proc)
+
+  // the segments of the other procs were appended unsorted
+  rmap->Sort();
   return true;
 }
 
@@ -948,7 +998,7 @@ bool MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::RedundantNodes(int side)
   // send everybody who doesn't belong here out of here
   if (lcomm_ == Teuchos::null) return true;
 
-  std::map<int, Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)>>* rmap = &(rnode_[side]);
+  NodeArray* rmap = &(rnode_[side]);
   // check whether redundant map has been build before
   if (rmap->size() != 0) return true;
 
@@ -1005,13 +1055,368 @@ bool MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::RedundantNodes(int side)
               Teuchos::rcp(new MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)(OutLevel()));
           tmp->UnPack(&(bcast[count]));
           count += (int)bcast[count];
-          rmap->insert(std::pair<int, Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)>>(tmp->Id(), tmp));
+          rmap->push_back(std::pair<int, Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)>>(tmp->Id(), tmp));
         }
       }
     }
 
     bcast.clear();
   }  // for (int proc=0; proc<lcomm_->NumProc(); ++proc)
+
+  // the nodes of the other procs were appended unsorted
+  rmap->Sort();
+  return true;
+}
+
+/*----------------------------------------------------------------------*
+ | store my own segments and nodes and those of the other procs within  |
+ | the halo around my nodes                                             |
+ |                                                                      |
+ | NOTE: this is a collective call of all procs in the intra-comm       |
+ |       It replaces RedundantSegments and RedundantNodes in            |
+ |       distributed mode. Only procs whose bounding boxes overlap      |
+ |       communicate with each other.                                   |
+ *----------------------------------------------------------------------*/
+MOERTEL_TEMPLATE_STATEMENT
+bool MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::HaloSegmentsAndNodes()
+{
+  if (!IsComplete()) {
+    std::cout << "***ERR*** MoertelT::InterfaceT::HaloSegmentsAndNodes:\n"
+              << "***ERR*** Complete() not called on interface " << Id() << "\n"
+              << "***ERR*** file/line: " << __FILE__ << "/" << __LINE__ << "\n";
+    return false;
+  }
+
+  // send everybody who doesn't belong here out of here
+  if (lcomm_ == Teuchos::null) return true;
+
+  // check whether the halo has been build before
+  if (rseg_[0].size() != 0 || rseg_[1].size() != 0) return true;
+
+  int const myrank = lcomm_->getRank();
+  int const nproc  = lcomm_->getSize();
+
+  // bounding box of my nodes enlarged by the halo width,
+  // procs without nodes have an empty box
+  double box[6];
+  MoertelT::EmptyBox(box);
+
+  std::map<int, Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)>>::const_iterator ncurr;
+  for (int side = 0; side < 2; ++side)
+    for (ncurr = node_[side].begin(); ncurr != node_[side].end(); ++ncurr) {
+      MoertelT::AddToBox(box, ncurr->second->XCoords(), halowidth_);
+    }
+
+  std::vector<double> boxes(6 * nproc);
+  Teuchos::gatherAll<LO, double>(*lcomm_, 6, box, 6 * nproc, &boxes[0]);
+
+  // my neighbors are the procs whose box overlaps mine
+  neighbors_ = MoertelT::HaloNeighbors(myrank, nproc, &boxes[0]);
+
+  int const nneighbor = neighbors_.size();
+
+  // start with my own segments and nodes
+  nodePID_.clear();
+  segPID_.clear();
+  std::map<int, Teuchos::RCP<MoertelT::SEGMENT_TEMPLATE_CLASS(SegmentT)>>::const_iterator scurr;
+  for (int side = 0; side < 2; ++side) {
+    rseg_[side]  = seg_[side];
+    rnode_[side] = node_[side];
+    for (scurr = seg_[side].begin(); scurr != seg_[side].end(); ++scurr)
+      segPID_.push_back(std::pair<int, int>(scurr->first, myrank));
+    for (ncurr = node_[side].begin(); ncurr != node_[side].end(); ++ncurr)
+      nodePID_.push_back(std::pair<int, int>(ncurr->first, myrank));
+  }
+
+  // a record in the buffers is (kind, side, owning proc, packed object)
+  // with kind 0 for a node and 1 for a segment
+  auto const unpack = [&](std::vector<std::vector<double>>& recvbuf) {
+    for (int i = 0; i < nneighbor; ++i) {
+      std::vector<double>& buf = recvbuf[i];
+      int                  pos = 0;
+      while (pos < (int)buf.size()) {
+        int const kind  = (int)buf[pos];
+        int const side  = (int)buf[pos + 1];
+        int const owner = (int)buf[pos + 2];
+        int const size  = (int)buf[pos + 3];
+        if (kind == 0) {
+          Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)> tmp =
+              Teuchos::rcp(new MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)(OutLevel()));
+          tmp->UnPack(&buf[pos + 3]);
+          rnode_[side].push_back(std::pair<int, Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)>>(tmp->Id(), tmp));
+          nodePID_.push_back(std::pair<int, int>(tmp->Id(), owner));
+        } else {
+          std::vector<int> spack(size);
+          for (int j = 0; j < size; ++j) spack[j] = (int)buf[pos + 3 + j];
+          // the type of segment is stored second in the pack
+          MoertelT::SEGMENT_TEMPLATE_CLASS(SegmentT)* tmp = MoertelT::AllocateSegment(spack[1], OutLevel());
+          tmp->UnPack(&spack[0]);
+          Teuchos::RCP<MoertelT::SEGMENT_TEMPLATE_CLASS(SegmentT)> tmp2 = Teuchos::rcp(tmp);
+          rseg_[side].push_back(
+              std::pair<int, Teuchos::RCP<MoertelT::SEGMENT_TEMPLATE_CLASS(SegmentT)>>(tmp2->Id(), tmp2));
+          segPID_.push_back(std::pair<int, int>(tmp2->Id(), owner));
+        }
+        pos += 3 + size;
+      }
+    }
+    // a node or segment can come from several procs, the copy I had before
+    // stays in the arrays, all copies have the same owner
+    for (int side = 0; side < 2; ++side) {
+      rseg_[side].Sort();
+      rnode_[side].Sort();
+    }
+    for (int i = 0; i < 2; ++i) {
+      std::vector<std::pair<int, int>>& pids = i ? segPID_ : nodePID_;
+      std::sort(pids.begin(), pids.end());
+      pids.erase(
+          std::unique(
+              pids.begin(),
+              pids.end(),
+              [](std::pair<int, int> const& a, std::pair<int, int> const& b) { return a.first == b.first; }),
+          pids.end());
+    }
+  };
+
+  std::vector<std::vector<double>> sendbuf(nneighbor);
+  std::vector<std::vector<double>> recvbuf;
+
+  // send my nodes to the neighbors whose box they are in
+  for (int side = 0; side < 2; ++side)
+    for (ncurr = node_[side].begin(); ncurr != node_[side].end(); ++ncurr) {
+      std::array<ST, DIM> const x         = ncurr->second->XCoords();
+      int                       numdouble = 0;
+      double*                   npack     = NULL;
+      for (int i = 0; i < nneighbor; ++i) {
+        if (!MoertelT::PointInBox(&boxes[6 * neighbors_[i]], x)) continue;
+        if (!npack) npack = ncurr->second->Pack(&numdouble);
+        sendbuf[i].push_back(0.0);
+        sendbuf[i].push_back((double)side);
+        sendbuf[i].push_back((double)myrank);
+        sendbuf[i].insert(sendbuf[i].end(), npack, npack + numdouble);
+      }
+      delete[] npack;
+    }
+  ExchangeHalo(sendbuf, recvbuf);
+  unpack(recvbuf);
+
+  // send my segments to the neighbors whose box they overlap, together
+  // with their nodes, so that every segment I hold has all its nodes
+  bool                       ok = true;
+  std::vector<std::set<int>> sentnodes(nneighbor);
+  for (int i = 0; i < nneighbor; ++i) sendbuf[i].clear();
+  for (int side = 0; side < 2; ++side)
+    for (scurr = seg_[side].begin(); scurr != seg_[side].end(); ++scurr) {
+      int const                                                          nnode = scurr->second->Nnode();
+      const int*                                                         nids  = scurr->second->NodeIds();
+      std::vector<Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)>> snodes(nnode);
+      double                                                             sbox[6];
+      MoertelT::EmptyBox(sbox);
+      bool found = true;
+      for (int j = 0; j < nnode; ++j) {
+        typename NodeArray::const_iterator node = rnode_[side].find(nids[j]);
+        if (node == rnode_[side].end()) {
+          std::cout << "***ERR*** MoertelT::InterfaceT::HaloSegmentsAndNodes:\n"
+                    << "***ERR*** Interface " << Id() << ": node " << nids[j] << " of segment " << scurr->first
+                    << " is not within the halo of its proc\n"
+                    << "***ERR*** increase the halo width\n"
+                    << "***ERR*** file/line: " << __FILE__ << "/" << __LINE__ << "\n";
+          found = false;
+          break;
+        }
+        snodes[j] = node->second;
+        MoertelT::AddToBox(sbox, node->second->XCoords());
+      }
+      if (!found) {
+        ok = false;
+        continue;
+      }
+      int  numint = 0;
+      int* spack  = NULL;
+      for (int i = 0; i < nneighbor; ++i) {
+        if (!MoertelT::BoxesOverlap(sbox, &boxes[6 * neighbors_[i]])) continue;
+        if (!spack) spack = scurr->second->Pack(&numint);
+        sendbuf[i].push_back(1.0);
+        sendbuf[i].push_back((double)side);
+        sendbuf[i].push_back((double)myrank);
+        for (int j = 0; j < numint; ++j) sendbuf[i].push_back((double)spack[j]);
+        for (int j = 0; j < nnode; ++j) {
+          if (!sentnodes[i].insert(nids[j]).second) continue;
+          int     numdouble = 0;
+          double* npack     = snodes[j]->Pack(&numdouble);
+          sendbuf[i].push_back(0.0);
+          sendbuf[i].push_back((double)side);
+          sendbuf[i].push_back((double)NodePID(nids[j]));
+          sendbuf[i].insert(sendbuf[i].end(), npack, npack + numdouble);
+          delete[] npack;
+        }
+      }
+      delete[] spack;
+    }
+  ExchangeHalo(sendbuf, recvbuf);
+  unpack(recvbuf);
+
+  // make the nodes know their adjacent segments among the ones I hold
+  typename SegmentArray::const_iterator rcurr;
+  for (int side = 0; side < 2; ++side)
+    for (rcurr = rseg_[side].begin(); rcurr != rseg_[side].end(); ++rcurr) {
+      const int* nids = rcurr->second->NodeIds();
+      for (int j = 0; j < rcurr->second->Nnode(); ++j) {
+        typename NodeArray::const_iterator node = rnode_[side].find(nids[j]);
+        if (node != rnode_[side].end()) node->second->AddSegment(rcurr->first);
+      }
+    }
+
+  if (OutLevel() > 5)
+    std::cout << "MoertelT::Interface " << Id() << ": proc " << myrank << " holds " << rseg_[0].size() + rseg_[1].size()
+              << " segments and " << rnode_[0].size() + rnode_[1].size() << " nodes, " << nneighbor
+              << " neighbors\n";
+
+  int lok = ok;
+  int gok = 1;
+  Teuchos::reduceAll<LO, int>(*lcomm_, Teuchos::REDUCE_MIN, 1, &lok, &gok);
+  return gok;
+}
+
+/*----------------------------------------------------------------------*
+ | exchange one buffer with each neighbor in the halo                   |
+ |                                                                      |
+ | NOTE: the overlap of the boxes is symmetric, so every proc receives  |
+ |       from the procs it sends to                                     |
+ *----------------------------------------------------------------------*/
+MOERTEL_TEMPLATE_STATEMENT
+bool MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::ExchangeHalo(
+    std::vector<std::vector<double>>& sendbuf,
+    std::vector<std::vector<double>>& recvbuf)
+{
+  int const nneighbor = neighbors_.size();
+  int const tag       = Id_;
+
+  if ((int)sendbuf.size() != nneighbor) {
+    std::stringstream oss;
+    oss << "***ERR*** MoertelT::InterfaceT::ExchangeHalo:\n"
+        << "***ERR*** need one send buffer per neighbor\n"
+        << "***ERR*** file/line: " << __FILE__ << "/" << __LINE__ << "\n";
+    throw MoertelT::ReportError(oss);
+  }
+  recvbuf.resize(nneighbor);
+
+  // exchange the sizes first
+  std::vector<int>                                       ssize(nneighbor);
+  std::vector<int>                                       rsize(nneighbor);
+  Teuchos::Array<Teuchos::RCP<Teuchos::CommRequest<LO>>> requests;
+  for (int i = 0; i < nneighbor; ++i) {
+    ssize[i] = sendbuf[i].size();
+    requests.push_back(Teuchos::ireceive<LO, int>(Teuchos::arcp(&rsize[i], 0, 1, false), neighbors_[i], tag, *lcomm_));
+  }
+  for (int i = 0; i < nneighbor; ++i)
+    requests.push_back(
+        Teuchos::isend<LO, int>(Teuchos::arcp<const int>(&ssize[i], 0, 1, false), neighbors_[i], tag, *lcomm_));
+  Teuchos::waitAll<LO>(*lcomm_, requests());
+  requests.clear();
+
+  // then the buffers that are not empty
+  for (int i = 0; i < nneighbor; ++i) {
+    recvbuf[i].resize(rsize[i]);
+    if (rsize[i] == 0) continue;
+    requests.push_back(
+        Teuchos::ireceive<LO, double>(Teuchos::arcp(&recvbuf[i][0], 0, rsize[i], false), neighbors_[i], tag, *lcomm_));
+  }
+  for (int i = 0; i < nneighbor; ++i) {
+    if (ssize[i] == 0) continue;
+    requests.push_back(Teuchos::isend<LO, double>(
+        Teuchos::arcp<const double>(&sendbuf[i][0], 0, ssize[i], false), neighbors_[i], tag, *lcomm_));
+  }
+  Teuchos::waitAll<LO>(*lcomm_, requests());
+
+  return true;
+}
+
+/*----------------------------------------------------------------------*
+ | broadcast one buffer to the neighbors in the halo, one round at a    |
+ | time like Teuchos::broadcast over all procs                          |
+ *----------------------------------------------------------------------*/
+MOERTEL_TEMPLATE_STATEMENT
+bool MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::BroadcastHalo(
+    int                               round,
+    std::vector<double>&              bcast,
+    int&                              blength,
+    std::vector<std::vector<double>>& recvbuf)
+{
+  if (round == 0) {
+    std::vector<std::vector<double>> sendbuf(
+        neighbors_.size(), std::vector<double>(bcast.begin(), bcast.begin() + blength));
+    return ExchangeHalo(sendbuf, recvbuf);
+  }
+
+  std::vector<double> const& rbuf = recvbuf[round - 1];
+  blength                         = rbuf.size();
+  if ((int)bcast.size() < blength) bcast.resize(blength);
+  std::copy(rbuf.begin(), rbuf.end(), bcast.begin());
+
+  return true;
+}
+
+/*----------------------------------------------------------------------*
+ | send rows of D or M of nodes I do not own to their owners            |
+ |                                                                      |
+ | NOTE: in distributed mode the owner of every node I hold is one of   |
+ |       my neighbors, as the halo is wider than any segment            |
+ *----------------------------------------------------------------------*/
+MOERTEL_TEMPLATE_STATEMENT
+bool MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::ExchangeRowsWithOwners(
+    std::vector<int>&    col,
+    std::vector<double>& val,
+    int&                 count)
+{
+  int const nneighbor = neighbors_.size();
+
+  // a row is (node id, size, size pairs of column and value)
+  std::vector<std::vector<double>> sendbuf(nneighbor);
+  std::vector<std::vector<double>> recvbuf;
+  for (int i = 0; i < count;) {
+    int const nodeid = col[i];
+    int const size   = col[i + 1];
+    int const owner  = NodePID(nodeid);
+
+    std::vector<int>::const_iterator neighbor = std::lower_bound(neighbors_.begin(), neighbors_.end(), owner);
+    if (neighbor == neighbors_.end() || *neighbor != owner) {
+      std::stringstream oss;
+      oss << "***ERR*** MoertelT::InterfaceT::ExchangeRowsWithOwners:\n"
+          << "***ERR*** Interface " << Id() << ": owner " << owner << " of node " << nodeid
+          << " is not a neighbor, increase the halo width\n"
+          << "***ERR*** file/line: " << __FILE__ << "/" << __LINE__ << "\n";
+      throw MoertelT::ReportError(oss);
+    }
+    std::vector<double>& buf = sendbuf[neighbor - neighbors_.begin()];
+    buf.push_back((double)nodeid);
+    buf.push_back((double)size);
+    for (int j = 0; j < size; ++j) {
+      buf.push_back((double)col[i + 2 + j]);
+      buf.push_back(val[i + 2 + j]);
+    }
+    i += 2 + size;
+  }
+  ExchangeHalo(sendbuf, recvbuf);
+
+  col.clear();
+  val.clear();
+  for (int i = 0; i < nneighbor; ++i) {
+    std::vector<double> const& buf = recvbuf[i];
+    for (int pos = 0; pos < (int)buf.size();) {
+      int const size = (int)buf[pos + 1];
+      col.push_back((int)buf[pos]);
+      val.push_back(0.0);
+      col.push_back(size);
+      val.push_back(0.0);
+      for (int j = 0; j < size; ++j) {
+        col.push_back((int)buf[pos + 2 + 2 * j]);
+        val.push_back(buf[pos + 3 + 2 * j]);
+      }
+      pos += 2 + 2 * size;
+    }
+  }
+  count = col.size();
+
   return true;
 }
 
@@ -1034,13 +1439,13 @@ bool MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::BuildNodeSegmentTopology()
   if (lcomm_ == Teuchos::null) return true;
 
   // loop nodes and find their adjacent segments
-  std::map<int, Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)>>::iterator ncurr;
+  typename NodeArray::iterator ncurr;
   for (int side = 0; side < 2; ++side) {
     for (ncurr = rnode_[side].begin(); ncurr != rnode_[side].end(); ++ncurr) ncurr->second->GetPtrstoSegments(*this);
   }
 
   // loop segments and find their adjacent nodes
-  std::map<int, Teuchos::RCP<MoertelT::SEGMENT_TEMPLATE_CLASS(SegmentT)>>::iterator scurr;
+  typename SegmentArray::iterator scurr;
   for (int side = 0; side < 2; ++side) {
     for (scurr = rseg_[side].begin(); scurr != rseg_[side].end(); ++scurr) scurr->second->GetPtrstoNodes(*this);
   }
@@ -1064,7 +1469,7 @@ int MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::SetLMDofs(int minLMGID)
     return (0);
   }
 
-  if (lcomm_ != Teuchos::null) {
+  if (lcomm_ != Teuchos::null && !distributed_) {
     int mside = MortarSide();
     int sside = OtherSide(mside);
 
@@ -1074,8 +1479,8 @@ int MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::SetLMDofs(int minLMGID)
     for (int i = 0; i < (int)rnode_[sside].size(); ++i) lhavelm[i] = 0;
 
     // loop through redundant nodes and add my flags
-    int                                                                            count = 0;
-    std::map<int, Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)>>::iterator curr;
+    int                          count = 0;
+    typename NodeArray::iterator curr;
     for (curr = rnode_[sside].begin(); curr != rnode_[sside].end(); ++curr) {
       if (NodePID(curr->second->Id()) != lcomm_->getRank()) {
         ++count;
@@ -1123,6 +1528,58 @@ int MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::SetLMDofs(int minLMGID)
       ++count;
     }
     ghavelm.clear();
+  } else if (lcomm_ != Teuchos::null) {
+    int mside = MortarSide();
+    int sside = OtherSide(mside);
+
+    // my own slave nodes that have a D get their multipliers after the
+    // ones of the lower procs
+    int                          lnlm = 0;
+    typename NodeArray::iterator curr;
+    for (curr = rnode_[sside].begin(); curr != rnode_[sside].end(); ++curr) {
+      if (NodePID(curr->second->Id()) != lcomm_->getRank()) continue;
+      if (curr->second->GetD() == Teuchos::null) continue;
+      lnlm += curr->second->Ndof();
+    }
+    int scanlm = 0;
+    int gnlm   = 0;
+    Teuchos::scan<LO, int>(*lcomm_, Teuchos::REDUCE_SUM, 1, &lnlm, &scanlm);
+    Teuchos::reduceAll<LO, int>(*lcomm_, Teuchos::REDUCE_SUM, 1, &lnlm, &gnlm);
+
+    // set them and tell the neighbors holding these nodes in their halo
+    int                              lmgid = minLMGID + scanlm - lnlm;
+    std::vector<std::vector<double>> sendbuf(neighbors_.size());
+    for (curr = rnode_[sside].begin(); curr != rnode_[sside].end(); ++curr) {
+      if (NodePID(curr->second->Id()) != lcomm_->getRank()) continue;
+      if (curr->second->GetD() == Teuchos::null) continue;
+      int ndof = curr->second->Ndof();
+      for (int i = 0; i < ndof; ++i) {
+        curr->second->SetLagrangeMultiplierId(lmgid + i);
+        Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(ProjectedNodeT)> pnode = curr->second->GetProjectedNode();
+        if (pnode != Teuchos::null) pnode->SetLagrangeMultiplierId(lmgid + i);
+      }
+      for (int i = 0; i < (int)neighbors_.size(); ++i) {
+        sendbuf[i].push_back((double)curr->second->Id());
+        sendbuf[i].push_back((double)lmgid);
+      }
+      lmgid += ndof;
+    }
+
+    std::vector<std::vector<double>> recvbuf;
+    ExchangeHalo(sendbuf, recvbuf);
+    for (int i = 0; i < (int)recvbuf.size(); ++i)
+      for (int j = 0; j < (int)recvbuf[i].size(); j += 2) {
+        Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)> node = GetNodeView((int)recvbuf[i][j]);
+        if (node == Teuchos::null) continue;  // not in my halo
+        int first = (int)recvbuf[i][j + 1];
+        for (int k = 0; k < node->Ndof(); ++k) {
+          node->SetLagrangeMultiplierId(first + k);
+          Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(ProjectedNodeT)> pnode = node->GetProjectedNode();
+          if (pnode != Teuchos::null) pnode->SetLagrangeMultiplierId(first + k);
+        }
+      }
+
+    minLMGID += gnlm;
   }  // if (lComm())
 
   // broadcast minLMGID to all procs including those not in intra-comm
@@ -1292,7 +1749,7 @@ std::vector<GO>* MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::MyLMIds()
   lmids->resize(rnode_[sside].size() * 10);
   int count = 0;
 
-  std::map<int, Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)>>::iterator curr;
+  typename NodeArray::iterator curr;
   for (curr = rnode_[sside].begin(); curr != rnode_[sside].end(); ++curr) {
     Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)> node = curr->second;
     if (NodePID(node->Id()) != lcomm_->getRank()) continue;
@@ -1442,7 +1899,7 @@ bool MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::DetectEndSegmentsandReduceOrd
   // A node attached to only one element AND on the boundary is
   // considered a corner node and is member of ONE support set
   // It is in the modified support psi tilde of the closest internal node
-  std::map<int, Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)>>::iterator ncurr;
+  typename NodeArray::iterator ncurr;
   for (ncurr = rnode_[sside].begin(); ncurr != rnode_[sside].end(); ++ncurr) {
     if (!(ncurr->second->IsOnBoundary())) continue;
     MoertelT::SEGMENT_TEMPLATE_CLASS(SegmentT)** seg = ncurr->second->Segments();
@@ -1511,7 +1968,7 @@ bool MoertelT::MOERTEL_TEMPLATE_CLASS(InterfaceT)::DetectEndSegmentsandReduceOrd
   // See B.Wohlmuth:"Discretization Methods and Iterative Solvers
   //                 Based on Domain Decomposition", pp 33/34, Springer 2001.
 
-  std::map<int, Teuchos::RCP<MoertelT::MOERTEL_TEMPLATE_CLASS(NodeT)>>::iterator ncurr;
+  typename NodeArray::iterator ncurr;
 
   // do 1
   for (ncurr = rnode_[sside].begin(); ncurr != rnode_[sside].end(); ++ncurr) {
@@ -214,6 +214,14 @@ class ManagerT
 
     // 2D interface possible values are 3,6,12,13,16,19,27
     integrationparams_->set("number Gaussian points 2D",12);
+
+    // 2D interfaces only integrate the segment pairs whose bounding
+    // boxes, enlarged by the search radius times their diagonal,
+    // overlap. The pairs are found again only after some node moved
+    // by more than the reuse margin, relative to the smallest segment.
+    integrationparams_->set("broad phase search",true);
+    integrationparams_->set("broad phase search radius",2.5);
+    integrationparams_->set("broad phase reuse margin",0.5);
   \endcode
 
   \sa SetProblemMap , AddInterface, Mortar_integrate
@@ -3,6 +3,7 @@
 // in the file license.txt in the top-level Albany directory.
 
 #include "Moertel_ManagerT.hpp"
+#include "Moertel_Tolerances.hpp"
 #include "Teuchos_Time.hpp"
 
 /*----------------------------------------------------------------------*
@@ -83,6 +84,10 @@ Teuchos::ParameterList& MoertelT::MOERTEL_TEMPLATE_CLASS(ManagerT)::Default_Para
     integrationparams_->set("number gaussian points 1D", 3);
     // 2D interface possible values are 3,6,12,13,16,19,27
     integrationparams_->set("number gaussian points 2D", 6);
+    // bounding box search of the segment pairs to integrate on 2D interfaces
+    integrationparams_->set("broad phase search", true);
+    integrationparams_->set("broad phase search radius", MOERTEL::Rough_Search_Radius);
+    integrationparams_->set("broad phase reuse margin", MOERTEL::Broad_Phase_Reuse_Margin);
   }
   return (*integrationparams_.get());
 }
@@ -10,6 +10,7 @@ namespace MOERTEL {
 double const Nodes_Identical_Epsilon   = 1.0e-15;
 double const Projection_Length_Epsilon = 1.0e-10;
 double const Rough_Search_Radius       = 2.5;
+double const Broad_Phase_Reuse_Margin  = 0.5;
 
 }  // namespace MOERTEL
 
@@ -5,8 +5,12 @@
 #ifndef MOERTEL_UTILST_HPP
 #define MOERTEL_UTILST_HPP
 
+#include <algorithm>
 #include <ctime>
 #include <iostream>
+#include <map>
+#include <utility>
+#include <vector>
 
 #include "Tpetra_CrsMatrix.hpp"
 
@@ -224,6 +228,131 @@ Print_Vector(std::string name, const Tpetra::Vector<ST, LO, GO, N>& v, int ibase
 int
 ReportError(std::string conststream& Message);
 
+/*!
+\brief Objects sorted by id in one contiguous array
+
+Holds the segments and nodes an interface stores in addition to its own
+ones. It offers the part of the std::map<int,T> interface the InterfaceT
+uses, iteration in id order, find, insert, size and clear, but without one
+heap allocation per entry.<br>
+insert() keeps the array sorted and is cheap when ids come in increasing
+order. To fill the array from several unsorted sources, push_back() all
+entries and call Sort() before the next find() or insert().
+*/
+template <class T>
+class IdArrayT
+{
+ public:
+  typedef std::pair<int, T>                                value_type;
+  typedef typename std::vector<value_type>::iterator       iterator;
+  typedef typename std::vector<value_type>::const_iterator const_iterator;
+
+  iterator
+  begin()
+  {
+    return data_.begin();
+  }
+  iterator
+  end()
+  {
+    return data_.end();
+  }
+  const_iterator
+  begin() const
+  {
+    return data_.begin();
+  }
+  const_iterator
+  end() const
+  {
+    return data_.end();
+  }
+
+  std::size_t
+  size() const
+  {
+    return data_.size();
+  }
+
+  void
+  clear()
+  {
+    data_.clear();
+  }
+
+  void
+  reserve(std::size_t n)
+  {
+    data_.reserve(n);
+  }
+
+  //! Replace the contents by the ones of a map, which is sorted already
+  IdArrayT&
+  operator=(std::map<int, T> const& m)
+  {
+    data_.assign(m.begin(), m.end());
+    return *this;
+  }
+
+  //! Find entry id, end() if there is none
+  iterator
+  find(int id)
+  {
+    iterator curr = std::lower_bound(data_.begin(), data_.end(), id, Less());
+    return (curr != data_.end() && curr->first == id) ? curr : data_.end();
+  }
+  const_iterator
+  find(int id) const
+  {
+    const_iterator curr = std::lower_bound(data_.begin(), data_.end(), id, Less());
+    return (curr != data_.end() && curr->first == id) ? curr : data_.end();
+  }
+
+  //! Insert an entry unless its id is present already
+  std::pair<iterator, bool>
+  insert(value_type const& v)
+  {
+    if (data_.empty() || data_.back().first < v.first) {
+      data_.push_back(v);
+      return std::pair<iterator, bool>(data_.end() - 1, true);
+    }
+    iterator curr = std::lower_bound(data_.begin(), data_.end(), v.first, Less());
+    if (curr != data_.end() && curr->first == v.first) return std::pair<iterator, bool>(curr, false);
+    return std::pair<iterator, bool>(data_.insert(curr, v), true);
+  }
+
+  //! Append an entry without keeping the array sorted, see Sort()
+  void
+  push_back(value_type const& v)
+  {
+    data_.push_back(v);
+  }
+
+  //! Sort by id and keep the first pushed of entries with equal ids
+  void
+  Sort()
+  {
+    std::stable_sort(
+        data_.begin(), data_.end(), [](value_type const& a, value_type const& b) { return a.first < b.first; });
+    data_.erase(
+        std::unique(
+            data_.begin(), data_.end(), [](value_type const& a, value_type const& b) { return a.first == b.first; }),
+        data_.end());
+  }
+
+ private:
+  struct Less
+  {
+    bool
+    operator()(value_type const& a, int id) const
+    {
+      return a.first < id;
+    }
+  };
+
+  std::vector<value_type> data_;
+};
+
 }  // namespace MoertelT
 
 #ifndef HAVE_MOERTEL_EXPLICIT_INSTANTIATION
@@ -34,6 +34,19 @@ Setup::init_problem_params(const Teuchos::RCP<Teuchos::ParameterList> problemPar
   if (_enableMemoizationForParams) _enableMemoization = true;
 }
 
+void
+Setup::init_state_handles(std::map<std::string, int> const& stateHandles)
+{
+  _stateHandles = stateHandles;
+}
+
+int
+Setup::get_state_handle(std::string const& stateName) const
+{
+  auto const it = _stateHandles.find(stateName);
+  return it == _stateHandles.end() ? -1 : it->second;
+}
+
 void
 Setup::init_unsaved_param(std::string const& param)
 {
@@ -6,6 +6,7 @@
 #define PHAL_SETUP_HPP_
 
 #include <iostream>
+#include <map>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
@@ -36,6 +37,16 @@ class Setup
   void
   init_unsaved_param(std::string const& param);
 
+  //! Pass the state handles of the state manager into Setup, so evaluators
+  //! can resolve the handles of the states they read during
+  //! postRegistrationSetup
+  void
+  init_state_handles(std::map<std::string, int> const& stateHandles);
+
+  //! Handle of a registered state, or -1 if it is unknown
+  int
+  get_state_handle(std::string const& stateName) const;
+
   //! Check if memoization is activated
   bool
   memoizer_active() const;
@@ -105,6 +116,9 @@ class Setup
   //! Used to ensure postRegistrationSetup only occurs once
   const Teuchos::RCP<StringSet> _setupEvals;
 
+  //! State name to handle, empty until init_state_handles is called
+  std::map<std::string, int> _stateHandles;
+
   //! Data structures for general memoization
   bool                          _enableMemoization;
   const Teuchos::RCP<StringMap> _dep2EvalFields;
@@ -96,6 +96,7 @@ struct Workset
   std::vector<PHX::index_size_type> Tangent_deriv_dims;
 
   Albany::WorksetConn                           wsElNodeEqID;
+  Albany::WorksetColoring                       wsColoring;
   Teuchos::ArrayRCP<Teuchos::ArrayRCP<GO>>      wsElNodeID;
   Teuchos::ArrayRCP<Teuchos::ArrayRCP<double*>> wsCoords;
   Teuchos::ArrayRCP<double>                     wsSphereVolume;
@@ -121,6 +122,10 @@ struct Workset
   Albany::StateArray*              stateArrayPtr{nullptr};
   Teuchos::RCP<Tpetra_MultiVector> auxDataPtrT;
 
+  // Same arrays as stateArrayPtr, indexed by Albany::StateManager state
+  // handles instead of names.
+  Albany::StateHandleArray* stateHandleArrayPtr{nullptr};
+
   bool transientTerms{false};
   bool accelerationTerms{false};
 
@@ -4,7 +4,9 @@
 
 #include "AAdapt_Erosion.hpp"
 
+#include <Kokkos_Core.hpp>
 #include <Teuchos_TimeMonitor.hpp>
+#include <algorithm>
 #include <stk_util/parallel/ParallelReduce.hpp>
 
 #include "Albany_GenericSTKMeshStruct.hpp"
@@ -97,6 +99,7 @@ AAdapt::Erosion::copyStateArrays(Albany::StateArrays const& sa)
   auto&& src_nsa = sa.nodeStateArrays;
   auto&& dst_nsa = state_arrays_.nodeStateArrays;
   copyStateArray(src_nsa, dst_nsa, node_state_store_);
+  gidwslid_map_ = stk_discretization_->getElemGIDws();
 }
 
 void
@@ -107,120 +110,63 @@ AAdapt::Erosion::transferStateArrays()
   auto&&     new_esa      = new_sa.elemStateArrays;
   auto&&     old_esa      = state_arrays_.elemStateArrays;
   auto&&     gidwslid_old = gidwslid_map_;
-  auto&&     wslidgid_new = stk_discretization_->getElemWsLIDGIDMap();
+  auto&&     gidwslid_new = stk_discretization_->getElemGIDws();
   auto const num_ws       = new_esa.size();
 
-  auto mapWsLID = [&](int ws, int lid) {
-    auto wslid       = std::make_pair(ws, lid);
-    auto wslidgid_it = wslidgid_new.find(wslid);
-    assert(wslidgid_it != wslidgid_new.end());
-    auto gid         = wslidgid_it->second;
-    auto gidwslid_it = gidwslid_old.find(gid);
-    assert(gidwslid_it != gidwslid_old.end());
-    auto wslid_old = gidwslid_it->second;
-    auto ws_old    = wslid_old.ws;
-    auto lid_old   = wslid_old.LID;
-    return std::make_pair(ws_old, lid_old);
-  };
-
-  auto oldValue1 = [&](int ws, std::string const& state, int lid) {
-    auto old_wslid = mapWsLID(ws, lid);
-    auto old_ws    = old_wslid.first;
-    auto old_lid   = old_wslid.second;
-    return old_esa[old_ws][state](old_lid);
-  };
-
-  auto oldValue2 = [&](int ws, std::string const& state, int lid, int qp) {
-    auto old_wslid = mapWsLID(ws, lid);
-    auto old_ws    = old_wslid.first;
-    auto old_lid   = old_wslid.second;
-    return old_esa[old_ws][state](old_lid, qp);
-  };
+  // Dense new (ws, lid) -> old (ws, lid) permutation. Both lists are sorted
+  // by GID, so a single merge pass builds it.
+  std::vector<std::vector<std::pair<int, int>>> old_wslid(num_ws);
+  auto                                          old_it = gidwslid_old.begin();
+  for (auto&& gidwslid : gidwslid_new) {
+    auto const gid = gidwslid.first;
+    while (old_it != gidwslid_old.end() && old_it->first < gid) ++old_it;
+    ALBANY_ASSERT(old_it != gidwslid_old.end() && old_it->first == gid, "No old state for element GID " << gid);
+    auto&&     ws_map = old_wslid[gidwslid.second.ws];
+    auto const lid    = static_cast<std::size_t>(gidwslid.second.LID);
+    if (ws_map.size() <= lid) ws_map.resize(lid + 1, std::make_pair(-1, -1));
+    ws_map[lid] = std::make_pair(old_it->second.ws, old_it->second.LID);
+  }
 
-  auto oldValue3 = [&](int ws, std::string const& state, int lid, int qp, int i) {
-    auto old_wslid = mapWsLID(ws, lid);
-    auto old_ws    = old_wslid.first;
-    auto old_lid   = old_wslid.second;
-    return old_esa[old_ws][state](old_lid, qp, i);
-  };
+  // Resolve the arrays of every state up front. The copies below touch
+  // no map, so the states can be transferred concurrently.
+  using ArrayPtrs      = std::vector<MDArray*>;
+  using ConstArrayPtrs = std::vector<MDArray const*>;
 
-  auto oldValue4 = [&](int ws, std::string const& state, int lid, int qp, int i, int j) {
-    auto old_wslid = mapWsLID(ws, lid);
-    auto old_ws    = old_wslid.first;
-    auto old_lid   = old_wslid.second;
-    return old_esa[old_ws][state](old_lid, qp, i, j);
-  };
+  auto const num_states = sis->size();
 
-  auto oldValue5 = [&](int ws, std::string const& state, int lid, int qp, int i, int j, int k) {
-    auto old_wslid = mapWsLID(ws, lid);
-    auto old_ws    = old_wslid.first;
-    auto old_lid   = old_wslid.second;
-    return old_esa[old_ws][state](old_lid, qp, i, j, k);
-  };
+  std::vector<ArrayPtrs>      new_arrays(num_states, ArrayPtrs(num_ws, nullptr));
+  std::vector<ConstArrayPtrs> old_arrays(num_states, ConstArrayPtrs(old_esa.size(), nullptr));
+  for (std::size_t s = 0; s < num_states; ++s) {
+    std::string const& state_name = (*sis)[s]->name;
+    for (std::size_t ws = 0; ws < num_ws; ++ws) {
+      auto it = new_esa[ws].find(state_name);
+      if (it != new_esa[ws].end()) new_arrays[s][ws] = &it->second;
+    }
+    for (std::size_t ws = 0; ws < old_esa.size(); ++ws) {
+      auto it = old_esa[ws].find(state_name);
+      if (it != old_esa[ws].end()) old_arrays[s][ws] = &it->second;
+    }
+  }
 
-  for (auto ws = 0; ws < num_ws; ++ws) {
-    for (auto s = 0; s < sis->size(); ++s) {
-      std::string const&             state_name = (*sis)[s]->name;
-      std::string const&             init_type  = (*sis)[s]->initType;
-      Albany::StateStruct::FieldDims dims;
-      new_esa[ws][state_name].dimensions(dims);
-      int size = dims.size();
-      if (size == 0) return;
-      switch (size) {
-        case 1:
-          for (auto cell = 0; cell < dims[0]; ++cell) {
-            double& value = new_esa[ws][state_name](cell);
-            value         = oldValue1(ws, state_name, cell);
-          }
-          break;
-        case 2:
-          for (auto cell = 0; cell < dims[0]; ++cell) {
-            for (auto qp = 0; qp < dims[1]; ++qp) {
-              double& value = new_esa[ws][state_name](cell, qp);
-              value         = oldValue2(ws, state_name, cell, qp);
-            }
-          }
-          break;
-        case 3:
-          for (auto cell = 0; cell < dims[0]; ++cell) {
-            for (auto qp = 0; qp < dims[1]; ++qp) {
-              for (auto i = 0; i < dims[2]; ++i) {
-                double& value = new_esa[ws][state_name](cell, qp, i);
-                value         = oldValue3(ws, state_name, cell, qp, i);
-              }
-            }
-          }
-          break;
-        case 4:
-          for (int cell = 0; cell < dims[0]; ++cell) {
-            for (int qp = 0; qp < dims[1]; ++qp) {
-              for (int i = 0; i < dims[2]; ++i) {
-                for (int j = 0; j < dims[3]; ++j) {
-                  double& value = new_esa[ws][state_name](cell, qp, i, j);
-                  value         = oldValue4(ws, state_name, cell, qp, i, j);
-                }
-              }
-            }
-          }
-          break;
-        case 5:
-          for (int cell = 0; cell < dims[0]; ++cell) {
-            for (int qp = 0; qp < dims[1]; ++qp) {
-              for (int i = 0; i < dims[2]; ++i) {
-                for (int j = 0; j < dims[3]; ++j) {
-                  for (int k = 0; k < dims[4]; ++k) {
-                    double& value = new_esa[ws][state_name](cell, qp, i, j, k);
-                    value         = oldValue5(ws, state_name, cell, qp, i, j, k);
-                  }
-                }
-              }
-            }
-          }
-          break;
-        default: ALBANY_ASSERT(1 <= size && size <= 5, ""); break;
+  // Arrays are cell-major, so each cell moves as one contiguous block.
+  // Cells keep their element block, so their old workset has the state.
+  auto transfer_state = [&](int const s) {
+    for (std::size_t ws = 0; ws < num_ws; ++ws) {
+      MDArray* const dst = new_arrays[s][ws];
+      if (dst == nullptr || dst->size() == 0) continue;
+      auto const num_cells = dst->dimension(0);
+      auto const stride    = dst->size() / num_cells;
+      for (auto cell = 0; cell < num_cells; ++cell) {
+        auto const    old_ws  = old_wslid[ws][cell].first;
+        auto const    old_lid = old_wslid[ws][cell].second;
+        double const* src     = old_arrays[s][old_ws]->contiguous_data() + old_lid * stride;
+        std::copy(src, src + stride, dst->contiguous_data() + cell * stride);
       }
     }
-  }
+  };
+
+  using HostPolicy = Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>;
+  Kokkos::parallel_for(HostPolicy(0, num_states), transfer_state);
 }
 
 bool
@@ -256,16 +202,33 @@ AAdapt::Erosion::adaptMesh()
   stk::all_reduce_sum(comm, &local_volume, &global_volume, 1);
   erosion_volume_ += global_volume;
 
-  // Throw away all the Albany data structures and re-build them from the mesh
+  // Rebuild the Albany data structures from the mesh. Only a few cells
+  // erode per step, so optionally reuse whatever the removal left intact.
+  // Rebalancing moves cells between ranks and needs the full rebuild.
   auto const rebalance = adapt_params_->get<bool>("Rebalance", false);
   if (rebalance == true) {
     auto stk_mesh_struct =
         Teuchos::rcp_dynamic_cast<Albany::GenericSTKMeshStruct>(stk_discretization_->getSTKMeshStruct());
     stk_mesh_struct->rebalanceAdaptedMeshT(adapt_params_, teuchos_comm_);
   }
-  stk_discretization_->updateMesh();
+  auto const incremental = adapt_params_->get<bool>("Incremental Mesh Update", false) == true && rebalance == false;
+  auto const update_name = incremental == true ? "Incremental" : "Full";
+  auto const update_timer =
+      Teuchos::TimeMonitor::getNewTimer(std::string("AAdapt::Erosion: ") + update_name + " Mesh Update");
+  auto const previous_time = update_timer->totalElapsedTime();
+  {
+    Teuchos::TimeMonitor update_time_monitor(*update_timer);
+    if (incremental == true) {
+      stk_discretization_->updateMeshIncremental();
+    } else {
+      stk_discretization_->updateMesh();
+    }
+  }
   stk_discretization_->setOutputInterval(1);
 
+  *output_stream_ << "*** ACE INFO: " << update_name
+                  << " Mesh Update Time : " << update_timer->totalElapsedTime() - previous_time << '\n';
+
   *output_stream_ << "*** ACE INFO: Eroded Volume : " << erosion_volume_ << '\n';
   *output_stream_ << "*** ACE INFO: Eroded Length : " << erosion_volume_ / cross_section_ << '\n';
 
@@ -283,6 +246,7 @@ AAdapt::Erosion::getValidAdapterParameters() const
   auto valid_pl = this->getGenericAdapterParams("Valid Erosion Params");
   valid_pl->set<bool>("Equilibrate", false, "Perform a steady solve after adaptation");
   valid_pl->set<bool>("Rebalance", true, "Rebalance mesh after adaptation in parallel runs");
+  valid_pl->set<bool>("Incremental Mesh Update", false, "Reuse discretization data left intact by erosion");
   valid_pl->set<bool>("Rename Exodus Output", false, "Use different exodus file names for adapted meshes");
   return valid_pl;
 }
@@ -86,6 +86,10 @@ class AbstractDiscretization
   virtual const Conn&
   getWsElNodeEqID() const = 0;
 
+  //! Get conflict-free cell colors per workset (empty if coloring is off)
+  virtual const Coloring&
+  getWsColoring() const = 0;
+
   //! Get map from (Ws, El, Local Node) -> unkGID
   virtual const WorksetArray<Teuchos::ArrayRCP<Teuchos::ArrayRCP<GO>>>::type&
   getWsElNodeID() const = 0;
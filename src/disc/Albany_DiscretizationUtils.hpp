@@ -61,6 +61,24 @@ struct WorksetArray
 using WorksetConn = Kokkos::View<LO***, Kokkos::LayoutRight, PHX::Device>;
 using Conn        = WorksetArray<WorksetConn>::type;
 
+// Partition of the cells of one workset into colors such that no two cells
+// of the same color share a degree of freedom. The cells of color c are
+// cells(offsets[c]), ..., cells(offsets[c + 1] - 1). An empty coloring
+// means the workset was not colored.
+struct WorksetColoring
+{
+  Kokkos::View<LO*, PHX::Device> cells;
+  std::vector<int>               offsets;
+
+  int
+  numColors() const
+  {
+    return offsets.empty() == true ? 0 : static_cast<int>(offsets.size()) - 1;
+  }
+};
+
+using Coloring = WorksetArray<WorksetColoring>::type;
+
 }  // namespace Albany
 
 #endif  // ALBANY_DISCRETIZATION_UTILS_HPP
@@ -0,0 +1,212 @@
+// Albany 3.0: Copyright 2016 National Technology & Engineering Solutions of
+// Sandia, LLC (NTESS). This Software is released under the BSD license detailed
+// in the file license.txt in the top-level Albany directory.
+
+#include "Albany_AsyncExodusWriter.hpp"
+
+#include <Ioss_ElementBlock.h>
+#include <Ioss_Field.h>
+#include <Ioss_NodeBlock.h>
+#include <Ioss_VariableType.h>
+
+#include <algorithm>
+#include <stk_io/IossBridge.hpp>
+#include <stk_mesh/base/MetaData.hpp>
+
+#include "Albany_Macros.hpp"
+
+namespace Albany {
+
+AsyncExodusWriter::AsyncExodusWriter(
+    Teuchos::RCP<stk::io::StkMeshIoBroker> const& mesh_data,
+    std::size_t const                             output_file_idx,
+    int const                                     max_pending,
+    RenamedFields const&                          renamed_fields)
+    : mesh_data_(mesh_data),
+      bulk_data_(mesh_data->bulk_data()),
+      region_(&*mesh_data->get_output_io_region(output_file_idx)),
+      max_pending_(std::max(max_pending, 1))
+{
+  ALBANY_ASSERT(
+      region_->get_state() == Ioss::STATE_TRANSIENT,
+      "The Exodus output model must be defined before asynchronous output starts");
+
+  for (auto* node_block : region_->get_node_blocks()) {
+    addBlock(node_block, stk::topology::NODE_RANK, renamed_fields);
+  }
+  for (auto* elem_block : region_->get_element_blocks()) {
+    addBlock(elem_block, stk::topology::ELEMENT_RANK, RenamedFields());
+  }
+
+  writer_ = std::thread(&AsyncExodusWriter::run, this);
+}
+
+AsyncExodusWriter::~AsyncExodusWriter()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  queue_changed_.notify_all();
+  writer_.join();
+}
+
+void
+AsyncExodusWriter::addBlock(
+    Ioss::GroupingEntity*       io_entity,
+    stk::mesh::EntityRank const rank,
+    RenamedFields const&        renamed_fields)
+{
+  Block block;
+  block.io_entity = io_entity;
+
+  stk::io::OutputParams params(*region_, bulk_data_);
+  stk::io::get_output_entity_list(io_entity, rank, params, block.entities);
+
+  // Same selection as setupExodusOutput: transient fields of this rank that
+  // were registered with the output region.
+  for (auto* field : bulk_data_.mesh_meta_data().get_fields()) {
+    if (field->entity_rank() != rank) continue;
+
+    auto const* role = field->attribute<Ioss::Field::RoleType>();
+    if (role == nullptr || *role != Ioss::Field::TRANSIENT) continue;
+    if (field->type_is<double>() == false) continue;
+    if (io_entity->field_exists(field->name()) == false) continue;
+
+    block.fields.push_back(field);
+    block.names.push_back(field->name());
+    block.scalars_per_entity.push_back(io_entity->get_field(field->name()).raw_storage()->component_count());
+  }
+
+  for (auto const& renamed : renamed_fields) {
+    if (renamed.first->entity_rank() != rank) continue;
+    if (io_entity->field_exists(renamed.second) == false) continue;
+
+    block.fields.push_back(renamed.first);
+    block.names.push_back(renamed.second);
+    block.scalars_per_entity.push_back(io_entity->get_field(renamed.second).raw_storage()->component_count());
+  }
+
+  if (block.fields.empty() == false) blocks_.push_back(std::move(block));
+}
+
+void
+AsyncExodusWriter::write(double const time, VectorGlobals const& vector_globals, IntegerGlobals const& integer_globals)
+{
+  Snapshot snapshot;
+  snapshot.time            = time;
+  snapshot.vector_globals  = vector_globals;
+  snapshot.integer_globals = integer_globals;
+
+  // Copy the field values into the staging buffer in the order the output
+  // region expects them. Entities on which a field is not defined get zeros.
+  for (auto const& block : blocks_) {
+    for (std::size_t f = 0; f < block.fields.size(); ++f) {
+      stk::mesh::FieldBase const& field      = *block.fields[f];
+      std::size_t const           num_scalar = block.scalars_per_entity[f];
+
+      std::vector<double> data(block.entities.size() * num_scalar, 0.0);
+      for (std::size_t e = 0; e < block.entities.size(); ++e) {
+        stk::mesh::Entity const entity = block.entities[e];
+
+        auto const*       values  = static_cast<double const*>(stk::mesh::field_data(field, entity));
+        std::size_t const defined = stk::mesh::field_scalars_per_entity(field, entity);
+        std::size_t const count   = std::min(defined, num_scalar);
+        if (values != nullptr) std::copy(values, values + count, data.begin() + e * num_scalar);
+      }
+      snapshot.field_data.push_back(std::move(data));
+    }
+  }
+
+  std::unique_lock<std::mutex> lock(mutex_);
+  queue_changed_.wait(lock, [this] { return pending_.size() < max_pending_ || error_ != nullptr; });
+  rethrowError();
+  pending_.push_back(std::move(snapshot));
+  lock.unlock();
+  queue_changed_.notify_all();
+}
+
+void
+AsyncExodusWriter::flush()
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  queue_changed_.wait(lock, [this] { return pending_.empty() == true && writing_ == false; });
+  rethrowError();
+}
+
+std::mutex&
+AsyncExodusWriter::exodusMutex()
+{
+  static std::mutex mutex;
+  return mutex;
+}
+
+void
+AsyncExodusWriter::rethrowError()
+{
+  if (error_ == nullptr) return;
+  std::exception_ptr error = error_;
+  error_                   = nullptr;
+  std::rethrow_exception(error);
+}
+
+void
+AsyncExodusWriter::run()
+{
+  while (true) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    queue_changed_.wait(lock, [this] { return pending_.empty() == false || stop_ == true; });
+    if (pending_.empty() == true) return;
+
+    Snapshot snapshot = std::move(pending_.front());
+    pending_.pop_front();
+    writing_ = true;
+    lock.unlock();
+    queue_changed_.notify_all();
+
+    std::exception_ptr error;
+    try {
+      writeSnapshot(snapshot);
+    } catch (...) {
+      error = std::current_exception();
+    }
+
+    lock.lock();
+    // The file is in an unknown state after a failure, so later steps are
+    // dropped rather than appended to it.
+    if (error != nullptr) {
+      error_ = error;
+      pending_.clear();
+    }
+    writing_ = false;
+    lock.unlock();
+    queue_changed_.notify_all();
+  }
+}
+
+void
+AsyncExodusWriter::writeSnapshot(Snapshot& snapshot)
+{
+  std::lock_guard<std::mutex> io_lock(exodusMutex());
+
+  int const step = region_->add_state(snapshot.time);
+  region_->begin_state(step);
+
+  std::size_t index = 0;
+  for (auto const& block : blocks_) {
+    for (auto const& name : block.names) {
+      block.io_entity->put_field_data(name, snapshot.field_data[index++]);
+    }
+  }
+  for (auto& global : snapshot.vector_globals) {
+    region_->put_field_data(global.first, global.second);
+  }
+  for (auto const& global : snapshot.integer_globals) {
+    std::vector<int> value{global.second};
+    region_->put_field_data(global.first, value);
+  }
+
+  region_->end_state(step);
+}
+
+}  // namespace Albany
@@ -0,0 +1,138 @@
+// Albany 3.0: Copyright 2016 National Technology & Engineering Solutions of
+// Sandia, LLC (NTESS). This Software is released under the BSD license detailed
+// in the file license.txt in the top-level Albany directory.
+
+#ifndef ALBANY_ASYNC_EXODUS_WRITER_HPP
+#define ALBANY_ASYNC_EXODUS_WRITER_HPP
+
+#include <Ioss_GroupingEntity.h>
+#include <Ioss_Region.h>
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <map>
+#include <mutex>
+#include <stk_io/StkMeshIoBroker.hpp>
+#include <stk_mesh/base/BulkData.hpp>
+#include <stk_mesh/base/FieldBase.hpp>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "Teuchos_RCP.hpp"
+
+namespace Albany {
+
+/*
+ * Writes Exodus output steps on a background thread.
+ *
+ * The output model must already be defined, that is, at least one step must
+ * have been written through the StkMeshIoBroker. After that, write() copies
+ * the transient output fields into a staging snapshot, in the entity order
+ * of the output region, queues it and returns. A single writer thread drains
+ * the queue into the Ioss region, so the mesh fields are free to change as
+ * soon as write() returns. At most max_pending snapshots are held at a time;
+ * write() waits for the writer when the queue is full, which bounds memory.
+ * The destructor flushes the queue.
+ *
+ * Node fields added to the output under another name, such as the current
+ * coordinates, are passed as renamed_fields and staged like the others.
+ *
+ * An exception thrown by the writer thread is kept, the remaining steps are
+ * dropped, and the exception is rethrown by the next write() or flush().
+ *
+ * NetCDF and HDF5 are not thread-safe, and every STK discretization may run
+ * its own writer, so all Exodus I/O of the process, including synchronous
+ * output, must hold exodusMutex(). The Ioss calls made by the writer must not
+ * need other ranks, so this is meant for the default file-per-process Exodus
+ * output.
+ */
+class AsyncExodusWriter
+{
+ public:
+  using VectorGlobals  = std::map<std::string, std::vector<double>>;
+  using IntegerGlobals = std::map<std::string, int>;
+  using RenamedFields  = std::vector<std::pair<stk::mesh::FieldBase*, std::string>>;
+
+  AsyncExodusWriter(
+      Teuchos::RCP<stk::io::StkMeshIoBroker> const& mesh_data,
+      std::size_t const                             output_file_idx,
+      int const                                     max_pending,
+      RenamedFields const&                          renamed_fields = RenamedFields());
+
+  ~AsyncExodusWriter();
+
+  AsyncExodusWriter(AsyncExodusWriter const&) = delete;
+  AsyncExodusWriter&
+  operator=(AsyncExodusWriter const&) = delete;
+
+  // Snapshot the output fields and the given globals and queue them as the
+  // output step at time.
+  void
+  write(double const time, VectorGlobals const& vector_globals, IntegerGlobals const& integer_globals);
+
+  // Wait until every queued step has been written.
+  void
+  flush();
+
+  // Serializes the Exodus I/O of all writers and discretizations.
+  static std::mutex&
+  exodusMutex();
+
+ private:
+  // An output entity (node or element block) of the region, the STK
+  // entities in its output order and the fields written on it, with their
+  // names in the output.
+  struct Block
+  {
+    Ioss::GroupingEntity*              io_entity;
+    std::vector<stk::mesh::Entity>     entities;
+    std::vector<stk::mesh::FieldBase*> fields;
+    std::vector<std::string>           names;
+    std::vector<std::size_t>           scalars_per_entity;
+  };
+
+  struct Snapshot
+  {
+    double                           time;
+    std::vector<std::vector<double>> field_data;  // one per (block, field)
+    VectorGlobals                    vector_globals;
+    IntegerGlobals                   integer_globals;
+  };
+
+  void
+  addBlock(
+      Ioss::GroupingEntity*       io_entity,
+      stk::mesh::EntityRank const rank,
+      RenamedFields const&        renamed_fields);
+
+  void
+  run();
+
+  void
+  writeSnapshot(Snapshot& snapshot);
+
+  // Rethrow and clear a writer error. The caller holds mutex_.
+  void
+  rethrowError();
+
+  Teuchos::RCP<stk::io::StkMeshIoBroker> mesh_data_;
+  stk::mesh::BulkData const&             bulk_data_;
+  Ioss::Region*                          region_;
+  std::vector<Block>                     blocks_;
+
+  std::size_t const       max_pending_;
+  std::deque<Snapshot>    pending_;
+  bool                    writing_{false};
+  bool                    stop_{false};
+  std::exception_ptr      error_;
+  std::mutex              mutex_;
+  std::condition_variable queue_changed_;
+  std::thread             writer_;
+};
+
+}  // namespace Albany
+
+#endif  // ALBANY_ASYNC_EXODUS_WRITER_HPP
@@ -1949,9 +1949,18 @@ GenericSTKMeshStruct::getValidGenericSTKParameters(std::string listname) const
   validPL->set<bool>("Use Serial Mesh", false, "Read in a single mesh on PE 0 and rebalance");
   validPL->set<bool>("Disable Exodus Output Initial Time", false, "Flag to disable Exodus output at initial time");
   validPL->set<bool>(
-      "Transfer Solution to Coordinates", false, "Copies the solution vector to the coordinates for output");
+      "Asynchronous Exodus Output", false, "Stage Exodus output steps and write them on a background thread");
+  validPL->set<int>(
+      "Asynchronous Exodus Output Queue Size", 2, "Maximum number of staged Exodus output steps held in memory");
+  validPL->set<bool>(
+      "Transfer Solution to Coordinates",
+      false,
+      "Copies the solution vector to the coordinates for output. The output file is rewritten every step, or with "
+      "asynchronous output the coordinates are written as the nodal field current_coordinates");
 
   validPL->set<bool>("Set All Parts IO", false, "If true, all parts are marked as io parts");
+  validPL->set<bool>(
+      "Workset Coloring", false, "Group the cells of each workset into colors so scatters need no atomics");
   validPL->set<bool>("Use Serial Mesh", false, "Read in a single mesh on PE 0 and rebalance");
   validPL->set<bool>("Use Composite Tet 10", false, "Flag to use the composite tet 10 basis in Intrepid");
   validPL->set<bool>("Build Node Sets From Side Sets", false, "Flag to build node sets from side sets");
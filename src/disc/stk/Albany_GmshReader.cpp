@@ -0,0 +1,1048 @@
+// Albany 3.0: Copyright 2016 National Technology & Engineering Solutions of
+// Sandia, LLC (NTESS). This Software is released under the BSD license detailed
+// in the file license.txt in the top-level Albany directory.
+
+#include "Albany_GmshReader.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <Teuchos_CommHelpers.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <numeric>
+#include <stk_util/parallel/CommSparse.hpp>
+#include <utility>
+
+#include "Albany_CommUtils.hpp"
+#include "Albany_Macros.hpp"
+#include "Kokkos_Core.hpp"
+
+namespace Albany {
+
+namespace {
+
+using HostPolicy = Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>;
+
+// Kinds of the items sent to and from the node directory.
+enum Message : int
+{
+  NODE,
+  REQUEST,
+  SIDE
+};
+
+// Node in the directory, with its coordinates.
+struct DirectoryNode
+{
+  GO     tag;
+  double coordinates[3];
+};
+
+// Number of nodes of a Gmsh element type, zero if not supported.
+int
+nodes_per_element(int const type)
+{
+  switch (type) {
+    case 1: return 2;    // 2-pt Line
+    case 2: return 3;    // 3-pt Triangle
+    case 3: return 4;    // 4-pt Quad
+    case 4: return 4;    // 4-pt Tetra
+    case 5: return 8;    // 8-pt Hexa
+    case 8: return 3;    // 3-pt Line
+    case 9: return 6;    // 6-pt Triangle
+    case 11: return 10;  // 10-pt Tetra
+    case 15: return 1;   // Point
+    default: return 0;
+  }
+}
+
+int
+element_dimension(int const type)
+{
+  switch (type) {
+    case 1:
+    case 8: return 1;
+    case 2:
+    case 3:
+    case 9: return 2;
+    case 4:
+    case 5:
+    case 11: return 3;
+    default: return 0;
+  }
+}
+
+// Element type of the sides of a cell type.
+int
+side_type_of(int const cell_type)
+{
+  switch (cell_type) {
+    case 2:
+    case 3: return 1;
+    case 4: return 2;
+    case 5: return 3;
+    case 9: return 8;
+    case 11: return 9;
+    default: return 0;
+  }
+}
+
+// Start of the line after the one that contains p.
+char const*
+next_line(char const* p, char const* end)
+{
+  char const* const newline = static_cast<char const*>(std::memchr(p, '\n', end - p));
+  return newline == nullptr ? end : newline + 1;
+}
+
+// Whether the line that starts at p contains only name.
+bool
+is_line(char const* p, char const* end, char const* name)
+{
+  std::size_t const length = std::strlen(name);
+  if (std::size_t(end - p) < length || std::memcmp(p, name, length) != 0) return false;
+  p += length;
+  return p == end || *p == '\n' || *p == '\r';
+}
+
+char const*
+skip_lines(char const* p, char const* end, std::size_t const number)
+{
+  for (std::size_t i = 0; i < number; ++i) {
+    p = next_line(p, end);
+  }
+  return p;
+}
+
+template <typename T>
+T
+read_binary(char const*& p)
+{
+  T value;
+  std::memcpy(&value, p, sizeof(T));
+  p += sizeof(T);
+  return value;
+}
+
+bool
+is_digit(char const c)
+{
+  return '0' <= c && c <= '9';
+}
+
+char const*
+skip_blanks(char const* p)
+{
+  while (*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n') ++p;
+  return p;
+}
+
+// The number parsers skip leading white space, advance p past the number
+// and return false if there is no number at p. Every section of a msh file
+// ends with an $End line, so they stop before the end of the mapping.
+bool
+parse_integer(char const*& p, GO& value)
+{
+  p = skip_blanks(p);
+
+  bool const negative = *p == '-';
+  if (*p == '-' || *p == '+') ++p;
+  if (is_digit(*p) == false) return false;
+
+  GO result{0};
+  while (is_digit(*p) == true) {
+    result = 10 * result + (*p - '0');
+    ++p;
+  }
+
+  value = negative == true ? -result : result;
+  return true;
+}
+
+// Mantissas of up to 15 significant digits and decimal exponents up to 22
+// in magnitude are represented exactly in double precision, and then one
+// multiplication or division gives the correctly rounded value. The rest,
+// rare in mesh files, go through strtod.
+bool
+parse_double(char const*& p, double& value)
+{
+  static double const powers_of_ten[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                         1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+  p = skip_blanks(p);
+
+  char const* const start    = p;
+  bool const        negative = *p == '-';
+  if (*p == '-' || *p == '+') ++p;
+
+  std::uint64_t mantissa{0};
+  int           digits{0};
+  int           exponent{0};
+  bool          any_digits{false};
+
+  while (is_digit(*p) == true) {
+    if (mantissa != 0 || *p != '0') ++digits;
+    if (digits <= 18) {
+      mantissa = 10 * mantissa + (*p - '0');
+    } else {
+      ++exponent;
+    }
+    any_digits = true;
+    ++p;
+  }
+
+  if (*p == '.') {
+    ++p;
+    while (is_digit(*p) == true) {
+      if (mantissa != 0 || *p != '0') ++digits;
+      if (digits <= 18) {
+        mantissa = 10 * mantissa + (*p - '0');
+        --exponent;
+      }
+      any_digits = true;
+      ++p;
+    }
+  }
+
+  if (any_digits == false) return false;
+
+  if (*p == 'e' || *p == 'E') {
+    char const* q = p + 1;
+    GO          e{0};
+    if (parse_integer(q, e) == false) return false;
+    exponent += static_cast<int>(e);
+    p = q;
+  }
+
+  if (digits <= 15 && -22 <= exponent && exponent <= 22) {
+    double const x = static_cast<double>(mantissa);
+    double const y = exponent < 0 ? x / powers_of_ten[-exponent] : x * powers_of_ten[exponent];
+    value          = negative == true ? -y : y;
+    return true;
+  }
+
+  char* end{nullptr};
+  value = std::strtod(start, &end);
+  p     = end;
+  return end != start;
+}
+
+}  // anonymous namespace
+
+GmshReader::MappedFile::MappedFile(std::string const& file_name)
+{
+  int const fd = ::open(file_name.c_str(), O_RDONLY);
+  ALBANY_ASSERT(fd >= 0, "Cannot open mesh file '" << file_name << "'");
+
+  struct stat       status;
+  int const         stat_error = ::fstat(fd, &status);
+  std::size_t const size       = stat_error == 0 ? status.st_size : 0;
+
+  void* const address = size > 0 ? ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0) : MAP_FAILED;
+  ::close(fd);
+
+  ALBANY_ASSERT(address != MAP_FAILED, "Cannot map mesh file '" << file_name << "'");
+
+  begin = static_cast<char const*>(address);
+  end   = begin + size;
+}
+
+GmshReader::MappedFile::~MappedFile()
+{
+  ::munmap(const_cast<char*>(begin), end - begin);
+}
+
+GmshReader::GmshReader(std::string const& file_name, Teuchos::RCP<Teuchos_Comm const> const& comm)
+    : file_name_(file_name), comm_(comm), file_(file_name)
+{
+  char const* p = findSection("$MeshFormat", file_.begin, file_.end);
+  ALBANY_ASSERT(p != file_.end, "No $MeshFormat section in mesh file '" << file_name_ << "'");
+
+  double version{0.0};
+  GO     file_type{0};
+  GO     data_size{0};
+
+  bool const header_read = parse_double(p, version) && parse_integer(p, file_type) && parse_integer(p, data_size);
+  ALBANY_ASSERT(header_read == true, "Invalid $MeshFormat section in mesh file '" << file_name_ << "'");
+  ALBANY_ASSERT(version == 4.1, "Only Gmsh 4.1 files can be read in parallel, '" << file_name_ << "' is " << version);
+
+  binary_ = file_type == 1;
+
+  if (binary_ == true) {
+    ALBANY_ASSERT(data_size == sizeof(std::uint64_t), "Unsupported data size " << data_size << " in binary mesh file");
+
+    // The integer 1 follows the format line to check endianness.
+    p = next_line(p, file_.end);
+    ALBANY_ASSERT(read_binary<int>(p) == 1, "Incompatible endianness of binary mesh file '" << file_name_ << "'");
+  }
+
+  // The sections before the nodes are small, the search stops there.
+  nodes_section_ = findSection("$Nodes", file_.begin, file_.end);
+  ALBANY_ASSERT(nodes_section_ != file_.end, "No $Nodes section in mesh file '" << file_name_ << "'");
+
+  physical_names_ = findSection("$PhysicalNames", file_.begin, nodes_section_) != file_.end;
+}
+
+void
+GmshReader::read()
+{
+  std::vector<Block> node_blocks;
+  std::vector<Block> element_blocks;
+  GO                 max_node_tag{0};
+  GO                 max_element_tag{0};
+
+  if (binary_ == true) {
+    char const* const nodes_end = indexBinaryBlocks(nodes_section_, true, node_blocks, max_node_tag);
+
+    char const* const elements = findSection("$Elements", nodes_end, file_.end);
+    ALBANY_ASSERT(elements != file_.end, "No $Elements section in mesh file '" << file_name_ << "'");
+
+    indexBinaryBlocks(elements, false, element_blocks, max_element_tag);
+  } else {
+    GO const elements_line = indexLines();
+
+    indexAsciiBlocks(0, true, node_blocks, max_node_tag);
+    indexAsciiBlocks(elements_line + 1, false, element_blocks, max_element_tag);
+  }
+
+  number_nodes_ = 0;
+  for (auto&& block : node_blocks) {
+    number_nodes_ += block.number;
+  }
+
+  readElements(element_blocks);
+
+  std::vector<GO>     tags;
+  std::vector<double> coordinates;
+  readNodes(node_blocks, tags, coordinates);
+
+  distribute(max_node_tag, tags, coordinates);
+}
+
+char const*
+GmshReader::findSection(char const* name, char const* from, char const* to) const
+{
+  for (char const* p = from; p < to; p = next_line(p, file_.end)) {
+    if (is_line(p, file_.end, name) == true) return next_line(p, file_.end);
+  }
+
+  return file_.end;
+}
+
+char const*
+GmshReader::indexBinaryBlocks(char const* section, bool const nodes, std::vector<Block>& blocks, GO& max_tag) const
+{
+  char const* p = section;
+
+  GO const number_blocks   = read_binary<std::uint64_t>(p);
+  GO const number_entities = read_binary<std::uint64_t>(p);
+  read_binary<std::uint64_t>(p);  // minimum tag
+  max_tag = read_binary<std::uint64_t>(p);
+
+  blocks.resize(number_blocks);
+
+  GO total{0};
+
+  for (auto&& block : blocks) {
+    block.dimension = read_binary<int>(p);
+    block.tag       = read_binary<int>(p);
+    block.type      = read_binary<int>(p);
+    block.number    = read_binary<std::uint64_t>(p);
+    block.data      = p;
+    total += block.number;
+
+    // Records have a fixed size, so the next block header is a seek away.
+    // Nodes come as all the tags, then all the coordinates, with the
+    // parametric ones if present.
+    if (nodes == true) {
+      int const coordinates_per_node = 3 + (block.type != 0 ? block.dimension : 0);
+      p += block.number * (sizeof(std::uint64_t) + coordinates_per_node * sizeof(double));
+    } else {
+      p += block.number * (1 + nodes_per_element(block.type)) * sizeof(std::uint64_t);
+    }
+
+    ALBANY_ASSERT(p <= file_.end, "Mesh file '" << file_name_ << "' is truncated");
+  }
+
+  ALBANY_ASSERT(total == number_entities, "Inconsistent block sizes in mesh file '" << file_name_ << "'");
+
+  return p;
+}
+
+GO
+GmshReader::indexLines()
+{
+  int const rank = comm_->getRank();
+  int const size = comm_->getSize();
+
+  // Line 0 starts at nodes_section_, right after the newline that ends the
+  // $Nodes line. The lines of a slice are those that start in it, so the
+  // newlines of slice k are in [slice_begin_[k] - 1, slice_begin_[k + 1] - 1).
+  std::size_t const length = file_.end - nodes_section_;
+
+  slice_begin_.resize(size + 1);
+  for (int k = 0; k <= size; ++k) {
+    slice_begin_[k] = nodes_section_ + length * k / size;
+  }
+
+  char const* const from  = slice_begin_[rank] - 1;
+  char const* const to    = slice_begin_[rank + 1] - 1;
+  std::size_t const bytes = to - from;
+  int const         parts = Kokkos::DefaultHostExecutionSpace::concurrency();
+
+  GO count{0};
+
+  Kokkos::parallel_reduce(
+      HostPolicy(0, parts),
+      [&](int const part, GO& local_count) {
+        local_count += std::count(from + bytes * part / parts, from + bytes * (part + 1) / parts, '\n');
+      },
+      count);
+
+  std::vector<GO> counts(size);
+  Teuchos::gatherAll<int, GO>(*comm_, 1, &count, size, counts.data());
+
+  slice_first_line_.assign(size + 1, 0);
+  for (int k = 0; k < size; ++k) {
+    slice_first_line_[k + 1] = slice_first_line_[k] + counts[k];
+  }
+
+  // Section lines are the only ones that start with $ in an ASCII file.
+  GO const no_line = std::numeric_limits<GO>::max();
+  GO       local_line{no_line};
+
+  for (char const* p = slice_begin_[rank]; p < slice_begin_[rank + 1]; ++p) {
+    p = static_cast<char const*>(std::memchr(p, '$', slice_begin_[rank + 1] - p));
+    if (p == nullptr) break;
+    if (p[-1] == '\n' && is_line(p, file_.end, "$Elements") == true) {
+      local_line = slice_first_line_[rank] + std::count(from, p - 1, '\n');
+      break;
+    }
+  }
+
+  GO elements_line{no_line};
+  Teuchos::reduceAll<int, GO>(*comm_, Teuchos::REDUCE_MIN, local_line, Teuchos::outArg(elements_line));
+  ALBANY_ASSERT(elements_line != no_line, "No $Elements section in mesh file '" << file_name_ << "'");
+
+  return elements_line;
+}
+
+char const*
+GmshReader::findLine(GO const line) const
+{
+  auto const upper = std::upper_bound(slice_first_line_.begin(), slice_first_line_.end(), line);
+  ALBANY_ASSERT(
+      upper != slice_first_line_.begin() && upper != slice_first_line_.end(),
+      "Mesh file '" << file_name_ << "' is truncated");
+
+  std::size_t const slice = upper - slice_first_line_.begin() - 1;
+  char const* const first = next_line(slice_begin_[slice] - 1, file_.end);
+
+  return skip_lines(first, file_.end, line - slice_first_line_[slice]);
+}
+
+void
+GmshReader::indexAsciiBlocks(GO const header, bool const nodes, std::vector<Block>& blocks, GO& max_tag)
+{
+  char const* p = findLine(header);
+
+  GO number_blocks{0};
+  GO number_entities{0};
+  GO min_tag{0};
+
+  bool const header_read = parse_integer(p, number_blocks) && parse_integer(p, number_entities) &&
+                           parse_integer(p, min_tag) && parse_integer(p, max_tag);
+  ALBANY_ASSERT(header_read == true, "Invalid section header in mesh file '" << file_name_ << "'");
+
+  blocks.resize(number_blocks);
+
+  int const rank = comm_->getRank();
+
+  // Where the last block header read by this rank starts. The headers of
+  // the slice of this rank come in order, so it only moves forward.
+  char const* cursor{nullptr};
+  GO          cursor_line{0};
+
+  GO line{header + 1};
+  GO total{0};
+
+  for (auto&& block : blocks) {
+    ALBANY_ASSERT(line < slice_first_line_.back(), "Mesh file '" << file_name_ << "' is truncated");
+
+    auto const upper = std::upper_bound(slice_first_line_.begin(), slice_first_line_.end(), line);
+    int const  owner = upper - slice_first_line_.begin() - 1;
+
+    GO values[4] = {0, 0, 0, -1};
+
+    if (owner == rank) {
+      cursor      = cursor == nullptr ? findLine(line) : skip_lines(cursor, file_.end, line - cursor_line);
+      cursor_line = line;
+
+      char const* q = cursor;
+      if ((parse_integer(q, values[0]) && parse_integer(q, values[1]) && parse_integer(q, values[2]) &&
+           parse_integer(q, values[3])) == false) {
+        values[3] = -1;
+      }
+    }
+
+    Teuchos::broadcast<int, GO>(*comm_, owner, 4, values);
+    ALBANY_ASSERT(values[3] >= 0, "Invalid block header in mesh file '" << file_name_ << "'");
+
+    block.dimension = values[0];
+    block.tag       = values[1];
+    block.type      = values[2];
+    block.number    = values[3];
+    block.line      = line + 1;
+    total += block.number;
+
+    // Nodes come as all the tag lines, then all the coordinate lines.
+    line += 1 + (nodes == true ? 2 : 1) * block.number;
+  }
+
+  ALBANY_ASSERT(total == number_entities, "Inconsistent block sizes in mesh file '" << file_name_ << "'");
+}
+
+void
+GmshReader::readElements(std::vector<Block> const& blocks)
+{
+  int const rank = comm_->getRank();
+  int const size = comm_->getSize();
+
+  for (auto&& block : blocks) {
+    ALBANY_ASSERT(nodes_per_element(block.type) > 0, "Element type (" << block.type << ") not supported");
+    dimension_ = std::max(dimension_, element_dimension(block.type));
+  }
+
+  ALBANY_ASSERT(dimension_ == 2 || dimension_ == 3, "Can only handle 2D and 3D geometries");
+
+  for (auto&& block : blocks) {
+    int const dimension = element_dimension(block.type);
+
+    if (dimension == dimension_) {
+      ALBANY_ASSERT(cell_type_ == 0 || cell_type_ == block.type, "Cannot mix element types");
+      cell_type_ = block.type;
+      number_cells_ += block.number;
+    } else if (dimension == dimension_ - 1) {
+      ALBANY_ASSERT(side_type_ == 0 || side_type_ == block.type, "Cannot mix side types");
+      side_type_ = block.type;
+      number_sides_ += block.number;
+      side_block_tags_.push_back(block.tag);
+    }
+  }
+
+  std::sort(side_block_tags_.begin(), side_block_tags_.end());
+  side_block_tags_.erase(std::unique(side_block_tags_.begin(), side_block_tags_.end()), side_block_tags_.end());
+
+  ALBANY_ASSERT(side_type_ == 0 || side_type_ == side_type_of(cell_type_), "Sides do not match the elements");
+
+  nodes_per_cell_ = nodes_per_element(cell_type_);
+  nodes_per_side_ = nodes_per_element(side_type_of(cell_type_));
+
+  // Contiguous ranges of cells and sides of this rank.
+  first_cell_ = number_cells_ * rank / size;
+
+  GO const last_cell  = number_cells_ * (rank + 1) / size;
+  GO const first_side = number_sides_ * rank / size;
+  GO const last_side  = number_sides_ * (rank + 1) / size;
+
+  cell_nodes_.resize((last_cell - first_cell_) * nodes_per_cell_);
+  side_nodes_.resize((last_side - first_side) * nodes_per_side_);
+  side_tags_.resize(last_side - first_side);
+  side_ids_.resize(last_side - first_side);
+
+  for (GO i = first_side; i < last_side; ++i) {
+    side_ids_[i - first_side] = i;
+  }
+
+  GO cell_offset{0};
+  GO side_offset{0};
+
+  for (auto&& block : blocks) {
+    int const dimension = element_dimension(block.type);
+
+    if (dimension == dimension_) {
+      GO const begin = std::max(first_cell_, cell_offset);
+      GO const end   = std::min(last_cell, cell_offset + GO(block.number));
+
+      if (begin < end) {
+        readElementRange(
+            block, begin - cell_offset, end - cell_offset, &cell_nodes_[(begin - first_cell_) * nodes_per_cell_]);
+      }
+
+      cell_offset += block.number;
+    } else if (dimension == dimension_ - 1) {
+      GO const begin = std::max(first_side, side_offset);
+      GO const end   = std::min(last_side, side_offset + GO(block.number));
+
+      if (begin < end) {
+        readElementRange(
+            block, begin - side_offset, end - side_offset, &side_nodes_[(begin - first_side) * nodes_per_side_]);
+        std::fill(side_tags_.begin() + (begin - first_side), side_tags_.begin() + (end - first_side), block.tag);
+      }
+
+      side_offset += block.number;
+    }
+  }
+
+  // The node ordering between gmsh and STK for tet10 is the same except
+  // for the last two, nodes 8 and 9 are switched.
+  if (cell_type_ == 11) {
+    std::size_t const number_local = cell_nodes_.size() / nodes_per_cell_;
+
+    Kokkos::parallel_for(HostPolicy(0, number_local), [&](std::size_t const cell) {
+      std::swap(cell_nodes_[cell * nodes_per_cell_ + 8], cell_nodes_[cell * nodes_per_cell_ + 9]);
+    });
+  }
+}
+
+void
+GmshReader::readElementRange(
+    Block const&      block,
+    std::size_t const begin,
+    std::size_t const end,
+    GO*               connectivity) const
+{
+  int const         n     = nodes_per_element(block.type);
+  std::size_t const count = end - begin;
+
+  if (binary_ == true) {
+    // Each record is the element tag followed by its node tags.
+    std::size_t const record = (1 + n) * sizeof(std::uint64_t);
+    char const* const data   = block.data + begin * record;
+
+    Kokkos::parallel_for(HostPolicy(0, count), [&](std::size_t const element) {
+      char const* p = data + element * record + sizeof(std::uint64_t);
+      for (int j = 0; j < n; ++j) {
+        connectivity[element * n + j] = read_binary<std::uint64_t>(p);
+      }
+    });
+    return;
+  }
+
+  // Lines have different lengths, so find where each one starts first.
+  std::vector<char const*> lines(count);
+
+  char const* p = findLine(block.line + begin);
+
+  for (auto&& line : lines) {
+    line = p;
+    p    = next_line(p, file_.end);
+  }
+
+  int errors{0};
+
+  Kokkos::parallel_reduce(
+      HostPolicy(0, count),
+      [&](std::size_t const element, int& local_errors) {
+        char const* q = lines[element];
+        GO          tag{0};
+        bool        line_read = parse_integer(q, tag);
+        for (int j = 0; j < n; ++j) {
+          line_read = line_read && parse_integer(q, connectivity[element * n + j]);
+        }
+        if (line_read == false) ++local_errors;
+      },
+      errors);
+
+  ALBANY_ASSERT(errors == 0, "Invalid element lines in mesh file '" << file_name_ << "'");
+}
+
+void
+GmshReader::readNodes(std::vector<Block> const& blocks, std::vector<GO>& tags, std::vector<double>& coordinates) const
+{
+  int const rank = comm_->getRank();
+  int const size = comm_->getSize();
+
+  GO const first = number_nodes_ * rank / size;
+  GO const last  = number_nodes_ * (rank + 1) / size;
+
+  tags.resize(last - first);
+  coordinates.resize(3 * (last - first));
+
+  GO  offset{0};
+  int errors{0};
+
+  for (auto&& block : blocks) {
+    GO const block_first = offset;
+    GO const begin       = std::max(first, block_first);
+    GO const end         = std::min(last, block_first + GO(block.number));
+
+    offset += block.number;
+
+    if (begin >= end) continue;
+
+    std::size_t const count        = end - begin;
+    std::size_t const skip         = begin - block_first;
+    GO* const         block_tags   = &tags[begin - first];
+    double* const     block_coords = &coordinates[3 * (begin - first)];
+
+    if (binary_ == true) {
+      std::size_t const stride   = (3 + (block.type != 0 ? block.dimension : 0)) * sizeof(double);
+      char const* const tag_data = block.data + skip * sizeof(std::uint64_t);
+      char const* const xyz_data = block.data + block.number * sizeof(std::uint64_t) + skip * stride;
+
+      Kokkos::parallel_for(HostPolicy(0, count), [&](std::size_t const i) {
+        char const* p = tag_data + i * sizeof(std::uint64_t);
+        block_tags[i] = read_binary<std::uint64_t>(p);
+        std::memcpy(&block_coords[3 * i], xyz_data + i * stride, 3 * sizeof(double));
+      });
+      continue;
+    }
+
+    // The tag lines of the range, then its coordinate lines.
+    std::vector<char const*> lines(2 * count);
+
+    char const* p = findLine(block.line + skip);
+    for (std::size_t i = 0; i < count; ++i) {
+      lines[i] = p;
+      p        = next_line(p, file_.end);
+    }
+
+    p = findLine(block.line + block.number + skip);
+    for (std::size_t i = 0; i < count; ++i) {
+      lines[count + i] = p;
+      p                = next_line(p, file_.end);
+    }
+
+    int block_errors{0};
+
+    Kokkos::parallel_reduce(
+        HostPolicy(0, count),
+        [&](std::size_t const i, int& local_errors) {
+          char const* q = lines[i];
+          char const* r = lines[count + i];
+          double*     x = &block_coords[3 * i];
+          if ((parse_integer(q, block_tags[i]) && parse_double(r, x[0]) && parse_double(r, x[1]) &&
+               parse_double(r, x[2])) == false) {
+            ++local_errors;
+          }
+        },
+        block_errors);
+
+    errors += block_errors;
+  }
+
+  ALBANY_ASSERT(errors == 0, "Invalid node lines in mesh file '" << file_name_ << "'");
+}
+
+void
+GmshReader::distribute(GO const max_tag, std::vector<GO> const& tags, std::vector<double> const& coordinates)
+{
+  int const rank = comm_->getRank();
+  int const size = comm_->getSize();
+
+  auto const in_range = [&](GO const tag) { return 1 <= tag && tag <= max_tag; };
+
+  GO min_local{0};
+  GO max_local{-1};
+  if (cell_nodes_.empty() == false) {
+    auto const bounds = std::minmax_element(cell_nodes_.begin(), cell_nodes_.end());
+    min_local         = *bounds.first;
+    max_local         = *bounds.second;
+  }
+
+  ALBANY_ASSERT(
+      cell_nodes_.empty() == true || (in_range(min_local) == true && in_range(max_local) == true),
+      "Element node tags out of range in mesh file '" << file_name_ << "'");
+  ALBANY_ASSERT(
+      std::all_of(tags.begin(), tags.end(), in_range) == true,
+      "Node tags out of range in mesh file '" << file_name_ << "'");
+
+  // Cells read in file order use nodes with nearby tags, so a table over
+  // the span of the local tags is usually about as large as the cells and
+  // replaces the sort and the searches. A span much larger than that falls
+  // back to the sorted tags.
+  std::size_t const span  = max_local - min_local + 1;
+  bool const        dense = span <= 4 * cell_nodes_.size();
+  std::vector<LO>   dense_index;
+
+  if (dense == true) {
+    dense_index.assign(span, -1);
+    for (auto&& tag : cell_nodes_) dense_index[tag - min_local] = 0;
+    node_tags_.clear();
+    for (std::size_t i = 0; i < span; ++i) {
+      if (dense_index[i] < 0) continue;
+      dense_index[i] = LO(node_tags_.size());
+      node_tags_.push_back(min_local + i);
+    }
+  } else {
+    node_tags_ = cell_nodes_;
+    std::sort(node_tags_.begin(), node_tags_.end());
+    node_tags_.erase(std::unique(node_tags_.begin(), node_tags_.end()), node_tags_.end());
+  }
+
+  std::size_t const number_nodes = node_tags_.size();
+  std::size_t const number_read  = tags.size();
+
+  // The directory splits the tags in equal ranges, one per rank.
+  auto const directory = [&](GO const tag) { return static_cast<int>((tag - 1) * size / max_tag); };
+
+  // Position in node_tags_, or -1.
+  auto const local_index = [&](GO const tag) {
+    if (dense == true) return min_local <= tag && tag <= max_local ? dense_index[tag - min_local] : LO(-1);
+    auto const it = std::lower_bound(node_tags_.begin(), node_tags_.end(), tag);
+    return it != node_tags_.end() && *it == tag ? LO(it - node_tags_.begin()) : LO(-1);
+  };
+
+  Teuchos::RCP<Teuchos_Comm const> comm    = comm_;
+  stk::ParallelMachine const       machine = getMpiCommFromTeuchosComm(comm);
+
+  int const nps = nodes_per_side_;
+
+  // The nodes read, the requests for the nodes of the local cells and the
+  // sides read go to the directory, each side to the one of its first node.
+  stk::CommSparse to_directory(machine);
+
+  for (int phase = 0; phase < 2; ++phase) {
+    for (std::size_t i = 0; i < number_read; ++i) {
+      stk::CommBuffer& buffer = to_directory.send_buffer(directory(tags[i]));
+      buffer.pack<int>(NODE);
+      buffer.pack<GO>(tags[i]);
+      buffer.pack<double>(&coordinates[3 * i], 3);
+    }
+    for (std::size_t i = 0; i < number_nodes; ++i) {
+      stk::CommBuffer& buffer = to_directory.send_buffer(directory(node_tags_[i]));
+      buffer.pack<int>(REQUEST);
+      buffer.pack<GO>(node_tags_[i]);
+    }
+    for (std::size_t i = 0; i < side_ids_.size(); ++i) {
+      stk::CommBuffer& buffer = to_directory.send_buffer(directory(side_nodes_[i * nps]));
+      buffer.pack<int>(SIDE);
+      buffer.pack<GO>(side_ids_[i]);
+      buffer.pack<int>(side_tags_[i]);
+      buffer.pack<GO>(&side_nodes_[i * nps], nps);
+    }
+
+    if (phase == 0) {
+      to_directory.allocate_buffers();
+    } else {
+      to_directory.communicate();
+    }
+  }
+
+  // Directory: nodes by tag, requests by tag and rank, and the sides as
+  // (position, tag, nodes).
+  std::vector<DirectoryNode>      directory_nodes;
+  std::vector<std::pair<GO, int>> requests;
+  std::vector<GO>                 directory_sides;
+
+  for (int p = 0; p < size; ++p) {
+    stk::CommBuffer& buffer = to_directory.recv_buffer(p);
+    while (buffer.remaining()) {
+      int kind{0};
+      buffer.unpack<int>(kind);
+      if (kind == NODE) {
+        DirectoryNode node;
+        buffer.unpack<GO>(node.tag);
+        buffer.unpack<double>(node.coordinates, 3);
+        directory_nodes.push_back(node);
+      } else if (kind == REQUEST) {
+        GO tag{0};
+        buffer.unpack<GO>(tag);
+        requests.emplace_back(tag, p);
+      } else {
+        std::size_t const start = directory_sides.size();
+        GO                id{0};
+        int               tag{0};
+        buffer.unpack<GO>(id);
+        buffer.unpack<int>(tag);
+        directory_sides.resize(start + 2 + nps);
+        directory_sides[start]     = id;
+        directory_sides[start + 1] = tag;
+        buffer.unpack<GO>(&directory_sides[start + 2], nps);
+      }
+    }
+  }
+
+  auto const tag_less = [](DirectoryNode const& a, DirectoryNode const& b) { return a.tag < b.tag; };
+  std::sort(directory_nodes.begin(), directory_nodes.end(), tag_less);
+  std::sort(requests.begin(), requests.end());
+
+  // The directory answers the requests, and sends each side to the ranks
+  // that have its first node, together with the list of those ranks.
+  stk::CommSparse from_directory(machine);
+
+  std::size_t const side_record = 2 + nps;
+  std::size_t const number_dir  = directory_sides.size() / side_record;
+  int               missing{0};
+
+  for (int phase = 0; phase < 2; ++phase) {
+    missing = 0;
+    for (auto&& request : requests) {
+      DirectoryNode key;
+      key.tag       = request.first;
+      auto const it = std::lower_bound(directory_nodes.begin(), directory_nodes.end(), key, tag_less);
+      if (it == directory_nodes.end() || it->tag != request.first) {
+        ++missing;
+        continue;
+      }
+      stk::CommBuffer& buffer = from_directory.send_buffer(request.second);
+      buffer.pack<int>(NODE);
+      buffer.pack<GO>(it->tag);
+      buffer.pack<double>(it->coordinates, 3);
+    }
+    for (std::size_t i = 0; i < number_dir; ++i) {
+      GO const* const side   = &directory_sides[i * side_record];
+      auto const      first  = std::lower_bound(requests.begin(), requests.end(), std::make_pair(side[2], 0));
+      auto const      last   = std::lower_bound(first, requests.end(), std::make_pair(side[2] + 1, 0));
+      int const       owners = last - first;
+      for (auto it = first; it != last; ++it) {
+        stk::CommBuffer& buffer = from_directory.send_buffer(it->second);
+        buffer.pack<int>(SIDE);
+        buffer.pack<GO>(side, side_record);
+        buffer.pack<int>(owners);
+        for (auto jt = first; jt != last; ++jt) buffer.pack<int>(jt->second);
+      }
+    }
+
+    if (phase == 0) {
+      from_directory.allocate_buffers();
+    } else {
+      from_directory.communicate();
+    }
+  }
+
+  int global_missing{0};
+  Teuchos::reduceAll<int, int>(*comm_, Teuchos::REDUCE_SUM, missing, Teuchos::outArg(global_missing));
+  ALBANY_ASSERT(global_missing == 0, "Missing node coordinates in mesh file '" << file_name_ << "'");
+
+  // The local cells of each local node, in increasing order.
+  std::size_t const number_cells = nodes_per_cell_ > 0 ? cell_nodes_.size() / nodes_per_cell_ : 0;
+  std::vector<LO>   node_cells_begin(number_nodes + 1, 0);
+  std::vector<LO>   node_cells(cell_nodes_.size());
+
+  std::vector<LO>   cell_local(cell_nodes_.size());
+
+  for (std::size_t i = 0; i < cell_nodes_.size(); ++i) {
+    cell_local[i] = local_index(cell_nodes_[i]);
+    ++node_cells_begin[cell_local[i] + 1];
+  }
+  std::partial_sum(node_cells_begin.begin(), node_cells_begin.end(), node_cells_begin.begin());
+
+  std::vector<LO> fill(node_cells_begin.begin(), node_cells_begin.end() - 1);
+  for (std::size_t cell = 0; cell < number_cells; ++cell) {
+    for (int j = 0; j < nodes_per_cell_; ++j) {
+      node_cells[fill[cell_local[cell * nodes_per_cell_ + j]]++] = cell;
+    }
+  }
+
+  // Lowest numbered local cell that has all the nodes of a side, or -1.
+  auto const side_cell = [&](GO const* nodes) {
+    LO const first = local_index(nodes[0]);
+    for (LO k = node_cells_begin[first]; k < node_cells_begin[first + 1]; ++k) {
+      GO const* const cn  = &cell_nodes_[node_cells[k] * nodes_per_cell_];
+      bool            has = true;
+      for (int j = 1; j < nps && has == true; ++j) {
+        has = std::find(cn, cn + nodes_per_cell_, nodes[j]) != cn + nodes_per_cell_;
+      }
+      if (has == true) return node_cells[k];
+    }
+    return LO(-1);
+  };
+
+  coordinates_.assign(3 * number_nodes, 0.0);
+
+  // Sides contained in a local cell, and the claims for them to send to the
+  // higher ranks that may contain them too. The lowest rank has the lowest
+  // numbered cells, so it keeps the side.
+  std::vector<GO>                 candidate_sides;
+  std::vector<std::pair<int, GO>> claims;
+
+  for (int p = 0; p < size; ++p) {
+    stk::CommBuffer& buffer = from_directory.recv_buffer(p);
+    while (buffer.remaining()) {
+      int kind{0};
+      buffer.unpack<int>(kind);
+      if (kind == NODE) {
+        GO tag{0};
+        buffer.unpack<GO>(tag);
+        buffer.unpack<double>(&coordinates_[3 * local_index(tag)], 3);
+      } else {
+        std::vector<GO> side(side_record);
+        int             owners{0};
+        buffer.unpack<GO>(side.data(), side_record);
+        buffer.unpack<int>(owners);
+
+        LO const cell = side_cell(&side[2]);
+        for (int i = 0; i < owners; ++i) {
+          int owner{0};
+          buffer.unpack<int>(owner);
+          if (cell >= 0 && owner > rank) claims.emplace_back(owner, side[0]);
+        }
+
+        if (cell >= 0) {
+          side.push_back(first_cell_ + cell);
+          candidate_sides.insert(candidate_sides.end(), side.begin(), side.end());
+        }
+      }
+    }
+  }
+
+  stk::CommSparse claim_comm(machine);
+
+  for (int phase = 0; phase < 2; ++phase) {
+    for (auto&& claim : claims) claim_comm.send_buffer(claim.first).pack<GO>(claim.second);
+
+    if (phase == 0) {
+      claim_comm.allocate_buffers();
+    } else {
+      claim_comm.communicate();
+    }
+  }
+
+  std::vector<GO> claimed;
+
+  for (int p = 0; p < size; ++p) {
+    stk::CommBuffer& buffer = claim_comm.recv_buffer(p);
+    while (buffer.remaining()) {
+      GO id{0};
+      buffer.unpack<GO>(id);
+      claimed.push_back(id);
+    }
+  }
+
+  std::sort(claimed.begin(), claimed.end());
+
+  // Keep the sides not claimed by a lower rank, sorted by position.
+  std::size_t const        candidate_record = side_record + 1;
+  std::size_t const        number_candidate = candidate_sides.size() / candidate_record;
+  std::vector<std::size_t> order;
+
+  for (std::size_t i = 0; i < number_candidate; ++i) {
+    GO const id = candidate_sides[i * candidate_record];
+    if (std::binary_search(claimed.begin(), claimed.end(), id) == false) order.push_back(i);
+  }
+
+  std::sort(order.begin(), order.end(), [&](std::size_t const a, std::size_t const b) {
+    return candidate_sides[a * candidate_record] < candidate_sides[b * candidate_record];
+  });
+
+  std::size_t const number_kept = order.size();
+
+  side_ids_.resize(number_kept);
+  side_tags_.resize(number_kept);
+  side_cells_.resize(number_kept);
+  side_nodes_.resize(number_kept * nps);
+
+  for (std::size_t i = 0; i < number_kept; ++i) {
+    GO const* const side = &candidate_sides[order[i] * candidate_record];
+    side_ids_[i]         = side[0];
+    side_tags_[i]        = side[1];
+    side_cells_[i]       = side[side_record];
+    std::copy(side + 2, side + side_record, &side_nodes_[i * nps]);
+  }
+
+  GO const local_kept = number_kept;
+  GO       total_kept{0};
+  Teuchos::reduceAll<int, GO>(*comm_, Teuchos::REDUCE_SUM, local_kept, Teuchos::outArg(total_kept));
+  ALBANY_ASSERT(
+      total_kept == number_sides_, "Cannot find the element of some sides in mesh file '" << file_name_ << "'");
+}
+
+}  // namespace Albany
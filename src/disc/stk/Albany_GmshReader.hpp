@@ -0,0 +1,260 @@
+// Albany 3.0: Copyright 2016 National Technology & Engineering Solutions of
+// Sandia, LLC (NTESS). This Software is released under the BSD license detailed
+// in the file license.txt in the top-level Albany directory.
+
+#ifndef ALBANY_GMSH_READER_HPP
+#define ALBANY_GMSH_READER_HPP
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "Albany_CommTypes.hpp"
+#include "Albany_ScalarOrdinalTypes.hpp"
+
+namespace Albany {
+
+/*
+ * Reads Gmsh 4.1 msh files, ASCII or binary, in parallel.
+ *
+ * The file is memory mapped and parsed in place, without streams, by
+ * hand-written number parsers. The cells, that is, the elements of the
+ * highest dimension, are numbered in file order and split in contiguous
+ * ranges, one per rank, and so are the sides, the elements one dimension
+ * lower, and the nodes. Each rank seeks to its ranges and parses only them,
+ * the lines or records concurrently on the host threads. Binary records
+ * have a fixed size, and ASCII lines are found through an index of the
+ * newlines that each rank counts in its own slice of the file.
+ *
+ * The coordinates of the nodes of the local cells and the sides are then
+ * sent where they are needed through a directory of the nodes distributed
+ * by tag, so memory per rank only depends on the local part of the mesh.
+ * Each side goes to the rank of the lowest numbered cell that contains it.
+ *
+ * Every rank must be able to open the file.
+ */
+class GmshReader
+{
+ public:
+  GmshReader(std::string const& file_name, Teuchos::RCP<Teuchos_Comm const> const& comm);
+
+  GmshReader(GmshReader const&) = delete;
+  GmshReader&
+  operator=(GmshReader const&) = delete;
+
+  // Read the cells in the range of this rank, their nodes and the sides
+  // that they contain. Collective.
+  void
+  read();
+
+  bool
+  isBinary() const
+  {
+    return binary_;
+  }
+
+  // Whether there is a $PhysicalNames section before the nodes.
+  bool
+  hasPhysicalNames() const
+  {
+    return physical_names_;
+  }
+
+  int
+  getDimension() const
+  {
+    return dimension_;
+  }
+
+  int
+  getNodesPerCell() const
+  {
+    return nodes_per_cell_;
+  }
+
+  int
+  getNodesPerSide() const
+  {
+    return nodes_per_side_;
+  }
+
+  // Number of cells in the whole mesh.
+  GO
+  getNumberCells() const
+  {
+    return number_cells_;
+  }
+
+  // Position in file order of the first local cell.
+  GO
+  getFirstCell() const
+  {
+    return first_cell_;
+  }
+
+  // Node tags of the local cells, in STK order, getNodesPerCell() per cell.
+  std::vector<GO> const&
+  getCellNodes() const
+  {
+    return cell_nodes_;
+  }
+
+  // Number of sides in the whole mesh.
+  GO
+  getNumberSides() const
+  {
+    return number_sides_;
+  }
+
+  // Position in file order of the sides of the local cells, sorted.
+  std::vector<GO> const&
+  getSideIds() const
+  {
+    return side_ids_;
+  }
+
+  // Node tags of the local sides, getNodesPerSide() per side.
+  std::vector<GO> const&
+  getSideNodes() const
+  {
+    return side_nodes_;
+  }
+
+  // Tag of the geometric entity of each local side.
+  std::vector<int> const&
+  getSideTags() const
+  {
+    return side_tags_;
+  }
+
+  // Position in file order of the lowest numbered cell of each local side.
+  std::vector<GO> const&
+  getSideCells() const
+  {
+    return side_cells_;
+  }
+
+  // Sorted tags of the geometric entities of all the sides in the mesh.
+  std::vector<int> const&
+  getSideBlockTags() const
+  {
+    return side_block_tags_;
+  }
+
+  // Sorted tags of the nodes of the local cells.
+  std::vector<GO> const&
+  getNodeTags() const
+  {
+    return node_tags_;
+  }
+
+  // Coordinates of the nodes in getNodeTags(), three per node.
+  std::vector<double> const&
+  getCoordinates() const
+  {
+    return coordinates_;
+  }
+
+ private:
+  // Read only mapping of the whole file, released on destruction.
+  struct MappedFile
+  {
+    explicit MappedFile(std::string const& file_name);
+
+    ~MappedFile();
+
+    MappedFile(MappedFile const&) = delete;
+    MappedFile&
+    operator=(MappedFile const&) = delete;
+
+    char const* begin{nullptr};
+    char const* end{nullptr};
+  };
+
+  // A block of nodes or elements, all on the same geometric entity.
+  struct Block
+  {
+    int         dimension{0};
+    int         tag{0};
+    int         type{0};  // element type, or parametric flag for nodes
+    std::size_t number{0};
+    char const* data{nullptr};  // binary, first record after the header
+    GO          line{0};        // ASCII, index of the first line after the header
+  };
+
+  // Position just after the line that contains only name, searching lines
+  // in [from, to). Returns the end of the file if not found.
+  char const*
+  findSection(char const* name, char const* from, char const* to) const;
+
+  // Index the blocks of the binary $Nodes or $Elements section that starts
+  // at position section, and return the position right after the last one.
+  char const*
+  indexBinaryBlocks(char const* section, bool const nodes, std::vector<Block>& blocks, GO& max_tag) const;
+
+  // Count the newlines in the slice of this rank of the data after $Nodes
+  // and gather the counts of all ranks, so any line can be found by
+  // skipping lines in one slice only. Returns the line of $Elements.
+  GO
+  indexLines();
+
+  // Start of line number line of the data after $Nodes.
+  char const*
+  findLine(GO const line) const;
+
+  // Index the blocks of the ASCII $Nodes or $Elements section whose header
+  // is line header. The rank that has the header of a block in its slice
+  // reads it and broadcasts it.
+  void
+  indexAsciiBlocks(GO const header, bool const nodes, std::vector<Block>& blocks, GO& max_tag);
+
+  void
+  readElements(std::vector<Block> const& blocks);
+
+  // Parse the node tags of the elements [begin, end) of block into
+  // connectivity.
+  void
+  readElementRange(Block const& block, std::size_t const begin, std::size_t const end, GO* connectivity) const;
+
+  // Parse the tags and coordinates of the nodes of this rank.
+  void
+  readNodes(std::vector<Block> const& blocks, std::vector<GO>& tags, std::vector<double>& coordinates) const;
+
+  // Send the nodes read and the sides read to the ranks that need them.
+  void
+  distribute(GO const max_tag, std::vector<GO> const& tags, std::vector<double> const& coordinates);
+
+  std::string const                      file_name_;
+  Teuchos::RCP<Teuchos_Comm const> const comm_;
+  MappedFile const                       file_;
+
+  bool        binary_{false};
+  bool        physical_names_{false};
+  char const* nodes_section_{nullptr};
+  int         dimension_{0};
+  int         cell_type_{0};
+  int         side_type_{0};
+  int         nodes_per_cell_{0};
+  int         nodes_per_side_{0};
+  GO          number_cells_{0};
+  GO          first_cell_{0};
+  GO          number_sides_{0};
+  GO          number_nodes_{0};
+
+  // ASCII line index, start of the slice and first line in it per rank.
+  std::vector<char const*> slice_begin_;
+  std::vector<GO>          slice_first_line_;
+
+  std::vector<GO>     cell_nodes_;
+  std::vector<GO>     side_ids_;
+  std::vector<GO>     side_nodes_;
+  std::vector<int>    side_tags_;
+  std::vector<GO>     side_cells_;
+  std::vector<int>    side_block_tags_;
+  std::vector<GO>     node_tags_;
+  std::vector<double> coordinates_;
+};
+
+}  // namespace Albany
+
+#endif  // ALBANY_GMSH_READER_HPP
@@ -6,6 +6,7 @@
 
 #include <Albany_STKNodeSharing.hpp>
 #include <Shards_BasicTopologies.hpp>
+#include <algorithm>
 #include <boost/algorithm/string/predicate.hpp>
 #include <iostream>
 #include <stk_io/IossBridge.hpp>
@@ -31,14 +32,26 @@ Albany::GmshSTKMeshStruct::GmshSTKMeshStruct(
   init_counters_to_zero();
   init_pointers_to_null();
 
-  // Reading the mesh on proc 0
-  if (commT->getRank() == 0) {
-    bool legacy = false;
-    bool binary = false;
-    bool ascii  = false;
+  bool const distributed_read = params->get("Gmsh Distributed Read", true);
+
+  // Gmsh 4.1 files are read on all procs, older formats and binary files
+  // with named sets only on proc 0
+  bool legacy = false;
+  bool binary = false;
+  bool ascii  = false;
 
+  int read_on_all_procs = 0;
+  if (commT->getRank() == 0) {
     determine_file_type(legacy, binary, ascii);
 
+    read_on_all_procs = distributed_read && (ascii || binary) && version == GmshVersion::V4_1 &&
+                        (binary == false || has_physical_names() == false);
+  }
+  Teuchos::broadcast(*commT, 0, 1, &read_on_all_procs);
+
+  if (read_on_all_procs == 1) {
+    loadDistributedMesh(commT);
+  } else if (commT->getRank() == 0) {
     if (legacy) {
       loadLegacyMesh();
     } else if (binary) {
@@ -214,6 +227,26 @@ Albany::GmshSTKMeshStruct::determine_file_type(bool& legacy, bool& binary, bool&
   return;
 }
 
+bool
+Albany::GmshSTKMeshStruct::has_physical_names()
+{
+  std::ifstream ifile;
+  open_fname(ifile);
+
+  // The names come before the entities, which are not text in binary files
+  std::string line;
+  bool        found = false;
+  while (std::getline(ifile, line) && line != "$Entities" && line != "$Nodes") {
+    if (line == "$PhysicalNames") {
+      found = true;
+      break;
+    }
+  }
+
+  ifile.close();
+  return found;
+}
+
 void
 Albany::GmshSTKMeshStruct::init_counters_to_zero()
 {
@@ -276,8 +309,15 @@ Albany::GmshSTKMeshStruct::setFieldAndBulkData(
 
   bulkData->modification_begin();  // Begin modifying the mesh
 
-  // Only proc 0 has loaded the file
-  if (commT->getRank() == 0) {
+  bool const read_on_all_procs = reader.is_null() == false;
+
+  // Only proc 0 has loaded the file, unless all procs read their part
+  if (read_on_all_procs == true) {
+    declare_distributed_entities(commT);
+
+    // The reader holds the local connectivity and the file mapping
+    reader = Teuchos::null;
+  } else if (commT->getRank() == 0) {
     stk::mesh::PartVector singlePartVec(1);
     unsigned int          ebNo   = 0;  // element block #???
     int                   sideID = 0;
@@ -354,9 +394,11 @@ Albany::GmshSTKMeshStruct::setFieldAndBulkData(
   bulkData->modification_end();
 
 #if defined(ALBANY_ZOLTAN)
-  // Gmsh is for sure using a serial mesh. We hard code it here, in case the
-  // user did not set it
-  params->set<bool>("Use Serial Mesh", true);
+  // Unless read on all procs, Gmsh is for sure using a serial mesh. We hard
+  // code it here, in case the user did not set it
+  if (read_on_all_procs == false) {
+    params->set<bool>("Use Serial Mesh", true);
+  }
 
   // Refine the mesh before starting the simulation if indicated
   uniformRefineMesh(commT);
@@ -387,6 +429,12 @@ Albany::GmshSTKMeshStruct::getValidDiscretizationParameters() const
       "mesh.msh",
       "Name of the file containing the 2D mesh, with list of coordinates, "
       "elements' connectivity and boundary edges' connectivity");
+  validPL->set<bool>(
+      "Gmsh Distributed Read",
+      true,
+      "Read Gmsh 4.1 files on all procs, each one parsing and keeping only "
+      "its share of the elements. Binary files with named sets are read on "
+      "proc 0");
 
   return validPL;
 }
@@ -561,6 +609,107 @@ Albany::GmshSTKMeshStruct::loadLegacyMesh()
   ifile.close();
 }
 
+void
+Albany::GmshSTKMeshStruct::loadDistributedMesh(const Teuchos::RCP<Teuchos_Comm const>& commT)
+{
+  reader = Teuchos::rcp(new GmshReader(fname, commT));
+
+  // The names come from the entities section, which is only parsed as text
+  ALBANY_ASSERT(
+      reader->isBinary() == false || reader->hasPhysicalNames() == false,
+      "Error! Cannot read the physical names of binary Gmsh file '" << fname << "' on all procs.\n");
+
+  reader->read();
+
+  this->numDim = reader->getDimension();
+
+  NumElemNodes = reader->getNodesPerCell();
+  NumSideNodes = reader->getNodesPerSide();
+  NumElems     = reader->getNumberCells();
+  NumSides     = reader->getSideIds().size();
+  NumNodes     = reader->getNodeTags().size();
+
+  return;
+}
+
+void
+Albany::GmshSTKMeshStruct::declare_distributed_entities(const Teuchos::RCP<Teuchos_Comm const>& commT)
+{
+  stk::mesh::PartVector singlePartVec(1);
+  unsigned int          ebNo = 0;  // element block #???
+
+  AbstractSTKFieldContainer::IntScalarFieldType* proc_rank_field   = fieldContainer->getProcRankField();
+  AbstractSTKFieldContainer::VectorFieldType*    coordinates_field = fieldContainer->getCoordinatesField();
+
+  std::vector<GO> const&     node_tags   = reader->getNodeTags();
+  std::vector<double> const& coordinates = reader->getCoordinates();
+  std::vector<GO> const&     cell_nodes  = reader->getCellNodes();
+  std::vector<GO> const&     side_nodes  = reader->getSideNodes();
+
+  // The nodes of the local elements, with their Gmsh tags as ids
+  singlePartVec[0] = nsPartVec["Node"];
+
+  for (std::size_t i = 0; i < node_tags.size(); i++) {
+    stk::mesh::Entity node = bulkData->declare_entity(stk::topology::NODE_RANK, node_tags[i], singlePartVec);
+
+    double* coord = stk::mesh::field_data(*coordinates_field, node);
+    coord[0]      = coordinates[3 * i];
+    coord[1]      = coordinates[3 * i + 1];
+    if (numDim == 3) coord[2] = coordinates[3 * i + 2];
+  }
+
+  // The local elements, numbered by their position in the file
+  GO const  first_elem      = reader->getFirstCell();
+  int const num_local_elems = cell_nodes.size() / NumElemNodes;
+
+  singlePartVec[0] = partVec[ebNo];
+
+  for (int i = 0; i < num_local_elems; i++) {
+    stk::mesh::Entity elem = bulkData->declare_entity(stk::topology::ELEMENT_RANK, first_elem + i + 1, singlePartVec);
+
+    for (int j = 0; j < NumElemNodes; j++) {
+      stk::mesh::Entity node = bulkData->get_entity(stk::topology::NODE_RANK, cell_nodes[i * NumElemNodes + j]);
+      bulkData->declare_relation(elem, node, j);
+    }
+
+    int* p_rank = stk::mesh::field_data(*proc_rank_field, elem);
+    p_rank[0]   = commT->getRank();
+  }
+
+  // The reader gives each side to the proc of the lowest numbered element
+  // that has it, sides are numbered by their position in the file
+  std::vector<GO> const&  side_ids   = reader->getSideIds();
+  std::vector<GO> const&  side_cells = reader->getSideCells();
+  std::vector<int> const& side_tags  = reader->getSideTags();
+
+  std::string           partName;
+  stk::mesh::PartVector nsPartVec_i(1), ssPartVec_i(2);
+  ssPartVec_i[0] = ssPartVec["BoundarySide"];  // The whole boundary side
+  for (int i = 0; i < NumSides; i++) {
+    int const tag  = side_tags[i];
+    partName       = bdTagToNodeSetName[tag];
+    nsPartVec_i[0] = nsPartVec[partName];
+
+    partName       = bdTagToSideSetName[tag];
+    ssPartVec_i[1] = ssPartVec[partName];
+
+    stk::mesh::Entity side = bulkData->declare_entity(metaData->side_rank(), side_ids[i] + 1, ssPartVec_i);
+    for (int j = 0; j < NumSideNodes; ++j) {
+      stk::mesh::Entity node_j = bulkData->get_entity(stk::topology::NODE_RANK, side_nodes[i * NumSideNodes + j]);
+      bulkData->change_entity_parts(node_j, nsPartVec_i);  // Add node to the boundary nodeset
+      bulkData->declare_relation(side, node_j, j);
+    }
+
+    stk::mesh::Entity elem      = bulkData->get_entity(stk::topology::ELEM_RANK, side_cells[i] + 1);
+    int               num_sides = bulkData->num_sides(elem);
+    bulkData->declare_relation(elem, side, num_sides);
+  }
+
+  fix_node_sharing(*bulkData);
+
+  return;
+}
+
 void
 Albany::GmshSTKMeshStruct::swallow_lines_until(std::ifstream& ifile, std::string& line, std::string line_of_interest)
 {
@@ -1327,10 +1476,15 @@ Albany::GmshSTKMeshStruct::set_boundaries(
   set_all_nodes_boundary(nsNames);
   set_all_sides_boundary(ssNames);
 
-  // Counting boundaries (only proc 0 has any stored, so far)
+  // Counting boundaries (only proc 0 has any stored, so far, unless the
+  // mesh was read on all procs)
   std::set<int> bdTags;
-  for (int i(0); i < NumSides; ++i) {
-    bdTags.insert(sides[NumSideNodes][i]);
+  if (reader.is_null() == false) {
+    bdTags.insert(reader->getSideBlockTags().begin(), reader->getSideBlockTags().end());
+  } else {
+    for (int i(0); i < NumSides; ++i) {
+      bdTags.insert(sides[NumSideNodes][i]);
+    }
   }
 
   // Broadcasting the tags
@@ -1357,8 +1511,9 @@ Albany::GmshSTKMeshStruct::set_boundaries(
 
   // Gmsh 4.1 Allows users to give string names to surface.
   // We overwrite the number based set names with the string ones
-  // if any exist
-  if (version == GmshVersion::V4_1) {
+  // if any exist. A mesh read on all procs says whether there are any.
+  bool const no_names = reader.is_null() == false && reader->hasPhysicalNames() == false;
+  if (version == GmshVersion::V4_1 && no_names == false) {
     // Map has format: "name",  physical_tag
     std::map<std::string, int> physical_names;
     get_physical_names(physical_names, commT);
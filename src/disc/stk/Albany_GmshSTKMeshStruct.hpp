@@ -6,6 +6,7 @@
 #define ALBANY_GMSH_STK_MESH_STRUCT_HPP
 
 #include "Albany_GenericSTKMeshStruct.hpp"
+#include "Albany_GmshReader.hpp"
 
 namespace Albany {
 
@@ -101,6 +102,10 @@ class GmshSTKMeshStruct : public GenericSTKMeshStruct
   void
   determine_file_type(bool& legacy, bool& binary, bool& ascii);
 
+  // Whether the msh file has a $PhysicalNames section
+  bool
+  has_physical_names();
+
   // Broadcast topology of the mesh from 0 to all over procs
   void
   broadcast_topology(const Teuchos::RCP<Teuchos_Comm const>& commT);
@@ -219,6 +224,19 @@ class GmshSTKMeshStruct : public GenericSTKMeshStruct
   void
   loadBinaryMesh();
 
+  // Reads a Gmsh 4.1 mesh on all procs, each one keeping only its share
+  // of the elements and their nodes.
+  void
+  loadDistributedMesh(const Teuchos::RCP<Teuchos_Comm const>& commT);
+
+  // Declares the local part of a mesh read by loadDistributedMesh.
+  // Each side goes to the proc of the lowest numbered element that has it.
+  void
+  declare_distributed_entities(const Teuchos::RCP<Teuchos_Comm const>& commT);
+
+  // Parallel reader, only set if the mesh was read on all procs
+  Teuchos::RCP<GmshReader> reader;
+
   // Init the int counters below to zero.
   void
   init_counters_to_zero();
@@ -8,6 +8,7 @@
 #include <Albany_ThyraUtils.hpp>
 #include <limits>
 
+#include "Albany_AsyncExodusWriter.hpp"
 #include "Albany_BucketArray.hpp"
 #include "Albany_GlobalLocalIndexer.hpp"
 #include "Albany_Macros.hpp"
@@ -35,6 +36,8 @@
 #include <stk_mesh/base/Selector.hpp>
 #include <stk_util/parallel/Parallel.hpp>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
 
 #if defined(ALBANY_PAR_NETCDF)
 extern "C" {
@@ -408,6 +411,63 @@ setup_latlon_interp(
   if (!rank) std::cout << "Max interpolation point search error: " << err << std::endl;
 }
 
+// Greedy coloring of the cells of one workset. Two cells conflict if they
+// share an entry of the connectivity, that is, if both scatter into the same
+// row. Cells are visited in order and take the lowest color not already used
+// by a conflicting cell.
+Albany::WorksetColoring
+colorCells(Albany::WorksetConn const& conn)
+{
+  auto const host_conn = Kokkos::create_mirror_view(conn);
+  Kokkos::deep_copy(host_conn, conn);
+
+  int const num_cells = host_conn.extent(0);
+  int const num_nodes = host_conn.extent(1);
+  int const num_eqs   = host_conn.extent(2);
+
+  std::unordered_map<LO, std::vector<int>> row_cells;
+  std::vector<int>                         cell_color(num_cells, -1);
+  std::vector<int>                         taken_by;
+  int                                      num_colors = 0;
+
+  for (int cell = 0; cell < num_cells; ++cell) {
+    for (int node = 0; node < num_nodes; ++node) {
+      for (int eq = 0; eq < num_eqs; ++eq) {
+        auto& cells = row_cells[host_conn(cell, node, eq)];
+        for (auto const other : cells) {
+          if (other != cell) taken_by[cell_color[other]] = cell;
+        }
+        if (cells.empty() == true || cells.back() != cell) cells.push_back(cell);
+      }
+    }
+    int color = 0;
+    while (color < num_colors && taken_by[color] == cell) ++color;
+    if (color == num_colors) {
+      ++num_colors;
+      taken_by.push_back(-1);
+    }
+    cell_color[cell] = color;
+  }
+
+  Albany::WorksetColoring coloring;
+  coloring.offsets.assign(num_colors + 1, 0);
+  for (int cell = 0; cell < num_cells; ++cell) {
+    ++coloring.offsets[cell_color[cell] + 1];
+  }
+  for (int color = 0; color < num_colors; ++color) {
+    coloring.offsets[color + 1] += coloring.offsets[color];
+  }
+
+  coloring.cells   = Kokkos::View<LO*, PHX::Device>("wsColoring", num_cells);
+  auto host_cells  = Kokkos::create_mirror_view(coloring.cells);
+  auto next_offset = coloring.offsets;
+  for (int cell = 0; cell < num_cells; ++cell) {
+    host_cells(next_offset[cell_color[cell]]++) = cell;
+  }
+  Kokkos::deep_copy(coloring.cells, host_cells);
+  return coloring;
+}
+
 }  // anonymous namespace
 
 namespace Albany {
@@ -432,10 +492,20 @@ STKDiscretization::STKDiscretization(
 {
   const bool disable_init_exo_output = discParams_->get<bool>("Disable Exodus Output Initial Time", false);
   if (disable_init_exo_output == true) output_initial_soln_to_exo_file = false;
+
+  async_exodus_output     = discParams_->get<bool>("Asynchronous Exodus Output", false);
+  async_exodus_queue_size = discParams_->get<int>("Asynchronous Exodus Output Queue Size", 2);
 }
 
 STKDiscretization::~STKDiscretization()
 {
+  // A destructor must not throw, so a failed pending write is only reported
+  try {
+    flushExodusOutput();
+  } catch (std::exception const& e) {
+    std::cerr << "STKDiscretization: asynchronous Exodus output failed: " << e.what() << std::endl;
+  }
+
   if (stkMeshStruct->cdfOutput) {
     if (netCDFp) {
       int const ierr = nc_close(netCDFp);
@@ -923,9 +993,10 @@ STKDiscretization::writeSolutionToFile(Thyra_Vector const& soln, double const ti
 
     container->transferSolutionToCoords();
 
-    if (!mesh_data.is_null()) {
-      // Mesh coordinates have changed. Rewrite output file by deleting the mesh
-      // data object and recreate it
+    // Mesh coordinates have changed. Rewrite output file by deleting the mesh
+    // data object and recreate it. Asynchronous output keeps the file and
+    // writes the coordinates as a field instead, see setupExodusOutput.
+    if (!mesh_data.is_null() && async_exodus_output == false) {
       setupExodusOutput();
     }
   }
@@ -934,23 +1005,7 @@ STKDiscretization::writeSolutionToFile(Thyra_Vector const& soln, double const ti
   if (stkMeshStruct->exoOutput && !(outputInterval % stkMeshStruct->exoOutputInterval)) {
     // Skip this write if outputInterval == 0 and output_initial_soln_to_exo_file == false
     if ((output_initial_soln_to_exo_file == true) || (outputInterval > 0)) {
-      double time_label = monotonicTimeLabel(time);
-      mesh_data->begin_output_step(outputFileIdx, time_label);
-      int out_step = mesh_data->write_defined_output_fields(outputFileIdx);
-      // Writing mesh global variables
-      for (auto& it : stkMeshStruct->getFieldContainer()->getMeshVectorStates()) {
-        mesh_data->write_global(outputFileIdx, it.first, it.second);
-      }
-      for (auto& it : stkMeshStruct->getFieldContainer()->getMeshScalarIntegerStates()) {
-        mesh_data->write_global(outputFileIdx, it.first, it.second);
-      }
-      mesh_data->end_output_step(outputFileIdx);
-
-      if (comm->getRank() == 0) {
-        *out << "STKDiscretization::writeSolution: writing time " << time;
-        if (time_label != time) *out << " with label " << time_label;
-        *out << " to index " << out_step << " in file " << stkMeshStruct->exoOutFile << std::endl;
-      }
+      writeExodusStep(time);
     }
   }
   outputInterval++;
@@ -978,9 +1033,10 @@ STKDiscretization::writeSolutionMVToFile(const Thyra_MultiVector& soln, double c
 
     container->transferSolutionToCoords();
 
-    if (!mesh_data.is_null()) {
-      // Mesh coordinates have changed. Rewrite output file by deleting the mesh
-      // data object and recreate it
+    // Mesh coordinates have changed. Rewrite output file by deleting the mesh
+    // data object and recreate it. Asynchronous output keeps the file and
+    // writes the coordinates as a field instead, see setupExodusOutput.
+    if (!mesh_data.is_null() && async_exodus_output == false) {
       setupExodusOutput();
     }
   }
@@ -988,23 +1044,7 @@ STKDiscretization::writeSolutionMVToFile(const Thyra_MultiVector& soln, double c
   if (stkMeshStruct->exoOutput && !(outputInterval % stkMeshStruct->exoOutputInterval)) {
     // Skip this write if outputInterval == 0 and output_initial_soln_to_exo_file == false
     if ((output_initial_soln_to_exo_file == true) || (outputInterval > 0)) {
-      double time_label = monotonicTimeLabel(time);
-      mesh_data->begin_output_step(outputFileIdx, time_label);
-      int out_step = mesh_data->write_defined_output_fields(outputFileIdx);
-      // Writing mesh global variables
-      for (auto& it : stkMeshStruct->getFieldContainer()->getMeshVectorStates()) {
-        mesh_data->write_global(outputFileIdx, it.first, it.second);
-      }
-      for (auto& it : stkMeshStruct->getFieldContainer()->getMeshScalarIntegerStates()) {
-        mesh_data->write_global(outputFileIdx, it.first, it.second);
-      }
-      mesh_data->end_output_step(outputFileIdx);
-
-      if (comm->getRank() == 0) {
-        *out << "STKDiscretization::writeSolution: writing time " << time;
-        if (time_label != time) *out << " with label " << time_label;
-        *out << " to index " << out_step << " in file " << stkMeshStruct->exoOutFile << std::endl;
-      }
+      writeExodusStep(time);
     }
   }
   outputInterval++;
@@ -1024,6 +1064,74 @@ STKDiscretization::writeSolutionMVToFile(const Thyra_MultiVector& soln, double c
   }
 }
 
+void
+STKDiscretization::writeExodusStep(double const time)
+{
+  double const time_label = monotonicTimeLabel(time);
+
+  // The state fields written below must hold the latest values
+  stateArrays.syncNewStates();
+
+  auto const& field_container = stkMeshStruct->getFieldContainer();
+
+  // With asynchronous output, the fields are staged and written by the
+  // background writer. The first step after setupExodusOutput always goes
+  // through the broker below, since it defines the output model.
+  if (async_exodus_writer != Teuchos::null) {
+    async_exodus_writer->write(
+        time_label, field_container->getMeshVectorStates(), field_container->getMeshScalarIntegerStates());
+    if (comm->getRank() == 0) {
+      *out << "STKDiscretization::writeSolution: queued time " << time;
+      if (time_label != time) *out << " with label " << time_label;
+      *out << " for file " << stkMeshStruct->exoOutFile << std::endl;
+    }
+    return;
+  }
+
+  int out_step = 0;
+  {
+    // Other discretizations may be writing from their background writers
+    std::lock_guard<std::mutex> io_lock(AsyncExodusWriter::exodusMutex());
+
+    mesh_data->begin_output_step(outputFileIdx, time_label);
+    out_step = mesh_data->write_defined_output_fields(outputFileIdx);
+    // Writing mesh global variables
+    for (auto& it : field_container->getMeshVectorStates()) {
+      mesh_data->write_global(outputFileIdx, it.first, it.second);
+    }
+    for (auto& it : field_container->getMeshScalarIntegerStates()) {
+      mesh_data->write_global(outputFileIdx, it.first, it.second);
+    }
+    mesh_data->end_output_step(outputFileIdx);
+  }
+
+  if (comm->getRank() == 0) {
+    *out << "STKDiscretization::writeSolution: writing time " << time;
+    if (time_label != time) *out << " with label " << time_label;
+    *out << " to index " << out_step << " in file " << stkMeshStruct->exoOutFile << std::endl;
+  }
+
+  if (async_exodus_output == true) {
+    AsyncExodusWriter::RenamedFields renamed_fields;
+    if (stkMeshStruct->transferSolutionToCoords == true) {
+      renamed_fields.emplace_back(stkMeshStruct->getCoordinatesField(), current_coordinates_name);
+    }
+    async_exodus_writer =
+        Teuchos::rcp(new AsyncExodusWriter(mesh_data, outputFileIdx, async_exodus_queue_size, renamed_fields));
+  }
+}
+
+void
+STKDiscretization::flushExodusOutput()
+{
+  // Destroying the writer drains its queue and joins its thread. Flush first
+  // so that a failed write is reported here.
+  if (async_exodus_writer == Teuchos::null) return;
+  Teuchos::RCP<AsyncExodusWriter> writer = async_exodus_writer;
+  async_exodus_writer                    = Teuchos::null;
+  writer->flush();
+}
+
 double
 STKDiscretization::monotonicTimeLabel(double const time)
 {
@@ -1493,8 +1601,180 @@ STKDiscretization::computeOverlapNodesAndUnknowns()
 void
 STKDiscretization::computeGraphs()
 {
+  stk::mesh::Selector select_owned_in_part =
+      stk::mesh::Selector(metaData.universal_part()) & stk::mesh::Selector(metaData.locally_owned_part());
+
+  stk::mesh::get_selected_entities(select_owned_in_part, bulkData.buckets(stk::topology::ELEMENT_RANK), cells);
+
+  if (comm->getRank() == 0) *out << "STKDisc: " << cells.size() << " elements on Proc 0 " << std::endl;
+
+  // The graphs depend only on the cell connectivity, the equations and the
+  // vector spaces. If none of these changed on any rank since the last
+  // build, as after an adaptation step that did not alter the mesh, the
+  // existing graphs are kept. The equations are fixed at construction. The
+  // topology key rejects most changes, and a match is confirmed against the
+  // cached connectivity. The vector space checks are collective, so every
+  // rank makes them.
+  std::size_t const topology_key = computeTopologyKey();
+
+  if (m_jac_factory != Teuchos::null && m_overlap_jac_factory != Teuchos::null) {
+    bool const same_vs         = sameAs(m_jac_factory->getRangeVectorSpace(), m_vs);
+    bool const same_overlap_vs = sameAs(m_overlap_jac_factory->getRangeVectorSpace(), m_overlap_vs);
+    bool const same_topology   = topology_key == graph_cache.topology_key && sameCellNodes() == true;
+
+    int local_reuse  = same_vs == true && same_overlap_vs == true && same_topology == true ? 1 : 0;
+    int global_reuse = 0;
+    Teuchos::reduceAll(*comm, Teuchos::REDUCE_MIN, 1, &local_reuse, &global_reuse);
+    if (global_reuse == 1) return;
+  }
+
   computeGraphsUpToFillComplete();
   fillCompleteGraphs();
+
+  graph_cache.topology_key = topology_key;
+}
+
+std::size_t
+STKDiscretization::computeTopologyKey() const
+{
+  std::size_t key = neq;
+
+  auto combine = [&key](std::size_t const value) { key ^= value + 0x9e3779b9 + (key << 6) + (key >> 2); };
+
+  for (auto const& eq_sidesets : sideSetEquations) {
+    combine(eq_sidesets.first);
+  }
+  for (auto const cell : cells) {
+    stk::mesh::Entity const* node_rels = bulkData.begin_nodes(cell);
+    std::size_t const        num_nodes = bulkData.num_nodes(cell);
+
+    combine(std::hash<GO>()(gid(cell)));
+    for (std::size_t j = 0; j < num_nodes; ++j) {
+      combine(std::hash<GO>()(gid(node_rels[j])));
+    }
+  }
+  return key;
+}
+
+bool
+STKDiscretization::sameCellNodes() const
+{
+  if (cells.size() != graph_cache.cell_nodes.size()) return false;
+
+  for (auto const cell : cells) {
+    auto const cached = graph_cache.cell_nodes.find(gid(cell));
+    if (cached == graph_cache.cell_nodes.end()) return false;
+
+    stk::mesh::Entity const* node_rels = bulkData.begin_nodes(cell);
+    std::size_t const        num_nodes = bulkData.num_nodes(cell);
+    if (cached->second.size() != num_nodes) return false;
+
+    for (std::size_t j = 0; j < num_nodes; ++j) {
+      if (cached->second[j] != gid(node_rels[j])) return false;
+    }
+  }
+  return true;
+}
+
+STKDiscretization::NodalLayout
+STKDiscretization::computeNodalLayout() const
+{
+  NodalLayout layout;
+  std::size_t& key = layout.key;
+
+  auto combine = [&key](std::size_t const value) { key ^= value + 0x9e3779b9 + (key << 6) + (key >> 2); };
+
+  // The DOF managers number nodes in the order they are selected, owned and
+  // shared nodes together, so the key covers that order for every part.
+  stk::mesh::Selector const      overlap_selector = metaData.locally_owned_part() | metaData.globally_shared_part();
+  std::vector<stk::mesh::Entity> nodes;
+  for (auto const& it : nodalDOFsStructContainer.mapOfDOFsStructs) {
+    std::string const&  part = it.first.first;
+    stk::mesh::Selector selector(overlap_selector);
+    if (part.size()) {
+      auto const it2 = stkMeshStruct->nsPartVec.find(part);
+      if (it2 != stkMeshStruct->nsPartVec.end()) selector &= *(it2->second);
+    }
+    stk::mesh::get_selected_entities(selector, bulkData.buckets(stk::topology::NODE_RANK), nodes);
+
+    combine(std::hash<std::string>()(part));
+    layout.part_sizes.push_back(nodes.size());
+    for (auto const node : nodes) {
+      GO const   node_gid = gid(node);
+      bool const owned    = bulkData.bucket(node).owned();
+      combine(std::hash<GO>()(node_gid));
+      combine(owned == true ? 1 : 0);
+      layout.nodes.emplace_back(node_gid, owned);
+    }
+  }
+  return layout;
+}
+
+void
+STKDiscretization::updateGraphCache()
+{
+  // Find the nodes of cells that were added, removed or reconnected since
+  // the last build. Only their rows need to be recomputed.
+  std::unordered_map<GO, std::vector<GO>> cell_nodes;
+  std::unordered_set<GO>                  touched_nodes;
+  cell_nodes.reserve(cells.size());
+
+  for (auto const cell : cells) {
+    stk::mesh::Entity const* node_rels = bulkData.begin_nodes(cell);
+    std::size_t const        num_nodes = bulkData.num_nodes(cell);
+
+    std::vector<GO> nodes(num_nodes);
+    for (std::size_t j = 0; j < num_nodes; ++j) {
+      nodes[j] = gid(node_rels[j]);
+    }
+
+    auto const cached = graph_cache.cell_nodes.find(gid(cell));
+    if (cached == graph_cache.cell_nodes.end()) {
+      touched_nodes.insert(nodes.begin(), nodes.end());
+    } else {
+      if (cached->second != nodes) {
+        touched_nodes.insert(nodes.begin(), nodes.end());
+        touched_nodes.insert(cached->second.begin(), cached->second.end());
+      }
+      graph_cache.cell_nodes.erase(cached);
+    }
+    cell_nodes.emplace(gid(cell), std::move(nodes));
+  }
+
+  // Whatever is left in the cache are cells that no longer exist here.
+  for (auto const& removed : graph_cache.cell_nodes) {
+    touched_nodes.insert(removed.second.begin(), removed.second.end());
+  }
+  graph_cache.cell_nodes = std::move(cell_nodes);
+
+  // A row couples a node to every node of the locally owned cells around it.
+  for (auto const node_gid : touched_nodes) {
+    stk::mesh::Entity const node = bulkData.get_entity(stk::topology::NODE_RANK, node_gid + 1);
+
+    std::vector<GO> columns;
+    if (bulkData.is_valid(node) == true) {
+      stk::mesh::Entity const* elem_rels = bulkData.begin_elements(node);
+      std::size_t const        num_elems = bulkData.num_elements(node);
+      for (std::size_t e = 0; e < num_elems; ++e) {
+        stk::mesh::Entity const elem = elem_rels[e];
+        if (bulkData.bucket(elem).owned() == false) continue;
+
+        stk::mesh::Entity const* node_rels = bulkData.begin_nodes(elem);
+        std::size_t const        num_nodes = bulkData.num_nodes(elem);
+        for (std::size_t j = 0; j < num_nodes; ++j) {
+          columns.push_back(gid(node_rels[j]));
+        }
+      }
+      std::sort(columns.begin(), columns.end());
+      columns.erase(std::unique(columns.begin(), columns.end()), columns.end());
+    }
+
+    if (columns.empty() == true) {
+      graph_cache.node_columns.erase(node_gid);
+    } else {
+      graph_cache.node_columns[node_gid] = std::move(columns);
+    }
+  }
 }
 
 void
@@ -1509,13 +1789,6 @@ STKDiscretization::computeGraphsUpToFillComplete()
 
   m_overlap_jac_factory = Teuchos::rcp(new ThyraCrsMatrixFactory(m_overlap_vs, m_overlap_vs, neq * nodes_per_element));
 
-  stk::mesh::Selector select_owned_in_part =
-      stk::mesh::Selector(metaData.universal_part()) & stk::mesh::Selector(metaData.locally_owned_part());
-
-  stk::mesh::get_selected_entities(select_owned_in_part, bulkData.buckets(stk::topology::ELEMENT_RANK), cells);
-
-  if (comm->getRank() == 0) *out << "STKDisc: " << cells.size() << " elements on Proc 0 " << std::endl;
-
   GO                     row, col;
   Teuchos::ArrayView<GO> colAV;
 
@@ -1527,28 +1800,22 @@ STKDiscretization::computeGraphsUpToFillComplete()
     }
   }
 
-  for (std::size_t i = 0; i < cells.size(); i++) {
-    stk::mesh::Entity        e         = cells[i];
-    stk::mesh::Entity const* node_rels = bulkData.begin_nodes(e);
-    const size_t             num_nodes = bulkData.num_nodes(e);
+  // Rows of untouched nodes come straight from the cache; each row is
+  // inserted once with all its columns instead of once per cell.
+  updateGraphCache();
 
-    // loop over local nodes
-    for (std::size_t j = 0; j < num_nodes; j++) {
-      stk::mesh::Entity rowNode = node_rels[j];
-
-      // loop over eqs
-      for (std::size_t k = 0; k < globalEqns.size(); ++k) {
-        row = getGlobalDOF(gid(rowNode), globalEqns[k]);
-        for (std::size_t l = 0; l < num_nodes; l++) {
-          stk::mesh::Entity colNode = node_rels[l];
-          for (std::size_t m = 0; m < globalEqns.size(); ++m) {
-            col   = getGlobalDOF(gid(colNode), globalEqns[m]);
-            colAV = Teuchos::arrayView(&col, 1);
-            m_overlap_jac_factory->insertGlobalIndices(row, colAV);
-          }
-        }
+  std::vector<GO> columns;
+  for (auto const& node_row : graph_cache.node_columns) {
+    columns.clear();
+    for (auto const col_node : node_row.second) {
+      for (std::size_t m = 0; m < globalEqns.size(); ++m) {
+        columns.push_back(getGlobalDOF(col_node, globalEqns[m]));
       }
     }
+    for (std::size_t k = 0; k < globalEqns.size(); ++k) {
+      row = getGlobalDOF(node_row.first, globalEqns[k]);
+      m_overlap_jac_factory->insertGlobalIndices(row, Teuchos::arrayView(columns.data(), columns.size()));
+    }
   }
 
   if (sideSetEquations.size() > 0) {
@@ -1756,6 +2023,12 @@ STKDiscretization::computeWorksetInfo()
 
   // Fill  wsElNodeEqID(workset, el_LID, local node, Eq) => unk_LID
   wsElNodeEqID.resize(num_buckets);
+
+  // Optionally group the cells of each workset into conflict-free colors
+  // so that scatters can use plain stores instead of atomics.
+  bool const color_worksets = discParams->get<bool>("Workset Coloring", false);
+  wsColoring.clear();
+  if (color_worksets == true) wsColoring.resize(num_buckets);
   wsElNodeID.resize(num_buckets);
   coords.resize(num_buckets);
   sphereVolume.resize(num_buckets);
@@ -1947,6 +2220,8 @@ STKDiscretization::computeWorksetInfo()
         for (int eq = 0; eq < static_cast<int>(neq); ++eq) wsElNodeEqID[b](i, j, eq) = node_eq_array((int)i, j, eq);
       }
     }
+
+    if (color_worksets == true) wsColoring[b] = colorCells(wsElNodeEqID[b]);
   }
 
   for (int d = 0; d < stkMeshStruct->numDim; d++) {
@@ -2075,6 +2350,10 @@ STKDiscretization::computeWorksetInfo()
     }
   }
 
+  // Keep double buffered old states where updateStates left them
+  stateArrays.applyGeneration();
+  stateArrays.buildStateHandleArrays();
+
   // Set boundary indicator fields
   computeWorksetInfoBoundaryIndicators();
 }
@@ -2304,6 +2583,9 @@ STKDiscretization::computeNodeSets()
 void
 STKDiscretization::setupExodusOutput()
 {
+  // Pending steps belong to the old output file.
+  flushExodusOutput();
+
   if (stkMeshStruct->exoOutput) {
     outputInterval = 0;
 
@@ -2317,7 +2599,10 @@ STKDiscretization::setupExodusOutput()
     // Schwarz problems Please see:
     // https://github.com/trilinos/Trilinos/issues/5479
     mesh_data->property_add(Ioss::Property("FLUSH_INTERVAL", 1));
-    outputFileIdx = mesh_data->create_output_mesh(str, stk::io::WRITE_RESULTS);
+    {
+      std::lock_guard<std::mutex> io_lock(AsyncExodusWriter::exodusMutex());
+      outputFileIdx = mesh_data->create_output_mesh(str, stk::io::WRITE_RESULTS);
+    }
 
     const auto& field_container = stkMeshStruct->getFieldContainer();
     // Adding mesh global variables
@@ -2343,6 +2628,13 @@ STKDiscretization::setupExodusOutput()
         mesh_data->add_field(outputFileIdx, *fields[i]);
       }
     }
+
+    // Exodus keeps one set of coordinates per file. With asynchronous output
+    // the file is not rewritten every step, so the coordinates that the
+    // solution is transferred to are written as a nodal field of every step.
+    if (stkMeshStruct->transferSolutionToCoords == true && async_exodus_output == true) {
+      mesh_data->add_field(outputFileIdx, *stkMeshStruct->getCoordinatesField(), current_coordinates_name);
+    }
   }
 }
 
@@ -2351,6 +2643,7 @@ STKDiscretization::reNameExodusOutput(std::string& filename)
 {
   if (stkMeshStruct->exoOutput && !mesh_data.is_null()) {
     // Delete the mesh data object and recreate it
+    flushExodusOutput();
     mesh_data = Teuchos::null;
 
     stkMeshStruct->exoOutFile = filename;
@@ -2590,6 +2883,7 @@ STKDiscretization::updateMesh()
   computeOwnedNodesAndUnknowns();
   computeNodalVectorSpaces(true);
   computeOverlapNodesAndUnknowns();
+  nodal_vs_layout = computeNodalLayout();
   setupMLCoords();
   transformMesh();
   computeGraphs();
@@ -2622,4 +2916,43 @@ STKDiscretization::updateMesh()
   }
 }
 
+void
+STKDiscretization::updateMeshIncremental()
+{
+  // Side set discretizations are rebuilt from scratch, and the first build
+  // has nothing to reuse.
+  if (m_vs.is_null() == true || stkMeshStruct->sideSetMeshStructs.size() > 0) {
+    updateMesh();
+    return;
+  }
+
+  // Removing cells only removes nodes, so the vector spaces survive unless
+  // some rank lost nodes or STK moved them to other buckets. Tpetra maps
+  // cannot shrink in place, so otherwise they are rebuilt.
+  NodalLayout nodal_layout = computeNodalLayout();
+  int         local_same   = nodal_layout == nodal_vs_layout ? 1 : 0;
+  int         global_same  = 0;
+  Teuchos::reduceAll(*comm, Teuchos::REDUCE_MIN, 1, &local_same, &global_same);
+  if (global_same == 1) {
+    computeOwnedNodesAndUnknowns();
+    computeOverlapNodesAndUnknowns();
+  } else {
+    computeNodalVectorSpaces(false);
+    computeOwnedNodesAndUnknowns();
+    computeNodalVectorSpaces(true);
+    computeOverlapNodesAndUnknowns();
+    setupMLCoords();
+    nodal_vs_layout = std::move(nodal_layout);
+  }
+
+  // The coordinates were transformed by the first build. The graph cache
+  // recomputes only the rows around removed cells.
+  computeGraphs();
+  computeWorksetInfo();
+  computeNodeSets();
+  computeSideSets();
+  setupExodusOutput();
+  meshToGraph();
+}
+
 }  // namespace Albany
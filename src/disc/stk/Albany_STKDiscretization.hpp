@@ -5,6 +5,7 @@
 #ifndef ALBANY_STK_DISCRETIZATION_HPP
 #define ALBANY_STK_DISCRETIZATION_HPP
 
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -28,6 +29,7 @@ namespace Albany {
 
 typedef shards::Array<GO, shards::NaturalOrder> GIDArray;
 
+class AsyncExodusWriter;
 class GlobalLocalIndexer;
 
 struct DOFsStruct
@@ -199,6 +201,13 @@ class STKDiscretization : public AbstractDiscretization
     return wsElNodeEqID;
   }
 
+  //! Get conflict-free cell colors per workset (empty if coloring is off)
+  Coloring const&
+  getWsColoring() const
+  {
+    return wsColoring;
+  }
+
   WorksetArray<Teuchos::ArrayRCP<Teuchos::ArrayRCP<GO>>>::type const&
   getWsElNodeID() const
   {
@@ -324,6 +333,7 @@ class STKDiscretization : public AbstractDiscretization
   setStateArrays(StateArrays& sa)
   {
     stateArrays = sa;
+    stateArrays.buildStateHandleArrays();
   }
 
   //! Get stateArrays
@@ -402,6 +412,14 @@ class STKDiscretization : public AbstractDiscretization
   void
   updateMesh();
 
+  //! Cheaper updateMesh for when cells were only removed, as by erosion.
+  //! Keeps the vector spaces when no node was removed or reordered, patches
+  //! the Jacobian graphs through the graph cache and does not transform the
+  //! coordinates again. Worksets, node and side sets, Exodus output and the
+  //! node graph are rebuilt as in updateMesh.
+  void
+  updateMeshIncremental();
+
   //! Function that transforms an STK mesh of a unit cube (for LandIce problems)
   void
   transformMesh();
@@ -570,6 +588,15 @@ class STKDiscretization : public AbstractDiscretization
   double
   monotonicTimeLabel(double const time);
 
+  //! Write one Exodus output step, through the background writer if
+  //! asynchronous output is on
+  void
+  writeExodusStep(double const time);
+
+  //! Wait for pending asynchronous output and stop the background writer
+  void
+  flushExodusOutput();
+
   void
   computeNodalVectorSpaces(bool overlapped);
 
@@ -640,6 +667,35 @@ class STKDiscretization : public AbstractDiscretization
   Teuchos::RCP<ThyraCrsMatrixFactory> m_jac_factory;
   Teuchos::RCP<ThyraCrsMatrixFactory> m_overlap_jac_factory;
 
+  //! Jacobian graph cache. Keeps the cell connectivity and node adjacency
+  //! of the last graph build, so that a rebuild after the mesh changes only
+  //! recomputes rows of nodes whose cells changed. The topology key lets
+  //! computeGraphs skip the rebuild when nothing changed.
+  struct GraphCache
+  {
+    std::size_t                             topology_key{0};
+    std::unordered_map<GO, std::vector<GO>> cell_nodes;
+    std::unordered_map<GO, std::vector<GO>> node_columns;
+  };
+  GraphCache graph_cache;
+
+  //! Nodes the vector spaces were last built from, per DOF part in DOF
+  //! manager order, with their ownership. The hash rejects most changes
+  //! before the lists are compared.
+  struct NodalLayout
+  {
+    std::size_t                      key{0};
+    std::vector<std::size_t>         part_sizes;
+    std::vector<std::pair<GO, bool>> nodes;
+
+    bool
+    operator==(NodalLayout const& other) const
+    {
+      return key == other.key && part_sizes == other.part_sizes && nodes == other.nodes;
+    }
+  };
+  NodalLayout nodal_vs_layout;
+
   NodalDOFsStructContainer nodalDOFsStructContainer;
 
   //! Processor ID
@@ -667,6 +723,9 @@ class STKDiscretization : public AbstractDiscretization
   //! Connectivity array [workset, element, local-node, Eq] => LID
   Conn wsElNodeEqID;
 
+  //! Cell colors per workset, filled if "Workset Coloring" is set
+  Coloring wsColoring;
+
   //! Connectivity array [workset, element, local-node] => GID
   WorksetArray<Teuchos::ArrayRCP<Teuchos::ArrayRCP<GO>>>::type wsElNodeID;
 
@@ -743,6 +802,15 @@ class STKDiscretization : public AbstractDiscretization
   // Boolean for disabling output of initial solution to Exodus file
   bool output_initial_soln_to_exo_file{true};
 
+  // Asynchronous Exodus output: steps after the first are staged and written
+  // by a background thread, with at most async_exodus_queue_size pending.
+  // With Transfer Solution to Coordinates the coordinates are written as the
+  // field current_coordinates_name instead of recreating the file.
+  bool                            async_exodus_output{false};
+  int                             async_exodus_queue_size{2};
+  Teuchos::RCP<AsyncExodusWriter> async_exodus_writer;
+  std::string const               current_coordinates_name{"current_coordinates"};
+
  private:
   Teuchos::RCP<ThyraCrsMatrixFactory> nodalMatrixFactory;
 
@@ -761,6 +829,19 @@ class STKDiscretization : public AbstractDiscretization
   void
   printVertexConnectivity();
 
+  std::size_t
+  computeTopologyKey() const;
+
+  //! True if the cells and their nodes match the graph cache exactly
+  bool
+  sameCellNodes() const;
+
+  NodalLayout
+  computeNodalLayout() const;
+
+  void
+  updateGraphCache();
+
   void
   computeGraphsUpToFillComplete();
 
@@ -51,6 +51,20 @@ class ScatterResidualBase : public PHX::EvaluatorWithBaseImpl<Traits>, public PH
 
   unsigned short int tensorRank;
 
+  // Runs the kernel selected by Tag over the cells of the workset. With a
+  // workset coloring the cells run one color at a time, so no two cells in
+  // flight share a row and the kernels use plain stores. Otherwise all cells
+  // run at once and the kernels use atomics.
+  template <typename Tag, typename Derived>
+  void
+  scatterCells(Derived const& derived, typename Traits::EvalData workset) const;
+
+  KOKKOS_INLINE_FUNCTION
+  void
+  scatterAdd(ST& target, ST const value) const;
+
+  bool colored{false};
+
  protected:
   Albany::WorksetConn                                                          nodeID;
   Albany::DeviceView1d<ST>                                                     f_kokkos;
@@ -139,11 +153,6 @@ class ScatterResidual<PHAL::AlbanyTraits::Residual, Traits>
   using Base::f_kokkos;
   using Base::nodeID;
   using Base::val_kokkos;
-
-  typedef typename PHX::Device::execution_space                         ExecutionSpace;
-  typedef Kokkos::RangePolicy<ExecutionSpace, PHAL_ScatterResRank0_Tag> PHAL_ScatterResRank0_Policy;
-  typedef Kokkos::RangePolicy<ExecutionSpace, PHAL_ScatterResRank1_Tag> PHAL_ScatterResRank1_Policy;
-  typedef Kokkos::RangePolicy<ExecutionSpace, PHAL_ScatterResRank2_Tag> PHAL_ScatterResRank2_Policy;
 };
 
 // **************************************************************
@@ -231,17 +240,6 @@ class ScatterResidual<PHAL::AlbanyTraits::Jacobian, Traits>
   using Base::f_kokkos;
   using Base::nodeID;
   using Base::val_kokkos;
-
-  typedef typename PHX::Device::execution_space                                 ExecutionSpace;
-  typedef Kokkos::RangePolicy<ExecutionSpace, PHAL_ScatterResRank0_Tag>         PHAL_ScatterResRank0_Policy;
-  typedef Kokkos::RangePolicy<ExecutionSpace, PHAL_ScatterJacRank0_Adjoint_Tag> PHAL_ScatterJacRank0_Adjoint_Policy;
-  typedef Kokkos::RangePolicy<ExecutionSpace, PHAL_ScatterJacRank0_Tag>         PHAL_ScatterJacRank0_Policy;
-  typedef Kokkos::RangePolicy<ExecutionSpace, PHAL_ScatterResRank1_Tag>         PHAL_ScatterResRank1_Policy;
-  typedef Kokkos::RangePolicy<ExecutionSpace, PHAL_ScatterJacRank1_Adjoint_Tag> PHAL_ScatterJacRank1_Adjoint_Policy;
-  typedef Kokkos::RangePolicy<ExecutionSpace, PHAL_ScatterJacRank1_Tag>         PHAL_ScatterJacRank1_Policy;
-  typedef Kokkos::RangePolicy<ExecutionSpace, PHAL_ScatterResRank2_Tag>         PHAL_ScatterResRank2_Policy;
-  typedef Kokkos::RangePolicy<ExecutionSpace, PHAL_ScatterJacRank2_Adjoint_Tag> PHAL_ScatterJacRank2_Adjoint_Policy;
-  typedef Kokkos::RangePolicy<ExecutionSpace, PHAL_ScatterJacRank2_Tag>         PHAL_ScatterJacRank2_Policy;
 };
 
 }  // namespace PHAL
@@ -104,6 +104,41 @@ ScatterResidualBase<EvalT, Traits>::postRegistrationSetup(typename Traits::Setup
   d.fill_field_dependencies(this->dependentFields(), this->evaluatedFields());
 }
 
+// **********************************************************************
+template <typename EvalT, typename Traits>
+template <typename Tag, typename Derived>
+void
+ScatterResidualBase<EvalT, Traits>::scatterCells(Derived const& derived, typename Traits::EvalData workset) const
+{
+  using ExecutionSpace = typename PHX::Device::execution_space;
+
+  if (colored == false) {
+    Kokkos::parallel_for(Kokkos::RangePolicy<ExecutionSpace, Tag>(0, workset.numCells), derived);
+    cudaCheckError();
+    return;
+  }
+
+  Albany::WorksetColoring const& coloring = workset.wsColoring;
+  auto const                     cells    = coloring.cells;
+  for (int color = 0; color < coloring.numColors(); ++color) {
+    Kokkos::parallel_for(
+        Kokkos::RangePolicy<ExecutionSpace>(coloring.offsets[color], coloring.offsets[color + 1]),
+        [=](int const i) { derived(Tag(), cells(i)); });
+    cudaCheckError();
+  }
+}
+
+template <typename EvalT, typename Traits>
+KOKKOS_INLINE_FUNCTION void
+ScatterResidualBase<EvalT, Traits>::scatterAdd(ST& target, ST const value) const
+{
+  if (colored == true) {
+    target += value;
+  } else {
+    Kokkos::atomic_fetch_add(&target, value);
+  }
+}
+
 // **********************************************************************
 // Specialization: Residual
 // **********************************************************************
@@ -126,7 +161,7 @@ ScatterResidual<PHAL::AlbanyTraits::Residual, Traits>::operator()(const PHAL_Sca
   for (std::size_t node = 0; node < this->numNodes; node++)
     for (std::size_t eq = 0; eq < numFields; eq++) {
       const LO id = nodeID(cell, node, this->offset + eq);
-      Kokkos::atomic_fetch_add(&f_kokkos(id), val_kokkos[eq](cell, node));
+      this->scatterAdd(f_kokkos(id), val_kokkos[eq](cell, node));
     }
 }
 
@@ -138,7 +173,7 @@ ScatterResidual<PHAL::AlbanyTraits::Residual, Traits>::operator()(const PHAL_Sca
   for (std::size_t node = 0; node < this->numNodes; node++)
     for (std::size_t eq = 0; eq < numFields; eq++) {
       const LO id = nodeID(cell, node, this->offset + eq);
-      Kokkos::atomic_fetch_add(&f_kokkos(id), this->valVec(cell, node, eq));
+      this->scatterAdd(f_kokkos(id), this->valVec(cell, node, eq));
     }
 }
 
@@ -151,7 +186,7 @@ ScatterResidual<PHAL::AlbanyTraits::Residual, Traits>::operator()(const PHAL_Sca
     for (std::size_t i = 0; i < numDims; i++)
       for (std::size_t j = 0; j < numDims; j++) {
         const LO id = nodeID(cell, node, this->offset + i * numDims + j);
-        Kokkos::atomic_fetch_add(&f_kokkos(id), this->valTensor(cell, node, i, j));
+        this->scatterAdd(f_kokkos(id), this->valTensor(cell, node, i, j));
       }
 }
 
@@ -166,7 +201,8 @@ ScatterResidual<PHAL::AlbanyTraits::Residual, Traits>::evaluateFields(typename T
   auto start = std::chrono::high_resolution_clock::now();
 #endif
   // Get map for local data structures
-  nodeID = workset.wsElNodeEqID;
+  nodeID        = workset.wsElNodeEqID;
+  this->colored = workset.wsColoring.numColors() > 0;
 
   // Get Tpetra vector view from a specific device
   f_kokkos = Albany::getNonconstDeviceData(f);
@@ -175,15 +211,12 @@ ScatterResidual<PHAL::AlbanyTraits::Residual, Traits>::evaluateFields(typename T
     // Get MDField views from std::vector
     for (int i = 0; i < numFields; i++) val_kokkos[i] = this->val[i].get_view();
 
-    Kokkos::parallel_for(PHAL_ScatterResRank0_Policy(0, workset.numCells), *this);
-    cudaCheckError();
+    this->template scatterCells<PHAL_ScatterResRank0_Tag>(*this, workset);
   } else if (this->tensorRank == 1) {
-    Kokkos::parallel_for(PHAL_ScatterResRank1_Policy(0, workset.numCells), *this);
-    cudaCheckError();
+    this->template scatterCells<PHAL_ScatterResRank1_Tag>(*this, workset);
   } else if (this->tensorRank == 2) {
     numDims = this->valTensor.extent(2);
-    Kokkos::parallel_for(PHAL_ScatterResRank2_Policy(0, workset.numCells), *this);
-    cudaCheckError();
+    this->template scatterCells<PHAL_ScatterResRank2_Tag>(*this, workset);
   }
 
 #if defined(ALBANY_TIMER)
@@ -218,7 +251,7 @@ ScatterResidual<PHAL::AlbanyTraits::Jacobian, Traits>::operator()(const PHAL_Sca
   for (std::size_t node = 0; node < this->numNodes; node++)
     for (std::size_t eq = 0; eq < numFields; eq++) {
       const LO id = nodeID(cell, node, this->offset + eq);
-      Kokkos::atomic_fetch_add(&f_kokkos(id), (val_kokkos[eq](cell, node)).val());
+      this->scatterAdd(f_kokkos(id), (val_kokkos[eq](cell, node)).val());
     }
 }
 
@@ -250,7 +283,7 @@ ScatterResidual<PHAL::AlbanyTraits::Jacobian, Traits>::operator()(
       auto valptr = val_kokkos[eq](cell, node);
       for (int lunk = 0; lunk < nunk; lunk++) {
         ST val = valptr.fastAccessDx(lunk);
-        Jac_kokkos.sumIntoValues(col[lunk], &row, 1, &val, false, true);
+        Jac_kokkos.sumIntoValues(col[lunk], &row, 1, &val, false, !this->colored);
       }
     }
   }
@@ -283,7 +316,7 @@ ScatterResidual<PHAL::AlbanyTraits::Jacobian, Traits>::operator()(const PHAL_Sca
       row         = nodeID(cell, node, this->offset + eq);
       auto valptr = val_kokkos[eq](cell, node);
       for (int i = 0; i < nunk; ++i) vals[i] = valptr.fastAccessDx(i);
-      Jac_kokkos.sumIntoValues(row, col, nunk, vals, false, true);
+      Jac_kokkos.sumIntoValues(row, col, nunk, vals, false, !this->colored);
     }
   }
 }
@@ -296,7 +329,7 @@ ScatterResidual<PHAL::AlbanyTraits::Jacobian, Traits>::operator()(const PHAL_Sca
   for (std::size_t node = 0; node < this->numNodes; node++) {
     for (std::size_t eq = 0; eq < numFields; eq++) {
       const LO id = nodeID(cell, node, this->offset + eq);
-      Kokkos::atomic_fetch_add(&f_kokkos(id), (this->valVec(cell, node, eq)).val());
+      this->scatterAdd(f_kokkos(id), (this->valVec(cell, node, eq)).val());
     }
   }
 }
@@ -329,7 +362,7 @@ ScatterResidual<PHAL::AlbanyTraits::Jacobian, Traits>::operator()(
       if (((this->valVec)(cell, node, eq)).hasFastAccess()) {
         for (int lunk = 0; lunk < nunk; lunk++) {
           ST val = ((this->valVec)(cell, node, eq)).fastAccessDx(lunk);
-          Jac_kokkos.sumIntoValues(col[lunk], &row, 1, &val, false, true);
+          Jac_kokkos.sumIntoValues(col[lunk], &row, 1, &val, false, !this->colored);
         }
       }  // has fast access
     }
@@ -363,7 +396,7 @@ ScatterResidual<PHAL::AlbanyTraits::Jacobian, Traits>::operator()(const PHAL_Sca
       row = nodeID(cell, node, this->offset + eq);
       if (((this->valVec)(cell, node, eq)).hasFastAccess()) {
         for (int i = 0; i < nunk; ++i) vals[i] = (this->valVec)(cell, node, eq).fastAccessDx(i);
-        Jac_kokkos.sumIntoValues(row, col, nunk, vals, false, true);
+        Jac_kokkos.sumIntoValues(row, col, nunk, vals, false, !this->colored);
       }
     }
   }
@@ -378,7 +411,7 @@ ScatterResidual<PHAL::AlbanyTraits::Jacobian, Traits>::operator()(const PHAL_Sca
     for (std::size_t i = 0; i < numDims; i++)
       for (std::size_t j = 0; j < numDims; j++) {
         const LO id = nodeID(cell, node, this->offset + i * numDims + j);
-        Kokkos::atomic_fetch_add(&f_kokkos(id), (this->valTensor(cell, node, i, j)).val());
+        this->scatterAdd(f_kokkos(id), (this->valTensor(cell, node, i, j)).val());
       }
 }
 
@@ -410,7 +443,7 @@ ScatterResidual<PHAL::AlbanyTraits::Jacobian, Traits>::operator()(
       if (((this->valTensor)(cell, node, eq / numDims, eq % numDims)).hasFastAccess()) {
         for (int lunk = 0; lunk < nunk; lunk++) {
           ST val = ((this->valTensor)(cell, node, eq / numDims, eq % numDims)).fastAccessDx(lunk);
-          Jac_kokkos.sumIntoValues(col[lunk], &row, 1, &val, false, true);
+          Jac_kokkos.sumIntoValues(col[lunk], &row, 1, &val, false, !this->colored);
         }
       }  // has fast access
     }
@@ -445,7 +478,7 @@ ScatterResidual<PHAL::AlbanyTraits::Jacobian, Traits>::operator()(const PHAL_Sca
       if (((this->valTensor)(cell, node, eq / numDims, eq % numDims)).hasFastAccess()) {
         for (int i = 0; i < nunk; ++i)
           vals[i] = (this->valTensor)(cell, node, eq / numDims, eq % numDims).fastAccessDx(i);
-        Jac_kokkos.sumIntoValues(row, col, nunk, vals, false, true);
+        Jac_kokkos.sumIntoValues(row, col, nunk, vals, false, !this->colored);
       }
     }
   }
@@ -460,7 +493,8 @@ ScatterResidual<PHAL::AlbanyTraits::Jacobian, Traits>::evaluateFields(typename T
   auto start = std::chrono::high_resolution_clock::now();
 #endif
   // Get map for local data structures
-  nodeID = workset.wsElNodeEqID;
+  nodeID        = workset.wsElNodeEqID;
+  this->colored = workset.wsColoring.numColors() > 0;
 
   // Get dimensions
   neq  = nodeID.extent(2);
@@ -478,43 +512,35 @@ ScatterResidual<PHAL::AlbanyTraits::Jacobian, Traits>::evaluateFields(typename T
     for (int i = 0; i < numFields; i++) val_kokkos[i] = this->val[i].get_view();
 
     if (loadResid) {
-      Kokkos::parallel_for(PHAL_ScatterResRank0_Policy(0, workset.numCells), *this);
-      cudaCheckError();
+      this->template scatterCells<PHAL_ScatterResRank0_Tag>(*this, workset);
     }
 
     if (workset.is_adjoint) {
-      Kokkos::parallel_for(PHAL_ScatterJacRank0_Adjoint_Policy(0, workset.numCells), *this);
-      cudaCheckError();
+      this->template scatterCells<PHAL_ScatterJacRank0_Adjoint_Tag>(*this, workset);
     } else {
-      Kokkos::parallel_for(PHAL_ScatterJacRank0_Policy(0, workset.numCells), *this);
-      cudaCheckError();
+      this->template scatterCells<PHAL_ScatterJacRank0_Tag>(*this, workset);
     }
   } else if (this->tensorRank == 1) {
     if (loadResid) {
-      Kokkos::parallel_for(PHAL_ScatterResRank1_Policy(0, workset.numCells), *this);
-      cudaCheckError();
+      this->template scatterCells<PHAL_ScatterResRank1_Tag>(*this, workset);
     }
 
     if (workset.is_adjoint) {
-      Kokkos::parallel_for(PHAL_ScatterJacRank1_Adjoint_Policy(0, workset.numCells), *this);
-      cudaCheckError();
+      this->template scatterCells<PHAL_ScatterJacRank1_Adjoint_Tag>(*this, workset);
     } else {
-      Kokkos::parallel_for(PHAL_ScatterJacRank1_Policy(0, workset.numCells), *this);
-      cudaCheckError();
+      this->template scatterCells<PHAL_ScatterJacRank1_Tag>(*this, workset);
     }
   } else if (this->tensorRank == 2) {
     numDims = this->valTensor.extent(2);
 
     if (loadResid) {
-      Kokkos::parallel_for(PHAL_ScatterResRank2_Policy(0, workset.numCells), *this);
-      cudaCheckError();
+      this->template scatterCells<PHAL_ScatterResRank2_Tag>(*this, workset);
     }
 
     if (workset.is_adjoint) {
-      Kokkos::parallel_for(PHAL_ScatterJacRank2_Adjoint_Policy(0, workset.numCells), *this);
+      this->template scatterCells<PHAL_ScatterJacRank2_Adjoint_Tag>(*this, workset);
     } else {
-      Kokkos::parallel_for(PHAL_ScatterJacRank2_Policy(0, workset.numCells), *this);
-      cudaCheckError();
+      this->template scatterCells<PHAL_ScatterJacRank2_Tag>(*this, workset);
     }
   }
 
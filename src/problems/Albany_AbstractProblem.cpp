@@ -162,6 +162,11 @@ Albany::AbstractProblem::getGenericProblemParams(std::string listname) const
       false,
       "Ignore residual calculations while computing the Jacobian (only "
       "generally appropriate for linear problems)");
+  validPL->set<int>(
+      "Workset Fill Threads",
+      1,
+      "Number of host threads evaluating worksets concurrently in residual "
+      "and Jacobian fills, taken from the Kokkos OpenMP pool (1 = serial fill)");
   validPL->set<double>(
       "Perturb Dirichlet",
       0.0,
@@ -4,6 +4,8 @@
 
 #include "StaticAllocator.hpp"
 
+#include <memory>
+
 using namespace utility;
 
 StaticAllocator::StaticAllocator(std::size_t size) : size_(size), buffer_(new unsigned char[size]), ptr_(buffer_) {}
@@ -15,3 +17,22 @@ StaticAllocator::clear()
 {
   ptr_ = buffer_;
 }
+
+std::size_t
+StaticAllocator::capacity() const
+{
+  return size_;
+}
+
+StaticAllocator&
+utility::threadLocalAllocator(std::size_t size)
+{
+  thread_local std::unique_ptr<StaticAllocator> allocator;
+
+  if (allocator == nullptr || allocator->capacity() < size) {
+    allocator.reset(new StaticAllocator(size));
+  }
+
+  allocator->clear();
+  return *allocator;
+}
@@ -84,12 +84,21 @@ class StaticAllocator
   void
   clear();
 
+  std::size_t
+  capacity() const;
+
  private:
   std::size_t    size_;
   unsigned char* buffer_;
   unsigned char* ptr_;
 };
 
+// Returns an allocator owned by the calling thread with at least the given
+// capacity. The allocator is cleared on every call, so anything created by a
+// previous call on the same thread must have been destroyed already.
+StaticAllocator&
+threadLocalAllocator(std::size_t size);
+
 // Allocates memory on the stack but is fixed size at compile time
 template <std::size_t Size>
 class StaticStackAllocator
@@ -0,0 +1,259 @@
+// Albany 3.0: Copyright 2016 National Technology & Engineering Solutions of
+// Sandia, LLC (NTESS). This Software is released under the BSD license detailed
+// in the file license.txt in the top-level Albany directory.
+
+// @HEADER
+
+#ifndef UTIL_TENSORPACK_HPP
+#define UTIL_TENSORPACK_HPP
+
+/**
+ *  \file TensorPack.hpp
+ *
+ *  \brief Structure-of-arrays packs of scalars and small tensors.
+ *
+ *  A pack holds the same quantity for W material points side by side, so
+ *  every operation is a loop over W independent lanes that the compiler can
+ *  map onto SIMD registers. Tensor packs store each component as one Pack,
+ *  component-major and lane-minor, and otherwise mirror BasicTensor.
+ */
+
+#include <Kokkos_Core.hpp>
+
+#include "Tensor.hpp"
+#include "TensorCommon.hpp"
+#include "TensorDetail.hpp"
+
+namespace util {
+
+/// Number of lanes used when a caller does not choose one. Eight doubles
+/// fill one AVX-512 register or two AVX2 registers, and match the number of
+/// integration points of a trilinear hexahedron.
+constexpr index_t PACK_WIDTH = 8;
+
+template <typename T, index_t W>
+class Pack
+{
+ public:
+  using value_type      = T;
+  using reference       = T&;
+  using const_reference = const T&;
+
+  static KOKKOS_INLINE_FUNCTION constexpr index_t
+  width();
+
+  KOKKOS_INLINE_FUNCTION
+  Pack();
+  explicit KOKKOS_INLINE_FUNCTION
+  Pack(value_type value);
+
+  KOKKOS_INLINE_FUNCTION const_reference
+  operator[](index_t lane) const;
+
+  KOKKOS_INLINE_FUNCTION reference
+  operator[](index_t lane);
+
+  KOKKOS_INLINE_FUNCTION Pack<T, W>&
+                         operator+=(const Pack<T, W>& other);
+  KOKKOS_INLINE_FUNCTION Pack<T, W>&
+                         operator-=(const Pack<T, W>& other);
+  KOKKOS_INLINE_FUNCTION Pack<T, W>&
+                         operator*=(const Pack<T, W>& other);
+  KOKKOS_INLINE_FUNCTION Pack<T, W>&
+                         operator/=(const Pack<T, W>& other);
+
+ private:
+  value_type data_[W];
+};
+
+template <typename T, index_t Order, index_t W>
+class BasicTensorPack
+{
+ public:
+  using value_type = T;
+  using pack_type  = Pack<T, W>;
+  using tensor     = BasicTensor<T, Order>;
+
+  static KOKKOS_INLINE_FUNCTION constexpr index_t
+  getOrder();
+  static KOKKOS_INLINE_FUNCTION constexpr index_t
+  width();
+
+  KOKKOS_INLINE_FUNCTION
+  BasicTensorPack();
+  explicit KOKKOS_INLINE_FUNCTION
+  BasicTensorPack(index_t dimension, value_type initialValue = value_type(0));
+
+  KOKKOS_INLINE_FUNCTION index_t
+  dim() const;
+
+  template <typename... Indices>
+  KOKKOS_INLINE_FUNCTION const pack_type&
+  operator()(Indices... indices) const;
+
+  template <typename... Indices>
+  KOKKOS_INLINE_FUNCTION pack_type&
+  operator()(Indices... indices);
+
+  /// Copy one lane in from, or out to, an ordinary tensor.
+  KOKKOS_INLINE_FUNCTION void
+  setLane(index_t lane, const tensor& tens);
+  KOKKOS_INLINE_FUNCTION tensor
+  getLane(index_t lane) const;
+
+  /// Copy one lane in from, or out to, an array indexed as
+  /// arr(fixed_indices..., i, j, ...), such as a PHX::MDField.
+  template <typename Array, typename... Indices>
+  KOKKOS_INLINE_FUNCTION void
+  load(index_t lane, const Array& arr, Indices... fixed_indices);
+  template <typename Array, typename... Indices>
+  KOKKOS_INLINE_FUNCTION void
+  store(index_t lane, Array& arr, Indices... fixed_indices) const;
+
+  constexpr KOKKOS_INLINE_FUNCTION index_t
+  arraySize() const;
+
+ protected:
+  using array_type = pack_type[detail::static_pow<Order>::value(3)];
+
+  template <typename... Indices>
+  KOKKOS_INLINE_FUNCTION index_t
+  index(Indices... indices) const;
+
+  index_t    dim_;
+  array_type data_;
+};
+
+template <typename T, index_t W = PACK_WIDTH>
+using Tensor2Pack = BasicTensorPack<T, 2, W>;
+
+template <typename T, index_t W = PACK_WIDTH>
+using Tensor4Pack = BasicTensorPack<T, 4, W>;
+
+// Lane-wise scalar operations
+
+template <typename T, index_t W>
+KOKKOS_INLINE_FUNCTION Pack<T, W>
+                       operator+(const Pack<T, W>& lhs, const Pack<T, W>& rhs);
+
+template <typename T, index_t W>
+KOKKOS_INLINE_FUNCTION Pack<T, W>
+                       operator-(const Pack<T, W>& lhs, const Pack<T, W>& rhs);
+
+template <typename T, index_t W>
+KOKKOS_INLINE_FUNCTION Pack<T, W>
+                       operator*(const Pack<T, W>& lhs, const Pack<T, W>& rhs);
+
+template <typename T, index_t W>
+KOKKOS_INLINE_FUNCTION Pack<T, W>
+                       operator/(const Pack<T, W>& lhs, const Pack<T, W>& rhs);
+
+template <typename T, index_t W>
+KOKKOS_INLINE_FUNCTION Pack<T, W>
+                       operator+(const Pack<T, W>& lhs, const typename Pack<T, W>::value_type& s);
+
+template <typename T, index_t W>
+KOKKOS_INLINE_FUNCTION Pack<T, W>
+                       operator+(const typename Pack<T, W>::value_type& s, const Pack<T, W>& rhs);
+
+template <typename T, index_t W>
+KOKKOS_INLINE_FUNCTION Pack<T, W>
+                       operator-(const Pack<T, W>& lhs, const typename Pack<T, W>::value_type& s);
+
+template <typename T, index_t W>
+KOKKOS_INLINE_FUNCTION Pack<T, W>
+                       operator-(const typename Pack<T, W>::value_type& s, const Pack<T, W>& rhs);
+
+template <typename T, index_t W>
+KOKKOS_INLINE_FUNCTION Pack<T, W>
+                       operator*(const typename Pack<T, W>::value_type& s, const Pack<T, W>& rhs);
+
+template <typename T, index_t W>
+KOKKOS_INLINE_FUNCTION Pack<T, W>
+                       operator*(const Pack<T, W>& lhs, const typename Pack<T, W>::value_type& s);
+
+template <typename T, index_t W>
+KOKKOS_INLINE_FUNCTION Pack<T, W>
+                       operator/(const typename Pack<T, W>::value_type& s, const Pack<T, W>& rhs);
+
+template <typename T, index_t W>
+KOKKOS_INLINE_FUNCTION Pack<T, W>
+                       operator/(const Pack<T, W>& lhs, const typename Pack<T, W>::value_type& s);
+
+template <typename T, index_t W>
+KOKKOS_INLINE_FUNCTION Pack<T, W>
+                       sqrt(const Pack<T, W>& x);
+
+template <typename T, index_t W>
+KOKKOS_INLINE_FUNCTION Pack<T, W>
+                       cbrt(const Pack<T, W>& x);
+
+template <typename T, index_t W>
+KOKKOS_INLINE_FUNCTION Pack<T, W>
+                       exp(const Pack<T, W>& x);
+
+template <typename T, index_t W>
+KOKKOS_INLINE_FUNCTION Pack<T, W>
+                       log(const Pack<T, W>& x);
+
+template <typename T, index_t W>
+KOKKOS_INLINE_FUNCTION Pack<T, W>
+                       pow(const Pack<T, W>& x, const typename Pack<T, W>::value_type& e);
+
+// Lane-wise tensor operations
+
+template <typename T, index_t O, index_t W>
+KOKKOS_INLINE_FUNCTION BasicTensorPack<T, O, W>
+                       operator+(const BasicTensorPack<T, O, W>& lhs, const BasicTensorPack<T, O, W>& rhs);
+
+template <typename T, index_t O, index_t W>
+KOKKOS_INLINE_FUNCTION BasicTensorPack<T, O, W>
+                       operator-(const BasicTensorPack<T, O, W>& lhs, const BasicTensorPack<T, O, W>& rhs);
+
+template <typename T, index_t O, index_t W>
+KOKKOS_INLINE_FUNCTION BasicTensorPack<T, O, W>
+                       operator*(const Pack<T, W>& s, const BasicTensorPack<T, O, W>& rhs);
+
+template <typename T, index_t O, index_t W>
+KOKKOS_INLINE_FUNCTION BasicTensorPack<T, O, W>
+                       operator*(const typename Pack<T, W>::value_type& s, const BasicTensorPack<T, O, W>& rhs);
+
+template <typename T, index_t O, index_t W>
+KOKKOS_INLINE_FUNCTION BasicTensorPack<T, O, W>
+                       operator/(const BasicTensorPack<T, O, W>& lhs, const Pack<T, W>& s);
+
+template <typename T, index_t W>
+KOKKOS_INLINE_FUNCTION Tensor2Pack<T, W>
+                       operator*(const Tensor2Pack<T, W>& lhs, const Tensor2Pack<T, W>& rhs);
+
+// Utility
+
+template <typename T, index_t W = PACK_WIDTH>
+KOKKOS_INLINE_FUNCTION Tensor2Pack<T, W>
+                       identity_pack(index_t dim);
+
+template <typename T, index_t W>
+KOKKOS_INLINE_FUNCTION Tensor2Pack<T, W>
+                       transpose(const Tensor2Pack<T, W>& tens);
+
+template <typename T, index_t W>
+KOKKOS_INLINE_FUNCTION Pack<T, W>
+                       trace(const Tensor2Pack<T, W>& tens);
+
+template <typename T, index_t W>
+KOKKOS_INLINE_FUNCTION Tensor2Pack<T, W>
+                       dev(const Tensor2Pack<T, W>& tens);
+
+template <typename T, index_t W>
+KOKKOS_INLINE_FUNCTION Pack<T, W>
+                       det(const Tensor2Pack<T, W>& tens);
+
+template <typename T, index_t W>
+KOKKOS_INLINE_FUNCTION Pack<T, W>
+                       norm(const Tensor2Pack<T, W>& tens);
+
+}  // namespace util
+
+#include "TensorPackImpl.hpp"
+
+#endif  // UTIL_TENSORPACK_HPP
@@ -0,0 +1,629 @@
+// Albany 3.0: Copyright 2016 National Technology & Engineering Solutions of
+// Sandia, LLC (NTESS). This Software is released under the BSD license detailed
+// in the file license.txt in the top-level Albany directory.
+
+// @HEADER
+
+#ifndef UTIL_TENSORPACKIMPL_HPP
+#define UTIL_TENSORPACKIMPL_HPP
+
+#include <cassert>
+#include <cmath>
+
+/**
+ *  \file TensorPackImpl.hpp
+ *
+ *  \brief
+ */
+
+namespace util {
+namespace detail {
+
+template <index_t Order>
+struct pack_copy;
+
+template <>
+struct pack_copy<2>
+{
+  template <typename TensorPack, typename Array, typename... Indices>
+  static KOKKOS_INLINE_FUNCTION void
+  load(TensorPack& tens, index_t lane, const Array& arr, Indices... fixed_indices)
+  {
+    for (index_t i = 0; i < tens.dim(); ++i) {
+      for (index_t j = 0; j < tens.dim(); ++j) {
+        tens(i, j)[lane] = arr(fixed_indices..., i, j);
+      }
+    }
+  }
+
+  template <typename TensorPack, typename Array, typename... Indices>
+  static KOKKOS_INLINE_FUNCTION void
+  store(const TensorPack& tens, index_t lane, Array& arr, Indices... fixed_indices)
+  {
+    for (index_t i = 0; i < tens.dim(); ++i) {
+      for (index_t j = 0; j < tens.dim(); ++j) {
+        arr(fixed_indices..., i, j) = tens(i, j)[lane];
+      }
+    }
+  }
+};
+
+template <>
+struct pack_copy<4>
+{
+  template <typename TensorPack, typename Array, typename... Indices>
+  static KOKKOS_INLINE_FUNCTION void
+  load(TensorPack& tens, index_t lane, const Array& arr, Indices... fixed_indices)
+  {
+    for (index_t i = 0; i < tens.dim(); ++i) {
+      for (index_t j = 0; j < tens.dim(); ++j) {
+        for (index_t k = 0; k < tens.dim(); ++k) {
+          for (index_t l = 0; l < tens.dim(); ++l) {
+            tens(i, j, k, l)[lane] = arr(fixed_indices..., i, j, k, l);
+          }
+        }
+      }
+    }
+  }
+
+  template <typename TensorPack, typename Array, typename... Indices>
+  static KOKKOS_INLINE_FUNCTION void
+  store(const TensorPack& tens, index_t lane, Array& arr, Indices... fixed_indices)
+  {
+    for (index_t i = 0; i < tens.dim(); ++i) {
+      for (index_t j = 0; j < tens.dim(); ++j) {
+        for (index_t k = 0; k < tens.dim(); ++k) {
+          for (index_t l = 0; l < tens.dim(); ++l) {
+            arr(fixed_indices..., i, j, k, l) = tens(i, j, k, l)[lane];
+          }
+        }
+      }
+    }
+  }
+};
+
+}  // namespace detail
+
+// Pack
+
+template <typename T, index_t W>
+KOKKOS_INLINE_FUNCTION constexpr index_t
+Pack<T, W>::width()
+{
+  return W;
+}
+
+template <typename T, index_t W>
+KOKKOS_INLINE_FUNCTION
+Pack<T, W>::Pack()
+{
+  for (index_t w = 0; w < W; ++w) {
+    data_[w] = value_type(0);
+  }
+}
+
+template <typename T, index_t W>
+KOKKOS_INLINE_FUNCTION
+Pack<T, W>::Pack(value_type value)
+{
+  for (index_t w = 0; w < W; ++w) {
+    data_[w] = value;
+  }
+}
+
+template <typename T, index_t W>
+KOKKOS_INLINE_FUNCTION typename Pack<T, W>::const_reference
+Pack<T, W>::operator[](index_t lane) const
+{
+  assert((lane >= 0) && (lane < W));
+  return data_[lane];
+}
+
+template <typename T, index_t W>
+KOKKOS_INLINE_FUNCTION typename Pack<T, W>::reference
+Pack<T, W>::operator[](index_t lane)
+{
+  assert((lane >= 0) && (lane < W));
+  return data_[lane];
+}
+
+template <typename T, index_t W>
+KOKKOS_INLINE_FUNCTION Pack<T, W>&
+Pack<T, W>::operator+=(const Pack<T, W>& other)
+{
+  for (index_t w = 0; w < W; ++w) {
+    data_[w] += other.data_[w];
+  }
+  return *this;
+}
+
+template <typename T, index_t W>
+KOKKOS_INLINE_FUNCTION Pack<T, W>&
+Pack<T, W>::operator-=(const Pack<T, W>& other)
+{
+  for (index_t w = 0; w < W; ++w) {
+    data_[w] -= other.data_[w];
+  }
+  return *this;
+}
+
+template <typename T, index_t W>
+KOKKOS_INLINE_FUNCTION Pack<T, W>&
+Pack<T, W>::operator*=(const Pack<T, W>& other)
+{
+  for (index_t w = 0; w < W; ++w) {
+    data_[w] *= other.data_[w];
+  }
+  return *this;
+}
+
+template <typename T, index_t W>
+KOKKOS_INLINE_FUNCTION Pack<T, W>&
+Pack<T, W>::operator/=(const Pack<T, W>& other)
+{
+  for (index_t w = 0; w < W; ++w) {
+    data_[w] /= other.data_[w];
+  }
+  return *this;
+}
+
+// BasicTensorPack
+
+template <typename T, index_t Order, index_t W>
+KOKKOS_INLINE_FUNCTION constexpr index_t
+BasicTensorPack<T, Order, W>::getOrder()
+{
+  return Order;
+}
+
+template <typename T, index_t Order, index_t W>
+KOKKOS_INLINE_FUNCTION constexpr index_t
+BasicTensorPack<T, Order, W>::width()
+{
+  return W;
+}
+
+template <typename T, index_t Order, index_t W>
+KOKKOS_INLINE_FUNCTION
+BasicTensorPack<T, Order, W>::BasicTensorPack() : dim_(0)
+{
+}
+
+template <typename T, index_t Order, index_t W>
+KOKKOS_INLINE_FUNCTION
+BasicTensorPack<T, Order, W>::BasicTensorPack(index_t dimension, value_type initialValue) : dim_(dimension)
+{
+  for (index_t c = 0; c < arraySize(); ++c) {
+    data_[c] = pack_type(initialValue);
+  }
+}
+
+template <typename T, index_t Order, index_t W>
+KOKKOS_INLINE_FUNCTION index_t
+BasicTensorPack<T, Order, W>::dim() const
+{
+  return dim_;
+}
+
+template <typename T, index_t Order, index_t W>
+template <typename... Indices>
+KOKKOS_INLINE_FUNCTION const typename BasicTensorPack<T, Order, W>::pack_type&
+BasicTensorPack<T, Order, W>::operator()(Indices... indices) const
+{
+  return data_[index(indices...)];
+}
+
+template <typename T, index_t Order, index_t W>
+template <typename... Indices>
+KOKKOS_INLINE_FUNCTION typename BasicTensorPack<T, Order, W>::pack_type&
+BasicTensorPack<T, Order, W>::operator()(Indices... indices)
+{
+  return data_[index(indices...)];
+}
+
+template <typename T, index_t Order, index_t W>
+KOKKOS_INLINE_FUNCTION void
+BasicTensorPack<T, Order, W>::setLane(index_t lane, const tensor& tens)
+{
+  assert(tens.dim() == dim_);
+  for (index_t c = 0; c < arraySize(); ++c) {
+    data_[c][lane] = *(tens.begin() + c);
+  }
+}
+
+template <typename T, index_t Order, index_t W>
+KOKKOS_INLINE_FUNCTION typename BasicTensorPack<T, Order, W>::tensor
+BasicTensorPack<T, Order, W>::getLane(index_t lane) const
+{
+  tensor ret(dim_);
+  for (index_t c = 0; c < arraySize(); ++c) {
+    *(ret.begin() + c) = data_[c][lane];
+  }
+  return ret;
+}
+
+template <typename T, index_t Order, index_t W>
+template <typename Array, typename... Indices>
+KOKKOS_INLINE_FUNCTION void
+BasicTensorPack<T, Order, W>::load(index_t lane, const Array& arr, Indices... fixed_indices)
+{
+  detail::pack_copy<Order>::load(*this, lane, arr, fixed_indices...);
+}
+
+template <typename T, index_t Order, index_t W>
+template <typename Array, typename... Indices>
+KOKKOS_INLINE_FUNCTION void
+BasicTensorPack<T, Order, W>::store(index_t lane, Array& arr, Indices... fixed_indices) const
+{
+  detail::pack_copy<Order>::store(*this, lane, arr, fixed_indices...);
+}
+
+template <typename T, index_t Order, index_t W>
+KOKKOS_INLINE_FUNCTION constexpr index_t
+BasicTensorPack<T, Order, W>::arraySize() const
+{
+  return detail::static_pow<Order>::value(dim_);
+}
+
+template <typename T, index_t Order, index_t W>
+template <typename... Indices>
+KOKKOS_INLINE_FUNCTION index_t
+BasicTensorPack<T, Order, W>::index(Indices... indices) const
+{
+  // Same layout as BasicTensor. Bounds check in debug mode
+  index_t ret = detail::power_series(dim_, indices...);
+  assert((ret >= 0) && (ret < arraySize()));
+  return ret;
+}
+
+// Lane-wise scalar operations
+
+template <typename T, index_t W>
+KOKKOS_INLINE_FUNCTION Pack<T, W>
+                       operator+(const Pack<T, W>& lhs, const Pack<T, W>& rhs)
+{
+  Pack<T, W> ret(lhs);
+  ret += rhs;
+  return ret;
+}
+
+template <typename T, index_t W>
+KOKKOS_INLINE_FUNCTION Pack<T, W>
+                       operator-(const Pack<T, W>& lhs, const Pack<T, W>& rhs)
+{
+  Pack<T, W> ret(lhs);
+  ret -= rhs;
+  return ret;
+}
+
+template <typename T, index_t W>
+KOKKOS_INLINE_FUNCTION Pack<T, W>
+                       operator*(const Pack<T, W>& lhs, const Pack<T, W>& rhs)
+{
+  Pack<T, W> ret(lhs);
+  ret *= rhs;
+  return ret;
+}
+
+template <typename T, index_t W>
+KOKKOS_INLINE_FUNCTION Pack<T, W>
+                       operator/(const Pack<T, W>& lhs, const Pack<T, W>& rhs)
+{
+  Pack<T, W> ret(lhs);
+  ret /= rhs;
+  return ret;
+}
+
+template <typename T, index_t W>
+KOKKOS_INLINE_FUNCTION Pack<T, W>
+                       operator+(const Pack<T, W>& lhs, const typename Pack<T, W>::value_type& s)
+{
+  Pack<T, W> ret;
+  for (index_t w = 0; w < W; ++w) {
+    ret[w] = lhs[w] + s;
+  }
+  return ret;
+}
+
+template <typename T, index_t W>
+KOKKOS_INLINE_FUNCTION Pack<T, W>
+                       operator+(const typename Pack<T, W>::value_type& s, const Pack<T, W>& rhs)
+{
+  Pack<T, W> ret;
+  for (index_t w = 0; w < W; ++w) {
+    ret[w] = s + rhs[w];
+  }
+  return ret;
+}
+
+template <typename T, index_t W>
+KOKKOS_INLINE_FUNCTION Pack<T, W>
+                       operator-(const Pack<T, W>& lhs, const typename Pack<T, W>::value_type& s)
+{
+  Pack<T, W> ret;
+  for (index_t w = 0; w < W; ++w) {
+    ret[w] = lhs[w] - s;
+  }
+  return ret;
+}
+
+template <typename T, index_t W>
+KOKKOS_INLINE_FUNCTION Pack<T, W>
+                       operator-(const typename Pack<T, W>::value_type& s, const Pack<T, W>& rhs)
+{
+  Pack<T, W> ret;
+  for (index_t w = 0; w < W; ++w) {
+    ret[w] = s - rhs[w];
+  }
+  return ret;
+}
+
+template <typename T, index_t W>
+KOKKOS_INLINE_FUNCTION Pack<T, W>
+                       operator*(const typename Pack<T, W>::value_type& s, const Pack<T, W>& rhs)
+{
+  Pack<T, W> ret;
+  for (index_t w = 0; w < W; ++w) {
+    ret[w] = s * rhs[w];
+  }
+  return ret;
+}
+
+template <typename T, index_t W>
+KOKKOS_INLINE_FUNCTION Pack<T, W>
+                       operator*(const Pack<T, W>& lhs, const typename Pack<T, W>::value_type& s)
+{
+  Pack<T, W> ret;
+  for (index_t w = 0; w < W; ++w) {
+    ret[w] = lhs[w] * s;
+  }
+  return ret;
+}
+
+template <typename T, index_t W>
+KOKKOS_INLINE_FUNCTION Pack<T, W>
+                       operator/(const typename Pack<T, W>::value_type& s, const Pack<T, W>& rhs)
+{
+  Pack<T, W> ret;
+  for (index_t w = 0; w < W; ++w) {
+    ret[w] = s / rhs[w];
+  }
+  return ret;
+}
+
+template <typename T, index_t W>
+KOKKOS_INLINE_FUNCTION Pack<T, W>
+                       operator/(const Pack<T, W>& lhs, const typename Pack<T, W>::value_type& s)
+{
+  Pack<T, W> ret;
+  for (index_t w = 0; w < W; ++w) {
+    ret[w] = lhs[w] / s;
+  }
+  return ret;
+}
+
+template <typename T, index_t W>
+KOKKOS_INLINE_FUNCTION Pack<T, W>
+                       sqrt(const Pack<T, W>& x)
+{
+  Pack<T, W> ret;
+  for (index_t w = 0; w < W; ++w) {
+    ret[w] = std::sqrt(x[w]);
+  }
+  return ret;
+}
+
+template <typename T, index_t W>
+KOKKOS_INLINE_FUNCTION Pack<T, W>
+                       cbrt(const Pack<T, W>& x)
+{
+  Pack<T, W> ret;
+  for (index_t w = 0; w < W; ++w) {
+    ret[w] = std::cbrt(x[w]);
+  }
+  return ret;
+}
+
+template <typename T, index_t W>
+KOKKOS_INLINE_FUNCTION Pack<T, W>
+                       exp(const Pack<T, W>& x)
+{
+  Pack<T, W> ret;
+  for (index_t w = 0; w < W; ++w) {
+    ret[w] = std::exp(x[w]);
+  }
+  return ret;
+}
+
+template <typename T, index_t W>
+KOKKOS_INLINE_FUNCTION Pack<T, W>
+                       log(const Pack<T, W>& x)
+{
+  Pack<T, W> ret;
+  for (index_t w = 0; w < W; ++w) {
+    ret[w] = std::log(x[w]);
+  }
+  return ret;
+}
+
+template <typename T, index_t W>
+KOKKOS_INLINE_FUNCTION Pack<T, W>
+                       pow(const Pack<T, W>& x, const typename Pack<T, W>::value_type& e)
+{
+  Pack<T, W> ret;
+  for (index_t w = 0; w < W; ++w) {
+    ret[w] = std::pow(x[w], e);
+  }
+  return ret;
+}
+
+// Lane-wise tensor operations
+
+template <typename T, index_t O, index_t W>
+KOKKOS_INLINE_FUNCTION BasicTensorPack<T, O, W>
+                       operator+(const BasicTensorPack<T, O, W>& lhs, const BasicTensorPack<T, O, W>& rhs)
+{
+  assert(lhs.dim() == rhs.dim());
+  BasicTensorPack<T, O, W> ret(lhs);
+  for (index_t c = 0; c < ret.arraySize(); ++c) {
+    ret(c) += rhs(c);
+  }
+  return ret;
+}
+
+template <typename T, index_t O, index_t W>
+KOKKOS_INLINE_FUNCTION BasicTensorPack<T, O, W>
+                       operator-(const BasicTensorPack<T, O, W>& lhs, const BasicTensorPack<T, O, W>& rhs)
+{
+  assert(lhs.dim() == rhs.dim());
+  BasicTensorPack<T, O, W> ret(lhs);
+  for (index_t c = 0; c < ret.arraySize(); ++c) {
+    ret(c) -= rhs(c);
+  }
+  return ret;
+}
+
+template <typename T, index_t O, index_t W>
+KOKKOS_INLINE_FUNCTION BasicTensorPack<T, O, W>
+                       operator*(const Pack<T, W>& s, const BasicTensorPack<T, O, W>& rhs)
+{
+  BasicTensorPack<T, O, W> ret(rhs);
+  for (index_t c = 0; c < ret.arraySize(); ++c) {
+    ret(c) *= s;
+  }
+  return ret;
+}
+
+template <typename T, index_t O, index_t W>
+KOKKOS_INLINE_FUNCTION BasicTensorPack<T, O, W>
+                       operator*(const typename Pack<T, W>::value_type& s, const BasicTensorPack<T, O, W>& rhs)
+{
+  BasicTensorPack<T, O, W> ret(rhs.dim());
+  for (index_t c = 0; c < ret.arraySize(); ++c) {
+    ret(c) = s * rhs(c);
+  }
+  return ret;
+}
+
+template <typename T, index_t O, index_t W>
+KOKKOS_INLINE_FUNCTION BasicTensorPack<T, O, W>
+                       operator/(const BasicTensorPack<T, O, W>& lhs, const Pack<T, W>& s)
+{
+  BasicTensorPack<T, O, W> ret(lhs);
+  for (index_t c = 0; c < ret.arraySize(); ++c) {
+    ret(c) /= s;
+  }
+  return ret;
+}
+
+template <typename T, index_t W>
+KOKKOS_INLINE_FUNCTION Tensor2Pack<T, W>
+                       operator*(const Tensor2Pack<T, W>& lhs, const Tensor2Pack<T, W>& rhs)
+{
+  assert(lhs.dim() == rhs.dim());
+  index_t           dim = lhs.dim();
+  Tensor2Pack<T, W> ret(dim);
+  for (index_t i = 0; i < dim; ++i) {
+    for (index_t j = 0; j < dim; ++j) {
+      Pack<T, W>& s = ret(i, j);
+      for (index_t k = 0; k < dim; ++k) {
+        s += lhs(i, k) * rhs(k, j);
+      }
+    }
+  }
+
+  return ret;
+}
+
+// Utility
+
+template <typename T, index_t W>
+KOKKOS_INLINE_FUNCTION Tensor2Pack<T, W>
+                       identity_pack(index_t dim)
+{
+  Tensor2Pack<T, W> ret(dim);
+  for (index_t i = 0; i < dim; ++i) {
+    ret(i, i) = Pack<T, W>(T(1));
+  }
+
+  return ret;
+}
+
+template <typename T, index_t W>
+KOKKOS_INLINE_FUNCTION Tensor2Pack<T, W>
+                       transpose(const Tensor2Pack<T, W>& tens)
+{
+  index_t           dim = tens.dim();
+  Tensor2Pack<T, W> ret(dim);
+  for (index_t i = 0; i < dim; ++i) {
+    for (index_t j = 0; j < dim; ++j) {
+      ret(i, j) = tens(j, i);
+    }
+  }
+
+  return ret;
+}
+
+template <typename T, index_t W>
+KOKKOS_INLINE_FUNCTION Pack<T, W>
+                       trace(const Tensor2Pack<T, W>& tens)
+{
+  Pack<T, W> ret;
+  for (index_t i = 0; i < tens.dim(); ++i) {
+    ret += tens(i, i);
+  }
+
+  return ret;
+}
+
+template <typename T, index_t W>
+KOKKOS_INLINE_FUNCTION Tensor2Pack<T, W>
+                       dev(const Tensor2Pack<T, W>& tens)
+{
+  index_t           dim   = tens.dim();
+  Pack<T, W> const  theta = (T(1) / dim) * trace(tens);
+  Tensor2Pack<T, W> ret(tens);
+  for (index_t i = 0; i < dim; ++i) {
+    ret(i, i) -= theta;
+  }
+
+  return ret;
+}
+
+template <typename T, index_t W>
+KOKKOS_INLINE_FUNCTION Pack<T, W>
+                       det(const Tensor2Pack<T, W>& tens)
+{
+  Pack<T, W> ret;
+  switch (tens.dim()) {
+    default: assert(false); break;
+
+    case 1: ret = tens(0, 0); break;
+
+    case 2: ret = tens(0, 0) * tens(1, 1) - tens(1, 0) * tens(0, 1); break;
+
+    case 3:
+      ret = tens(0, 0) * tens(1, 1) * tens(2, 2) + tens(0, 1) * tens(1, 2) * tens(2, 0) +
+            tens(0, 2) * tens(1, 0) * tens(2, 1) - tens(0, 2) * tens(1, 1) * tens(2, 0) -
+            tens(0, 1) * tens(1, 0) * tens(2, 2) - tens(0, 0) * tens(1, 2) * tens(2, 1);
+      break;
+  }
+
+  return ret;
+}
+
+template <typename T, index_t W>
+KOKKOS_INLINE_FUNCTION Pack<T, W>
+                       norm(const Tensor2Pack<T, W>& tens)
+{
+  Pack<T, W> ret;
+  for (index_t c = 0; c < tens.arraySize(); ++c) {
+    ret += tens(c) * tens(c);
+  }
+
+  return sqrt(ret);
+}
+
+}  // namespace util
+
+#endif  // UTIL_TENSORPACKIMPL_HPP
@@ -0,0 +1,42 @@
+#! /usr/bin/env python
+import sys
+import os
+import re
+
+from subprocess import Popen
+
+name = "cuboid_step_reduction"
+log_file_name = name + ".log"
+result = 0
+
+with open(log_file_name, 'r') as log_file:
+    print(log_file.read())
+
+converged = False
+reduced = False
+
+for line in open(log_file_name):
+  if "Schwarz Alternating Method converged: YES" in line:
+    converged = True
+  if "INFO: Reducing step" in line:
+    reduced = True
+
+for line in open(log_file_name):
+  if "Schwarz Alternating Method converged: NO" in line:
+    converged = False
+
+if converged == False:
+  result = result + 1
+
+# Without a reduced step the restore after a failed subdomain solve is
+# not exercised
+if reduced == False:
+  print("no step was reduced")
+  result = result + 1
+
+if result != 0:
+    print("result is %s" % result)
+    print("%s test has failed" % name)
+
+
+sys.exit(result)